@@ -0,0 +1,391 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "file_reader.h"
+#include "legate_library.h"
+#include "legateio.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define LEGATEIO_HAS_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#if defined(LEGATEIO_HAS_IO_URING) && \
+  !(defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter))
+#undef LEGATEIO_HAS_IO_URING
+#endif
+
+namespace legateio {
+
+namespace {
+
+// O_DIRECT requires the file offset, length, and destination address to be multiples of the
+// device's logical block size; 4 KiB covers every device we care about
+constexpr size_t DIRECT_ALIGNMENT = 4096;
+// Buffered reads go through the page cache, so bigger chunks just amortize the syscall
+constexpr size_t BUFFERED_CHUNK = 16 << 20;
+
+#ifdef LEGATEIO_HAS_IO_URING
+
+// Direct reads are split into chunks of this size and kept in flight together, so a single
+// reader task still fills the NVMe queue
+constexpr size_t DIRECT_CHUNK  = 1 << 20;
+constexpr uint32_t QUEUE_DEPTH = 32;
+
+// A minimal io_uring wrapper over the raw syscalls, set up once per reader thread. Each
+// Realm processor runs on a dedicated thread, so the ring needs no locking.
+struct IOURing {
+  IOURing()
+  {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ring_fd = static_cast<int>(syscall(__NR_io_uring_setup, QUEUE_DEPTH, &params));
+    // Old kernels or seccomp policies can refuse the ring; callers fall back to pread
+    if (ring_fd < 0) return;
+
+    sq_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) sq_size = cq_size = std::max(sq_size, cq_size);
+
+    auto* sq_ptr = mmap(nullptr,
+                        sq_size,
+                        PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE,
+                        ring_fd,
+                        IORING_OFF_SQ_RING);
+    if (MAP_FAILED == sq_ptr) {
+      close(ring_fd);
+      ring_fd = -1;
+      return;
+    }
+    sq_base = static_cast<uint8_t*>(sq_ptr);
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+      cq_base = sq_base;
+    else {
+      auto* cq_ptr = mmap(nullptr,
+                          cq_size,
+                          PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE,
+                          ring_fd,
+                          IORING_OFF_CQ_RING);
+      if (MAP_FAILED == cq_ptr) {
+        teardown();
+        return;
+      }
+      cq_base = static_cast<uint8_t*>(cq_ptr);
+    }
+
+    sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    auto* sqes_ptr = mmap(nullptr,
+                          sqes_size,
+                          PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE,
+                          ring_fd,
+                          IORING_OFF_SQES);
+    if (MAP_FAILED == sqes_ptr) {
+      teardown();
+      return;
+    }
+    sqes = static_cast<io_uring_sqe*>(sqes_ptr);
+
+    sq_head      = reinterpret_cast<uint32_t*>(sq_base + params.sq_off.head);
+    sq_tail      = reinterpret_cast<uint32_t*>(sq_base + params.sq_off.tail);
+    sq_ring_mask = *reinterpret_cast<uint32_t*>(sq_base + params.sq_off.ring_mask);
+    sq_array     = reinterpret_cast<uint32_t*>(sq_base + params.sq_off.array);
+    cq_head      = reinterpret_cast<uint32_t*>(cq_base + params.cq_off.head);
+    cq_tail      = reinterpret_cast<uint32_t*>(cq_base + params.cq_off.tail);
+    cq_ring_mask = *reinterpret_cast<uint32_t*>(cq_base + params.cq_off.ring_mask);
+    cqes         = reinterpret_cast<io_uring_cqe*>(cq_base + params.cq_off.cqes);
+    usable       = true;
+  }
+  ~IOURing() { teardown(); }
+
+  void teardown()
+  {
+    if (sqes != nullptr) munmap(sqes, sqes_size);
+    if (cq_base != nullptr && cq_base != sq_base) munmap(cq_base, cq_size);
+    if (sq_base != nullptr) munmap(sq_base, sq_size);
+    if (ring_fd >= 0) close(ring_fd);
+    sqes    = nullptr;
+    cq_base = nullptr;
+    sq_base = nullptr;
+    ring_fd = -1;
+    usable  = false;
+  }
+
+  // Queues one read without submitting it; the caller batches the io_uring_enter
+  void push_read(int fd, void* dst, size_t offset, size_t size, uint64_t user_data)
+  {
+    // This thread is the only submitter, so the unsynchronized tail read is fine
+    uint32_t tail = *sq_tail;
+    uint32_t idx  = tail & sq_ring_mask;
+    auto& sqe     = sqes[idx];
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode    = IORING_OP_READ;
+    sqe.fd        = fd;
+    sqe.addr      = reinterpret_cast<uint64_t>(dst);
+    sqe.len       = static_cast<uint32_t>(size);
+    sqe.off       = offset;
+    sqe.user_data = user_data;
+    sq_array[idx] = idx;
+    __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+  }
+
+  // Submits everything queued and waits for at least `min_complete` completions
+  bool enter(uint32_t to_submit, uint32_t min_complete)
+  {
+    do {
+      int ret = static_cast<int>(syscall(__NR_io_uring_enter,
+                                         ring_fd,
+                                         to_submit,
+                                         min_complete,
+                                         IORING_ENTER_GETEVENTS,
+                                         nullptr,
+                                         0));
+      if (ret >= 0) return true;
+    } while (EINTR == errno);
+    return false;
+  }
+
+  // Pops the next completion; blocks until one is available
+  bool pop_completion(uint64_t& user_data, int32_t& res)
+  {
+    uint32_t head = *cq_head;
+    while (head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE))
+      if (!enter(0, 1)) return false;
+    auto& cqe = cqes[head & cq_ring_mask];
+    user_data = cqe.user_data;
+    res       = cqe.res;
+    __atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+    return true;
+  }
+
+  int ring_fd{-1};
+  uint8_t* sq_base{nullptr};
+  uint8_t* cq_base{nullptr};
+  io_uring_sqe* sqes{nullptr};
+  size_t sq_size{0};
+  size_t cq_size{0};
+  size_t sqes_size{0};
+  uint32_t* sq_head{nullptr};
+  uint32_t* sq_tail{nullptr};
+  uint32_t sq_ring_mask{0};
+  uint32_t* sq_array{nullptr};
+  uint32_t* cq_head{nullptr};
+  uint32_t* cq_tail{nullptr};
+  uint32_t cq_ring_mask{0};
+  io_uring_cqe* cqes{nullptr};
+  bool usable{false};
+  // Set once the kernel has completed an IORING_OP_READ; rings on pre-5.6 kernels come up
+  // fine but fail the opcode with EINVAL
+  bool read_op_verified{false};
+};
+
+#endif  // LEGATEIO_HAS_IO_URING
+
+bool aligned(size_t value) { return value % DIRECT_ALIGNMENT == 0; }
+
+}  // namespace
+
+FileReader::FileReader(const std::string& filename) : filename_(filename)
+{
+  fd_ = open(filename.c_str(), O_RDONLY);
+  if (fd_ < 0) {
+    logger.error() << "Failed to open " << filename << ": " << strerror(errno);
+    LEGATE_ABORT;
+  }
+#ifdef O_DIRECT
+  // Not all file systems support direct I/O; reads simply stay on the buffered path then
+  direct_fd_ = open(filename.c_str(), O_RDONLY | O_DIRECT);
+#endif
+  alignment_ = DIRECT_ALIGNMENT;
+}
+
+FileReader::~FileReader()
+{
+  if (direct_fd_ >= 0) close(direct_fd_);
+  if (fd_ >= 0) close(fd_);
+}
+
+void FileReader::read(void* dst, size_t offset, size_t size)
+{
+  if (0 == size) return;
+  if (direct_fd_ >= 0 && aligned(offset) && aligned(size) &&
+      aligned(reinterpret_cast<uintptr_t>(dst)))
+    read_direct(dst, offset, size);
+  else
+    read_buffered(dst, offset, size);
+}
+
+void FileReader::read_buffered(void* dst, size_t offset, size_t size)
+{
+  auto* cursor = static_cast<uint8_t*>(dst);
+  while (size > 0) {
+    auto n = pread(fd_, cursor, std::min(size, BUFFERED_CHUNK), static_cast<off_t>(offset));
+    if (n < 0) {
+      if (EINTR == errno) continue;
+      logger.error() << "Failed to read " << filename_ << ": " << strerror(errno);
+      LEGATE_ABORT;
+    }
+    if (0 == n) {
+      logger.error() << "Unexpected end of file in " << filename_;
+      LEGATE_ABORT;
+    }
+    cursor += n;
+    offset += n;
+    size -= static_cast<size_t>(n);
+  }
+}
+
+void FileReader::read_direct(void* dst, size_t offset, size_t size)
+{
+  if (read_with_io_uring(direct_fd_, dst, offset, size)) return;
+  // No usable ring; synchronous direct reads still skip the page cache copy
+  auto* cursor = static_cast<uint8_t*>(dst);
+  while (size > 0) {
+    auto n = pread(direct_fd_, cursor, std::min(size, BUFFERED_CHUNK), static_cast<off_t>(offset));
+    if (n < 0) {
+      if (EINTR == errno) continue;
+      logger.error() << "Failed to read " << filename_ << ": " << strerror(errno);
+      LEGATE_ABORT;
+    }
+    if (0 == n) {
+      logger.error() << "Unexpected end of file in " << filename_;
+      LEGATE_ABORT;
+    }
+    cursor += n;
+    offset += n;
+    size -= static_cast<size_t>(n);
+  }
+}
+
+bool FileReader::read_with_io_uring(int fd, void* dst, size_t offset, size_t size)
+{
+#ifndef LEGATEIO_HAS_IO_URING
+  return false;
+#else
+  static thread_local IOURing ring;
+  if (!ring.usable) return false;
+
+  struct Request {
+    uint8_t* dst;
+    size_t offset;
+    size_t size;
+  };
+  Request requests[QUEUE_DEPTH];
+  std::vector<uint32_t> free_slots;
+  free_slots.reserve(QUEUE_DEPTH);
+  for (uint32_t slot = 0; slot < QUEUE_DEPTH; ++slot) free_slots.push_back(slot);
+
+  auto* base        = static_cast<uint8_t*>(dst);
+  size_t queued     = 0;  // bytes handed to the ring so far
+  uint32_t inflight = 0;
+
+  auto push_next = [&]() {
+    auto len  = std::min(DIRECT_CHUNK, size - queued);
+    auto slot = free_slots.back();
+    free_slots.pop_back();
+    requests[slot] = Request{base + queued, offset + queued, len};
+    ring.push_read(fd, requests[slot].dst, requests[slot].offset, requests[slot].size, slot);
+    queued += len;
+    ++inflight;
+  };
+
+  // Until the kernel has proven it supports IORING_OP_READ, keep a single request in flight
+  // so an unsupported opcode can fall back to pread without leaving work in the ring
+  auto drain_one = [&](bool& retry) -> bool {
+    retry = false;
+    uint64_t slot;
+    int32_t res;
+    if (!ring.pop_completion(slot, res)) return false;
+    --inflight;
+    auto& req = requests[slot];
+    if (res < 0) {
+      if (!ring.read_op_verified && (-EINVAL == res || -EOPNOTSUPP == res)) return false;
+      logger.error() << "Failed to read " << filename_ << ": " << strerror(-res);
+      LEGATE_ABORT;
+    }
+    if (0 == res) {
+      logger.error() << "Unexpected end of file in " << filename_;
+      LEGATE_ABORT;
+    }
+    ring.read_op_verified = true;
+    if (static_cast<size_t>(res) < req.size) {
+      // Short read; resubmit the remainder on the same slot
+      requests[slot] = Request{req.dst + res, req.offset + res, req.size - res};
+      ring.push_read(fd, requests[slot].dst, requests[slot].offset, requests[slot].size, slot);
+      ++inflight;
+      retry = true;
+      return true;
+    }
+    free_slots.push_back(static_cast<uint32_t>(slot));
+    return true;
+  };
+
+  if (!ring.read_op_verified) {
+    push_next();
+    bool retry = true;
+    while (retry) {
+      if (!ring.enter(1, 1)) {
+        ring.teardown();
+        return false;
+      }
+      if (!drain_one(retry)) {
+        // The kernel accepted the ring but not the read opcode; retire it for this thread
+        ring.teardown();
+        return false;
+      }
+    }
+  }
+
+  while (queued < size || inflight > 0) {
+    uint32_t to_submit = 0;
+    while (queued < size && !free_slots.empty()) {
+      push_next();
+      ++to_submit;
+    }
+    if (0 == inflight) break;
+    if (!ring.enter(to_submit, 1)) {
+      logger.error() << "io_uring_enter failed reading " << filename_ << ": " << strerror(errno);
+      LEGATE_ABORT;
+    }
+    bool retry = false;
+    if (!drain_one(retry)) {
+      logger.error() << "io_uring completion failed reading " << filename_ << ": "
+                     << strerror(errno);
+      LEGATE_ABORT;
+    }
+    if (retry && !ring.enter(1, 0)) {
+      logger.error() << "io_uring_enter failed reading " << filename_ << ": " << strerror(errno);
+      LEGATE_ABORT;
+    }
+  }
+  return true;
+#endif
+}
+
+}  // namespace legateio
@@ -0,0 +1,61 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace legateio {
+
+// A positional-read engine for parallel file ingest. Each reader task opens its own
+// FileReader and pulls its shard of the file straight into the memory of the buffer it will
+// bind to the store, so the data is copied exactly once, from the device to the instance.
+//
+// When the file system supports it, the file is opened with O_DIRECT and reads whose file
+// offset, destination address, and length are all block-aligned bypass the page cache
+// entirely; on kernels with io_uring, several chunks of such a read are kept in flight at
+// once to fill the NVMe queue. Reads that don't meet the alignment requirements (shard
+// boundaries rarely do) fall back to buffered positional reads in large chunks, which still
+// scale with the number of reader tasks.
+class FileReader {
+ public:
+  FileReader(const std::string& filename);
+  ~FileReader();
+
+ public:
+  FileReader(const FileReader&)            = delete;
+  FileReader& operator=(const FileReader&) = delete;
+
+ public:
+  // Reads `size` bytes at absolute file offset `offset` into `dst`, choosing the fastest
+  // path the arguments allow. Aborts on I/O errors and on EOF short of `size` bytes.
+  void read(void* dst, size_t offset, size_t size);
+
+ private:
+  void read_buffered(void* dst, size_t offset, size_t size);
+  void read_direct(void* dst, size_t offset, size_t size);
+  bool read_with_io_uring(int fd, void* dst, size_t offset, size_t size);
+
+ private:
+  std::string filename_;
+  int fd_{-1};         // buffered descriptor, always open
+  int direct_fd_{-1};  // O_DIRECT descriptor, -1 when the file system refused it
+  size_t alignment_{0};
+};
+
+}  // namespace legateio
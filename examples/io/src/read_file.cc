@@ -14,8 +14,7 @@
  *
  */
 
-#include <fstream>
-
+#include "file_reader.h"
 #include "legate_library.h"
 #include "legateio.h"
 
@@ -36,9 +35,9 @@ struct read_fn {
     size_t size;
 
     // All reader tasks need to read the header to figure out the total number of elements
-    std::ifstream in(filename, std::ios::binary | std::ios::in);
-    in.read(reinterpret_cast<char*>(&code), sizeof(int64_t));
-    in.read(reinterpret_cast<char*>(&size), sizeof(size_t));
+    FileReader reader(filename);
+    reader.read(&code, 0, sizeof(int64_t));
+    reader.read(&size, sizeof(int64_t), sizeof(size_t));
 
     if (static_cast<legate::Type::Code>(code) != CODE) {
       logger.error() << "Type mismatch: " << CODE << " != " << code;
@@ -55,12 +54,14 @@ struct read_fn {
     int64_t my_ext = my_hi - my_lo;
     auto buf       = output.create_output_buffer<VAL, 1>(legate::Point<1>(my_ext));
 
-    // Skip to the right offset where the data assigned to this reader task actually starts
-    if (my_lo != 0) in.seekg(my_lo * sizeof(VAL), std::ios_base::cur);
-    for (int64_t idx = 0; idx < my_ext; ++idx) {
-      auto ptr = buf.ptr(legate::Point<1>(idx));
-      in.read(reinterpret_cast<char*>(ptr), sizeof(VAL));
-    }
+    // Pull this reader's section of the file straight into the buffer that will be bound to
+    // the store: the FileReader issues bulk positional reads into the buffer memory (direct
+    // I/O when the alignment works out), so each shard moves at device bandwidth instead of
+    // one element at a time through a file stream
+    constexpr size_t HEADER_SIZE = sizeof(int64_t) + sizeof(size_t);
+    if (my_ext > 0)
+      reader.read(
+        buf.ptr(legate::Point<1>(0)), HEADER_SIZE + my_lo * sizeof(VAL), my_ext * sizeof(VAL));
 
     // Finally, bind the output buffer to the store
     //
@@ -377,6 +377,11 @@ class BufferBuilder:
         for char in string:
             self.pack_char(char)
 
+    def pack_bytes(self, arg: bytes) -> None:
+        self.fmt.append(f"{len(arg)}s")
+        self.size += len(arg)
+        self.add_arg(arg, legion.LEGION_TYPE_TOTAL + 2)
+
     def pack_buffer(self, buf: Any) -> None:
         self.pack_32bit_uint(buf.get_size())
         self.fmt.append(buf.fmt[1:])
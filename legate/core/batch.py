@@ -0,0 +1,162 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from __future__ import annotations
+
+from typing import TYPE_CHECKING, Any, Optional, Sequence, Tuple
+
+from . import ffi
+from ._legion.future import Future
+from ._legion.util import BufferBuilder
+
+if TYPE_CHECKING:
+    from ._legion import Region
+
+# Region requirement encoding: region, parent, privilege, coherence,
+# redop (0 if not a reduction requirement), mapping tag, field ids
+ReqType = Tuple["Region", "Region", int, int, int, int, Sequence[int]]
+
+_OP_TASK = 0
+_OP_FENCE = 1
+_OP_DISCARD = 2
+
+
+class BatchBuffer:
+    """
+    Encodes a sequence of operations to be submitted through
+    ``legate_submit_batch`` in a single FFI crossing.
+
+    Operations are packed straight into a ``BufferBuilder`` as they are
+    added, without intermediate launcher objects, so fine-grained workloads
+    pay one crossing and one GIL round trip per batch instead of one per
+    operation. The encoding must be kept in sync with the decoder in
+    ``src/core/legate_c.cc``.
+    """
+
+    def __init__(self) -> None:
+        self._buf = BufferBuilder()
+        self._num_ops = 0
+        self._num_futures = 0
+
+    def _pack_region(self, region: Region) -> None:
+        handle = region.handle
+        buf = self._buf
+        buf.pack_32bit_uint(handle.index_space.id)
+        buf.pack_32bit_uint(handle.index_space.tid)
+        buf.pack_32bit_uint(handle.index_space.type_tag)
+        buf.pack_32bit_uint(handle.field_space.id)
+        buf.pack_32bit_uint(handle.tree_id)
+
+    def add_task(
+        self,
+        task_id: int,
+        args: bytes = b"",
+        futures: Sequence[Future] = (),
+        requirements: Sequence[ReqType] = (),
+        mapper: int = 0,
+        tag: int = 0,
+        wants_future: bool = False,
+    ) -> Optional[int]:
+        """
+        Adds a single task launch to the batch. ``task_id`` is the global
+        Legion task id. Returns the index of the task's future in the list
+        returned by ``submit`` when ``wants_future`` is set, ``None``
+        otherwise.
+        """
+        buf = self._buf
+        buf.pack_32bit_int(_OP_TASK)
+        buf.pack_32bit_uint(task_id)
+        buf.pack_32bit_uint(mapper)
+        buf.pack_32bit_uint(tag)
+        buf.pack_32bit_uint(len(args))
+        buf.pack_bytes(args)
+        buf.pack_32bit_uint(len(futures))
+        for future in futures:
+            buf.pack_64bit_uint(
+                int(ffi.cast("uintptr_t", future.handle.impl))
+            )
+        buf.pack_32bit_uint(len(requirements))
+        for (
+            region,
+            parent,
+            privilege,
+            coherence,
+            redop,
+            req_tag,
+            fields,
+        ) in requirements:
+            self._pack_region(region)
+            self._pack_region(parent)
+            buf.pack_32bit_uint(privilege)
+            buf.pack_32bit_uint(coherence)
+            buf.pack_32bit_uint(redop)
+            buf.pack_32bit_uint(req_tag)
+            buf.pack_32bit_uint(len(fields))
+            for fid in fields:
+                buf.pack_32bit_uint(fid)
+        buf.pack_bool(wants_future)
+        self._num_ops += 1
+        if not wants_future:
+            return None
+        index = self._num_futures
+        self._num_futures += 1
+        return index
+
+    def add_fence(self, mapping: bool = False) -> None:
+        """
+        Adds a mapping or execution fence to the batch. Fences issued this
+        way never block the caller.
+        """
+        self._buf.pack_32bit_int(_OP_FENCE)
+        self._buf.pack_bool(mapping)
+        self._num_ops += 1
+
+    def add_discard(
+        self, region: Region, parent: Region, fields: Sequence[int]
+    ) -> None:
+        """
+        Adds a discard of the given fields' contents to the batch.
+        """
+        self._buf.pack_32bit_int(_OP_DISCARD)
+        self._pack_region(region)
+        self._pack_region(parent)
+        self._buf.pack_32bit_uint(len(fields))
+        for fid in fields:
+            self._buf.pack_32bit_uint(fid)
+        self._num_ops += 1
+
+    def submit(self, core_library: Any) -> list[Future]:
+        """
+        Submits all recorded operations in one FFI crossing and returns the
+        futures of the task launches that asked for them, in submission
+        order. Must be called from the top-level task.
+        """
+        header = BufferBuilder()
+        header.pack_32bit_uint(self._num_ops)
+        data = (header.get_string() or b"") + (self._buf.get_string() or b"")
+        buffer = ffi.new("char[]", data)
+        out = (
+            ffi.new("void*[]", self._num_futures)
+            if self._num_futures > 0
+            else ffi.NULL
+        )
+        num_futures = core_library.legate_submit_batch(
+            buffer, len(data), out, self._num_futures
+        )
+        futures = []
+        for idx in range(num_futures):
+            handle = ffi.new("legion_future_t*")
+            handle[0].impl = out[idx]
+            futures.append(Future(handle[0]))
+        return futures
@@ -19,6 +19,7 @@ from abc import ABC, abstractmethod, abstractproperty
 from typing import TYPE_CHECKING
 
 from . import FutureMap, Point, Rect
+from .machine import ProcessorKind
 
 if TYPE_CHECKING:
     from .machine import ProcessorRange
@@ -34,8 +35,15 @@ class Communicator(ABC):
         # From launch domains to communicator future maps transformed to N-D
         self._nd_handles: dict[tuple[Rect, ProcessorRange], FutureMap] = {}
 
+    def _key_range(self) -> ProcessorRange:
+        # Handles are cached by the range of processors that actually carry
+        # the communicator, not by the whole machine scope, so scope changes
+        # that leave this range intact keep reusing the same handle. Cached
+        # handles are only collected by destroy() at shutdown.
+        return self._runtime.machine.get_processor_range()
+
     def _get_1d_handle(self, volume: int) -> FutureMap:
-        proc_range = self._runtime.machine.get_processor_range()
+        proc_range = self._key_range()
         key = (volume, proc_range)
         comm = self._handles.get(key)
         if comm is not None:
@@ -47,7 +55,7 @@ class Communicator(ABC):
     def _transform_handle(
         self, comm: FutureMap, launch_domain: Rect
     ) -> FutureMap:
-        proc_range = self._runtime.machine.get_processor_range()
+        proc_range = self._key_range()
         key = (launch_domain, proc_range)
         match = self._nd_handles.get(key)
         if match is not None:
@@ -100,6 +108,13 @@ class NCCLCommunicator(Communicator):
     def needs_barrier(self) -> bool:
         return self._needs_barrier
 
+    def _key_range(self) -> ProcessorRange:
+        # NCCL communicators only depend on the participating GPUs, so key
+        # them by the GPU range regardless of the scope's preferred kind;
+        # otherwise every scope change around the same GPU set would re-pay
+        # ncclCommInitRank
+        return self._runtime.machine.get_processor_range(ProcessorKind.GPU)
+
     def _initialize(self, volume: int) -> FutureMap:
         from .launcher import TaskLauncher as Task
 
@@ -158,6 +158,42 @@ class Context:
         buf = fut.get_buffer(dt.itemsize)
         return np.frombuffer(buf, dtype=dt)[0]
 
+    def get_tunable_vector(
+        self, tunable_id: int, dtype: Dtype, count: int
+    ) -> npt.NDArray[Any]:
+        """
+        Queries a tunable parameter whose response packs multiple values,
+        fetching them all in a single mapper round trip.
+
+        Parameters
+        ----------
+        tunable_id : int
+            Tunable id. Local to each mapper.
+
+        dtype : Dtype
+            Type of each packed value
+
+        count : int
+            Number of packed values
+
+        Returns
+        -------
+        np.ndarray
+            A NumPy array holding the values of the tunable parameter
+        """
+        dt = dtype.to_numpy_dtype()
+        fut = Future(
+            legion.legion_runtime_select_tunable_value(
+                self._runtime.legion_runtime,
+                self._runtime.legion_context,
+                tunable_id,
+                self.mapper_id,
+                0,
+            )
+        )
+        buf = fut.get_buffer(dt.itemsize * count)
+        return np.frombuffer(buf, dtype=dt, count=count)
+
     def get_unique_op_id(self) -> int:
         return self._runtime.get_unique_op_id()
 
@@ -35,6 +35,19 @@ class PendingException:
         self._future = future
         self._tb_repr = tb_repr
 
+    def poll(self) -> Optional[bool]:
+        """Tests the exception future without blocking.
+
+        Returns ``None`` if the future has not completed yet, ``False`` if the
+        task completed cleanly and the entry can be retired, and ``True`` if
+        the task raised and a ``raise_exception`` call is needed.
+        """
+        if not self._future.is_ready():
+            return None
+        buf = self._future.get_buffer()
+        (raised,) = struct.unpack("?", buf[:1])
+        return raised
+
     def raise_exception(self) -> None:
         buf = self._future.get_buffer()
         (raised,) = struct.unpack("?", buf[:1])
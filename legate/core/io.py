@@ -14,13 +14,18 @@
 #
 from __future__ import annotations
 
+import json
+import os
 from typing import TYPE_CHECKING, Callable, Iterable, Optional, Union
 
+import numpy as np
+
 from . import ffi  # Make sure we only have one ffi instance
 from . import (
     Future,
     FutureMap,
     IndexPartition,
+    InlineMapping,
     PartitionByDomain,
     Point,
     Rect,
@@ -136,6 +141,34 @@ class TiledSplit(DataSplit):
         return part
 
 
+def _sharded_local_colors(colors: tuple[int, ...]) -> list[Point]:
+    # Assign colors following the default sharding, by inverting the core
+    # linearizing sharding functor for the local shard
+    sid = runtime.core_context.get_sharding_id(
+        runtime.core_library.LEGATE_CORE_LINEARIZE_SHARD_ID
+    )
+    shard = legion.legion_runtime_local_shard(legion_runtime, legion_context)
+    domain = Rect(colors).raw()
+    total_shards = legion.legion_runtime_total_shards(
+        legion_runtime, legion_context
+    )
+    points_size = ffi.new("size_t *")
+    points_size[0] = 1
+    for c in colors:
+        points_size[0] *= c
+    points_ptr = ffi.new("legion_domain_point_t[%s]" % points_size[0])
+    legion.legion_sharding_functor_invert(
+        sid,
+        shard,
+        domain,
+        domain,
+        total_shards,
+        points_ptr,
+        points_size,
+    )
+    return [Point(points_ptr[i]) for i in range(points_size[0])]
+
+
 def ingest(
     dtype: Dtype,
     shape: Union[int, tuple[int, ...]],
@@ -218,37 +251,11 @@ def ingest(
             f"data_split: expected a DataSplit object but got {data_split}"
         )
 
-    # Assign colors following the default sharding
-    def default_get_local_colors() -> list[Point]:
-        sid = runtime.core_context.get_sharding_id(
-            runtime.core_library.LEGATE_CORE_LINEARIZE_SHARD_ID
-        )
-        shard = legion.legion_runtime_local_shard(
-            legion_runtime, legion_context
-        )
-        domain = Rect(colors).raw()
-        total_shards = legion.legion_runtime_total_shards(
-            legion_runtime, legion_context
-        )
-        points_size = ffi.new("size_t *")
-        points_size[0] = 1
-        for c in colors:
-            points_size[0] *= c
-        points_ptr = ffi.new("legion_domain_point_t[%s]" % points_size[0])
-        legion.legion_sharding_functor_invert(
-            sid,
-            shard,
-            domain,
-            domain,
-            total_shards,
-            points_ptr,
-            points_size,
-        )
-        return [Point(points_ptr[i]) for i in range(points_size[0])]
-
     store = runtime.core_context.create_store(dtype, Shape(shape))
     local_colors = (
-        get_local_colors() if get_local_colors else default_get_local_colors()
+        get_local_colors()
+        if get_local_colors
+        else _sharded_local_colors(colors)
     )
     partition = data_split.make_partition(store, colors, local_colors)
     shard_local_buffers = {c: get_buffer(c) for c in local_colors}
@@ -256,3 +263,177 @@ def ingest(
     store.attach_external_allocation(alloc, False)
     # first store is the (non-existent) mask
     return Table.from_arrays(["ingested"], [Array(dtype, [None, store])])
+
+
+def _checkpoint_tile_shape(
+    shape: tuple[int, ...], colors: tuple[int, ...]
+) -> tuple[int, ...]:
+    if len(shape) != len(colors):
+        raise ValueError(
+            f"colors {colors} must have the same number of dimensions as "
+            f"the store shape {shape}"
+        )
+    return tuple((s + c - 1) // c for s, c in zip(shape, colors))
+
+
+def _chunk_path(dirname: str, color: Point, dim: int) -> str:
+    name = "chunk_" + "_".join(str(color[i]) for i in range(dim)) + ".bin"
+    return os.path.join(dirname, name)
+
+
+def _subregion_view(
+    physical_region: Any, fid: int, lo: tuple[int, ...], hi: tuple[int, ...]
+) -> tuple[Any, tuple[int, ...], tuple[int, ...]]:
+    # Build an accessor over the mapped subregion and return the raw base
+    # pointer along with the extents and byte strides of the instance layout
+    dim = len(lo)
+    func = getattr(
+        legion, f"legion_physical_region_get_field_accessor_array_{dim}d"
+    )
+    accessor = func(physical_region.handle, ffi.cast("legion_field_id_t", fid))
+    rect = ffi.new(f"legion_rect_{dim}d_t *")
+    for d in range(dim):
+        rect[0].lo.x[d] = lo[d]
+        rect[0].hi.x[d] = hi[d]  # inclusive
+    subrect = ffi.new(f"legion_rect_{dim}d_t *")
+    offsets = ffi.new("legion_byte_offset_t[]", dim)
+    func = getattr(legion, f"legion_accessor_array_{dim}d_raw_rect_ptr")
+    base_ptr = func(accessor, rect[0], subrect, offsets)
+    assert base_ptr is not None
+    extent = tuple(hi[d] - lo[d] + 1 for d in range(dim))
+    strides = tuple(offsets[d].offset for d in range(dim))
+    return base_ptr, extent, strides
+
+
+def checkpoint(store: Store, dirname: str, colors: tuple[int, ...]) -> None:
+    """
+    Snapshot the contents of a store to a directory of per-node files.
+
+    The store's domain is tiled according to `colors`, and every node writes
+    out exactly the tiles that the default sharding assigns to it, so a
+    checkpoint runs at the aggregate bandwidth of the node-local (or
+    parallel) filesystem instead of serializing through one node. The
+    matching `restore` call reattaches the files through the external
+    allocation mechanism.
+
+    Parameters
+    ----------
+    store : Store
+        The store to snapshot; must be backed by a region
+
+    dirname : str
+        Directory to write the checkpoint into; created if necessary. The
+        first shard also writes a small `manifest.json` recording the shape,
+        colors and type of the checkpointed store
+
+    colors : Tuple[int]
+        How many tiles (and hence files) to split each dimension into. For
+        the writes to proceed in parallel the total number of tiles should be
+        at least the number of nodes
+    """
+    if not isinstance(store.storage, RegionField):
+        raise ValueError("Only region-backed stores can be checkpointed")
+    shape = tuple(store.shape)
+    tile_shape = _checkpoint_tile_shape(shape, colors)
+    dim = len(shape)
+
+    os.makedirs(dirname, exist_ok=True)
+    shard = legion.legion_runtime_local_shard(legion_runtime, legion_context)
+    if shard == 0:
+        manifest = {
+            "shape": list(shape),
+            "colors": list(colors),
+            "dtype": str(store.type),
+        }
+        with open(os.path.join(dirname, "manifest.json"), "w") as f:
+            json.dump(manifest, f)
+
+    functor = Tiling(Shape(tile_shape), Shape(colors))
+    partition = store.find_or_create_legion_partition(functor, complete=True)
+    assert partition is not None
+
+    fid = store.storage.field.field_id
+    np_dtype = store.type.to_numpy_dtype()
+    for color in _sharded_local_colors(colors):
+        lo = tuple(color[i] * tile_shape[i] for i in range(dim))
+        hi = tuple(
+            min(shape[i], (color[i] + 1) * tile_shape[i]) - 1
+            for i in range(dim)
+        )
+        # Tiles that fall entirely outside the domain have nothing to write
+        if any(hi[i] < lo[i] for i in range(dim)):
+            continue
+        subregion = partition.get_child(color)
+        mapping = InlineMapping(subregion, fid, read_only=True)
+        physical_region = runtime.dispatch(mapping)
+        physical_region.wait_until_valid()
+        try:
+            base_ptr, extent, strides = _subregion_view(
+                physical_region, fid, lo, hi
+            )
+            nbytes = (
+                sum((extent[d] - 1) * strides[d] for d in range(dim))
+                + np_dtype.itemsize
+            )
+            view = np.ndarray(
+                extent,
+                dtype=np_dtype,
+                buffer=ffi.buffer(base_ptr, nbytes),
+                strides=strides,
+            )
+            np.ascontiguousarray(view).tofile(
+                _chunk_path(dirname, color, dim)
+            )
+        finally:
+            runtime.unmap_region(physical_region)
+
+
+def restore(
+    dtype: Dtype,
+    shape: Union[int, tuple[int, ...]],
+    colors: tuple[int, ...],
+    dirname: str,
+) -> LegateDataInterface:
+    """
+    Reconstruct a store from a checkpoint written by `checkpoint`.
+
+    Each tile is read on whichever node Legate wants it to live on and the
+    buffers are attached through the external allocation mechanism, so the
+    restore also scales with node count, as long as the checkpoint directory
+    is visible on all nodes (a parallel filesystem, or files restaged to the
+    same paths).
+
+    Parameters
+    ----------
+    dtype : Dtype
+        Type of the checkpointed store
+
+    shape : int | Tuple[int]
+        Shape of the checkpointed store
+
+    colors : Tuple[int]
+        The tiling the checkpoint was written with
+
+    dirname : str
+        Directory holding the checkpoint files
+
+    Returns
+    -------
+    A single-column Table backed by the checkpointed data, as from `ingest`
+    """
+    shape = (shape,) if isinstance(shape, int) else tuple(shape)
+    tile_shape = _checkpoint_tile_shape(shape, colors)
+    dim = len(shape)
+
+    def get_buffer(color: Point) -> memoryview:
+        extent = tuple(
+            min(shape[i], (color[i] + 1) * tile_shape[i])
+            - color[i] * tile_shape[i]
+            for i in range(dim)
+        )
+        data = np.fromfile(
+            _chunk_path(dirname, color, dim), dtype=dtype.to_numpy_dtype()
+        ).reshape(extent)
+        return memoryview(data)  # type: ignore[arg-type]
+
+    return ingest(dtype, shape, colors, TiledSplit(tile_shape), get_buffer)
@@ -98,6 +98,10 @@ _SERIALIZERS: dict[int, Serializer] = {
     ty.string.uid: BufferBuilder.pack_string,
 }
 
+# Read-only futures no bigger than this are inlined into the task argument
+# blob at launch when their values are already available
+_MAX_INLINE_FUTURE_SIZE = 64
+
 EntryType = Tuple[Union["Broadcast", "Partition"], int, int]
 
 
@@ -137,12 +141,18 @@ class ScalarArg:
 
 class FutureStoreArg:
     def __init__(
-        self, store: Store, read_only: bool, future_index: int, redop: int
+        self,
+        store: Store,
+        read_only: bool,
+        future_index: int,
+        redop: int,
+        inline_data: Optional[bytes] = None,
     ) -> None:
         self._store = store
         self._read_only = read_only
         self._future_index = future_index
         self._redop = redop
+        self._inline_data = inline_data
 
     def pack(self, buf: BufferBuilder) -> None:
         self._store.serialize(buf)
@@ -154,6 +164,11 @@ class FutureStoreArg:
         buf.pack_32bit_uint(len(extents))
         for extent in extents:
             buf.pack_64bit_int(extent)
+        if self._inline_data is None:
+            buf.pack_bool(False)
+        else:
+            buf.pack_bool(True)
+            buf.pack_bytes(self._inline_data)
 
     def __str__(self) -> str:
         return f"FutureStoreArg({self._store})"
@@ -792,9 +807,29 @@ class TaskLauncher:
             # the inverse isn't true.)
             future_index = -1
             read_only = perm == Permission.READ
+            inline_data: Optional[bytes] = None
             if store.has_storage and perm != Permission.REDUCTION:
-                future_index = self.add_future(store.storage)
-            args.append(FutureStoreArg(store, read_only, future_index, redop))
+                storage = store.storage
+                # Small completed futures are copied straight into the
+                # argument blob, so steady-state consumers (loop-carried
+                # alphas, counts) read them with no future propagation or
+                # subscription on the task side. is_ready with subscribe=True
+                # also requests the payload, so a future that misses the
+                # first launch becomes inlinable on later ones.
+                if (
+                    read_only
+                    and store.type.size <= _MAX_INLINE_FUTURE_SIZE
+                    and storage.handle is not None
+                    and storage.is_ready(subscribe=True)
+                ):
+                    inline_data = bytes(storage.get_buffer(store.type.size))
+                else:
+                    future_index = self.add_future(storage)
+            args.append(
+                FutureStoreArg(
+                    store, read_only, future_index, redop, inline_data
+                )
+            )
 
         else:
             if TYPE_CHECKING:
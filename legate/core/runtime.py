@@ -41,12 +41,14 @@ from legion_top import add_cleanup_item, top_level
 from ..settings import settings
 from . import ffi  # Make sure we only have one ffi instance
 from . import (
+    Domain,
     Fence,
     FieldSpace,
     Future,
     FutureMap,
     IndexSpace,
     OutputRegion,
+    Point,
     Rect,
     Region,
     legate_task_postamble,
@@ -156,10 +158,20 @@ class FreeFieldInfo:
 
 
 class FieldMatch(Dispatchable[Future]):
-    __slots__ = ["manager", "fields", "input", "output", "future"]
+    __slots__ = [
+        "manager",
+        "fields",
+        "input",
+        "output",
+        "future",
+        "num_matched",
+    ]
 
     def __init__(self, fields: List[FreeFieldInfo]) -> None:
         self.fields = fields
+        # Number of fields that matched on all shards, filled in once the
+        # match result is processed
+        self.num_matched = 0
         # Allocate arrays of ints that are twice as long as fields since
         # our values will be 'field_id,tree_id' pairs
         if (num_fields := len(fields)) > 0:
@@ -211,6 +223,7 @@ class FieldMatch(Dispatchable[Future]):
         else:
             num_fields = struct.unpack_from("Q", self.future.get_buffer(8))[0]
         assert num_fields <= len(self.fields)
+        self.num_matched = num_fields
         if num_fields > 0:
             # Put all the returned fields onto the ordered queue in the order
             # that they are in this list since we know
@@ -249,7 +262,48 @@ class FieldMatchManager:
         self._freed_fields: List[FreeFieldInfo] = []
         self._matches: Deque[FieldMatch] = deque()
         self._match_counter = 0
-        self._match_frequency = runtime.max_field_reuse_frequency
+        # The configured frequency is the baseline; the effective frequency
+        # adapts to the observed match rate as the workload shifts phases
+        self._base_frequency = runtime.max_field_reuse_frequency
+        self._match_frequency = self._base_frequency
+        # Exponential moving average of the fraction of offered fields that
+        # matched on all shards
+        self._match_rate = 0.0
+        self._num_observed_matches = 0
+
+    @property
+    def effective_match_frequency(self) -> int:
+        return self._match_frequency
+
+    @property
+    def match_rate(self) -> float:
+        return self._match_rate
+
+    def _record_match_result(self, matched: int, offered: int) -> None:
+        if offered == 0:
+            return
+        rate = matched / offered
+        if self._num_observed_matches == 0:
+            self._match_rate = rate
+        else:
+            self._match_rate = 0.75 * self._match_rate + 0.25 * rate
+        self._num_observed_matches += 1
+        # Productive matches are worth issuing sooner, since every match that
+        # recycles fields avoids fresh allocations on all shards; unproductive
+        # ones are wasted collectives, so back off. The effective frequency
+        # moves one doubling/halving at a time and stays within 4x of the
+        # configured value, so one pathological phase can neither thrash the
+        # frequency nor pin it at an extreme.
+        if self._match_rate > 0.5:
+            target = max(self._base_frequency // 4, 1)
+        elif self._match_rate < 0.1:
+            target = self._base_frequency * 4
+        else:
+            target = self._base_frequency
+        if target > self._match_frequency:
+            self._match_frequency = min(target, self._match_frequency * 2)
+        elif target < self._match_frequency:
+            self._match_frequency = max(target, self._match_frequency // 2)
 
     def add_free_field(
         self,
@@ -296,6 +350,7 @@ class FieldMatchManager:
         while len(self._matches) > 0:
             match = self._matches.popleft()
             match.update_free_fields()
+            self._record_match_result(match.num_matched, len(match.fields))
 
 
 # This class keeps track of usage of a single region
@@ -695,6 +750,23 @@ class PartitionManager:
         self._storage_key_partitions: dict[tuple[int, int], PartitionBase] = {}
         self._store_key_partitions: dict[tuple[int, int], PartitionBase] = {}
 
+    def renegotiate_min_shard_volume(self) -> None:
+        """
+        Re-polls the adapted minimum shard volume published by the core
+        mapper, which scales the static minimum based on the observed task
+        granularity, and drops any launch spaces computed with the old
+        value. Call between phases of a long-running application so the
+        partition granularity tracks workload behavior.
+        """
+        new_volume = self._runtime.core_context.get_tunable(
+            self._runtime.core_library.LEGATE_CORE_TUNABLE_ADAPTED_MIN_SHARD_VOLUME,  # noqa: E501
+            ty.int64,
+        )
+        if new_volume == self._min_shard_volume:
+            return
+        self._min_shard_volume = new_volume
+        self._launch_spaces = {}
+
     def get_current_num_pieces(self) -> int:
         return len(self._runtime.machine)
 
@@ -1071,9 +1143,18 @@ class Runtime:
         # to be dispatched. This list allows cross library introspection for
         # Legate operations.
         self._outstanding_ops: List[Operation] = []
-        self._window_size = self._core_context.get_tunable(
-            legion.LEGATE_CORE_TUNABLE_WINDOW_SIZE,
-            ty.uint32,
+        # Every tunable consumed during startup comes back in one packed
+        # response; fetching them individually costs a mapper invocation and
+        # a future round trip apiece, which adds up at high node counts.
+        # Entries are ordered by legate_core_startup_tunable_t and widened
+        # to 64 bits.
+        startup_tunables = self._core_context.get_tunable_vector(
+            legion.LEGATE_CORE_TUNABLE_STARTUP_BATCH,
+            ty.uint64,
+            legion.LEGATE_CORE_STARTUP_TUNABLE_NUM_VALUES,
+        )
+        self._window_size = int(
+            startup_tunables[legion.LEGATE_CORE_STARTUP_TUNABLE_WINDOW_SIZE]
         )
 
         self._next_store_id = 0
@@ -1081,29 +1162,23 @@ class Runtime:
 
         self._barriers: List[legion.legion_phase_barrier_t] = []
         self.nccl_needs_barrier = bool(
-            self._core_context.get_tunable(
-                legion.LEGATE_CORE_TUNABLE_NCCL_NEEDS_BARRIER,
-                ty.bool_,
-            )
+            startup_tunables[
+                legion.LEGATE_CORE_STARTUP_TUNABLE_NCCL_NEEDS_BARRIER
+            ]
         )
 
         self._num_nodes = int(
-            self._core_context.get_tunable(
-                legion.LEGATE_CORE_TUNABLE_NUM_NODES,
-                ty.int32,
-            )
+            startup_tunables[legion.LEGATE_CORE_STARTUP_TUNABLE_NUM_NODES]
         )
         self.max_field_reuse_frequency = int(
-            self._core_context.get_tunable(
-                legion.LEGATE_CORE_TUNABLE_FIELD_REUSE_FREQUENCY,
-                ty.uint32,
-            )
+            startup_tunables[
+                legion.LEGATE_CORE_STARTUP_TUNABLE_FIELD_REUSE_FREQUENCY
+            ]
         )
         self.max_field_reuse_size = int(
-            self._core_context.get_tunable(
-                legion.LEGATE_CORE_TUNABLE_FIELD_REUSE_SIZE,
-                ty.uint64,
-            )
+            startup_tunables[
+                legion.LEGATE_CORE_STARTUP_TUNABLE_FIELD_REUSE_SIZE
+            ]
         )
         self._field_manager_class = (
             ConsensusMatchingFieldManager
@@ -1111,10 +1186,9 @@ class Runtime:
             else FieldManager
         )
         self._max_lru_length = int(
-            self._core_context.get_tunable(
-                legion.LEGATE_CORE_TUNABLE_MAX_LRU_LENGTH,
-                ty.uint32,
-            )
+            startup_tunables[
+                legion.LEGATE_CORE_STARTUP_TUNABLE_MAX_LRU_LENGTH
+            ]
         )
 
         # Now we initialize managers
@@ -1148,16 +1222,14 @@ class Runtime:
         self._registered_shardings: dict[ShardSpec, int] = {}
 
         self._max_pending_exceptions: int = int(
-            self._core_context.get_tunable(
-                legion.LEGATE_CORE_TUNABLE_MAX_PENDING_EXCEPTIONS,
-                ty.uint32,
-            )
+            startup_tunables[
+                legion.LEGATE_CORE_STARTUP_TUNABLE_MAX_PENDING_EXCEPTIONS
+            ]
         )
         self._precise_exception_trace: bool = bool(
-            self._core_context.get_tunable(
-                legion.LEGATE_CORE_TUNABLE_PRECISE_EXCEPTION_TRACE,
-                ty.bool_,
-            )
+            startup_tunables[
+                legion.LEGATE_CORE_STARTUP_TUNABLE_PRECISE_EXCEPTION_TRACE
+            ]
         )
 
         self._pending_exceptions: list[PendingException] = []
@@ -1235,6 +1307,33 @@ class Runtime:
     def field_match_manager(self) -> FieldMatchManager:
         return self._field_match_manager
 
+    @property
+    def effective_field_reuse_frequency(self) -> int:
+        """
+        Returns the field reuse frequency currently in effect, after
+        adaptation to the observed consensus match rate. Starts at the
+        configured LEGATE_FIELD_REUSE_FREQ value.
+
+        Returns
+        -------
+        int
+            Effective field reuse frequency
+        """
+        return self._field_match_manager.effective_match_frequency
+
+    @property
+    def field_match_rate(self) -> float:
+        """
+        Returns the moving average of the fraction of freed fields that
+        matched on all shards in recent consensus matches.
+
+        Returns
+        -------
+        float
+            Field match rate between 0 and 1
+        """
+        return self._field_match_manager.match_rate
+
     @property
     def annotation(self) -> LibraryAnnotations:
         """
@@ -1352,6 +1451,16 @@ class Runtime:
 
         self.destroyed = True
 
+    def early_cleanup(self) -> None:
+        """
+        Starts tearing down communicator state and cached mapper instances
+        on a background thread, so cleanup overlaps with tasks still running
+        in the job's tail (e.g. final output I/O). No task launched after
+        this call may use a communicator; everything else keeps working, and
+        shutdown waits for the teardown to finish.
+        """
+        self.core_library.legate_early_cleanup()
+
     def get_unique_op_id(self) -> int:
         op_id = self._unique_op_id
         self._unique_op_id += 1
@@ -1408,7 +1517,12 @@ class Runtime:
         if len(self._outstanding_ops) >= self._window_size:
             self.flush_scheduling_window()
         if len(self._pending_exceptions) >= self._max_pending_exceptions:
-            self.raise_exceptions()
+            # Retire the futures that already completed cleanly before
+            # resorting to a blocking scan; in the common case where no task
+            # throws, the window never stalls the pipeline
+            self._drain_pending_exceptions()
+            if len(self._pending_exceptions) >= self._max_pending_exceptions:
+                self.raise_exceptions()
 
     def _progress_unordered_operations(self) -> None:
         legion.legion_context_progress_unordered_operations(
@@ -1977,15 +2091,86 @@ class Runtime:
     ) -> Future:
         if isinstance(future_map, Future):
             return future_map
-        else:
-            return future_map.reduce(
+        if settings.tree_reduce():
+            result = self._tree_reduce_future_map(
+                future_map, redop, ordered, init_value
+            )
+            if result is not None:
+                return result
+        return future_map.reduce(
+            self.legion_context,
+            self.legion_runtime,
+            redop,
+            ordered=ordered,
+            mapper=self.core_context.mapper_id,
+            init_value=init_value,
+        )
+
+    def _tree_reduce_future_map(
+        self,
+        future_map: FutureMap,
+        redop: int,
+        ordered: bool,
+        init_value: Optional[Future],
+    ) -> Optional[Future]:
+        # Combine each shard's point futures first and then reduce one value
+        # per shard, so a large flat reduction no longer funnels every point
+        # future through the owner node. Returns None when the launch is too
+        # small (or not dense) for the tree to pay off
+        domain = Domain(
+            legion.legion_future_map_get_domain(future_map.handle)
+        )
+        if not domain.dense:
+            return None
+        total_shards = legion.legion_runtime_total_shards(
+            self.legion_runtime, self.legion_context
+        )
+        volume = int(domain.get_volume())
+        if total_shards <= 1 or volume <= 2 * total_shards:
+            return None
+        # Points are iterated in the same linearized order the linearizing
+        # sharding functor uses, so each group's futures live on the shard
+        # that produced them and the partial reductions stay node-local
+        chunk = (volume + total_shards - 1) // total_shards
+        points = list(domain.rect)
+        shard_futures: list[Future] = []
+        for start in range(0, volume, chunk):
+            group = points[start : start + chunk]
+            sub = FutureMap.from_dict(
                 self.legion_context,
                 self.legion_runtime,
-                redop,
-                ordered=ordered,
-                mapper=self.core_context.mapper_id,
-                init_value=init_value,
+                Rect([len(group)]),
+                {
+                    Point([idx]): future_map.get_future(point)
+                    for idx, point in enumerate(group)
+                },
+            )
+            shard_futures.append(
+                sub.reduce(
+                    self.legion_context,
+                    self.legion_runtime,
+                    redop,
+                    ordered=ordered,
+                    mapper=self.core_context.mapper_id,
+                )
             )
+        top = FutureMap.from_dict(
+            self.legion_context,
+            self.legion_runtime,
+            Rect([len(shard_futures)]),
+            {
+                Point([idx]): future
+                for idx, future in enumerate(shard_futures)
+            },
+        )
+        return top.reduce(
+            self.legion_context,
+            self.legion_runtime,
+            redop,
+            ordered=ordered,
+            mapper=self.core_context.mapper_id,
+            init_value=init_value,
+        )
 
     def reduce_exception_future_map(
         self,
@@ -2068,6 +2253,16 @@ class Runtime:
         exn = PendingException(exn_types, future, tb_repr)
         self._pending_exceptions.append(exn)
 
+    def _drain_pending_exceptions(self) -> None:
+        # Drops entries whose futures completed without raising. Entries that
+        # did raise (or are still in flight) are kept in place, so a later
+        # raise_exceptions still surfaces exceptions in issue order.
+        self._pending_exceptions = [
+            pending
+            for pending in self._pending_exceptions
+            if pending.poll() is not False
+        ]
+
     def raise_exceptions(self) -> None:
         pending_exceptions = self._pending_exceptions
         self._pending_exceptions = []
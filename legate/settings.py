@@ -68,6 +68,21 @@ class LegateRuntimeSettings(Settings):
         """,
     )
 
+    tree_reduce: EnvOnlySetting[bool] = EnvOnlySetting(
+        "tree_reduce",
+        "LEGATE_TREE_REDUCE",
+        default=False,
+        convert=convert_bool,
+        help="""
+        Whether to reduce large future maps with a two-level tree, combining
+        each shard's futures locally before reducing one value per shard.
+        This avoids funneling every point future through the owner node on
+        large multi-node launches.
+
+        This is a read-only environment variable setting used by the runtime.
+        """,
+    )
+
     test: EnvOnlySetting[bool] = EnvOnlySetting(
         "test",
         "LEGATE_TEST",
@@ -19,6 +19,7 @@
 
 option(legate_core_BUILD_TESTS OFF)
 option(legate_core_BUILD_EXAMPLES OFF)
+option(legate_core_BUILD_BENCHMARKS OFF)
 include(cmake/Modules/legate_core_options.cmake)
 
 ##############################################################################
@@ -184,6 +185,7 @@ list(APPEND legate_core_SOURCES
   src/core/comm/comm_cpu.cc
   src/core/comm/coll.cc
   src/core/data/allocator.cc
+  src/core/data/kernels.cc
   src/core/data/scalar.cc
   src/core/data/store.cc
   src/core/data/transform.cc
@@ -192,10 +194,13 @@ list(APPEND legate_core_SOURCES
   src/core/mapping/default_mapper.cc
   src/core/mapping/instance_manager.cc
   src/core/mapping/machine.cc
+  src/core/mapping/mapper_stats.cc
+  src/core/mapping/mapper_trace.cc
   src/core/mapping/mapping.cc
   src/core/mapping/operation.cc
   src/core/mapping/store.cc
   src/core/runtime/context.cc
+  src/core/runtime/perf_counters.cc
   src/core/runtime/projection.cc
   src/core/runtime/runtime.cc
   src/core/runtime/shard.cc
@@ -203,11 +208,14 @@ list(APPEND legate_core_SOURCES
   src/core/task/return.cc
   src/core/task/task.cc
   src/core/task/task_info.cc
+  src/core/task/task_stats.cc
   src/core/task/variant_options.cc
   src/core/type/type_info.cc
+  src/core/utilities/async_logging.cc
   src/core/utilities/debug.cc
   src/core/utilities/deserializer.cc
   src/core/utilities/machine.cc
+  src/core/utilities/serializer.cc
   src/core/utilities/linearize.cc
 )
 
@@ -223,7 +231,10 @@ endif()
 if(Legion_USE_CUDA)
   list(APPEND legate_core_SOURCES
     src/core/comm/comm_nccl.cu
-    src/core/cuda/stream_pool.cu)
+    src/core/cuda/graph_cache.cu
+    src/core/data/kernels.cu
+    src/core/cuda/stream_pool.cu
+    src/core/task/return.cu)
 endif()
 
 add_library(legate_core ${legate_core_SOURCES})
@@ -308,10 +319,12 @@ if (legate_core_BUILD_DOCS)
       src/core/task/variant_options.h
       src/core/task/exception.h
       src/core/cuda/stream_pool.h
+      src/core/cuda/graph_cache.h
       # data
       src/core/data/store.h
       src/core/data/scalar.h
       src/core/data/buffer.h
+      src/core/data/kernels.h
       src/core/utilities/span.h
       src/core/data/allocator.h
       # runtime
@@ -326,6 +339,8 @@ if (legate_core_BUILD_DOCS)
       # utilities
       src/core/utilities/debug.h
       src/core/utilities/dispatch.h
+      src/core/utilities/parallel_for.h
+      src/core/utilities/raw_access.h
       # main page
       src/legate.h
     )
@@ -376,12 +391,14 @@ install(
 
 install(
   FILES src/core/cuda/cuda_help.h
+        src/core/cuda/graph_cache.h
         src/core/cuda/stream_pool.h
   DESTINATION ${CMAKE_INSTALL_INCLUDEDIR}/legate/core/cuda)
 
 install(
   FILES src/core/data/allocator.h
         src/core/data/buffer.h
+        src/core/data/kernels.h
         src/core/data/scalar.h
         src/core/data/scalar.inl
         src/core/data/store.h
@@ -427,6 +444,9 @@ install(
         src/core/utilities/dispatch.h
         src/core/utilities/machine.h
         src/core/utilities/nvtx_help.h
+        src/core/utilities/parallel_for.h
+        src/core/utilities/raw_access.h
+        src/core/utilities/serializer.h
         src/core/utilities/span.h
         src/core/utilities/typedefs.h
   DESTINATION ${CMAKE_INSTALL_INCLUDEDIR}/legate/core/utilities)
@@ -497,3 +517,7 @@ endif()
 if(legate_core_BUILD_EXAMPLES)
   add_subdirectory(examples)
 endif()
+
+if(legate_core_BUILD_BENCHMARKS)
+  add_subdirectory(tests/benchmarks)
+endif()
@@ -19,6 +19,7 @@
 #include <pthread.h>
 #include <stdio.h>
 #include <string.h>
+#include <algorithm>
 #include <atomic>
 #include <cstdlib>
 #include <unordered_map>
@@ -27,9 +28,16 @@
 #include <stdint.h>
 #endif
 
+#ifdef __linux__
+#include <sched.h>
+#endif
+
 #include "coll.h"
+#include "env_defaults.h"
 #include "legate.h"
 #include "legion.h"
+#include "mathtypes/complex.h"
+#include "mathtypes/half.h"
 
 namespace legate {
 namespace comm {
@@ -117,6 +125,184 @@ int collAllgather(
   return backend_network->allgather(sendbuf, recvbuf, count, type, global_comm);
 }
 
+int collAllgatherv(const void* sendbuf,
+                   int sendcount,
+                   void* recvbuf,
+                   const int recvcounts[],
+                   const int rdispls[],
+                   CollDataType type,
+                   CollComm global_comm)
+{
+  log_coll.debug(
+    "Allgatherv: global_rank %d, mpi_rank %d, unique_id %d, comm_size %d, "
+    "mpi_comm_size %d %d, nb_threads %d",
+    global_comm->global_rank,
+    global_comm->mpi_rank,
+    global_comm->unique_id,
+    global_comm->global_comm_size,
+    global_comm->mpi_comm_size,
+    global_comm->mpi_comm_size_actual,
+    global_comm->nb_threads);
+  return backend_network->allgatherv(
+    sendbuf, sendcount, recvbuf, recvcounts, rdispls, type, global_comm);
+}
+
+int collAllreduce(const void* sendbuf,
+                  void* recvbuf,
+                  int count,
+                  CollDataType type,
+                  CollRedOp op,
+                  CollComm global_comm)
+{
+  log_coll.debug(
+    "Allreduce: global_rank %d, mpi_rank %d, unique_id %d, comm_size %d, "
+    "mpi_comm_size %d %d, nb_threads %d",
+    global_comm->global_rank,
+    global_comm->mpi_rank,
+    global_comm->unique_id,
+    global_comm->global_comm_size,
+    global_comm->mpi_comm_size,
+    global_comm->mpi_comm_size_actual,
+    global_comm->nb_threads);
+  return backend_network->allreduce(sendbuf, recvbuf, count, type, op, global_comm);
+}
+
+int collReduceScatter(const void* sendbuf,
+                      void* recvbuf,
+                      int recvcount,
+                      CollDataType type,
+                      CollRedOp op,
+                      CollComm global_comm)
+{
+  // IN_PLACE
+  if (sendbuf == recvbuf) {
+    log_coll.error("Do not support inplace ReduceScatter");
+    LEGATE_ABORT;
+  }
+  log_coll.debug(
+    "ReduceScatter: global_rank %d, mpi_rank %d, unique_id %d, comm_size %d, "
+    "mpi_comm_size %d %d, nb_threads %d",
+    global_comm->global_rank,
+    global_comm->mpi_rank,
+    global_comm->unique_id,
+    global_comm->global_comm_size,
+    global_comm->mpi_comm_size,
+    global_comm->mpi_comm_size_actual,
+    global_comm->nb_threads);
+  return backend_network->reduce_scatter(sendbuf, recvbuf, recvcount, type, op, global_comm);
+}
+
+int collBcast(void* buf, int count, CollDataType type, int root, CollComm global_comm)
+{
+  log_coll.debug(
+    "Bcast: root %d, global_rank %d, mpi_rank %d, unique_id %d, comm_size %d, "
+    "mpi_comm_size %d %d, nb_threads %d",
+    root,
+    global_comm->global_rank,
+    global_comm->mpi_rank,
+    global_comm->unique_id,
+    global_comm->global_comm_size,
+    global_comm->mpi_comm_size,
+    global_comm->mpi_comm_size_actual,
+    global_comm->nb_threads);
+  return backend_network->bcast(buf, count, type, root, global_comm);
+}
+
+int collGather(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, int root, CollComm global_comm)
+{
+  // IN_PLACE
+  if (sendbuf == recvbuf) {
+    log_coll.error("Do not support inplace Gather");
+    LEGATE_ABORT;
+  }
+  log_coll.debug(
+    "Gather: root %d, global_rank %d, mpi_rank %d, unique_id %d, comm_size %d, "
+    "mpi_comm_size %d %d, nb_threads %d",
+    root,
+    global_comm->global_rank,
+    global_comm->mpi_rank,
+    global_comm->unique_id,
+    global_comm->global_comm_size,
+    global_comm->mpi_comm_size,
+    global_comm->mpi_comm_size_actual,
+    global_comm->nb_threads);
+  return backend_network->gather(sendbuf, recvbuf, count, type, root, global_comm);
+}
+
+int collScatter(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, int root, CollComm global_comm)
+{
+  // IN_PLACE
+  if (sendbuf == recvbuf) {
+    log_coll.error("Do not support inplace Scatter");
+    LEGATE_ABORT;
+  }
+  log_coll.debug(
+    "Scatter: root %d, global_rank %d, mpi_rank %d, unique_id %d, comm_size %d, "
+    "mpi_comm_size %d %d, nb_threads %d",
+    root,
+    global_comm->global_rank,
+    global_comm->mpi_rank,
+    global_comm->unique_id,
+    global_comm->global_comm_size,
+    global_comm->mpi_comm_size,
+    global_comm->mpi_comm_size_actual,
+    global_comm->nb_threads);
+  return backend_network->scatter(sendbuf, recvbuf, count, type, root, global_comm);
+}
+
+CollRequest collIalltoallv(const void* sendbuf,
+                           const int sendcounts[],
+                           const int sdispls[],
+                           void* recvbuf,
+                           const int recvcounts[],
+                           const int rdispls[],
+                           CollDataType type,
+                           CollComm global_comm)
+{
+  // IN_PLACE
+  if (sendbuf == recvbuf) {
+    log_coll.error("Do not support inplace Ialltoallv");
+    LEGATE_ABORT;
+  }
+  return backend_network->ialltoallv(
+    sendbuf, sendcounts, sdispls, recvbuf, recvcounts, rdispls, type, global_comm);
+}
+
+CollRequest collIalltoall(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm)
+{
+  // IN_PLACE
+  if (sendbuf == recvbuf) {
+    log_coll.error("Do not support inplace Ialltoall");
+    LEGATE_ABORT;
+  }
+  return backend_network->ialltoall(sendbuf, recvbuf, count, type, global_comm);
+}
+
+CollRequest collIallgather(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm)
+{
+  return backend_network->iallgather(sendbuf, recvbuf, count, type, global_comm);
+}
+
+int collTest(CollRequest request, int* completed)
+{
+  assert(request != nullptr);
+  *completed = request->done.load() ? 1 : 0;
+  return CollSuccess;
+}
+
+int collWait(CollRequest request)
+{
+  assert(request != nullptr);
+  request->worker.join();
+  int status = request->status;
+  delete request;
+  return status;
+}
+
 // called from main thread
 int collInit(int argc, char* argv[])
 {
@@ -137,16 +323,55 @@ int collInit(int argc, char* argv[])
 
 int collFinalize()
 {
+  // Idempotent, since the early-teardown path can finalize the network before the regular
+  // shutdown sequence gets here
   delete backend_network;
+  backend_network = nullptr;
   return CollSuccess;
 }
 
 int collInitComm() { return backend_network->init_comm(); }
 
-BackendNetwork::BackendNetwork() : coll_inited(false), current_unique_id(0) {}
+BackendNetwork::BackendNetwork() : coll_inited(false), current_unique_id(0)
+{
+  // Pick the progress core once, from the main thread: task threads are typically pinned to a
+  // single compute core by the time the first nonblocking collective runs, so their inherited
+  // mask would name the wrong core. The highest core of the startup mask is chosen because
+  // launchers that reserve a core for communication leave it at the top of the rank's binding
+  // (e.g. Realm's utility core split).
+  const bool pin_progress = extract_env("LEGATE_COLL_PROGRESS_CORE",
+                                        COLL_PROGRESS_CORE_DEFAULT,
+                                        COLL_PROGRESS_CORE_TEST) != 0;
+  if (!pin_progress) return;
+#ifdef __linux__
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  if (sched_getaffinity(0, sizeof(mask), &mask) != 0) {
+    log_coll.warning("could not read the affinity mask; progress pinning disabled");
+    return;
+  }
+  for (int core = 0; core < CPU_SETSIZE; core++)
+    if (CPU_ISSET(core, &mask)) progress_core = core;
+  log_coll.debug("reserving core %d for communication progress", progress_core);
+#else
+  log_coll.warning("LEGATE_COLL_PROGRESS_CORE is only supported on Linux");
+#endif
+}
 
 BackendNetwork::~BackendNetwork() {}
 
+void BackendNetwork::bindProgressThread()
+{
+  if (progress_core < 0) return;
+#ifdef __linux__
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  CPU_SET(progress_core, &mask);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) != 0)
+    log_coll.warning("failed to pin the progress thread to core %d", progress_core);
+#endif
+}
+
 int BackendNetwork::collGetUniqueId(int* id)
 {
   *id = current_unique_id;
@@ -154,6 +379,51 @@ int BackendNetwork::collGetUniqueId(int* id)
   return CollSuccess;
 }
 
+CollRequest BackendNetwork::ialltoallv(const void* sendbuf,
+                                       const int sendcounts[],
+                                       const int sdispls[],
+                                       void* recvbuf,
+                                       const int recvcounts[],
+                                       const int rdispls[],
+                                       CollDataType type,
+                                       CollComm global_comm)
+{
+  // One worker per request rather than a shared progress thread: the thread-local rendezvous
+  // in LocalNetwork needs every co-located rank's collective to make progress concurrently
+  CollRequest request = new Coll_Request();
+  request->worker     = std::thread([=] {
+    bindProgressThread();
+    request->status =
+      alltoallv(sendbuf, sendcounts, sdispls, recvbuf, recvcounts, rdispls, type, global_comm);
+    request->done.store(true);
+  });
+  return request;
+}
+
+CollRequest BackendNetwork::ialltoall(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm)
+{
+  CollRequest request = new Coll_Request();
+  request->worker     = std::thread([=] {
+    bindProgressThread();
+    request->status = alltoall(sendbuf, recvbuf, count, type, global_comm);
+    request->done.store(true);
+  });
+  return request;
+}
+
+CollRequest BackendNetwork::iallgather(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm)
+{
+  CollRequest request = new Coll_Request();
+  request->worker     = std::thread([=] {
+    bindProgressThread();
+    request->status = allgather(sendbuf, recvbuf, count, type, global_comm);
+    request->done.store(true);
+  });
+  return request;
+}
+
 void* BackendNetwork::allocateInplaceBuffer(const void* recvbuf, size_t size)
 {
   void* sendbuf_tmp = malloc(size);
@@ -162,6 +432,150 @@ void* BackendNetwork::allocateInplaceBuffer(const void* recvbuf, size_t size)
   return sendbuf_tmp;
 }
 
+namespace {
+
+template <typename T>
+void apply_reduction(T* inout, const T* in, int count, CollRedOp op)
+{
+  switch (op) {
+    case CollRedOp::CollSum: {
+      for (int i = 0; i < count; i++) inout[i] += in[i];
+      break;
+    }
+    case CollRedOp::CollProd: {
+      for (int i = 0; i < count; i++) inout[i] *= in[i];
+      break;
+    }
+    case CollRedOp::CollMax: {
+      for (int i = 0; i < count; i++) inout[i] = std::max(inout[i], in[i]);
+      break;
+    }
+    case CollRedOp::CollMin: {
+      for (int i = 0; i < count; i++) inout[i] = std::min(inout[i], in[i]);
+      break;
+    }
+    default: {
+      log_coll.fatal("Unknown reduction op");
+      LEGATE_ABORT;
+    }
+  }
+}
+
+// __half has no native host arithmetic, so the reduction is computed in float; the conversions
+// are cheap enough that the float inner loops still vectorize
+void apply_reduction_half(__half* inout, const __half* in, int count, CollRedOp op)
+{
+  switch (op) {
+    case CollRedOp::CollSum: {
+      for (int i = 0; i < count; i++)
+        inout[i] = static_cast<__half>(static_cast<float>(inout[i]) + static_cast<float>(in[i]));
+      break;
+    }
+    case CollRedOp::CollProd: {
+      for (int i = 0; i < count; i++)
+        inout[i] = static_cast<__half>(static_cast<float>(inout[i]) * static_cast<float>(in[i]));
+      break;
+    }
+    case CollRedOp::CollMax: {
+      for (int i = 0; i < count; i++)
+        inout[i] =
+          static_cast<__half>(std::max(static_cast<float>(inout[i]), static_cast<float>(in[i])));
+      break;
+    }
+    case CollRedOp::CollMin: {
+      for (int i = 0; i < count; i++)
+        inout[i] =
+          static_cast<__half>(std::min(static_cast<float>(inout[i]), static_cast<float>(in[i])));
+      break;
+    }
+    default: {
+      log_coll.fatal("Unknown reduction op");
+      LEGATE_ABORT;
+    }
+  }
+}
+
+// Sum and product are well defined for complex operands; there is no total order on complex
+// numbers, so max and min are rejected instead of silently comparing components
+template <typename T>
+void apply_reduction_complex(complex<T>* inout, const complex<T>* in, int count, CollRedOp op)
+{
+  switch (op) {
+    case CollRedOp::CollSum: {
+      for (int i = 0; i < count; i++) inout[i] = inout[i] + in[i];
+      break;
+    }
+    case CollRedOp::CollProd: {
+      for (int i = 0; i < count; i++) inout[i] = inout[i] * in[i];
+      break;
+    }
+    default: {
+      log_coll.fatal("Reduction op not supported for complex types");
+      LEGATE_ABORT;
+    }
+  }
+}
+
+}  // namespace
+
+void BackendNetwork::applyReduction(
+  void* inout, const void* in, int count, CollDataType type, CollRedOp op)
+{
+  switch (type) {
+    case CollDataType::CollInt8:
+    case CollDataType::CollChar: {
+      apply_reduction(static_cast<int8_t*>(inout), static_cast<const int8_t*>(in), count, op);
+      break;
+    }
+    case CollDataType::CollUint8: {
+      apply_reduction(static_cast<uint8_t*>(inout), static_cast<const uint8_t*>(in), count, op);
+      break;
+    }
+    case CollDataType::CollInt: {
+      apply_reduction(static_cast<int*>(inout), static_cast<const int*>(in), count, op);
+      break;
+    }
+    case CollDataType::CollUint32: {
+      apply_reduction(static_cast<uint32_t*>(inout), static_cast<const uint32_t*>(in), count, op);
+      break;
+    }
+    case CollDataType::CollInt64: {
+      apply_reduction(static_cast<int64_t*>(inout), static_cast<const int64_t*>(in), count, op);
+      break;
+    }
+    case CollDataType::CollUint64: {
+      apply_reduction(static_cast<uint64_t*>(inout), static_cast<const uint64_t*>(in), count, op);
+      break;
+    }
+    case CollDataType::CollFloat: {
+      apply_reduction(static_cast<float*>(inout), static_cast<const float*>(in), count, op);
+      break;
+    }
+    case CollDataType::CollDouble: {
+      apply_reduction(static_cast<double*>(inout), static_cast<const double*>(in), count, op);
+      break;
+    }
+    case CollDataType::CollHalf: {
+      apply_reduction_half(static_cast<__half*>(inout), static_cast<const __half*>(in), count, op);
+      break;
+    }
+    case CollDataType::CollComplexFloat: {
+      apply_reduction_complex(
+        static_cast<complex<float>*>(inout), static_cast<const complex<float>*>(in), count, op);
+      break;
+    }
+    case CollDataType::CollComplexDouble: {
+      apply_reduction_complex(
+        static_cast<complex<double>*>(inout), static_cast<const complex<double>*>(in), count, op);
+      break;
+    }
+    default: {
+      log_coll.fatal("Unknown datatype");
+      LEGATE_ABORT;
+    }
+  }
+}
+
 }  // namespace coll
 }  // namespace comm
 }  // namespace legate
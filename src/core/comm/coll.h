@@ -18,6 +18,11 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #ifdef LEGATE_USE_NETWORK
@@ -50,6 +55,11 @@ struct ThreadComm {
   bool ready_flag;
   const void** buffers;
   const int** displs;
+  // sense-reversing spin barrier state, used instead of the pthread barrier when
+  // use_spin_barrier is set (see LocalNetwork::comm_create)
+  bool use_spin_barrier;
+  volatile int barrier_count;
+  volatile int barrier_sense;
 };
 
 enum class CollDataType : int {
@@ -62,6 +72,18 @@ enum class CollDataType : int {
   CollUint64 = 6,
   CollFloat  = 7,
   CollDouble = 8,
+  CollHalf   = 9,
+  // Complex payloads travel natively instead of being reinterpreted as paired floats, so
+  // typed reductions (sum, product) stay available for them
+  CollComplexFloat  = 10,
+  CollComplexDouble = 11,
+};
+
+enum class CollRedOp : int {
+  CollSum  = 0,
+  CollProd = 1,
+  CollMax  = 2,
+  CollMin  = 3,
 };
 
 enum CollStatus : int {
@@ -78,6 +100,10 @@ struct Coll_Comm {
 #ifdef LEGATE_USE_NETWORK
   MPI_Comm mpi_comm;
   RankMappingTable mapping_table;
+  // Peer-offset visit order for the pairwise alltoall(v) loops, biased so offsets rich in
+  // node-local pairs run first; nullptr keeps the default (global_rank + i) order (see
+  // MPINetwork::comm_create)
+  int* offset_schedule;
 #endif
   volatile ThreadComm* local_comm;
   int mpi_rank;
@@ -88,10 +114,25 @@ struct Coll_Comm {
   int nb_threads;
   int unique_id;
   bool status;
+  // this rank's local sense for the spin barrier; only used by LocalNetwork
+  int barrier_local_sense;
+  // negotiated in comm_create (LEGATE_COLL_COMPRESSION); when set, large alltoallv segments
+  // are compressed before they hit the wire
+  bool compression_enabled;
 };
 
 typedef Coll_Comm* CollComm;
 
+// Completion handle for the nonblocking collective variants; poll it with collTest or block on
+// it with collWait, which also reclaims the handle
+struct Coll_Request {
+  std::thread worker;
+  std::atomic<bool> done{false};
+  int status{CollSuccess};
+};
+
+typedef Coll_Request* CollRequest;
+
 class BackendNetwork {
  public:
   BackendNetwork();
@@ -121,17 +162,88 @@ class BackendNetwork {
   virtual int allgather(
     const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm) = 0;
 
+  // Variable-count allgather: rank r contributes sendcount (= recvcounts[r]) elements and every
+  // rank receives rank r's block at rdispls[r]; recvcounts and rdispls must match on all ranks
+  virtual int allgatherv(const void* sendbuf,
+                         int sendcount,
+                         void* recvbuf,
+                         const int recvcounts[],
+                         const int rdispls[],
+                         CollDataType type,
+                         CollComm global_comm) = 0;
+
+  virtual int allreduce(const void* sendbuf,
+                        void* recvbuf,
+                        int count,
+                        CollDataType type,
+                        CollRedOp op,
+                        CollComm global_comm) = 0;
+
+  // Every rank contributes global_comm_size * recvcount elements and receives the reduction of
+  // its own recvcount-sized chunk
+  virtual int reduce_scatter(const void* sendbuf,
+                             void* recvbuf,
+                             int recvcount,
+                             CollDataType type,
+                             CollRedOp op,
+                             CollComm global_comm) = 0;
+
+  // Rooted collectives. Every rank of the communicator must pass the same root; sendbuf of
+  // scatter and recvbuf of gather are only dereferenced on the root
+  virtual int bcast(void* buf, int count, CollDataType type, int root, CollComm global_comm) = 0;
+
+  virtual int gather(const void* sendbuf,
+                     void* recvbuf,
+                     int count,
+                     CollDataType type,
+                     int root,
+                     CollComm global_comm) = 0;
+
+  virtual int scatter(const void* sendbuf,
+                      void* recvbuf,
+                      int count,
+                      CollDataType type,
+                      int root,
+                      CollComm global_comm) = 0;
+
+  // Nonblocking variants: the collective runs on a worker thread owned by the returned handle,
+  // so the calling task can overlap compute with communication. Every peer of a communicator
+  // still has to enter the same collective, blocking or not, in the same order.
+  CollRequest ialltoallv(const void* sendbuf,
+                         const int sendcounts[],
+                         const int sdispls[],
+                         void* recvbuf,
+                         const int recvcounts[],
+                         const int rdispls[],
+                         CollDataType type,
+                         CollComm global_comm);
+
+  CollRequest ialltoall(
+    const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm);
+
+  CollRequest iallgather(
+    const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm);
+
  protected:
   int collGetUniqueId(int* id);
 
   void* allocateInplaceBuffer(const void* recvbuf, size_t size);
 
+  // Pins the calling worker thread to the reserved progress core (LEGATE_COLL_PROGRESS_CORE);
+  // a no-op when no core was reserved or the platform has no thread affinity
+  void bindProgressThread();
+
+  // Elementwise `inout = inout op in` over `count` elements of the given type
+  void applyReduction(void* inout, const void* in, int count, CollDataType type, CollRedOp op);
+
  public:
   CollCommType comm_type;
 
  protected:
   bool coll_inited;
   int current_unique_id;
+  // core reserved for communication progress, picked once at startup; -1 when pinning is off
+  int progress_core{-1};
 };
 
 #ifdef LEGATE_USE_NETWORK
@@ -166,7 +278,33 @@ class MPINetwork : public BackendNetwork {
   int allgather(
     const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm);
 
- protected:
+  int allgatherv(const void* sendbuf,
+                 int sendcount,
+                 void* recvbuf,
+                 const int recvcounts[],
+                 const int rdispls[],
+                 CollDataType type,
+                 CollComm global_comm);
+
+  int allreduce(const void* sendbuf,
+                void* recvbuf,
+                int count,
+                CollDataType type,
+                CollRedOp op,
+                CollComm global_comm);
+
+  int reduce_scatter(const void* sendbuf,
+                     void* recvbuf,
+                     int recvcount,
+                     CollDataType type,
+                     CollRedOp op,
+                     CollComm global_comm);
+
+  // Binomial-tree rooted collectives: each rank exchanges at most log2(P) messages, and gather
+  // and scatter aggregate whole subtrees into single messages instead of sending P-1 blocks
+  // through the root's link
+  int bcast(void* buf, int count, CollDataType type, int root, CollComm global_comm);
+
   int gather(const void* sendbuf,
              void* recvbuf,
              int count,
@@ -174,7 +312,61 @@ class MPINetwork : public BackendNetwork {
              int root,
              CollComm global_comm);
 
-  int bcast(void* buf, int count, CollDataType type, int root, CollComm global_comm);
+  int scatter(const void* sendbuf,
+              void* recvbuf,
+              int count,
+              CollDataType type,
+              int root,
+              CollComm global_comm);
+
+ protected:
+  // Opt-in alltoallv used when the communicator negotiated compression: per-peer segments above
+  // a size threshold are squeezed with a zero-run-length codec before they hit the wire,
+  // trading spare CPU cycles for wire bandwidth on mostly-zero payloads
+  int alltoallvCompressed(const void* sendbuf,
+                          const int sendcounts[],
+                          const int sdispls[],
+                          void* recvbuf,
+                          const int recvcounts[],
+                          const int rdispls[],
+                          CollDataType type,
+                          CollComm global_comm);
+
+  // Bruck-style alltoall in ceil(log2(P)) rounds, used for small messages where per-message
+  // latency dominates the extra pack/unpack copies
+  int alltoallBruck(
+    const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm);
+
+  // Aggregated alltoallv for latency-bound exchanges: blocks of at most slot_elems elements are
+  // packed into fixed per-peer slots and moved with the Bruck schedule, while oversized blocks
+  // keep the point-to-point path, so P tiny messages collapse into ceil(log2(P)) rounds
+  int alltoallvAggregated(const void* sendbuf,
+                          const int sendcounts[],
+                          const int sdispls[],
+                          void* recvbuf,
+                          const int recvcounts[],
+                          const int rdispls[],
+                          CollDataType type,
+                          CollComm global_comm,
+                          int slot_elems);
+
+  // Pairwise exchange driven by persistent MPI requests: the send/recv schedule for a given
+  // (communicator, buffers, counts) shape is built once with MPI_Send_init/MPI_Recv_init and
+  // only re-armed with MPI_Startall when the same shape repeats, taking the per-iteration
+  // schedule construction of iterative solvers off the critical path
+  int alltoallvPersistent(const void* sendbuf,
+                          const int sendcounts[],
+                          const int sdispls[],
+                          void* recvbuf,
+                          const int recvcounts[],
+                          const int rdispls[],
+                          CollDataType type,
+                          CollComm global_comm);
+
+  // Two-level allgather for runs with multiple ranks per process: contributions are first
+  // aggregated at a per-process leader, then the leaders exchange one message per process pair
+  int allgatherHierarchical(
+    const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm);
 
   MPI_Datatype dtypeToMPIDtype(CollDataType dtype);
 
@@ -182,14 +374,67 @@ class MPINetwork : public BackendNetwork {
 
   int generateAlltoallvTag(int rank1, int rank2, CollComm global_comm);
 
+  int generateAllreduceTag(int rank1, int rank2, CollComm global_comm);
+
+  int generateReduceScatterTag(int rank1, int rank2, CollComm global_comm);
+
   int generateBcastTag(int rank, CollComm global_comm);
 
   int generateGatherTag(int rank, CollComm global_comm);
 
+  int generateScatterTag(int rank, CollComm global_comm);
+
+  // Ranks that share an entry in the mpi_rank mapping table live in the same process, so
+  // comm_create wires them up with a shared pointer table (the same ThreadComm LocalNetwork
+  // uses) and alltoall(v) moves their segments by direct copy instead of self-directed MPI
+  // messages
+  bool isLocalRank(CollComm global_comm, int global_rank);
+
+  void barrierLocal(CollComm global_comm);
+
+  void resetLocalBuffer(CollComm global_comm);
+
+ private:
+  // Cached schedule for one repeated alltoallv shape; the requests stay inactive between uses,
+  // so evicted or stale entries never touch their buffers
+  struct PersistentSchedule {
+    int unique_id;
+    int global_rank;
+    const void* sendbuf;
+    void* recvbuf;
+    CollDataType type;
+    std::vector<int> sendcounts;
+    std::vector<int> sdispls;
+    std::vector<int> recvcounts;
+    std::vector<int> rdispls;
+    std::vector<MPI_Request> requests;
+    uint64_t last_used;
+    // set while the owning rank is between Startall and Waitall; such entries are not evicted
+    bool in_use;
+  };
+
+  PersistentSchedule* findOrCreateSchedule(const void* sendbuf,
+                                           const int sendcounts[],
+                                           const int sdispls[],
+                                           void* recvbuf,
+                                           const int recvcounts[],
+                                           const int rdispls[],
+                                           CollDataType type,
+                                           CollComm global_comm,
+                                           bool* created);
+
  private:
   int mpi_tag_ub;
   bool self_init_mpi;
   std::vector<MPI_Comm> mpi_comms;
+  std::vector<ThreadComm*> thread_comms;
+  // LRU cache of persistent alltoallv schedules, shared by all ranks of this process
+  std::vector<PersistentSchedule*> persistent_schedules;
+  std::mutex persistent_mutex;
+  uint64_t persistent_clock{0};
+  // node id of every MPI_COMM_WORLD rank, discovered at construction (LEGATE_COLL_TOPOLOGY_AWARE);
+  // empty when discovery is disabled
+  std::vector<int> node_ids;
 };
 #endif
 
@@ -224,15 +469,75 @@ class LocalNetwork : public BackendNetwork {
   int allgather(
     const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm);
 
+  int allgatherv(const void* sendbuf,
+                 int sendcount,
+                 void* recvbuf,
+                 const int recvcounts[],
+                 const int rdispls[],
+                 CollDataType type,
+                 CollComm global_comm);
+
+  int allreduce(const void* sendbuf,
+                void* recvbuf,
+                int count,
+                CollDataType type,
+                CollRedOp op,
+                CollComm global_comm);
+
+  int reduce_scatter(const void* sendbuf,
+                     void* recvbuf,
+                     int recvcount,
+                     CollDataType type,
+                     CollRedOp op,
+                     CollComm global_comm);
+
+  // Rooted collectives move data by direct copy through the shared pointer table: non-roots
+  // read the root's buffer in place, so no aggregation buffers are needed
+  int bcast(void* buf, int count, CollDataType type, int root, CollComm global_comm);
+
+  int gather(const void* sendbuf,
+             void* recvbuf,
+             int count,
+             CollDataType type,
+             int root,
+             CollComm global_comm);
+
+  int scatter(const void* sendbuf,
+              void* recvbuf,
+              int count,
+              CollDataType type,
+              int root,
+              CollComm global_comm);
+
  protected:
   size_t getDtypeSize(CollDataType dtype);
 
+  // memcpy replacement for the peer-to-peer segment copies; large copies use non-temporal
+  // stores so multi-MB exchanges do not evict the shared last-level cache
+  void streamingCopy(void* dst, const void* src, size_t size);
+
   void resetLocalBuffer(CollComm global_comm);
 
   void barrierLocal(CollComm global_comm);
 
+  void spinBarrier(CollComm global_comm);
+
+  // Pool accessors for retired thread groups; thread-safe, as rank 0 of several communicators
+  // can create/destroy concurrently
+  ThreadComm* popThreadComm(int global_comm_size);
+
+  void pushThreadComm(int global_comm_size, ThreadComm* thread_comm);
+
  private:
   std::vector<ThreadComm*> thread_comms;
+  // Thread groups retired by comm_destroy, keyed by communicator size; comm_create adopts a
+  // matching one instead of re-running the barrier/buffer setup, so the per-scope communicator
+  // churn of iterative workloads degenerates into a pointer swap
+  std::map<int, std::vector<ThreadComm*>> comm_pool;
+  // ThreadComms displaced by a pool hit; peers may still be spinning on their ready_flag when
+  // the swap happens, so they are only reclaimed at finalize
+  std::vector<ThreadComm*> retired_comms;
+  std::mutex comm_pool_mutex;
 };
 
 extern BackendNetwork* backend_network;
@@ -260,6 +565,57 @@ int collAlltoall(
 int collAllgather(
   const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm);
 
+int collAllgatherv(const void* sendbuf,
+                   int sendcount,
+                   void* recvbuf,
+                   const int recvcounts[],
+                   const int rdispls[],
+                   CollDataType type,
+                   CollComm global_comm);
+
+int collAllreduce(const void* sendbuf,
+                  void* recvbuf,
+                  int count,
+                  CollDataType type,
+                  CollRedOp op,
+                  CollComm global_comm);
+
+int collReduceScatter(const void* sendbuf,
+                      void* recvbuf,
+                      int recvcount,
+                      CollDataType type,
+                      CollRedOp op,
+                      CollComm global_comm);
+
+int collBcast(void* buf, int count, CollDataType type, int root, CollComm global_comm);
+
+int collGather(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, int root, CollComm global_comm);
+
+int collScatter(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, int root, CollComm global_comm);
+
+CollRequest collIalltoallv(const void* sendbuf,
+                           const int sendcounts[],
+                           const int sdispls[],
+                           void* recvbuf,
+                           const int recvcounts[],
+                           const int rdispls[],
+                           CollDataType type,
+                           CollComm global_comm);
+
+CollRequest collIalltoall(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm);
+
+CollRequest collIallgather(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm);
+
+// Sets completed to 1 once the collective behind the request has finished
+int collTest(CollRequest request, int* completed);
+
+// Blocks until the collective has finished, frees the request, and returns its status
+int collWait(CollRequest request);
+
 int collInit(int argc, char* argv[]);
 
 int collFinalize();
@@ -29,7 +29,12 @@ void register_tasks(Legion::Machine machine,
                     const LibraryContext* context)
 {
 #ifdef LEGATE_USE_CUDA
-  nccl::register_tasks(machine, runtime, context);
+  // Registering the NCCL paths is pure startup overhead when the run has no GPUs: stream
+  // pools and communicators are created lazily on first use, so skipping registration here
+  // keeps CPU-only runs of a CUDA-enabled build entirely free of GPU-side setup
+  Legion::Machine::ProcessorQuery gpus(machine);
+  gpus.only_kind(Processor::TOC_PROC);
+  if (gpus.count() > 0) nccl::register_tasks(machine, runtime, context);
 #endif
   bool disable_mpi =
     static_cast<bool>(extract_env("LEGATE_DISABLE_MPI", DISABLE_MPI_DEFAULT, DISABLE_MPI_TEST));
@@ -15,11 +15,18 @@
  */
 
 #include <assert.h>
+#include <sched.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include "coll.h"
+#include "core/runtime/runtime.h"
+#include "env_defaults.h"
 #include "legate.h"
 #include "legion.h"
 
@@ -45,10 +52,23 @@ LocalNetwork::~LocalNetwork()
   log_coll.debug("Finalize LocalNetwork");
   assert(BackendNetwork::coll_inited == true);
   for (ThreadComm* thread_comm : thread_comms) {
+    if (thread_comm == nullptr) { continue; }
     assert(!thread_comm->ready_flag);
     free(thread_comm);
   }
   thread_comms.clear();
+  for (auto& pool_entry : comm_pool) {
+    for (ThreadComm* thread_comm : pool_entry.second) {
+      assert(!thread_comm->ready_flag);
+      pthread_barrier_destroy((pthread_barrier_t*)&(thread_comm->barrier));
+      free(thread_comm->buffers);
+      free(thread_comm->displs);
+      free(thread_comm);
+    }
+  }
+  comm_pool.clear();
+  for (ThreadComm* thread_comm : retired_comms) { free(thread_comm); }
+  retired_comms.clear();
   BackendNetwork::coll_inited = false;
 }
 
@@ -66,17 +86,47 @@ int LocalNetwork::comm_create(CollComm global_comm,
   global_comm->mpi_comm_size        = 1;
   global_comm->mpi_comm_size_actual = 1;
   global_comm->mpi_rank             = 0;
+  global_comm->compression_enabled  = false;
   if (global_comm->global_rank == 0) {
-    pthread_barrier_init((pthread_barrier_t*)&(thread_comms[global_comm->unique_id]->barrier),
-                         nullptr,
-                         global_comm->global_comm_size);
-    thread_comms[global_comm->unique_id]->buffers =
-      (const void**)malloc(sizeof(void*) * global_comm_size);
-    thread_comms[global_comm->unique_id]->displs =
-      (const int**)malloc(sizeof(int*) * global_comm_size);
-    for (int i = 0; i < global_comm_size; i++) {
-      thread_comms[global_comm->unique_id]->buffers[i] = nullptr;
-      thread_comms[global_comm->unique_id]->displs[i]  = nullptr;
+    ThreadComm* recycled = popThreadComm(global_comm_size);
+    if (recycled != nullptr) {
+      // A retired thread group of the right size already has its barrier initialized and its
+      // pointer tables allocated, so adopting it is just a slot swap; peers re-read the slot
+      // while they spin on ready_flag, so they pick up the new pointer. The displaced
+      // placeholder can still be under a peer's read, hence retired_comms instead of free
+      {
+        std::lock_guard<std::mutex> guard(comm_pool_mutex);
+        retired_comms.push_back(thread_comms[global_comm->unique_id]);
+      }
+#ifdef DEBUG_LEGATE
+      for (int i = 0; i < global_comm_size; i++) {
+        assert(recycled->buffers[i] == nullptr);
+        assert(recycled->displs[i] == nullptr);
+      }
+#endif
+      recycled->barrier_count              = 0;
+      recycled->barrier_sense              = 0;
+      thread_comms[global_comm->unique_id] = recycled;
+    } else {
+      pthread_barrier_init((pthread_barrier_t*)&(thread_comms[global_comm->unique_id]->barrier),
+                           nullptr,
+                           global_comm->global_comm_size);
+      thread_comms[global_comm->unique_id]->buffers =
+        (const void**)malloc(sizeof(void*) * global_comm_size);
+      thread_comms[global_comm->unique_id]->displs =
+        (const int**)malloc(sizeof(int*) * global_comm_size);
+      for (int i = 0; i < global_comm_size; i++) {
+        thread_comms[global_comm->unique_id]->buffers[i] = nullptr;
+        thread_comms[global_comm->unique_id]->displs[i]  = nullptr;
+      }
+      // The spin barrier avoids the futex wakeup latency of the pthread barrier, which dominates
+      // the small collectives issued by control-plane tasks
+      static const bool use_spin_barrier =
+        extract_env(
+          "LEGATE_COLL_SPIN_BARRIER", COLL_SPIN_BARRIER_DEFAULT, COLL_SPIN_BARRIER_TEST) != 0;
+      thread_comms[global_comm->unique_id]->use_spin_barrier = use_spin_barrier;
+      thread_comms[global_comm->unique_id]->barrier_count    = 0;
+      thread_comms[global_comm->unique_id]->barrier_sense    = 0;
     }
     __sync_synchronize();
     thread_comms[global_comm->unique_id]->ready_flag = true;
@@ -84,7 +134,8 @@ int LocalNetwork::comm_create(CollComm global_comm,
   __sync_synchronize();
   volatile ThreadComm* data = thread_comms[global_comm->unique_id];
   while (data->ready_flag != true) { data = thread_comms[global_comm->unique_id]; }
-  global_comm->local_comm = thread_comms[global_comm->unique_id];
+  global_comm->local_comm          = thread_comms[global_comm->unique_id];
+  global_comm->barrier_local_sense = 0;
   barrierLocal(global_comm);
   assert(global_comm->local_comm->ready_flag == true);
   assert(global_comm->local_comm->buffers != nullptr);
@@ -97,17 +148,25 @@ int LocalNetwork::comm_destroy(CollComm global_comm)
 {
   barrierLocal(global_comm);
   if (global_comm->global_rank == 0) {
-    pthread_barrier_destroy((pthread_barrier_t*)&(thread_comms[global_comm->unique_id]->barrier));
-    free(thread_comms[global_comm->unique_id]->buffers);
-    thread_comms[global_comm->unique_id]->buffers = nullptr;
-    free(thread_comms[global_comm->unique_id]->displs);
-    thread_comms[global_comm->unique_id]->displs = nullptr;
+    // Keep the barrier and pointer tables intact: the whole thread group goes back to the pool
+    // so the next comm_create of the same size can adopt it wholesale
     __sync_synchronize();
     thread_comms[global_comm->unique_id]->ready_flag = false;
   }
   __sync_synchronize();
   volatile ThreadComm* data = thread_comms[global_comm->unique_id];
   while (data->ready_flag != false) { data = thread_comms[global_comm->unique_id]; }
+  // Once recycled, the thread group can be re-activated by another communicator, so rank 0 must
+  // not pool it before every rank has seen ready_flag go down; barrier_count doubles as the
+  // departure counter here (it is reset on adoption)
+  if (__sync_add_and_fetch(const_cast<int*>(&data->barrier_count), 1) ==
+      global_comm->global_comm_size) {
+    data->barrier_count = 0;
+    __sync_synchronize();
+    pushThreadComm(global_comm->global_comm_size,
+                   const_cast<ThreadComm*>(thread_comms[global_comm->unique_id]));
+    thread_comms[global_comm->unique_id] = nullptr;
+  }
   global_comm->status = false;
   return CollSuccess;
 }
@@ -118,10 +177,13 @@ int LocalNetwork::init_comm()
   collGetUniqueId(&id);
   assert(thread_comms.size() == id);
   // create thread comm
-  ThreadComm* thread_comm = (ThreadComm*)malloc(sizeof(ThreadComm));
-  thread_comm->ready_flag = false;
-  thread_comm->buffers    = nullptr;
-  thread_comm->displs     = nullptr;
+  ThreadComm* thread_comm       = (ThreadComm*)malloc(sizeof(ThreadComm));
+  thread_comm->ready_flag       = false;
+  thread_comm->buffers          = nullptr;
+  thread_comm->displs           = nullptr;
+  thread_comm->use_spin_barrier = false;
+  thread_comm->barrier_count    = 0;
+  thread_comm->barrier_sense    = 0;
   thread_comms.push_back(thread_comm);
   log_coll.debug("Init comm id %d", id);
   return id;
@@ -180,7 +242,7 @@ int LocalNetwork::alltoallv(const void* sendbuf,
       rdispls[recvfrom_global_rank],
       dst);
 #endif
-    memcpy(dst, src, recvcounts[recvfrom_global_rank] * type_extent);
+    streamingCopy(dst, src, recvcounts[recvfrom_global_rank] * type_extent);
   }
 
   barrierLocal(global_comm);
@@ -233,7 +295,7 @@ int LocalNetwork::alltoall(
       recvfrom_global_rank,
       dst);
 #endif
-    memcpy(dst, src, count * type_extent);
+    streamingCopy(dst, src, count * type_extent);
   }
 
   barrierLocal(global_comm);
@@ -280,7 +342,69 @@ int LocalNetwork::allgather(
       global_rank,
       dst);
 #endif
-    memcpy(dst, src, count * type_extent);
+    streamingCopy(dst, src, count * type_extent);
+  }
+
+  barrierLocal(global_comm);
+  if (sendbuf == recvbuf) { free(const_cast<void*>(sendbuf_tmp)); }
+
+  __sync_synchronize();
+
+  resetLocalBuffer(global_comm);
+  barrierLocal(global_comm);
+
+  return CollSuccess;
+}
+
+int LocalNetwork::allgatherv(const void* sendbuf,
+                             int sendcount,
+                             void* recvbuf,
+                             const int recvcounts[],
+                             const int rdispls[],
+                             CollDataType type,
+                             CollComm global_comm)
+{
+  int total_size  = global_comm->global_comm_size;
+  int global_rank = global_comm->global_rank;
+
+  int type_extent = getDtypeSize(type);
+
+  assert(sendcount == recvcounts[global_rank]);
+
+  const void* sendbuf_tmp = sendbuf;
+
+  // MPI_IN_PLACE: the contribution already sits at its displacement in recvbuf
+  if (sendbuf == recvbuf) {
+    sendbuf_tmp =
+      allocateInplaceBuffer(static_cast<const char*>(recvbuf) +
+                              static_cast<ptrdiff_t>(rdispls[global_rank]) * type_extent,
+                            type_extent * sendcount);
+  }
+
+  global_comm->local_comm->buffers[global_rank] = sendbuf_tmp;
+  __sync_synchronize();
+
+  for (int recvfrom_global_rank = 0; recvfrom_global_rank < total_size; recvfrom_global_rank++) {
+    // wait for other threads to update the buffer address
+    while (global_comm->local_comm->buffers[recvfrom_global_rank] == nullptr)
+      ;
+    const void* src = global_comm->local_comm->buffers[recvfrom_global_rank];
+    char* dst       = static_cast<char*>(recvbuf) +
+                static_cast<ptrdiff_t>(rdispls[recvfrom_global_rank]) * type_extent;
+#ifdef DEBUG_LEGATE
+    log_coll.debug(
+      "AllgathervLocal i: %d === global_rank %d, dtype %d, copy rank %d (%p) count %d to rank %d "
+      "(%p)",
+      recvfrom_global_rank,
+      global_rank,
+      type_extent,
+      recvfrom_global_rank,
+      src,
+      recvcounts[recvfrom_global_rank],
+      global_rank,
+      dst);
+#endif
+    streamingCopy(dst, src, recvcounts[recvfrom_global_rank] * type_extent);
   }
 
   barrierLocal(global_comm);
@@ -294,6 +418,232 @@ int LocalNetwork::allgather(
   return CollSuccess;
 }
 
+int LocalNetwork::allreduce(const void* sendbuf,
+                            void* recvbuf,
+                            int count,
+                            CollDataType type,
+                            CollRedOp op,
+                            CollComm global_comm)
+{
+  int total_size  = global_comm->global_comm_size;
+  int global_rank = global_comm->global_rank;
+
+  int type_extent = getDtypeSize(type);
+
+  const void* sendbuf_tmp = sendbuf;
+
+  // MPI_IN_PLACE
+  if (sendbuf == recvbuf) { sendbuf_tmp = allocateInplaceBuffer(recvbuf, type_extent * count); }
+
+  global_comm->local_comm->buffers[global_rank] = sendbuf_tmp;
+  __sync_synchronize();
+
+  // every rank reduces all contributions into its own receive buffer
+  for (int recvfrom_global_rank = 0; recvfrom_global_rank < total_size; recvfrom_global_rank++) {
+    // wait for other threads to update the buffer address
+    while (global_comm->local_comm->buffers[recvfrom_global_rank] == nullptr)
+      ;
+    const void* src = global_comm->local_comm->buffers[recvfrom_global_rank];
+#ifdef DEBUG_LEGATE
+    log_coll.debug("AllreduceLocal i: %d === global_rank %d, dtype %d, reduce rank %d (%p)",
+                   recvfrom_global_rank,
+                   global_rank,
+                   type_extent,
+                   recvfrom_global_rank,
+                   src);
+#endif
+    if (recvfrom_global_rank == 0) {
+      memcpy(recvbuf, src, count * type_extent);
+    } else {
+      applyReduction(recvbuf, src, count, type, op);
+    }
+  }
+
+  barrierLocal(global_comm);
+  if (sendbuf == recvbuf) { free(const_cast<void*>(sendbuf_tmp)); }
+
+  __sync_synchronize();
+
+  resetLocalBuffer(global_comm);
+  barrierLocal(global_comm);
+
+  return CollSuccess;
+}
+
+int LocalNetwork::reduce_scatter(const void* sendbuf,
+                                 void* recvbuf,
+                                 int recvcount,
+                                 CollDataType type,
+                                 CollRedOp op,
+                                 CollComm global_comm)
+{
+  int total_size  = global_comm->global_comm_size;
+  int global_rank = global_comm->global_rank;
+
+  int type_extent = getDtypeSize(type);
+
+  // Should not see inplace here
+  if (sendbuf == recvbuf) { assert(0); }
+
+  global_comm->local_comm->buffers[global_rank] = sendbuf;
+  __sync_synchronize();
+
+  // every rank reduces only the chunk it owns from each contribution
+  ptrdiff_t offset = static_cast<ptrdiff_t>(global_rank) * type_extent * recvcount;
+  for (int recvfrom_global_rank = 0; recvfrom_global_rank < total_size; recvfrom_global_rank++) {
+    // wait for other threads to update the buffer address
+    while (global_comm->local_comm->buffers[recvfrom_global_rank] == nullptr)
+      ;
+    const char* src =
+      static_cast<const char*>(global_comm->local_comm->buffers[recvfrom_global_rank]) + offset;
+#ifdef DEBUG_LEGATE
+    log_coll.debug("ReduceScatterLocal i: %d === global_rank %d, dtype %d, reduce rank %d (%p)",
+                   recvfrom_global_rank,
+                   global_rank,
+                   type_extent,
+                   recvfrom_global_rank,
+                   src);
+#endif
+    if (recvfrom_global_rank == 0) {
+      memcpy(recvbuf, src, recvcount * type_extent);
+    } else {
+      applyReduction(recvbuf, src, recvcount, type, op);
+    }
+  }
+
+  barrierLocal(global_comm);
+  __sync_synchronize();
+
+  resetLocalBuffer(global_comm);
+  barrierLocal(global_comm);
+
+  return CollSuccess;
+}
+
+int LocalNetwork::bcast(void* buf, int count, CollDataType type, int root, CollComm global_comm)
+{
+  int global_rank = global_comm->global_rank;
+
+  int type_extent = getDtypeSize(type);
+
+  // only the root publishes its buffer; everyone else copies straight out of it
+  if (global_rank == root) {
+    global_comm->local_comm->buffers[root] = buf;
+    __sync_synchronize();
+  } else {
+    // wait for the root to update the buffer address
+    while (global_comm->local_comm->buffers[root] == nullptr)
+      ;
+    const void* src = global_comm->local_comm->buffers[root];
+#ifdef DEBUG_LEGATE
+    log_coll.debug("BcastLocal: global_rank %d, dtype %d, copy root %d (%p) to rank %d (%p)",
+                   global_rank,
+                   type_extent,
+                   root,
+                   src,
+                   global_rank,
+                   buf);
+#endif
+    streamingCopy(buf, src, count * type_extent);
+  }
+
+  barrierLocal(global_comm);
+  __sync_synchronize();
+
+  resetLocalBuffer(global_comm);
+  barrierLocal(global_comm);
+
+  return CollSuccess;
+}
+
+int LocalNetwork::gather(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, int root, CollComm global_comm)
+{
+  int total_size  = global_comm->global_comm_size;
+  int global_rank = global_comm->global_rank;
+
+  int type_extent = getDtypeSize(type);
+
+  // Should not see inplace here
+  if (sendbuf == recvbuf) { assert(0); }
+
+  global_comm->local_comm->buffers[global_rank] = sendbuf;
+  __sync_synchronize();
+
+  if (global_rank == root) {
+    for (int recvfrom_global_rank = 0; recvfrom_global_rank < total_size; recvfrom_global_rank++) {
+      // wait for other threads to update the buffer address
+      while (global_comm->local_comm->buffers[recvfrom_global_rank] == nullptr)
+        ;
+      const void* src = global_comm->local_comm->buffers[recvfrom_global_rank];
+      char* dst       = static_cast<char*>(recvbuf) +
+                  static_cast<ptrdiff_t>(recvfrom_global_rank) * type_extent * count;
+#ifdef DEBUG_LEGATE
+      log_coll.debug(
+        "GatherLocal i: %d === global_rank %d, dtype %d, copy rank %d (%p) to root %d (%p)",
+        recvfrom_global_rank,
+        global_rank,
+        type_extent,
+        recvfrom_global_rank,
+        src,
+        global_rank,
+        dst);
+#endif
+      streamingCopy(dst, src, count * type_extent);
+    }
+  }
+
+  barrierLocal(global_comm);
+  __sync_synchronize();
+
+  resetLocalBuffer(global_comm);
+  barrierLocal(global_comm);
+
+  return CollSuccess;
+}
+
+int LocalNetwork::scatter(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, int root, CollComm global_comm)
+{
+  int global_rank = global_comm->global_rank;
+
+  int type_extent = getDtypeSize(type);
+
+  // Should not see inplace here
+  if (sendbuf == recvbuf) { assert(0); }
+
+  // only the root publishes its buffer; every rank copies its own block out of it
+  if (global_rank == root) {
+    global_comm->local_comm->buffers[root] = sendbuf;
+    __sync_synchronize();
+  } else {
+    // wait for the root to update the buffer address
+    while (global_comm->local_comm->buffers[root] == nullptr)
+      ;
+  }
+
+  const char* src = static_cast<const char*>(global_comm->local_comm->buffers[root]) +
+                    static_cast<ptrdiff_t>(global_rank) * type_extent * count;
+#ifdef DEBUG_LEGATE
+  log_coll.debug("ScatterLocal: global_rank %d, dtype %d, copy root %d (%p) to rank %d (%p)",
+                 global_rank,
+                 type_extent,
+                 root,
+                 src,
+                 global_rank,
+                 recvbuf);
+#endif
+  streamingCopy(recvbuf, src, count * type_extent);
+
+  barrierLocal(global_comm);
+  __sync_synchronize();
+
+  resetLocalBuffer(global_comm);
+  barrierLocal(global_comm);
+
+  return CollSuccess;
+}
+
 // protected functions start from here
 
 size_t LocalNetwork::getDtypeSize(CollDataType dtype)
@@ -324,6 +674,15 @@ size_t LocalNetwork::getDtypeSize(CollDataType dtype)
     case CollDataType::CollDouble: {
       return sizeof(double);
     }
+    case CollDataType::CollHalf: {
+      return sizeof(uint16_t);
+    }
+    case CollDataType::CollComplexFloat: {
+      return 2 * sizeof(float);
+    }
+    case CollDataType::CollComplexDouble: {
+      return 2 * sizeof(double);
+    }
     default: {
       log_coll.fatal("Unknown datatype");
       LEGATE_ABORT;
@@ -332,6 +691,54 @@ size_t LocalNetwork::getDtypeSize(CollDataType dtype)
   }
 }
 
+void LocalNetwork::streamingCopy(void* dst, const void* src, size_t size)
+{
+#ifdef __SSE2__
+  static const size_t threshold = extract_env("LEGATE_COLL_STREAMING_THRESHOLD",
+                                              COLL_STREAMING_THRESHOLD_DEFAULT,
+                                              COLL_STREAMING_THRESHOLD_TEST);
+  // Non-temporal stores bypass the cache hierarchy, which only pays off for copies too large
+  // to stay resident anyway; they also require a 16-byte aligned destination
+  if (size >= threshold && threshold > 0 && (reinterpret_cast<uintptr_t>(dst) & 0xF) == 0) {
+    char* d           = static_cast<char*>(dst);
+    const char* s     = static_cast<const char*>(src);
+    size_t vec_size   = size & ~static_cast<size_t>(63);
+    for (size_t pos = 0; pos < vec_size; pos += 64) {
+      __m128i x0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + pos));
+      __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + pos + 16));
+      __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + pos + 32));
+      __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + pos + 48));
+      _mm_stream_si128(reinterpret_cast<__m128i*>(d + pos), x0);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(d + pos + 16), x1);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(d + pos + 32), x2);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(d + pos + 48), x3);
+    }
+    // Make the streaming stores visible before the post-copy barrier releases the peers
+    _mm_sfence();
+    if (vec_size < size) { memcpy(d + vec_size, s + vec_size, size - vec_size); }
+    return;
+  }
+#endif
+  memcpy(dst, src, size);
+}
+
+ThreadComm* LocalNetwork::popThreadComm(int global_comm_size)
+{
+  std::lock_guard<std::mutex> guard(comm_pool_mutex);
+  auto pool_entry = comm_pool.find(global_comm_size);
+  if (pool_entry == comm_pool.end() || pool_entry->second.empty()) { return nullptr; }
+  ThreadComm* thread_comm = pool_entry->second.back();
+  pool_entry->second.pop_back();
+  return thread_comm;
+}
+
+void LocalNetwork::pushThreadComm(int global_comm_size, ThreadComm* thread_comm)
+{
+  assert(!thread_comm->ready_flag);
+  std::lock_guard<std::mutex> guard(comm_pool_mutex);
+  comm_pool[global_comm_size].push_back(thread_comm);
+}
+
 void LocalNetwork::resetLocalBuffer(CollComm global_comm)
 {
   int global_rank                               = global_comm->global_rank;
@@ -342,7 +749,42 @@ void LocalNetwork::resetLocalBuffer(CollComm global_comm)
 void LocalNetwork::barrierLocal(CollComm global_comm)
 {
   assert(BackendNetwork::coll_inited == true);
-  pthread_barrier_wait(const_cast<pthread_barrier_t*>(&(global_comm->local_comm->barrier)));
+  if (global_comm->local_comm->use_spin_barrier) {
+    spinBarrier(global_comm);
+  } else {
+    pthread_barrier_wait(const_cast<pthread_barrier_t*>(&(global_comm->local_comm->barrier)));
+  }
+}
+
+void LocalNetwork::spinBarrier(CollComm global_comm)
+{
+  volatile ThreadComm* local_comm = global_comm->local_comm;
+
+  // Sense-reversing barrier: the last arriving rank resets the counter and flips the shared
+  // sense, releasing the ranks spinning on it
+  int sense                        = 1 - global_comm->barrier_local_sense;
+  global_comm->barrier_local_sense = sense;
+  if (__sync_add_and_fetch(const_cast<int*>(&local_comm->barrier_count), 1) ==
+      global_comm->global_comm_size) {
+    local_comm->barrier_count = 0;
+    __sync_synchronize();
+    local_comm->barrier_sense = sense;
+  } else {
+    // Spin briefly for the low-latency case, then yield so long waits (large payload copies
+    // still in flight on peer ranks) fall back to blocking-like behavior
+    constexpr int max_spins = 1024;
+    int spins               = 0;
+    while (local_comm->barrier_sense != sense) {
+      if (++spins < max_spins) {
+#ifdef __SSE2__
+        _mm_pause();
+#endif
+      } else {
+        sched_yield();
+      }
+    }
+    __sync_synchronize();
+  }
 }
 
 }  // namespace coll
@@ -15,31 +15,160 @@
  */
 
 #include <assert.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
 
 #include "coll.h"
+#include "env_defaults.h"
 #include "legate.h"
 #include "legion.h"
 
+#ifdef LEGATE_USE_CUDA
+#include <cuda_runtime_api.h>
+#include <mutex>
+#include "core/cuda/cuda_help.h"
+#endif
+
 namespace legate {
 namespace comm {
 namespace coll {
 
 extern Logger log_coll;
 
+#ifdef LEGATE_USE_CUDA
+
+namespace {
+
+// Reuse pool of pinned host buffers for staging device-resident payloads when the MPI stack
+// cannot take device pointers directly
+class PinnedBufferPool {
+ public:
+  void* acquire(size_t size)
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto& entry : entries_) {
+      if (!entry.in_use && entry.capacity >= size) {
+        entry.in_use = true;
+        return entry.ptr;
+      }
+    }
+    void* ptr = nullptr;
+    CHECK_CUDA(cudaMallocHost(&ptr, size));
+    entries_.push_back({ptr, size, true});
+    return ptr;
+  }
+
+  void release(void* ptr)
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto& entry : entries_) {
+      if (entry.ptr == ptr) {
+        entry.in_use = false;
+        return;
+      }
+    }
+    assert(false);
+  }
+
+ private:
+  struct Entry {
+    void* ptr;
+    size_t capacity;
+    bool in_use;
+  };
+  std::mutex lock_;
+  std::vector<Entry> entries_;
+};
+
+PinnedBufferPool& pinned_pool()
+{
+  static PinnedBufferPool pool{};
+  return pool;
+}
+
+bool is_device_ptr(const void* ptr)
+{
+  cudaPointerAttributes attrs;
+  cudaError_t res = cudaPointerGetAttributes(&attrs, ptr);
+  return res == cudaSuccess && attrs.type == cudaMemoryTypeDevice;
+}
+
+bool cuda_aware_mpi()
+{
+  static const bool aware =
+    extract_env("LEGATE_CUDA_AWARE_MPI", CUDA_AWARE_MPI_DEFAULT, CUDA_AWARE_MPI_TEST) != 0;
+  return aware;
+}
+
+}  // namespace
+
+#endif  // LEGATE_USE_CUDA
+
 enum CollTag : int {
-  BCAST_TAG     = 0,
-  GATHER_TAG    = 1,
-  ALLTOALL_TAG  = 2,
-  ALLTOALLV_TAG = 3,
-  MAX_TAG       = 10,
+  BCAST_TAG         = 0,
+  GATHER_TAG        = 1,
+  ALLTOALL_TAG      = 2,
+  ALLTOALLV_TAG     = 3,
+  ALLREDUCE_TAG     = 4,
+  REDUCESCATTER_TAG = 5,
+  SCATTER_TAG       = 6,
+  MAX_TAG           = 10,
 };
 
 static inline std::pair<int, int> mostFrequent(const int* arr, int n);
 static inline int match2ranks(int rank1, int rank2, CollComm global_comm);
 
+namespace {
+
+// Zero-run-length codec backing the opt-in compressed alltoallv: the stream is a sequence of
+// records [u8 literal_count][literals][u16 zero_run]. Returns the compressed size, or 0 when
+// the result would not fit in dst_capacity (i.e. the input does not compress).
+size_t zrle_compress(const char* src, size_t size, char* dst, size_t dst_capacity)
+{
+  size_t in = 0, out = 0;
+  while (in < size) {
+    size_t lit_start = in;
+    while (in < size && src[in] != 0 && in - lit_start < 255) { in++; }
+    size_t nlit = in - lit_start;
+    size_t run  = 0;
+    while (in < size && src[in] == 0 && run < 65535) {
+      in++;
+      run++;
+    }
+    if (out + 3 + nlit > dst_capacity) return 0;
+    dst[out++] = static_cast<char>(nlit);
+    memcpy(dst + out, src + lit_start, nlit);
+    out += nlit;
+    dst[out++] = static_cast<char>(run & 0xFF);
+    dst[out++] = static_cast<char>((run >> 8) & 0xFF);
+  }
+  return out;
+}
+
+size_t zrle_decompress(const char* src, size_t size, char* dst, size_t dst_capacity)
+{
+  size_t in = 0, out = 0;
+  while (in < size) {
+    size_t nlit = static_cast<unsigned char>(src[in++]);
+    assert(in + nlit + 2 <= size && out + nlit <= dst_capacity);
+    memcpy(dst + out, src + in, nlit);
+    in += nlit;
+    out += nlit;
+    size_t run = static_cast<size_t>(static_cast<unsigned char>(src[in])) |
+                 (static_cast<size_t>(static_cast<unsigned char>(src[in + 1])) << 8);
+    in += 2;
+    assert(out + run <= dst_capacity);
+    memset(dst + out, 0, run);
+    out += run;
+  }
+  return out;
+}
+
+}  // namespace
+
 inline void check_mpi(int error, const char* file, int line)
 {
   if (error != MPI_SUCCESS) {
@@ -87,6 +216,39 @@ MPINetwork::MPINetwork(int argc, char* argv[])
   assert(flag);
   mpi_tag_ub = *tag_ub;
   assert(mpi_comms.empty());
+  // Topology discovery: record which node every MPI rank lives on, so comm_create can bias
+  // exchange schedules toward node-local pairs (on multi-rail clusters cross-switch congestion
+  // bites well before a NIC saturates)
+  const bool topology_aware =
+    extract_env(
+      "LEGATE_COLL_TOPOLOGY_AWARE", COLL_TOPOLOGY_AWARE_DEFAULT, COLL_TOPOLOGY_AWARE_TEST) != 0;
+  if (topology_aware) {
+    int world_size, name_len;
+    char name[MPI_MAX_PROCESSOR_NAME];
+    memset(name, 0, sizeof(name));
+    CHECK_MPI(MPI_Get_processor_name(name, &name_len));
+    CHECK_MPI(MPI_Comm_size(MPI_COMM_WORLD, &world_size));
+    std::vector<char> all_names(static_cast<size_t>(world_size) * MPI_MAX_PROCESSOR_NAME);
+    CHECK_MPI(MPI_Allgather(name,
+                            MPI_MAX_PROCESSOR_NAME,
+                            MPI_CHAR,
+                            all_names.data(),
+                            MPI_MAX_PROCESSOR_NAME,
+                            MPI_CHAR,
+                            MPI_COMM_WORLD));
+    node_ids.resize(world_size);
+    for (int i = 0; i < world_size; i++) {
+      node_ids[i] = i;
+      for (int j = 0; j < i; j++) {
+        if (strncmp(&all_names[static_cast<size_t>(i) * MPI_MAX_PROCESSOR_NAME],
+                    &all_names[static_cast<size_t>(j) * MPI_MAX_PROCESSOR_NAME],
+                    MPI_MAX_PROCESSOR_NAME) == 0) {
+          node_ids[i] = node_ids[j];
+          break;
+        }
+      }
+    }
+  }
   BackendNetwork::coll_inited = true;
   BackendNetwork::comm_type   = CollCommType::CollMPI;
 }
@@ -95,8 +257,19 @@ MPINetwork::~MPINetwork()
 {
   log_coll.debug("Finalize MPINetwork");
   assert(BackendNetwork::coll_inited == true);
+  for (PersistentSchedule* schedule : persistent_schedules) {
+    assert(!schedule->in_use);
+    for (MPI_Request& request : schedule->requests) { CHECK_MPI(MPI_Request_free(&request)); }
+    delete schedule;
+  }
+  persistent_schedules.clear();
   for (MPI_Comm& mpi_comm : mpi_comms) { CHECK_MPI(MPI_Comm_free(&mpi_comm)); }
   mpi_comms.clear();
+  for (ThreadComm* thread_comm : thread_comms) {
+    assert(!thread_comm->ready_flag);
+    free(thread_comm);
+  }
+  thread_comms.clear();
   int fina_flag = 0;
   CHECK_MPI(MPI_Finalized(&fina_flag));
   if (fina_flag == 1) {
@@ -126,6 +299,16 @@ int MPINetwork::init_comm()
   MPI_Comm mpi_comm;
   CHECK_MPI(MPI_Comm_dup(MPI_COMM_WORLD, &mpi_comm));
   mpi_comms.push_back(mpi_comm);
+  // create the thread comm backing the same-process fast path
+  assert(thread_comms.size() == id);
+  ThreadComm* thread_comm       = (ThreadComm*)malloc(sizeof(ThreadComm));
+  thread_comm->ready_flag       = false;
+  thread_comm->buffers          = nullptr;
+  thread_comm->displs           = nullptr;
+  thread_comm->use_spin_barrier = false;
+  thread_comm->barrier_count    = 0;
+  thread_comm->barrier_sense    = 0;
+  thread_comms.push_back(thread_comm);
   log_coll.debug("Init comm id %d", id);
   return id;
 }
@@ -160,11 +343,103 @@ int MPINetwork::comm_create(CollComm global_comm,
   std::pair<int, int> p             = mostFrequent(mapping_table, global_comm_size);
   global_comm->nb_threads           = p.first;
   global_comm->mpi_comm_size_actual = p.second;
+
+  // Topology-aware peer ordering: visit the offsets whose pairwise exchanges are mostly
+  // node-local first, so intra-node traffic drains while the send queues are still empty and the
+  // cross-switch exchanges are left to overlap each other. The schedule only permutes the offset
+  // sequence and every rank derives the same permutation, which keeps the pairwise send/recv
+  // matching (and the alltoallv window flushes) aligned across ranks.
+  global_comm->offset_schedule = nullptr;
+  if (!node_ids.empty() && global_comm_size > 2) {
+    std::vector<int> scores(global_comm_size, 0);
+    int min_score = global_comm_size, max_score = 0;
+    for (int offset = 1; offset < global_comm_size; offset++) {
+      for (int r = 0; r < global_comm_size; r++) {
+        const int peer = (r + offset) % global_comm_size;
+        if (node_ids[mapping_table[r]] == node_ids[mapping_table[peer]]) { scores[offset]++; }
+      }
+      min_score = std::min(min_score, scores[offset]);
+      max_score = std::max(max_score, scores[offset]);
+    }
+    // a uniform score (single node, or perfectly interleaved ranks) makes reordering a no-op
+    if (max_score > min_score) {
+      global_comm->offset_schedule = (int*)malloc(sizeof(int) * (global_comm_size - 1));
+      for (int offset = 1; offset < global_comm_size; offset++) {
+        global_comm->offset_schedule[offset - 1] = offset;
+      }
+      std::stable_sort(global_comm->offset_schedule,
+                       global_comm->offset_schedule + global_comm_size - 1,
+                       [&scores](int lhs, int rhs) { return scores[lhs] > scores[rhs]; });
+    }
+  }
+
+  // Every rank reads the same environment, so this amounts to a per-communicator negotiation:
+  // either all peers frame their alltoallv segments or none do
+  static const bool compression =
+    extract_env("LEGATE_COLL_COMPRESSION", COLL_COMPRESSION_DEFAULT, COLL_COMPRESSION_TEST) != 0;
+  global_comm->compression_enabled = compression;
+
+  // Wire up the shared pointer table for ranks co-located in this process, so alltoall(v) can
+  // move their segments by direct copy. The first co-located rank initializes the table, like
+  // rank 0 does in LocalNetwork::comm_create.
+  global_comm->local_comm          = nullptr;
+  global_comm->barrier_local_sense = 0;
+  int local_size                   = 0;
+  int local_leader                 = -1;
+  for (int i = 0; i < global_comm_size; i++) {
+    if (mapping_table[i] == mpi_rank) {
+      if (local_leader < 0) { local_leader = i; }
+      local_size++;
+    }
+  }
+  if (local_size > 1) {
+    if (global_rank == local_leader) {
+      pthread_barrier_init(
+        (pthread_barrier_t*)&(thread_comms[unique_id]->barrier), nullptr, local_size);
+      thread_comms[unique_id]->buffers = (const void**)malloc(sizeof(void*) * global_comm_size);
+      thread_comms[unique_id]->displs  = (const int**)malloc(sizeof(int*) * global_comm_size);
+      for (int i = 0; i < global_comm_size; i++) {
+        thread_comms[unique_id]->buffers[i] = nullptr;
+        thread_comms[unique_id]->displs[i]  = nullptr;
+      }
+      __sync_synchronize();
+      thread_comms[unique_id]->ready_flag = true;
+    }
+    __sync_synchronize();
+    volatile ThreadComm* data = thread_comms[unique_id];
+    while (data->ready_flag != true) { data = thread_comms[unique_id]; }
+    global_comm->local_comm = thread_comms[unique_id];
+    barrierLocal(global_comm);
+  }
   return CollSuccess;
 }
 
 int MPINetwork::comm_destroy(CollComm global_comm)
 {
+  if (global_comm->local_comm != nullptr) {
+    int local_leader = -1;
+    for (int i = 0; i < global_comm->global_comm_size; i++) {
+      if (global_comm->mapping_table.mpi_rank[i] == global_comm->mpi_rank) {
+        local_leader = i;
+        break;
+      }
+    }
+    barrierLocal(global_comm);
+    if (global_comm->global_rank == local_leader) {
+      pthread_barrier_destroy(
+        (pthread_barrier_t*)&(thread_comms[global_comm->unique_id]->barrier));
+      free(thread_comms[global_comm->unique_id]->buffers);
+      thread_comms[global_comm->unique_id]->buffers = nullptr;
+      free(thread_comms[global_comm->unique_id]->displs);
+      thread_comms[global_comm->unique_id]->displs = nullptr;
+      __sync_synchronize();
+      thread_comms[global_comm->unique_id]->ready_flag = false;
+    }
+    __sync_synchronize();
+    volatile ThreadComm* data = thread_comms[global_comm->unique_id];
+    while (data->ready_flag != false) { data = thread_comms[global_comm->unique_id]; }
+    global_comm->local_comm = nullptr;
+  }
   if (global_comm->mapping_table.global_rank != nullptr) {
     free(global_comm->mapping_table.global_rank);
     global_comm->mapping_table.global_rank = nullptr;
@@ -173,6 +448,10 @@ int MPINetwork::comm_destroy(CollComm global_comm)
     free(global_comm->mapping_table.mpi_rank);
     global_comm->mapping_table.mpi_rank = nullptr;
   }
+  if (global_comm->offset_schedule != nullptr) {
+    free(global_comm->offset_schedule);
+    global_comm->offset_schedule = nullptr;
+  }
   global_comm->status = false;
   return CollSuccess;
 }
@@ -186,8 +465,6 @@ int MPINetwork::alltoallv(const void* sendbuf,
                           CollDataType type,
                           CollComm global_comm)
 {
-  MPI_Status status;
-
   int total_size  = global_comm->global_comm_size;
   int global_rank = global_comm->global_rank;
 
@@ -196,10 +473,93 @@ int MPINetwork::alltoallv(const void* sendbuf,
   MPI_Aint lb, type_extent;
   MPI_Type_get_extent(mpi_type, &lb, &type_extent);
 
+  // Post nonblocking send/recv pairs in windows, so up to window_size exchanges overlap instead
+  // of each ring step serializing on its slowest peer. The peer order and the tags are the same
+  // as in the blocking version. Large per-peer payloads are further split into segments of at
+  // most max_segment bytes, all in flight at once, so the wire transfer of early segments
+  // overlaps the displacement walk and the posting of the rest. Both ends derive the same
+  // segment count from the matching sendcounts/recvcounts entries, so the per-pair message
+  // sequence still lines up.
+  static const int window_size = static_cast<int>(
+    extract_env("LEGATE_COLL_WINDOW_SIZE", COLL_WINDOW_SIZE_DEFAULT, COLL_WINDOW_SIZE_TEST));
+  static const size_t max_segment =
+    extract_env("LEGATE_COLL_MAX_SEGMENT", COLL_MAX_SEGMENT_DEFAULT, COLL_MAX_SEGMENT_TEST);
+  const int seg_elems =
+    std::max(1, static_cast<int>(max_segment / static_cast<size_t>(type_extent)));
+  std::vector<MPI_Request> requests;
+  requests.reserve(2 * window_size);
+
+  bool device_buffers = false;
+#ifdef LEGATE_USE_CUDA
+  device_buffers = is_device_ptr(sendbuf) || is_device_ptr(recvbuf);
+  if (device_buffers && !cuda_aware_mpi()) {
+    // Stage through pinned host buffers when the MPI stack cannot take device pointers
+    size_t send_elems = 0, recv_elems = 0;
+    for (int i = 0; i < total_size; i++) {
+      send_elems = std::max(send_elems, static_cast<size_t>(sdispls[i]) + sendcounts[i]);
+      recv_elems = std::max(recv_elems, static_cast<size_t>(rdispls[i]) + recvcounts[i]);
+    }
+    void* host_send = pinned_pool().acquire(send_elems * type_extent);
+    void* host_recv = pinned_pool().acquire(recv_elems * type_extent);
+    CHECK_CUDA(cudaMemcpy(host_send, sendbuf, send_elems * type_extent, cudaMemcpyDefault));
+    int res =
+      alltoallv(host_send, sendcounts, sdispls, host_recv, recvcounts, rdispls, type, global_comm);
+    CHECK_CUDA(cudaMemcpy(recvbuf, host_recv, recv_elems * type_extent, cudaMemcpyDefault));
+    pinned_pool().release(host_send);
+    pinned_pool().release(host_recv);
+    return res;
+  }
+#endif
+
+  if (global_comm->compression_enabled && !device_buffers) {
+    return alltoallvCompressed(
+      sendbuf, sendcounts, sdispls, recvbuf, recvcounts, rdispls, type, global_comm);
+  }
+
+  // Metadata shuffles with tens-of-byte blocks are latency-bound: P point-to-point messages,
+  // each paying full per-message latency. Blocks that fit the configured slot are packed into a
+  // fixed-slot buffer and moved with the log(P) Bruck schedule instead; the slot size is a
+  // static knob, so every rank takes the aggregated path together without negotiating, and both
+  // endpoints of a pair see the same count and agree on which path its block takes. The
+  // pack/unpack copies assume host memory, so device-resident payloads stay pairwise.
+  static const int agg_threshold = static_cast<int>(extract_env("LEGATE_ALLTOALLV_AGG_THRESHOLD",
+                                                                ALLTOALLV_AGG_THRESHOLD_DEFAULT,
+                                                                ALLTOALLV_AGG_THRESHOLD_TEST));
+  if (agg_threshold > 0 && !device_buffers && total_size >= 8) {
+    const int slot_elems = std::max(1, agg_threshold / static_cast<int>(type_extent));
+    return alltoallvAggregated(
+      sendbuf, sendcounts, sdispls, recvbuf, recvcounts, rdispls, type, global_comm, slot_elems);
+  }
+
+  // Iterative solvers repeat the exact same exchange every timestep; the persistent path caches
+  // the posting schedule as persistent MPI requests and only re-arms it on repeats. Ranks that
+  // share their process with others stay on the plain path below, which moves co-located
+  // segments through the shared pointer table; both paths produce identical wire messages for
+  // remote peers, so they interoperate.
+  static const bool persistent_enabled =
+    extract_env("LEGATE_COLL_PERSISTENT", COLL_PERSISTENT_DEFAULT, COLL_PERSISTENT_TEST) != 0;
+  if (persistent_enabled && !device_buffers && global_comm->local_comm == nullptr) {
+    return alltoallvPersistent(
+      sendbuf, sendcounts, sdispls, recvbuf, recvcounts, rdispls, type, global_comm);
+  }
+
+  // Ranks co-located in this process exchange their segments through the shared pointer table
+  // instead of self-directed MPI messages; device-resident payloads stay on the MPI path, which
+  // a CUDA-aware stack handles directly
+  const bool use_local = global_comm->local_comm != nullptr && !device_buffers;
+  if (use_local) {
+    global_comm->local_comm->displs[global_rank]  = sdispls;
+    global_comm->local_comm->buffers[global_rank] = sendbuf;
+    __sync_synchronize();
+  }
+
+  const int* schedule = global_comm->offset_schedule;
   int sendto_global_rank, recvfrom_global_rank, sendto_mpi_rank, recvfrom_mpi_rank;
   for (int i = 1; i < total_size + 1; i++) {
-    sendto_global_rank   = (global_rank + i) % total_size;
-    recvfrom_global_rank = (global_rank + total_size - i) % total_size;
+    // the self exchange (offset total_size) always comes last; only peer offsets are reordered
+    const int offset     = (schedule != nullptr && i < total_size) ? schedule[i - 1] : i;
+    sendto_global_rank   = (global_rank + offset) % total_size;
+    recvfrom_global_rank = (global_rank + total_size - offset) % total_size;
     char* src            = static_cast<char*>(const_cast<void*>(sendbuf)) +
                 static_cast<ptrdiff_t>(sdispls[sendto_global_rank]) * type_extent;
     char* dst = static_cast<char*>(recvbuf) +
@@ -228,18 +588,502 @@ int MPINetwork::alltoallv(const void* sendbuf,
       recvfrom_mpi_rank,
       recv_tag);
 #endif
-    CHECK_MPI(MPI_Sendrecv(src,
-                           scount,
-                           mpi_type,
-                           sendto_mpi_rank,
-                           send_tag,
-                           dst,
-                           rcount,
-                           mpi_type,
-                           recvfrom_mpi_rank,
-                           recv_tag,
-                           global_comm->mpi_comm,
-                           &status));
+    if (use_local && isLocalRank(global_comm, recvfrom_global_rank)) {
+      // wait for the co-located rank to publish its buffer and displacements
+      while (global_comm->local_comm->buffers[recvfrom_global_rank] == nullptr ||
+             global_comm->local_comm->displs[recvfrom_global_rank] == nullptr)
+        ;
+      const char* peer_base =
+        static_cast<const char*>(global_comm->local_comm->buffers[recvfrom_global_rank]);
+      const int* peer_displs = global_comm->local_comm->displs[recvfrom_global_rank];
+      memcpy(dst,
+             peer_base + static_cast<ptrdiff_t>(peer_displs[global_rank]) * type_extent,
+             static_cast<size_t>(rcount) * type_extent);
+    } else {
+      int nrecv_segs = std::max(1, (rcount + seg_elems - 1) / seg_elems);
+      for (int s = 0; s < nrecv_segs; s++) {
+        int offset = s * seg_elems;
+        int len    = std::min(seg_elems, rcount - offset);
+        MPI_Request recv_req;
+        CHECK_MPI(MPI_Irecv(dst + static_cast<ptrdiff_t>(offset) * type_extent,
+                            len,
+                            mpi_type,
+                            recvfrom_mpi_rank,
+                            recv_tag,
+                            global_comm->mpi_comm,
+                            &recv_req));
+        requests.push_back(recv_req);
+      }
+    }
+    if (!(use_local && isLocalRank(global_comm, sendto_global_rank))) {
+      int nsend_segs = std::max(1, (scount + seg_elems - 1) / seg_elems);
+      for (int s = 0; s < nsend_segs; s++) {
+        int offset = s * seg_elems;
+        int len    = std::min(seg_elems, scount - offset);
+        MPI_Request send_req;
+        CHECK_MPI(MPI_Isend(src + static_cast<ptrdiff_t>(offset) * type_extent,
+                            len,
+                            mpi_type,
+                            sendto_mpi_rank,
+                            send_tag,
+                            global_comm->mpi_comm,
+                            &send_req));
+        requests.push_back(send_req);
+      }
+    }
+    // Flush at fixed peer rounds so every rank drains at the same point in the schedule,
+    // regardless of how many segments each pair produced
+    if (i % window_size == 0 && !requests.empty()) {
+      CHECK_MPI(MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE));
+      requests.clear();
+    }
+  }
+  if (!requests.empty())
+    CHECK_MPI(MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE));
+
+  if (use_local) {
+    barrierLocal(global_comm);
+    __sync_synchronize();
+    resetLocalBuffer(global_comm);
+    barrierLocal(global_comm);
+  }
+
+  return CollSuccess;
+}
+
+int MPINetwork::alltoallvCompressed(const void* sendbuf,
+                                    const int sendcounts[],
+                                    const int sdispls[],
+                                    void* recvbuf,
+                                    const int recvcounts[],
+                                    const int rdispls[],
+                                    CollDataType type,
+                                    CollComm global_comm)
+{
+  MPI_Status status;
+
+  int total_size  = global_comm->global_comm_size;
+  int global_rank = global_comm->global_rank;
+
+  MPI_Datatype mpi_type = dtypeToMPIDtype(type);
+
+  MPI_Aint lb, type_extent;
+  MPI_Type_get_extent(mpi_type, &lb, &type_extent);
+
+  static const size_t threshold = extract_env("LEGATE_COLL_COMPRESSION_THRESHOLD",
+                                              COLL_COMPRESSION_THRESHOLD_DEFAULT,
+                                              COLL_COMPRESSION_THRESHOLD_TEST);
+
+  const bool use_local = global_comm->local_comm != nullptr;
+  if (use_local) {
+    global_comm->local_comm->displs[global_rank]  = sdispls;
+    global_comm->local_comm->buffers[global_rank] = sendbuf;
+    __sync_synchronize();
+  }
+
+  // Each wire message is framed as [u64 raw_bytes][u64 payload_bytes][payload]; payload_bytes
+  // equal to raw_bytes marks a segment that was below the threshold or did not compress
+  constexpr size_t header_bytes = 2 * sizeof(uint64_t);
+  std::vector<char> send_frame;
+  std::vector<char> recv_frame;
+
+  const int* schedule = global_comm->offset_schedule;
+  for (int i = 1; i < total_size + 1; i++) {
+    // the self exchange (offset total_size) always comes last; only peer offsets are reordered
+    const int offset         = (schedule != nullptr && i < total_size) ? schedule[i - 1] : i;
+    int sendto_global_rank   = (global_rank + offset) % total_size;
+    int recvfrom_global_rank = (global_rank + total_size - offset) % total_size;
+    const char* src          = static_cast<const char*>(sendbuf) +
+                      static_cast<ptrdiff_t>(sdispls[sendto_global_rank]) * type_extent;
+    char* dst = static_cast<char*>(recvbuf) +
+                static_cast<ptrdiff_t>(rdispls[recvfrom_global_rank]) * type_extent;
+    size_t sbytes         = static_cast<size_t>(sendcounts[sendto_global_rank]) * type_extent;
+    size_t rbytes         = static_cast<size_t>(recvcounts[recvfrom_global_rank]) * type_extent;
+    int sendto_mpi_rank   = global_comm->mapping_table.mpi_rank[sendto_global_rank];
+    int recvfrom_mpi_rank = global_comm->mapping_table.mpi_rank[recvfrom_global_rank];
+    assert(sendto_global_rank == global_comm->mapping_table.global_rank[sendto_global_rank]);
+    assert(recvfrom_global_rank == global_comm->mapping_table.global_rank[recvfrom_global_rank]);
+    int send_tag = generateAlltoallvTag(sendto_global_rank, global_rank, global_comm);
+    int recv_tag = generateAlltoallvTag(global_rank, recvfrom_global_rank, global_comm);
+
+    bool local_recv = use_local && isLocalRank(global_comm, recvfrom_global_rank);
+    bool local_send = use_local && isLocalRank(global_comm, sendto_global_rank);
+    if (local_recv) {
+      // wait for the co-located rank to publish its buffer and displacements
+      while (global_comm->local_comm->buffers[recvfrom_global_rank] == nullptr ||
+             global_comm->local_comm->displs[recvfrom_global_rank] == nullptr)
+        ;
+      const char* peer_base =
+        static_cast<const char*>(global_comm->local_comm->buffers[recvfrom_global_rank]);
+      const int* peer_displs = global_comm->local_comm->displs[recvfrom_global_rank];
+      memcpy(dst, peer_base + static_cast<ptrdiff_t>(peer_displs[global_rank]) * type_extent, rbytes);
+    }
+
+    size_t send_bytes = 0;
+    if (!local_send) {
+      send_frame.resize(header_bytes + sbytes);
+      uint64_t raw     = sbytes;
+      uint64_t payload = 0;
+      size_t compressed =
+        sbytes >= threshold ? zrle_compress(src, sbytes, send_frame.data() + header_bytes, sbytes)
+                            : 0;
+      if (compressed > 0 && compressed < sbytes) {
+        payload = compressed;
+      } else {
+        payload = raw;
+        memcpy(send_frame.data() + header_bytes, src, sbytes);
+      }
+      memcpy(send_frame.data(), &raw, sizeof(raw));
+      memcpy(send_frame.data() + sizeof(raw), &payload, sizeof(payload));
+      send_bytes = header_bytes + payload;
+    }
+    if (!local_recv) { recv_frame.resize(header_bytes + rbytes); }
+
+    if (!local_send && !local_recv) {
+      CHECK_MPI(MPI_Sendrecv(send_frame.data(),
+                             static_cast<int>(send_bytes),
+                             MPI_BYTE,
+                             sendto_mpi_rank,
+                             send_tag,
+                             recv_frame.data(),
+                             static_cast<int>(header_bytes + rbytes),
+                             MPI_BYTE,
+                             recvfrom_mpi_rank,
+                             recv_tag,
+                             global_comm->mpi_comm,
+                             &status));
+    } else if (!local_send) {
+      CHECK_MPI(MPI_Send(send_frame.data(),
+                         static_cast<int>(send_bytes),
+                         MPI_BYTE,
+                         sendto_mpi_rank,
+                         send_tag,
+                         global_comm->mpi_comm));
+    } else if (!local_recv) {
+      CHECK_MPI(MPI_Recv(recv_frame.data(),
+                         static_cast<int>(header_bytes + rbytes),
+                         MPI_BYTE,
+                         recvfrom_mpi_rank,
+                         recv_tag,
+                         global_comm->mpi_comm,
+                         &status));
+    }
+
+    if (!local_recv) {
+      uint64_t raw, payload;
+      memcpy(&raw, recv_frame.data(), sizeof(raw));
+      memcpy(&payload, recv_frame.data() + sizeof(raw), sizeof(payload));
+      assert(raw == rbytes);
+      if (payload == raw) {
+        memcpy(dst, recv_frame.data() + header_bytes, raw);
+      } else {
+        size_t decompressed = zrle_decompress(recv_frame.data() + header_bytes, payload, dst, raw);
+        assert(decompressed == raw);
+        static_cast<void>(decompressed);
+      }
+    }
+  }
+
+  if (use_local) {
+    barrierLocal(global_comm);
+    __sync_synchronize();
+    resetLocalBuffer(global_comm);
+    barrierLocal(global_comm);
+  }
+
+  return CollSuccess;
+}
+
+int MPINetwork::alltoallvAggregated(const void* sendbuf,
+                                    const int sendcounts[],
+                                    const int sdispls[],
+                                    void* recvbuf,
+                                    const int recvcounts[],
+                                    const int rdispls[],
+                                    CollDataType type,
+                                    CollComm global_comm,
+                                    int slot_elems)
+{
+  int total_size  = global_comm->global_comm_size;
+  int global_rank = global_comm->global_rank;
+
+  MPI_Datatype mpi_type = dtypeToMPIDtype(type);
+
+  MPI_Aint lb, type_extent;
+  MPI_Type_get_extent(mpi_type, &lb, &type_extent);
+  ptrdiff_t slot = type_extent * static_cast<ptrdiff_t>(slot_elems);
+
+  const char* send = static_cast<const char*>(sendbuf);
+  char* recv       = static_cast<char*>(recvbuf);
+
+  // Pack every block that fits its slot; slots of oversized blocks travel as padding and are
+  // ignored on receive. The receiver knows each peer's count from recvcounts, so no per-slot
+  // header is needed.
+  std::vector<char> packed_send(static_cast<size_t>(slot) * total_size);
+  std::vector<char> packed_recv(static_cast<size_t>(slot) * total_size);
+  for (int i = 0; i < total_size; i++) {
+    if (sendcounts[i] <= slot_elems) {
+      memcpy(packed_send.data() + static_cast<ptrdiff_t>(i) * slot,
+             send + static_cast<ptrdiff_t>(sdispls[i]) * type_extent,
+             static_cast<size_t>(sendcounts[i]) * type_extent);
+    }
+  }
+
+  alltoallBruck(packed_send.data(), packed_recv.data(), slot_elems, type, global_comm);
+
+  for (int i = 0; i < total_size; i++) {
+    if (recvcounts[i] <= slot_elems) {
+      memcpy(recv + static_cast<ptrdiff_t>(rdispls[i]) * type_extent,
+             packed_recv.data() + static_cast<ptrdiff_t>(i) * slot,
+             static_cast<size_t>(recvcounts[i]) * type_extent);
+    }
+  }
+
+  // Oversized blocks keep the point-to-point path. Both endpoints of a pair see the same count
+  // (the sender in sendcounts, the receiver in recvcounts), so they agree on which blocks take
+  // it. These are the exception in a latency-bound exchange, so no segmentation here.
+  static const int window_size = static_cast<int>(
+    extract_env("LEGATE_COLL_WINDOW_SIZE", COLL_WINDOW_SIZE_DEFAULT, COLL_WINDOW_SIZE_TEST));
+  std::vector<MPI_Request> requests;
+  for (int i = 1; i < total_size; i++) {
+    int sendto_global_rank   = (global_rank + i) % total_size;
+    int recvfrom_global_rank = (global_rank + total_size - i) % total_size;
+    assert(sendto_global_rank == global_comm->mapping_table.global_rank[sendto_global_rank]);
+    assert(recvfrom_global_rank == global_comm->mapping_table.global_rank[recvfrom_global_rank]);
+    if (recvcounts[recvfrom_global_rank] > slot_elems) {
+      int recvfrom_mpi_rank = global_comm->mapping_table.mpi_rank[recvfrom_global_rank];
+      int recv_tag          = generateAlltoallvTag(global_rank, recvfrom_global_rank, global_comm);
+#ifdef DEBUG_LEGATE
+      log_coll.debug("AlltoallvAggMPI: global_rank %d, oversized recv %d from %d (%d), tag %d",
+                     global_rank,
+                     recvcounts[recvfrom_global_rank],
+                     recvfrom_global_rank,
+                     recvfrom_mpi_rank,
+                     recv_tag);
+#endif
+      MPI_Request recv_req;
+      CHECK_MPI(
+        MPI_Irecv(recv + static_cast<ptrdiff_t>(rdispls[recvfrom_global_rank]) * type_extent,
+                  recvcounts[recvfrom_global_rank],
+                  mpi_type,
+                  recvfrom_mpi_rank,
+                  recv_tag,
+                  global_comm->mpi_comm,
+                  &recv_req));
+      requests.push_back(recv_req);
+    }
+    if (sendcounts[sendto_global_rank] > slot_elems) {
+      int sendto_mpi_rank = global_comm->mapping_table.mpi_rank[sendto_global_rank];
+      int send_tag        = generateAlltoallvTag(sendto_global_rank, global_rank, global_comm);
+#ifdef DEBUG_LEGATE
+      log_coll.debug("AlltoallvAggMPI: global_rank %d, oversized send %d to %d (%d), tag %d",
+                     global_rank,
+                     sendcounts[sendto_global_rank],
+                     sendto_global_rank,
+                     sendto_mpi_rank,
+                     send_tag);
+#endif
+      MPI_Request send_req;
+      CHECK_MPI(
+        MPI_Isend(send + static_cast<ptrdiff_t>(sdispls[sendto_global_rank]) * type_extent,
+                  sendcounts[sendto_global_rank],
+                  mpi_type,
+                  sendto_mpi_rank,
+                  send_tag,
+                  global_comm->mpi_comm,
+                  &send_req));
+      requests.push_back(send_req);
+    }
+    if (i % window_size == 0 && !requests.empty()) {
+      CHECK_MPI(MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE));
+      requests.clear();
+    }
+  }
+  // the self block bypasses the wire entirely when oversized
+  if (recvcounts[global_rank] > slot_elems) {
+    memcpy(recv + static_cast<ptrdiff_t>(rdispls[global_rank]) * type_extent,
+           send + static_cast<ptrdiff_t>(sdispls[global_rank]) * type_extent,
+           static_cast<size_t>(recvcounts[global_rank]) * type_extent);
+  }
+  if (!requests.empty())
+    CHECK_MPI(MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE));
+
+  return CollSuccess;
+}
+
+MPINetwork::PersistentSchedule* MPINetwork::findOrCreateSchedule(const void* sendbuf,
+                                                                 const int sendcounts[],
+                                                                 const int sdispls[],
+                                                                 void* recvbuf,
+                                                                 const int recvcounts[],
+                                                                 const int rdispls[],
+                                                                 CollDataType type,
+                                                                 CollComm global_comm,
+                                                                 bool* created)
+{
+  constexpr size_t max_schedules = 16;
+
+  int total_size  = global_comm->global_comm_size;
+  int global_rank = global_comm->global_rank;
+
+  std::lock_guard<std::mutex> guard(persistent_mutex);
+
+  for (PersistentSchedule* schedule : persistent_schedules) {
+    if (schedule->unique_id == global_comm->unique_id && schedule->global_rank == global_rank &&
+        schedule->sendbuf == sendbuf && schedule->recvbuf == recvbuf && schedule->type == type &&
+        static_cast<int>(schedule->sendcounts.size()) == total_size &&
+        std::equal(schedule->sendcounts.begin(), schedule->sendcounts.end(), sendcounts) &&
+        std::equal(schedule->sdispls.begin(), schedule->sdispls.end(), sdispls) &&
+        std::equal(schedule->recvcounts.begin(), schedule->recvcounts.end(), recvcounts) &&
+        std::equal(schedule->rdispls.begin(), schedule->rdispls.end(), rdispls)) {
+      assert(!schedule->in_use);
+      schedule->last_used = ++persistent_clock;
+      schedule->in_use    = true;
+      *created            = false;
+      return schedule;
+    }
+  }
+
+  // evict the least recently used idle entry once the cache is full
+  while (persistent_schedules.size() >= max_schedules) {
+    auto victim = persistent_schedules.end();
+    for (auto it = persistent_schedules.begin(); it != persistent_schedules.end(); ++it) {
+      if ((*it)->in_use) continue;
+      if (victim == persistent_schedules.end() || (*it)->last_used < (*victim)->last_used)
+        victim = it;
+    }
+    if (victim == persistent_schedules.end()) break;
+    for (MPI_Request& request : (*victim)->requests) { CHECK_MPI(MPI_Request_free(&request)); }
+    delete *victim;
+    persistent_schedules.erase(victim);
+  }
+
+  PersistentSchedule* schedule = new PersistentSchedule();
+  schedule->unique_id          = global_comm->unique_id;
+  schedule->global_rank        = global_rank;
+  schedule->sendbuf            = sendbuf;
+  schedule->recvbuf            = recvbuf;
+  schedule->type               = type;
+  schedule->sendcounts.assign(sendcounts, sendcounts + total_size);
+  schedule->sdispls.assign(sdispls, sdispls + total_size);
+  schedule->recvcounts.assign(recvcounts, recvcounts + total_size);
+  schedule->rdispls.assign(rdispls, rdispls + total_size);
+  schedule->last_used = ++persistent_clock;
+  schedule->in_use    = true;
+  persistent_schedules.push_back(schedule);
+  *created = true;
+  return schedule;
+}
+
+int MPINetwork::alltoallvPersistent(const void* sendbuf,
+                                    const int sendcounts[],
+                                    const int sdispls[],
+                                    void* recvbuf,
+                                    const int recvcounts[],
+                                    const int rdispls[],
+                                    CollDataType type,
+                                    CollComm global_comm)
+{
+  int total_size  = global_comm->global_comm_size;
+  int global_rank = global_comm->global_rank;
+
+  MPI_Datatype mpi_type = dtypeToMPIDtype(type);
+
+  MPI_Aint lb, type_extent;
+  MPI_Type_get_extent(mpi_type, &lb, &type_extent);
+
+  // Same segmentation as the plain pairwise path, so the two paths generate identical per-pair
+  // message sequences and can be mixed across ranks of one communicator
+  static const size_t max_segment =
+    extract_env("LEGATE_COLL_MAX_SEGMENT", COLL_MAX_SEGMENT_DEFAULT, COLL_MAX_SEGMENT_TEST);
+  const int seg_elems =
+    std::max(1, static_cast<int>(max_segment / static_cast<size_t>(type_extent)));
+
+  bool created        = false;
+  PersistentSchedule* schedule = findOrCreateSchedule(
+    sendbuf, sendcounts, sdispls, recvbuf, recvcounts, rdispls, type, global_comm, &created);
+
+  if (created) {
+#ifdef DEBUG_LEGATE
+    log_coll.debug("AlltoallvPersistentMPI: global_rank %d, mpi rank %d, build schedule",
+                   global_rank,
+                   global_comm->mpi_rank);
+#endif
+    const char* send = static_cast<const char*>(sendbuf);
+    char* recv       = static_cast<char*>(recvbuf);
+    for (int i = 1; i < total_size; i++) {
+      int sendto_global_rank   = (global_rank + i) % total_size;
+      int recvfrom_global_rank = (global_rank + total_size - i) % total_size;
+      int sendto_mpi_rank      = global_comm->mapping_table.mpi_rank[sendto_global_rank];
+      int recvfrom_mpi_rank    = global_comm->mapping_table.mpi_rank[recvfrom_global_rank];
+      assert(sendto_global_rank == global_comm->mapping_table.global_rank[sendto_global_rank]);
+      assert(recvfrom_global_rank == global_comm->mapping_table.global_rank[recvfrom_global_rank]);
+      int send_tag = generateAlltoallvTag(sendto_global_rank, global_rank, global_comm);
+      int recv_tag = generateAlltoallvTag(global_rank, recvfrom_global_rank, global_comm);
+
+      char* dst  = recv + static_cast<ptrdiff_t>(rdispls[recvfrom_global_rank]) * type_extent;
+      int rcount = recvcounts[recvfrom_global_rank];
+      int nrecv_segs = std::max(1, (rcount + seg_elems - 1) / seg_elems);
+      for (int s = 0; s < nrecv_segs; s++) {
+        int offset = s * seg_elems;
+        int len    = std::min(seg_elems, rcount - offset);
+        MPI_Request recv_req;
+        CHECK_MPI(MPI_Recv_init(dst + static_cast<ptrdiff_t>(offset) * type_extent,
+                                len,
+                                mpi_type,
+                                recvfrom_mpi_rank,
+                                recv_tag,
+                                global_comm->mpi_comm,
+                                &recv_req));
+        schedule->requests.push_back(recv_req);
+      }
+
+      const char* src =
+        send + static_cast<ptrdiff_t>(sdispls[sendto_global_rank]) * type_extent;
+      int scount     = sendcounts[sendto_global_rank];
+      int nsend_segs = std::max(1, (scount + seg_elems - 1) / seg_elems);
+      for (int s = 0; s < nsend_segs; s++) {
+        int offset = s * seg_elems;
+        int len    = std::min(seg_elems, scount - offset);
+        MPI_Request send_req;
+        CHECK_MPI(MPI_Send_init(const_cast<char*>(src) + static_cast<ptrdiff_t>(offset) * type_extent,
+                                len,
+                                mpi_type,
+                                sendto_mpi_rank,
+                                send_tag,
+                                global_comm->mpi_comm,
+                                &send_req));
+        schedule->requests.push_back(send_req);
+      }
+    }
+  }
+#ifdef DEBUG_LEGATE
+  else {
+    log_coll.debug("AlltoallvPersistentMPI: global_rank %d, mpi rank %d, reuse schedule (%zu reqs)",
+                   global_rank,
+                   global_comm->mpi_rank,
+                   schedule->requests.size());
+  }
+#endif
+
+  if (!schedule->requests.empty()) {
+    CHECK_MPI(MPI_Startall(schedule->requests.size(), schedule->requests.data()));
+  }
+
+  // the self block never touches the wire; it has to be copied on every repeat
+  memcpy(static_cast<char*>(recvbuf) + static_cast<ptrdiff_t>(rdispls[global_rank]) * type_extent,
+         static_cast<const char*>(sendbuf) +
+           static_cast<ptrdiff_t>(sdispls[global_rank]) * type_extent,
+         static_cast<size_t>(recvcounts[global_rank]) * type_extent);
+
+  if (!schedule->requests.empty()) {
+    CHECK_MPI(
+      MPI_Waitall(schedule->requests.size(), schedule->requests.data(), MPI_STATUSES_IGNORE));
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(persistent_mutex);
+    schedule->in_use = false;
   }
 
   return CollSuccess;
@@ -258,10 +1102,49 @@ int MPINetwork::alltoall(
   MPI_Aint lb, type_extent;
   MPI_Type_get_extent(mpi_type, &lb, &type_extent);
 
+  bool device_buffers = false;
+#ifdef LEGATE_USE_CUDA
+  device_buffers = is_device_ptr(sendbuf) || is_device_ptr(recvbuf);
+  if (device_buffers && !cuda_aware_mpi()) {
+    // Stage through pinned host buffers when the MPI stack cannot take device pointers
+    size_t bytes    = static_cast<size_t>(total_size) * count * type_extent;
+    void* host_send = pinned_pool().acquire(bytes);
+    void* host_recv = pinned_pool().acquire(bytes);
+    CHECK_CUDA(cudaMemcpy(host_send, sendbuf, bytes, cudaMemcpyDefault));
+    int res = alltoall(host_send, host_recv, count, type, global_comm);
+    CHECK_CUDA(cudaMemcpy(recvbuf, host_recv, bytes, cudaMemcpyDefault));
+    pinned_pool().release(host_send);
+    pinned_pool().release(host_recv);
+    return res;
+  }
+#endif
+
+  // Small exchanges are latency-bound and benefit from the log(P)-round Bruck algorithm at the
+  // cost of extra copies; large ones stay on the bandwidth-friendly pairwise exchange. The
+  // Bruck pack/unpack copies assume host memory, so device-resident payloads stay pairwise.
+  static const int bruck_threshold = static_cast<int>(extract_env(
+    "LEGATE_ALLTOALL_BRUCK_THRESHOLD", ALLTOALL_BRUCK_THRESHOLD_DEFAULT, ALLTOALL_BRUCK_THRESHOLD_TEST));
+  if (!device_buffers && total_size >= 8 &&
+      type_extent * static_cast<ptrdiff_t>(count) <= bruck_threshold) {
+    return alltoallBruck(sendbuf, recvbuf, count, type, global_comm);
+  }
+
+  // Ranks co-located in this process exchange their segments through the shared pointer table
+  // instead of self-directed MPI messages; device-resident payloads stay on the MPI path, which
+  // a CUDA-aware stack handles directly
+  const bool use_local = global_comm->local_comm != nullptr && !device_buffers;
+  if (use_local) {
+    global_comm->local_comm->buffers[global_rank] = sendbuf;
+    __sync_synchronize();
+  }
+
+  const int* schedule = global_comm->offset_schedule;
   int sendto_global_rank, recvfrom_global_rank, sendto_mpi_rank, recvfrom_mpi_rank;
   for (int i = 1; i < total_size + 1; i++) {
-    sendto_global_rank   = (global_rank + i) % total_size;
-    recvfrom_global_rank = (global_rank + total_size - i) % total_size;
+    // the self exchange (offset total_size) always comes last; only peer offsets are reordered
+    const int offset     = (schedule != nullptr && i < total_size) ? schedule[i - 1] : i;
+    sendto_global_rank   = (global_rank + offset) % total_size;
+    recvfrom_global_rank = (global_rank + total_size - offset) % total_size;
     char* src            = static_cast<char*>(const_cast<void*>(sendbuf)) +
                 static_cast<ptrdiff_t>(sendto_global_rank) * type_extent * count;
     char* dst = static_cast<char*>(recvbuf) +
@@ -288,18 +1171,139 @@ int MPINetwork::alltoall(
       recvfrom_mpi_rank,
       recv_tag);
 #endif
-    CHECK_MPI(MPI_Sendrecv(src,
-                           count,
+    bool local_recv = use_local && isLocalRank(global_comm, recvfrom_global_rank);
+    bool local_send = use_local && isLocalRank(global_comm, sendto_global_rank);
+    if (local_recv) {
+      // wait for the co-located rank to publish its buffer
+      while (global_comm->local_comm->buffers[recvfrom_global_rank] == nullptr)
+        ;
+      const char* peer_base =
+        static_cast<const char*>(global_comm->local_comm->buffers[recvfrom_global_rank]);
+      memcpy(dst,
+             peer_base + static_cast<ptrdiff_t>(global_rank) * type_extent * count,
+             static_cast<size_t>(count) * type_extent);
+    }
+    if (!local_send && !local_recv) {
+      CHECK_MPI(MPI_Sendrecv(src,
+                             count,
+                             mpi_type,
+                             sendto_mpi_rank,
+                             send_tag,
+                             dst,
+                             count,
+                             mpi_type,
+                             recvfrom_mpi_rank,
+                             recv_tag,
+                             global_comm->mpi_comm,
+                             &status));
+    } else if (!local_send) {
+      CHECK_MPI(MPI_Send(src, count, mpi_type, sendto_mpi_rank, send_tag, global_comm->mpi_comm));
+    } else if (!local_recv) {
+      CHECK_MPI(MPI_Recv(
+        dst, count, mpi_type, recvfrom_mpi_rank, recv_tag, global_comm->mpi_comm, &status));
+    }
+  }
+
+  if (use_local) {
+    barrierLocal(global_comm);
+    __sync_synchronize();
+    resetLocalBuffer(global_comm);
+    barrierLocal(global_comm);
+  }
+
+  return CollSuccess;
+}
+
+int MPINetwork::alltoallBruck(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm)
+{
+  MPI_Status status;
+
+  int total_size  = global_comm->global_comm_size;
+  int global_rank = global_comm->global_rank;
+
+  MPI_Datatype mpi_type = dtypeToMPIDtype(type);
+
+  MPI_Aint lb, type_extent;
+  MPI_Type_get_extent(mpi_type, &lb, &type_extent);
+  ptrdiff_t block = type_extent * static_cast<ptrdiff_t>(count);
+
+  // Step 1: rotate locally so scratch block i holds the data destined for rank
+  // (global_rank + i) % total_size
+  std::vector<char> scratch(block * total_size);
+  const char* send = static_cast<const char*>(sendbuf);
+  for (int i = 0; i < total_size; i++) {
+    memcpy(scratch.data() + static_cast<ptrdiff_t>(i) * block,
+           send + static_cast<ptrdiff_t>((global_rank + i) % total_size) * block,
+           block);
+  }
+
+  // Step 2: ceil(log2(P)) rounds; round k ships every block whose index has bit k set to rank
+  // global_rank + k and receives the matching blocks from global_rank - k
+  int max_blocks = (total_size + 1) / 2;
+  std::vector<char> packed(block * max_blocks);
+  std::vector<char> unpacked(block * max_blocks);
+  std::vector<int> indices;
+  indices.reserve(max_blocks);
+  for (int k = 1; k < total_size; k <<= 1) {
+    indices.clear();
+    for (int i = 1; i < total_size; i++) {
+      if (i & k) { indices.push_back(i); }
+    }
+    for (size_t j = 0; j < indices.size(); j++) {
+      memcpy(packed.data() + static_cast<ptrdiff_t>(j) * block,
+             scratch.data() + static_cast<ptrdiff_t>(indices[j]) * block,
+             block);
+    }
+    int sendto_global_rank   = (global_rank + k) % total_size;
+    int recvfrom_global_rank = (global_rank + total_size - k) % total_size;
+    int sendto_mpi_rank      = global_comm->mapping_table.mpi_rank[sendto_global_rank];
+    int recvfrom_mpi_rank    = global_comm->mapping_table.mpi_rank[recvfrom_global_rank];
+    assert(sendto_global_rank == global_comm->mapping_table.global_rank[sendto_global_rank]);
+    assert(recvfrom_global_rank == global_comm->mapping_table.global_rank[recvfrom_global_rank]);
+    int send_tag = generateAlltoallTag(sendto_global_rank, global_rank, global_comm);
+    int recv_tag = generateAlltoallTag(global_rank, recvfrom_global_rank, global_comm);
+#ifdef DEBUG_LEGATE
+    log_coll.debug(
+      "AlltoallBruckMPI k: %d === global_rank %d, mpi rank %d, send %zu blocks to %d (%d), "
+      "send_tag %d, recv from %d (%d), recv_tag %d",
+      k,
+      global_rank,
+      global_comm->mpi_rank,
+      indices.size(),
+      sendto_global_rank,
+      sendto_mpi_rank,
+      send_tag,
+      recvfrom_global_rank,
+      recvfrom_mpi_rank,
+      recv_tag);
+#endif
+    CHECK_MPI(MPI_Sendrecv(packed.data(),
+                           static_cast<int>(indices.size()) * count,
                            mpi_type,
                            sendto_mpi_rank,
                            send_tag,
-                           dst,
-                           count,
+                           unpacked.data(),
+                           static_cast<int>(indices.size()) * count,
                            mpi_type,
                            recvfrom_mpi_rank,
                            recv_tag,
                            global_comm->mpi_comm,
                            &status));
+    for (size_t j = 0; j < indices.size(); j++) {
+      memcpy(scratch.data() + static_cast<ptrdiff_t>(indices[j]) * block,
+             unpacked.data() + static_cast<ptrdiff_t>(j) * block,
+             block);
+    }
+  }
+
+  // Step 3: inverse rotation; scratch block i now holds the data coming from rank
+  // (global_rank - i + total_size) % total_size
+  char* recv = static_cast<char*>(recvbuf);
+  for (int i = 0; i < total_size; i++) {
+    memcpy(recv + static_cast<ptrdiff_t>((global_rank + total_size - i) % total_size) * block,
+           scratch.data() + static_cast<ptrdiff_t>(i) * block,
+           block);
   }
 
   return CollSuccess;
@@ -316,20 +1320,427 @@ int MPINetwork::allgather(
   MPI_Aint lb, type_extent;
   MPI_Type_get_extent(mpi_type, &lb, &type_extent);
 
+#ifdef LEGATE_USE_CUDA
+  // The gather/bcast legs assemble the result with host-side copies, so device-resident
+  // payloads always stage through pinned host buffers here, CUDA-aware MPI or not
+  if (is_device_ptr(sendbuf) || is_device_ptr(recvbuf)) {
+    size_t send_bytes = static_cast<size_t>(count) * type_extent;
+    size_t recv_bytes = static_cast<size_t>(total_size) * count * type_extent;
+    void* host_recv   = pinned_pool().acquire(recv_bytes);
+    int res;
+    if (sendbuf == recvbuf) {
+      CHECK_CUDA(cudaMemcpy(host_recv, recvbuf, send_bytes, cudaMemcpyDefault));
+      res = allgather(host_recv, host_recv, count, type, global_comm);
+    } else {
+      void* host_send = pinned_pool().acquire(send_bytes);
+      CHECK_CUDA(cudaMemcpy(host_send, sendbuf, send_bytes, cudaMemcpyDefault));
+      res = allgather(host_send, host_recv, count, type, global_comm);
+      pinned_pool().release(host_send);
+    }
+    CHECK_CUDA(cudaMemcpy(recvbuf, host_recv, recv_bytes, cudaMemcpyDefault));
+    pinned_pool().release(host_recv);
+    return res;
+  }
+#endif
+
   void* sendbuf_tmp = const_cast<void*>(sendbuf);
 
   // MPI_IN_PLACE
   if (sendbuf == recvbuf) { sendbuf_tmp = allocateInplaceBuffer(recvbuf, type_extent * count); }
 
-  gather(sendbuf_tmp, recvbuf, count, type, 0, global_comm);
+  // With multiple ranks per process, aggregate within the process first and exchange one
+  // message per process pair instead of going through a single flat root
+  if (global_comm->nb_threads > 1 && global_comm->mpi_comm_size_actual > 1) {
+    allgatherHierarchical(sendbuf_tmp, recvbuf, count, type, global_comm);
+  } else {
+    gather(sendbuf_tmp, recvbuf, count, type, 0, global_comm);
 
-  bcast(recvbuf, count * total_size, type, 0, global_comm);
+    bcast(recvbuf, count * total_size, type, 0, global_comm);
+  }
 
   if (sendbuf == recvbuf) { free(sendbuf_tmp); }
 
   return CollSuccess;
 }
 
+int MPINetwork::allgatherv(const void* sendbuf,
+                           int sendcount,
+                           void* recvbuf,
+                           const int recvcounts[],
+                           const int rdispls[],
+                           CollDataType type,
+                           CollComm global_comm)
+{
+  MPI_Status status;
+
+  int total_size  = global_comm->global_comm_size;
+  int global_rank = global_comm->global_rank;
+
+  MPI_Datatype mpi_type = dtypeToMPIDtype(type);
+
+  MPI_Aint lb, type_extent;
+  MPI_Type_get_extent(mpi_type, &lb, &type_extent);
+
+  assert(sendcount == recvcounts[global_rank]);
+
+  // extent of the assembled result, for the bcast leg and any staging copies
+  size_t total_elems = 0;
+  for (int i = 0; i < total_size; i++)
+    total_elems = std::max(total_elems, static_cast<size_t>(rdispls[i]) + recvcounts[i]);
+
+#ifdef LEGATE_USE_CUDA
+  // Like allgather, the gather/bcast legs assemble the result with host-side copies, so
+  // device-resident payloads stage through pinned host buffers
+  if (is_device_ptr(sendbuf) || is_device_ptr(recvbuf)) {
+    size_t send_bytes = static_cast<size_t>(sendcount) * type_extent;
+    size_t recv_bytes = total_elems * type_extent;
+    void* host_recv   = pinned_pool().acquire(recv_bytes);
+    int res;
+    if (sendbuf == recvbuf) {
+      CHECK_CUDA(cudaMemcpy(host_recv, recvbuf, recv_bytes, cudaMemcpyDefault));
+      res = allgatherv(host_recv, sendcount, host_recv, recvcounts, rdispls, type, global_comm);
+    } else {
+      void* host_send = pinned_pool().acquire(send_bytes);
+      CHECK_CUDA(cudaMemcpy(host_send, sendbuf, send_bytes, cudaMemcpyDefault));
+      res = allgatherv(host_send, sendcount, host_recv, recvcounts, rdispls, type, global_comm);
+      pinned_pool().release(host_send);
+    }
+    CHECK_CUDA(cudaMemcpy(recvbuf, host_recv, recv_bytes, cudaMemcpyDefault));
+    pinned_pool().release(host_recv);
+    return res;
+  }
+#endif
+
+  const void* sendbuf_tmp = sendbuf;
+
+  // MPI_IN_PLACE: the contribution already sits at its displacement in recvbuf
+  if (sendbuf == recvbuf) {
+    sendbuf_tmp =
+      allocateInplaceBuffer(static_cast<const char*>(recvbuf) +
+                              static_cast<ptrdiff_t>(rdispls[global_rank]) * type_extent,
+                            static_cast<size_t>(type_extent) * sendcount);
+  }
+
+  // Flat gather of the variable-sized blocks to rank 0, each block travelling at its true size
+  // straight into its displacement, followed by a tree bcast of the assembled span. A subtree-
+  // aggregating gather would need an extra count exchange per level, which the typical small
+  // irregular payloads do not amortize.
+  if (global_rank != 0) {
+    int tag = generateGatherTag(global_rank, global_comm);
+#ifdef DEBUG_LEGATE
+    log_coll.debug("AllgathervMPI: global_rank %d, mpi rank %d, send count %d to root, tag %d",
+                   global_rank,
+                   global_comm->mpi_rank,
+                   sendcount,
+                   tag);
+#endif
+    CHECK_MPI(MPI_Send(sendbuf_tmp,
+                       sendcount,
+                       mpi_type,
+                       global_comm->mapping_table.mpi_rank[0],
+                       tag,
+                       global_comm->mpi_comm));
+  } else {
+    char* dst = static_cast<char*>(recvbuf);
+    for (int i = 0; i < total_size; i++) {
+      char* block = dst + static_cast<ptrdiff_t>(rdispls[i]) * type_extent;
+      if (i == global_rank) {
+        memcpy(block, sendbuf_tmp, static_cast<size_t>(type_extent) * sendcount);
+        continue;
+      }
+      int recvfrom_mpi_rank = global_comm->mapping_table.mpi_rank[i];
+      assert(i == global_comm->mapping_table.global_rank[i]);
+      int tag = generateGatherTag(i, global_comm);
+#ifdef DEBUG_LEGATE
+      log_coll.debug("AllgathervMPI: root recv count %d from %d (%d) at displ %d, tag %d",
+                     recvcounts[i],
+                     i,
+                     recvfrom_mpi_rank,
+                     rdispls[i],
+                     tag);
+#endif
+      CHECK_MPI(MPI_Recv(
+        block, recvcounts[i], mpi_type, recvfrom_mpi_rank, tag, global_comm->mpi_comm, &status));
+    }
+  }
+
+  bcast(recvbuf, static_cast<int>(total_elems), type, 0, global_comm);
+
+  if (sendbuf == recvbuf) { free(const_cast<void*>(sendbuf_tmp)); }
+
+  return CollSuccess;
+}
+
+int MPINetwork::allgatherHierarchical(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, CollComm global_comm)
+{
+  MPI_Status status;
+
+  int total_size  = global_comm->global_comm_size;
+  int global_rank = global_comm->global_rank;
+
+  MPI_Datatype mpi_type = dtypeToMPIDtype(type);
+
+  MPI_Aint lb, type_extent;
+  MPI_Type_get_extent(mpi_type, &lb, &type_extent);
+  ptrdiff_t block = type_extent * static_cast<ptrdiff_t>(count);
+
+  // Discover the co-located ranks and the per-process leaders from the mapping table. The
+  // leader of a process is the first global rank mapped to it.
+  const int* mpi_ranks = global_comm->mapping_table.mpi_rank;
+  int my_mpi_rank      = mpi_ranks[global_rank];
+  std::vector<int> local_group;
+  std::vector<int> leaders;
+  for (int r = 0; r < total_size; r++) {
+    if (mpi_ranks[r] == my_mpi_rank) local_group.push_back(r);
+    bool seen = false;
+    for (auto leader : leaders) seen = seen || mpi_ranks[leader] == mpi_ranks[r];
+    if (!seen) leaders.push_back(r);
+  }
+  int leader     = local_group.front();
+  bool am_leader = global_rank == leader;
+
+  // Step 1: non-leaders ship their contribution to the local leader, which packs the
+  // contributions in group order
+  char* nodebuf = nullptr;
+  if (!am_leader) {
+    int tag = generateGatherTag(global_rank, global_comm);
+    CHECK_MPI(MPI_Send(sendbuf, count, mpi_type, my_mpi_rank, tag, global_comm->mpi_comm));
+  } else {
+    nodebuf = static_cast<char*>(malloc(block * local_group.size()));
+    assert(nodebuf != nullptr);
+    for (size_t idx = 0; idx < local_group.size(); ++idx) {
+      int r     = local_group[idx];
+      char* dst = nodebuf + static_cast<ptrdiff_t>(idx) * block;
+      if (r == global_rank)
+        memcpy(dst, sendbuf, block);
+      else {
+        int tag = generateGatherTag(r, global_comm);
+        CHECK_MPI(
+          MPI_Recv(dst, count, mpi_type, my_mpi_rank, tag, global_comm->mpi_comm, &status));
+      }
+    }
+  }
+
+  // Step 2: leaders exchange the aggregated blocks in a ring, one message per process pair,
+  // and scatter the received members into their global-rank slots in the recv buffer
+  if (am_leader) {
+    for (size_t idx = 0; idx < local_group.size(); ++idx)
+      memcpy(static_cast<char*>(recvbuf) + static_cast<ptrdiff_t>(local_group[idx]) * block,
+             nodebuf + static_cast<ptrdiff_t>(idx) * block,
+             block);
+
+    size_t my_idx = 0;
+    for (size_t idx = 0; idx < leaders.size(); ++idx)
+      if (leaders[idx] == global_rank) my_idx = idx;
+
+    int num_leaders = static_cast<int>(leaders.size());
+    std::vector<int> remote_group;
+    std::vector<char> remote_buf;
+    for (int i = 1; i < num_leaders; i++) {
+      int sendto   = leaders[(my_idx + i) % num_leaders];
+      int recvfrom = leaders[(my_idx + num_leaders - i) % num_leaders];
+
+      remote_group.clear();
+      for (int r = 0; r < total_size; r++)
+        if (mpi_ranks[r] == mpi_ranks[recvfrom]) remote_group.push_back(r);
+      remote_buf.resize(block * remote_group.size());
+
+      int send_tag = generateAlltoallTag(sendto, global_rank, global_comm);
+      int recv_tag = generateAlltoallTag(global_rank, recvfrom, global_comm);
+      CHECK_MPI(MPI_Sendrecv(nodebuf,
+                             count * static_cast<int>(local_group.size()),
+                             mpi_type,
+                             mpi_ranks[sendto],
+                             send_tag,
+                             remote_buf.data(),
+                             count * static_cast<int>(remote_group.size()),
+                             mpi_type,
+                             mpi_ranks[recvfrom],
+                             recv_tag,
+                             global_comm->mpi_comm,
+                             &status));
+
+      for (size_t idx = 0; idx < remote_group.size(); ++idx)
+        memcpy(static_cast<char*>(recvbuf) + static_cast<ptrdiff_t>(remote_group[idx]) * block,
+               remote_buf.data() + static_cast<ptrdiff_t>(idx) * block,
+               block);
+    }
+    free(nodebuf);
+  }
+
+  // Step 3: leaders broadcast the assembled result to their co-located ranks
+  if (am_leader) {
+    for (auto r : local_group) {
+      if (r == global_rank) continue;
+      int tag = generateBcastTag(r, global_comm);
+      CHECK_MPI(MPI_Send(
+        recvbuf, count * total_size, mpi_type, my_mpi_rank, tag, global_comm->mpi_comm));
+    }
+  } else {
+    int tag = generateBcastTag(global_rank, global_comm);
+    CHECK_MPI(MPI_Recv(
+      recvbuf, count * total_size, mpi_type, my_mpi_rank, tag, global_comm->mpi_comm, &status));
+  }
+
+  return CollSuccess;
+}
+
+int MPINetwork::allreduce(const void* sendbuf,
+                          void* recvbuf,
+                          int count,
+                          CollDataType type,
+                          CollRedOp op,
+                          CollComm global_comm)
+{
+  MPI_Status status;
+
+  int total_size  = global_comm->global_comm_size;
+  int global_rank = global_comm->global_rank;
+
+  MPI_Datatype mpi_type = dtypeToMPIDtype(type);
+
+  MPI_Aint lb, type_extent;
+  MPI_Type_get_extent(mpi_type, &lb, &type_extent);
+
+  // MPI_IN_PLACE
+  if (sendbuf != recvbuf) {
+    memcpy(recvbuf, sendbuf, type_extent * static_cast<ptrdiff_t>(count));
+  }
+  if (total_size == 1) { return CollSuccess; }
+
+  // Ring allreduce: a reduce-scatter pass followed by an allgather pass, so each rank moves
+  // roughly 2 * count elements regardless of the communicator size. The buffer is split into
+  // total_size nearly-equal chunks; chunk i covers [i * count / total_size, (i + 1) * count /
+  // total_size).
+  auto chunk_lo = [&](int i) {
+    return static_cast<int>(static_cast<int64_t>(i) * count / total_size);
+  };
+  auto chunk_count = [&](int i) { return chunk_lo(i + 1) - chunk_lo(i); };
+
+  int max_chunk = 0;
+  for (int i = 0; i < total_size; i++) { max_chunk = std::max(max_chunk, chunk_count(i)); }
+  std::vector<char> tmp(static_cast<size_t>(max_chunk) * type_extent);
+
+  int sendto_global_rank   = (global_rank + 1) % total_size;
+  int recvfrom_global_rank = (global_rank + total_size - 1) % total_size;
+  int sendto_mpi_rank      = global_comm->mapping_table.mpi_rank[sendto_global_rank];
+  int recvfrom_mpi_rank    = global_comm->mapping_table.mpi_rank[recvfrom_global_rank];
+  assert(sendto_global_rank == global_comm->mapping_table.global_rank[sendto_global_rank]);
+  assert(recvfrom_global_rank == global_comm->mapping_table.global_rank[recvfrom_global_rank]);
+  int send_tag = generateAllreduceTag(sendto_global_rank, global_rank, global_comm);
+  int recv_tag = generateAllreduceTag(global_rank, recvfrom_global_rank, global_comm);
+
+  char* data = static_cast<char*>(recvbuf);
+
+  // Reduce-scatter pass: after total_size - 1 steps rank r holds the fully reduced chunk
+  // (r + 1) % total_size. Reusing the same tag each step is safe because messages between a
+  // fixed pair of ranks are matched in order.
+  for (int s = 0; s < total_size - 1; s++) {
+    int send_chunk = ((global_rank - s) % total_size + total_size) % total_size;
+    int recv_chunk = ((global_rank - s - 1) % total_size + total_size) % total_size;
+    CHECK_MPI(MPI_Sendrecv(data + static_cast<ptrdiff_t>(chunk_lo(send_chunk)) * type_extent,
+                           chunk_count(send_chunk),
+                           mpi_type,
+                           sendto_mpi_rank,
+                           send_tag,
+                           tmp.data(),
+                           chunk_count(recv_chunk),
+                           mpi_type,
+                           recvfrom_mpi_rank,
+                           recv_tag,
+                           global_comm->mpi_comm,
+                           &status));
+    applyReduction(data + static_cast<ptrdiff_t>(chunk_lo(recv_chunk)) * type_extent,
+                   tmp.data(),
+                   chunk_count(recv_chunk),
+                   type,
+                   op);
+  }
+
+  // Allgather pass: circulate the reduced chunks around the same ring
+  for (int s = 0; s < total_size - 1; s++) {
+    int send_chunk = ((global_rank + 1 - s) % total_size + total_size) % total_size;
+    int recv_chunk = ((global_rank - s) % total_size + total_size) % total_size;
+    CHECK_MPI(MPI_Sendrecv(data + static_cast<ptrdiff_t>(chunk_lo(send_chunk)) * type_extent,
+                           chunk_count(send_chunk),
+                           mpi_type,
+                           sendto_mpi_rank,
+                           send_tag,
+                           data + static_cast<ptrdiff_t>(chunk_lo(recv_chunk)) * type_extent,
+                           chunk_count(recv_chunk),
+                           mpi_type,
+                           recvfrom_mpi_rank,
+                           recv_tag,
+                           global_comm->mpi_comm,
+                           &status));
+  }
+
+  return CollSuccess;
+}
+
+int MPINetwork::reduce_scatter(const void* sendbuf,
+                               void* recvbuf,
+                               int recvcount,
+                               CollDataType type,
+                               CollRedOp op,
+                               CollComm global_comm)
+{
+  MPI_Status status;
+
+  int total_size  = global_comm->global_comm_size;
+  int global_rank = global_comm->global_rank;
+
+  MPI_Datatype mpi_type = dtypeToMPIDtype(type);
+
+  MPI_Aint lb, type_extent;
+  MPI_Type_get_extent(mpi_type, &lb, &type_extent);
+  ptrdiff_t block = type_extent * static_cast<ptrdiff_t>(recvcount);
+
+  if (total_size == 1) {
+    memcpy(recvbuf, sendbuf, block);
+    return CollSuccess;
+  }
+
+  // Ring reduce-scatter over a scratch copy of the send buffer; the chunk assignment is shifted
+  // by one relative to allreduce so that rank r ends up holding its own chunk r
+  std::vector<char> work(block * total_size);
+  memcpy(work.data(), sendbuf, block * total_size);
+  std::vector<char> tmp(block);
+
+  int sendto_global_rank   = (global_rank + 1) % total_size;
+  int recvfrom_global_rank = (global_rank + total_size - 1) % total_size;
+  int sendto_mpi_rank      = global_comm->mapping_table.mpi_rank[sendto_global_rank];
+  int recvfrom_mpi_rank    = global_comm->mapping_table.mpi_rank[recvfrom_global_rank];
+  assert(sendto_global_rank == global_comm->mapping_table.global_rank[sendto_global_rank]);
+  assert(recvfrom_global_rank == global_comm->mapping_table.global_rank[recvfrom_global_rank]);
+  int send_tag = generateReduceScatterTag(sendto_global_rank, global_rank, global_comm);
+  int recv_tag = generateReduceScatterTag(global_rank, recvfrom_global_rank, global_comm);
+
+  for (int s = 0; s < total_size - 1; s++) {
+    int send_chunk = ((global_rank - s - 1) % total_size + total_size) % total_size;
+    int recv_chunk = ((global_rank - s - 2) % total_size + total_size) % total_size;
+    CHECK_MPI(MPI_Sendrecv(work.data() + static_cast<ptrdiff_t>(send_chunk) * block,
+                           recvcount,
+                           mpi_type,
+                           sendto_mpi_rank,
+                           send_tag,
+                           tmp.data(),
+                           recvcount,
+                           mpi_type,
+                           recvfrom_mpi_rank,
+                           recv_tag,
+                           global_comm->mpi_comm,
+                           &status));
+    applyReduction(
+      work.data() + static_cast<ptrdiff_t>(recv_chunk) * block, tmp.data(), recvcount, type, op);
+  }
+
+  memcpy(recvbuf, work.data() + static_cast<ptrdiff_t>(global_rank) * block, block);
+
+  return CollSuccess;
+}
+
 int MPINetwork::gather(
   const void* sendbuf, void* recvbuf, int count, CollDataType type, int root, CollComm global_comm)
 {
@@ -343,108 +1754,212 @@ int MPINetwork::gather(
   // Should not see inplace here
   if (sendbuf == recvbuf) { assert(0); }
 
-  int root_mpi_rank = global_comm->mapping_table.mpi_rank[root];
   assert(root == global_comm->mapping_table.global_rank[root]);
 
-  int tag;
-
-  // non-root
-  if (global_rank != root) {
-    tag = generateGatherTag(global_rank, global_comm);
+  MPI_Aint lb, type_extent;
+  MPI_Type_get_extent(mpi_type, &lb, &type_extent);
+  ptrdiff_t block = type_extent * static_cast<ptrdiff_t>(count);
+
+  // Binomial tree rooted at root: every rank assembles the blocks of its subtree in
+  // relative-rank order and ships them to its parent in a single message, so the root's inbound
+  // link carries log2(P) aggregates instead of P-1 individual blocks. mask ends up as the
+  // lowest set bit of the relative rank, which is also the size of this rank's subtree.
+  int relative = (global_rank - root + total_size) % total_size;
+  int mask     = 1;
+  while (mask < total_size && (relative & mask) == 0) mask <<= 1;
+  int span = std::min(mask, total_size - relative);
+
+  std::vector<char> subtree(static_cast<size_t>(block) * span);
+  memcpy(subtree.data(), sendbuf, block);
+
+  for (int child_mask = 1; child_mask < mask; child_mask <<= 1) {
+    int child_rel = relative + child_mask;
+    if (child_rel >= total_size) break;
+    int child_span     = std::min(child_mask, total_size - child_rel);
+    int child          = (child_rel + root) % total_size;
+    int child_mpi_rank = global_comm->mapping_table.mpi_rank[child];
+    assert(child == global_comm->mapping_table.global_rank[child]);
+    int tag = generateGatherTag(child, global_comm);
 #ifdef DEBUG_LEGATE
-    log_coll.debug("GatherMPI: non-root send global_rank %d, mpi rank %d, send to %d (%d), tag %d",
+    log_coll.debug("GatherMPI: global_rank %d, mpi rank %d, recv subtree from %d (%d) span %d, tag %d",
                    global_rank,
                    global_comm->mpi_rank,
-                   root,
-                   root_mpi_rank,
+                   child,
+                   child_mpi_rank,
+                   child_span,
                    tag);
 #endif
-    CHECK_MPI(MPI_Send(sendbuf, count, mpi_type, root_mpi_rank, tag, global_comm->mpi_comm));
-    return CollSuccess;
+    CHECK_MPI(MPI_Recv(subtree.data() + static_cast<ptrdiff_t>(child_mask) * block,
+                       count * child_span,
+                       mpi_type,
+                       child_mpi_rank,
+                       tag,
+                       global_comm->mpi_comm,
+                       &status));
   }
 
-  // root
-  MPI_Aint incr, lb, type_extent;
-  MPI_Type_get_extent(mpi_type, &lb, &type_extent);
-  incr      = type_extent * static_cast<ptrdiff_t>(count);
-  char* dst = static_cast<char*>(recvbuf);
-  int recvfrom_mpi_rank;
-  for (int i = 0; i < total_size; i++) {
-    recvfrom_mpi_rank = global_comm->mapping_table.mpi_rank[i];
-    assert(i == global_comm->mapping_table.global_rank[i]);
-    tag = generateGatherTag(i, global_comm);
+  if (relative != 0) {
+    int parent          = (relative - mask + root) % total_size;
+    int parent_mpi_rank = global_comm->mapping_table.mpi_rank[parent];
+    int tag             = generateGatherTag(global_rank, global_comm);
 #ifdef DEBUG_LEGATE
-    log_coll.debug(
-      "GatherMPI: root i %d === global_rank %d, mpi rank %d, recv %p, from %d (%d), tag %d",
-      i,
-      global_rank,
-      global_comm->mpi_rank,
-      dst,
-      i,
-      recvfrom_mpi_rank,
-      tag);
+    log_coll.debug("GatherMPI: global_rank %d, mpi rank %d, send span %d to parent %d (%d), tag %d",
+                   global_rank,
+                   global_comm->mpi_rank,
+                   span,
+                   parent,
+                   parent_mpi_rank,
+                   tag);
 #endif
-    assert(dst != nullptr);
-    if (global_rank == i) {
-      memcpy(dst, sendbuf, incr);
-    } else {
-      CHECK_MPI(
-        MPI_Recv(dst, count, mpi_type, recvfrom_mpi_rank, tag, global_comm->mpi_comm, &status));
-    }
-    dst += incr;
+    CHECK_MPI(
+      MPI_Send(subtree.data(), count * span, mpi_type, parent_mpi_rank, tag, global_comm->mpi_comm));
+    return CollSuccess;
   }
 
+  // root: rotate the relative-rank-ordered aggregate into global-rank order
+  char* dst = static_cast<char*>(recvbuf);
+  assert(dst != nullptr);
+  for (int rel = 0; rel < total_size; rel++)
+    memcpy(dst + static_cast<ptrdiff_t>((rel + root) % total_size) * block,
+           subtree.data() + static_cast<ptrdiff_t>(rel) * block,
+           block);
+
   return CollSuccess;
 }
 
 int MPINetwork::bcast(void* buf, int count, CollDataType type, int root, CollComm global_comm)
 {
-  int tag;
   MPI_Status status;
 
   int total_size  = global_comm->global_comm_size;
   int global_rank = global_comm->global_rank;
 
-  int root_mpi_rank = global_comm->mapping_table.mpi_rank[root];
   assert(root == global_comm->mapping_table.global_rank[root]);
 
   MPI_Datatype mpi_type = dtypeToMPIDtype(type);
 
-  // non-root
-  if (global_rank != root) {
-    tag = generateBcastTag(global_rank, global_comm);
+  // Binomial tree rooted at root: every rank receives the payload once from its parent and
+  // forwards it down, so the root sends log2(P) messages instead of P-1 and the levels of the
+  // tree run in parallel
+  int relative = (global_rank - root + total_size) % total_size;
+  int mask     = 1;
+  while (mask < total_size && (relative & mask) == 0) mask <<= 1;
+
+  if (relative != 0) {
+    int parent          = (relative - mask + root) % total_size;
+    int parent_mpi_rank = global_comm->mapping_table.mpi_rank[parent];
+    int tag             = generateBcastTag(global_rank, global_comm);
 #ifdef DEBUG_LEGATE
-    log_coll.debug("BcastMPI: non-root recv global_rank %d, mpi rank %d, send to %d (%d), tag %d",
+    log_coll.debug("BcastMPI: global_rank %d, mpi rank %d, recv from parent %d (%d), tag %d",
                    global_rank,
                    global_comm->mpi_rank,
-                   root,
-                   root_mpi_rank,
+                   parent,
+                   parent_mpi_rank,
                    tag);
 #endif
-    CHECK_MPI(MPI_Recv(buf, count, mpi_type, root_mpi_rank, tag, global_comm->mpi_comm, &status));
-    return CollSuccess;
+    CHECK_MPI(MPI_Recv(buf, count, mpi_type, parent_mpi_rank, tag, global_comm->mpi_comm, &status));
   }
 
-  // root
-  int sendto_mpi_rank;
-  for (int i = 0; i < total_size; i++) {
-    sendto_mpi_rank = global_comm->mapping_table.mpi_rank[i];
-    assert(i == global_comm->mapping_table.global_rank[i]);
-    tag = generateBcastTag(i, global_comm);
+  // larger subtrees first, so the longest forwarding chains start earliest
+  for (int child_mask = mask >> 1; child_mask > 0; child_mask >>= 1) {
+    int child_rel = relative + child_mask;
+    if (child_rel >= total_size) continue;
+    int child          = (child_rel + root) % total_size;
+    int child_mpi_rank = global_comm->mapping_table.mpi_rank[child];
+    assert(child == global_comm->mapping_table.global_rank[child]);
+    int tag = generateBcastTag(child, global_comm);
 #ifdef DEBUG_LEGATE
-    log_coll.debug("BcastMPI: root i %d === global_rank %d, mpi rank %d, send to %d (%d), tag %d",
-                   i,
+    log_coll.debug("BcastMPI: global_rank %d, mpi rank %d, send to child %d (%d), tag %d",
                    global_rank,
                    global_comm->mpi_rank,
-                   i,
-                   sendto_mpi_rank,
+                   child,
+                   child_mpi_rank,
                    tag);
 #endif
-    if (global_rank != i) {
-      CHECK_MPI(MPI_Send(buf, count, mpi_type, sendto_mpi_rank, tag, global_comm->mpi_comm));
-    }
+    CHECK_MPI(MPI_Send(buf, count, mpi_type, child_mpi_rank, tag, global_comm->mpi_comm));
+  }
+
+  return CollSuccess;
+}
+
+int MPINetwork::scatter(
+  const void* sendbuf, void* recvbuf, int count, CollDataType type, int root, CollComm global_comm)
+{
+  MPI_Status status;
+
+  int total_size  = global_comm->global_comm_size;
+  int global_rank = global_comm->global_rank;
+
+  MPI_Datatype mpi_type = dtypeToMPIDtype(type);
+
+  // Should not see inplace here
+  if (sendbuf == recvbuf) { assert(0); }
+
+  assert(root == global_comm->mapping_table.global_rank[root]);
+
+  MPI_Aint lb, type_extent;
+  MPI_Type_get_extent(mpi_type, &lb, &type_extent);
+  ptrdiff_t block = type_extent * static_cast<ptrdiff_t>(count);
+
+  // Reverse of the tree gather: the root packs the blocks in relative-rank order and every
+  // rank hands each child the contiguous range of its whole subtree in a single message
+  int relative = (global_rank - root + total_size) % total_size;
+  int mask     = 1;
+  while (mask < total_size && (relative & mask) == 0) mask <<= 1;
+  int span = std::min(mask, total_size - relative);
+
+  std::vector<char> subtree(static_cast<size_t>(block) * span);
+
+  if (relative == 0) {
+    const char* src = static_cast<const char*>(sendbuf);
+    for (int rel = 0; rel < total_size; rel++)
+      memcpy(subtree.data() + static_cast<ptrdiff_t>(rel) * block,
+             src + static_cast<ptrdiff_t>((rel + root) % total_size) * block,
+             block);
+  } else {
+    int parent          = (relative - mask + root) % total_size;
+    int parent_mpi_rank = global_comm->mapping_table.mpi_rank[parent];
+    int tag             = generateScatterTag(global_rank, global_comm);
+#ifdef DEBUG_LEGATE
+    log_coll.debug("ScatterMPI: global_rank %d, mpi rank %d, recv span %d from parent %d (%d), tag %d",
+                   global_rank,
+                   global_comm->mpi_rank,
+                   span,
+                   parent,
+                   parent_mpi_rank,
+                   tag);
+#endif
+    CHECK_MPI(MPI_Recv(
+      subtree.data(), count * span, mpi_type, parent_mpi_rank, tag, global_comm->mpi_comm, &status));
+  }
+
+  for (int child_mask = mask >> 1; child_mask > 0; child_mask >>= 1) {
+    int child_rel = relative + child_mask;
+    if (child_rel >= total_size) continue;
+    int child_span     = std::min(child_mask, total_size - child_rel);
+    int child          = (child_rel + root) % total_size;
+    int child_mpi_rank = global_comm->mapping_table.mpi_rank[child];
+    assert(child == global_comm->mapping_table.global_rank[child]);
+    int tag = generateScatterTag(child, global_comm);
+#ifdef DEBUG_LEGATE
+    log_coll.debug("ScatterMPI: global_rank %d, mpi rank %d, send span %d to child %d (%d), tag %d",
+                   global_rank,
+                   global_comm->mpi_rank,
+                   child_span,
+                   child,
+                   child_mpi_rank,
+                   tag);
+#endif
+    CHECK_MPI(MPI_Send(subtree.data() + static_cast<ptrdiff_t>(child_mask) * block,
+                       count * child_span,
+                       mpi_type,
+                       child_mpi_rank,
+                       tag,
+                       global_comm->mpi_comm));
   }
 
+  memcpy(recvbuf, subtree.data(), block);
+
   return CollSuccess;
 }
 
@@ -532,6 +2047,17 @@ MPI_Datatype MPINetwork::dtypeToMPIDtype(CollDataType dtype)
     case CollDataType::CollDouble: {
       return MPI_DOUBLE;
     }
+    case CollDataType::CollHalf: {
+      // half payloads travel as opaque byte pairs; reductions are applied locally in
+      // applyReduction, so MPI never needs an arithmetic half type
+      return MPI_UINT16_T;
+    }
+    case CollDataType::CollComplexFloat: {
+      return MPI_C_FLOAT_COMPLEX;
+    }
+    case CollDataType::CollComplexDouble: {
+      return MPI_C_DOUBLE_COMPLEX;
+    }
     default: {
       log_coll.fatal("Unknown datatype");
       LEGATE_ABORT;
@@ -554,6 +2080,20 @@ int MPINetwork::generateAlltoallvTag(int rank1, int rank2, CollComm global_comm)
   return tag;
 }
 
+int MPINetwork::generateAllreduceTag(int rank1, int rank2, CollComm global_comm)
+{
+  int tag = match2ranks(rank1, rank2, global_comm) * CollTag::MAX_TAG + CollTag::ALLREDUCE_TAG;
+  assert(tag <= mpi_tag_ub && tag > 0);
+  return tag;
+}
+
+int MPINetwork::generateReduceScatterTag(int rank1, int rank2, CollComm global_comm)
+{
+  int tag = match2ranks(rank1, rank2, global_comm) * CollTag::MAX_TAG + CollTag::REDUCESCATTER_TAG;
+  assert(tag <= mpi_tag_ub && tag > 0);
+  return tag;
+}
+
 int MPINetwork::generateBcastTag(int rank, CollComm global_comm)
 {
   int tag = rank * CollTag::MAX_TAG + CollTag::BCAST_TAG;
@@ -568,6 +2108,31 @@ int MPINetwork::generateGatherTag(int rank, CollComm global_comm)
   return tag;
 }
 
+int MPINetwork::generateScatterTag(int rank, CollComm global_comm)
+{
+  int tag = rank * CollTag::MAX_TAG + CollTag::SCATTER_TAG;
+  assert(tag <= mpi_tag_ub && tag > 0);
+  return tag;
+}
+
+bool MPINetwork::isLocalRank(CollComm global_comm, int global_rank)
+{
+  return global_comm->mapping_table.mpi_rank[global_rank] == global_comm->mpi_rank;
+}
+
+void MPINetwork::barrierLocal(CollComm global_comm)
+{
+  assert(BackendNetwork::coll_inited == true);
+  pthread_barrier_wait(const_cast<pthread_barrier_t*>(&(global_comm->local_comm->barrier)));
+}
+
+void MPINetwork::resetLocalBuffer(CollComm global_comm)
+{
+  int global_rank                               = global_comm->global_rank;
+  global_comm->local_comm->buffers[global_rank] = nullptr;
+  global_comm->local_comm->displs[global_rank]  = nullptr;
+}
+
 }  // namespace coll
 }  // namespace comm
 }  // namespace legate
@@ -0,0 +1,232 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <nccl.h>
+
+#include <type_traits>
+
+#include "core/comm/communicator.h"
+#include "core/cuda/cuda_help.h"
+
+/**
+ * @file
+ * @brief Typed NCCL collective wrappers for GPU task variants
+ *
+ * Every library used to write its own `ncclAllReduce` invocation with ad-hoc datatype
+ * mapping and stream handling. These wrappers map `legate_type_of` element types to NCCL
+ * datatypes, issue the collective on the caller's task stream, and check errors, so GPU
+ * variants get one tuned call path. This header pulls in `nccl.h`, so it is meant for
+ * inclusion from `.cu` translation units only.
+ */
+namespace legate {
+namespace comm {
+namespace nccl {
+
+namespace detail {
+
+inline void check_nccl_result(ncclResult_t error, const char* file, int line)
+{
+  if (error != ncclSuccess) {
+    fprintf(stderr,
+            "Internal NCCL failure with error %s in file %s at line %d\n",
+            ncclGetErrorString(error),
+            file,
+            line);
+    exit(error);
+  }
+}
+
+#define LEGATE_CHECK_NCCL(expr)                                                \
+  do {                                                                         \
+    legate::comm::nccl::detail::check_nccl_result((expr), __FILE__, __LINE__); \
+  } while (false)
+
+// Maps element types to NCCL datatypes. Types without a native NCCL datatype (16-bit
+// integers, complex) still work for the data-movement collectives, which fall back to
+// transferring raw bytes, but not for reductions
+template <typename T>
+struct nccl_type_of {
+  static constexpr bool native = false;
+};
+template <>
+struct nccl_type_of<bool> {
+  static constexpr bool native        = true;
+  static constexpr ncclDataType_t value = ncclUint8;
+};
+template <>
+struct nccl_type_of<int8_t> {
+  static constexpr bool native        = true;
+  static constexpr ncclDataType_t value = ncclInt8;
+};
+template <>
+struct nccl_type_of<uint8_t> {
+  static constexpr bool native        = true;
+  static constexpr ncclDataType_t value = ncclUint8;
+};
+template <>
+struct nccl_type_of<int32_t> {
+  static constexpr bool native        = true;
+  static constexpr ncclDataType_t value = ncclInt32;
+};
+template <>
+struct nccl_type_of<uint32_t> {
+  static constexpr bool native        = true;
+  static constexpr ncclDataType_t value = ncclUint32;
+};
+template <>
+struct nccl_type_of<int64_t> {
+  static constexpr bool native        = true;
+  static constexpr ncclDataType_t value = ncclInt64;
+};
+template <>
+struct nccl_type_of<uint64_t> {
+  static constexpr bool native        = true;
+  static constexpr ncclDataType_t value = ncclUint64;
+};
+template <>
+struct nccl_type_of<__half> {
+  static constexpr bool native        = true;
+  static constexpr ncclDataType_t value = ncclFloat16;
+};
+template <>
+struct nccl_type_of<float> {
+  static constexpr bool native        = true;
+  static constexpr ncclDataType_t value = ncclFloat32;
+};
+template <>
+struct nccl_type_of<double> {
+  static constexpr bool native        = true;
+  static constexpr ncclDataType_t value = ncclFloat64;
+};
+
+inline ncclComm_t unwrap(const Communicator& comm) { return *comm.get<ncclComm_t*>(); }
+
+}  // namespace detail
+
+/**
+ * @ingroup task
+ * @brief RAII scope that batches every collective issued inside it into one NCCL group
+ *
+ * Wrapping several wrapper calls (e.g. one all-reduce per store of a multi-store task) in
+ * a `GroupScope` fuses them into a single group launch, so NCCL schedules them together
+ * instead of paying one kernel launch and one rendezvous per store.
+ */
+struct GroupScope {
+  GroupScope() { LEGATE_CHECK_NCCL(ncclGroupStart()); }
+  ~GroupScope() { LEGATE_CHECK_NCCL(ncclGroupEnd()); }
+
+  GroupScope(const GroupScope&)            = delete;
+  GroupScope& operator=(const GroupScope&) = delete;
+};
+
+/**
+ * @ingroup task
+ * @brief Performs an all-reduce over `count` elements on the caller's task stream
+ *
+ * @param comm Communicator passed to the task variant
+ * @param src Device buffer of elements to reduce
+ * @param dst Device buffer receiving the reduced elements; may alias `src`
+ * @param count Number of elements
+ * @param redop NCCL reduction operator (`ncclSum`, `ncclMax`, ...)
+ * @param stream Stream to order the collective on; pass the task's stream from the pool
+ */
+template <typename T>
+void all_reduce(const Communicator& comm,
+                const T* src,
+                T* dst,
+                size_t count,
+                ncclRedOp_t redop,
+                cudaStream_t stream)
+{
+  static_assert(detail::nccl_type_of<T>::native,
+                "all_reduce requires an element type with a native NCCL datatype");
+  LEGATE_CHECK_NCCL(
+    ncclAllReduce(src, dst, count, detail::nccl_type_of<T>::value, redop, detail::unwrap(comm), stream));
+}
+
+/**
+ * @ingroup task
+ * @brief Gathers `count` elements from every rank into a contiguous destination buffer
+ *
+ * Element types without a native NCCL datatype are transferred as raw bytes.
+ *
+ * @param comm Communicator passed to the task variant
+ * @param src Device buffer of this rank's `count` elements
+ * @param dst Device buffer of `count * num_ranks` elements, filled in rank order
+ * @param count Number of elements contributed by each rank
+ * @param stream Stream to order the collective on
+ */
+template <typename T>
+void all_gather(const Communicator& comm, const T* src, T* dst, size_t count, cudaStream_t stream)
+{
+  if constexpr (detail::nccl_type_of<T>::native) {
+    LEGATE_CHECK_NCCL(
+      ncclAllGather(src, dst, count, detail::nccl_type_of<T>::value, detail::unwrap(comm), stream));
+  } else {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "all_gather requires a trivially copyable element type");
+    LEGATE_CHECK_NCCL(
+      ncclAllGather(src, dst, count * sizeof(T), ncclInt8, detail::unwrap(comm), stream));
+  }
+}
+
+/**
+ * @ingroup task
+ * @brief Exchanges `count` elements with every rank (personalized all-to-all)
+ *
+ * NCCL has no all-to-all primitive, so this issues the send/recv pairs inside one group;
+ * nesting the call in an outer `GroupScope` fuses exchanges of multiple stores. Element
+ * types without a native NCCL datatype are transferred as raw bytes.
+ *
+ * @param comm Communicator passed to the task variant
+ * @param src Device buffer of `count * num_ranks` elements, one block per destination rank
+ * @param dst Device buffer of `count * num_ranks` elements, one block per source rank
+ * @param count Number of elements exchanged with each rank
+ * @param stream Stream to order the collective on
+ */
+template <typename T>
+void all_to_all(const Communicator& comm, const T* src, T* dst, size_t count, cudaStream_t stream)
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "all_to_all requires a trivially copyable element type");
+  auto nccl_comm = detail::unwrap(comm);
+
+  int num_ranks = 0;
+  LEGATE_CHECK_NCCL(ncclCommCount(nccl_comm, &num_ranks));
+
+  ncclDataType_t type;
+  size_t block;
+  if constexpr (detail::nccl_type_of<T>::native) {
+    type  = detail::nccl_type_of<T>::value;
+    block = count;
+  } else {
+    type  = ncclInt8;
+    block = count * sizeof(T);
+  }
+
+  LEGATE_CHECK_NCCL(ncclGroupStart());
+  for (int rank = 0; rank < num_ranks; ++rank) {
+    LEGATE_CHECK_NCCL(ncclSend(src + rank * count, block, type, rank, nccl_comm, stream));
+    LEGATE_CHECK_NCCL(ncclRecv(dst + rank * count, block, type, rank, nccl_comm, stream));
+  }
+  LEGATE_CHECK_NCCL(ncclGroupEnd());
+}
+
+}  // namespace nccl
+}  // namespace comm
+}  // namespace legate
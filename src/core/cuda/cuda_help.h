@@ -20,6 +20,14 @@
 #include <cuda_runtime.h>
 #include <stdio.h>
 
+#ifdef __CUDACC__
+#include <cuda_fp16.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+
 #define CHECK_CUDA(expr)                                      \
   do {                                                        \
     cudaError_t __result__ = (expr);                          \
@@ -60,5 +68,170 @@ __host__ inline void check_cuda(cudaError_t error, const char* file, int line)
   }
 }
 
+struct LaunchConfig {
+  uint32_t num_blocks;
+  uint32_t threads_per_block;
+};
+
+// Returns grid/block geometry for a grid-stride kernel over `volume` elements. The block
+// size comes from cudaOccupancyMaxPotentialBlockSize, so register-heavy kernels get a
+// smaller block instead of spilling at a hardcoded 128, and the grid is capped at the
+// smallest size that still fills the device at that occupancy. The query runs once per
+// kernel symbol: each Realm processor is pinned to one device on a dedicated thread, so a
+// thread_local cache keyed by symbol needs no locking and never mixes devices. Callers that
+// vary the dynamic shared memory size per launch of the same kernel should not use this
+// helper, as the first launch's size is the one cached.
+template <typename KERNEL>
+__host__ inline LaunchConfig launch_config(KERNEL kernel,
+                                           size_t volume,
+                                           size_t dynamic_smem_size = 0)
+{
+  struct Geometry {
+    int32_t min_grid_size;
+    int32_t block_size;
+  };
+  static thread_local std::unordered_map<const void*, Geometry> cache;
+
+  auto* symbol = reinterpret_cast<const void*>(kernel);
+  auto finder  = cache.find(symbol);
+  if (cache.end() == finder) {
+    int min_grid_size = 0;
+    int block_size    = 0;
+    CHECK_CUDA(
+      cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, kernel, dynamic_smem_size));
+    finder = cache.emplace(symbol, Geometry{min_grid_size, block_size}).first;
+  }
+
+  auto& geom        = finder->second;
+  auto threads      = static_cast<size_t>(geom.block_size);
+  auto wanted       = (volume + threads - 1) / threads;
+  auto num_blocks   = std::max(std::min(wanted, static_cast<size_t>(geom.min_grid_size)),
+                             static_cast<size_t>(1));
+  return LaunchConfig{static_cast<uint32_t>(num_blocks), static_cast<uint32_t>(threads)};
+}
+
+#ifdef __CUDACC__
+
+// Packed fp16 helpers. Kernels that walk __half data two elements at a time through these
+// shims keep the values in half2 registers and hit the doubled fp16 throughput of the
+// packed datapath; on architectures without the corresponding half2 instructions the shims
+// fall back to float arithmetic without changing the call sites.
+
+// Packed load/store; `ptr` must be 4-byte aligned, which holds for any even element index
+// into a `create_buffer` allocation
+__device__ __forceinline__ __half2 load_half2(const __half* ptr)
+{
+  return *reinterpret_cast<const __half2*>(ptr);
+}
+
+__device__ __forceinline__ void store_half2(__half* ptr, __half2 value)
+{
+  *reinterpret_cast<__half2*>(ptr) = value;
+}
+
+// Conversion shims
+__device__ __forceinline__ __half2 to_half2(float lo, float hi)
+{
+  return __floats2half2_rn(lo, hi);
+}
+
+__device__ __forceinline__ float2 to_float2(__half2 value) { return __half22float2(value); }
+
+// Packed arithmetic with pre-sm_53 float fallbacks
+__device__ __forceinline__ __half2 add_half2(__half2 lhs, __half2 rhs)
+{
+#if __CUDA_ARCH__ >= 530
+  return __hadd2(lhs, rhs);
+#else
+  const float2 flhs = __half22float2(lhs);
+  const float2 frhs = __half22float2(rhs);
+  return __floats2half2_rn(flhs.x + frhs.x, flhs.y + frhs.y);
+#endif
+}
+
+__device__ __forceinline__ __half2 mul_half2(__half2 lhs, __half2 rhs)
+{
+#if __CUDA_ARCH__ >= 530
+  return __hmul2(lhs, rhs);
+#else
+  const float2 flhs = __half22float2(lhs);
+  const float2 frhs = __half22float2(rhs);
+  return __floats2half2_rn(flhs.x * frhs.x, flhs.y * frhs.y);
+#endif
+}
+
+__device__ __forceinline__ __half2 fma_half2(__half2 a, __half2 b, __half2 c)
+{
+#if __CUDA_ARCH__ >= 530
+  return __hfma2(a, b, c);
+#else
+  const float2 fa = __half22float2(a);
+  const float2 fb = __half22float2(b);
+  const float2 fc = __half22float2(c);
+  return __floats2half2_rn(fa.x * fb.x + fc.x, fa.y * fb.y + fc.y);
+#endif
+}
+
+// Native packed min/max only exist from sm_80 on
+__device__ __forceinline__ __half2 max_half2(__half2 lhs, __half2 rhs)
+{
+#if __CUDA_ARCH__ >= 800
+  return __hmax2(lhs, rhs);
+#else
+  const float2 flhs = __half22float2(lhs);
+  const float2 frhs = __half22float2(rhs);
+  return __floats2half2_rn(flhs.x > frhs.x ? flhs.x : frhs.x,
+                           flhs.y > frhs.y ? flhs.y : frhs.y);
+#endif
+}
+
+__device__ __forceinline__ __half2 min_half2(__half2 lhs, __half2 rhs)
+{
+#if __CUDA_ARCH__ >= 800
+  return __hmin2(lhs, rhs);
+#else
+  const float2 flhs = __half22float2(lhs);
+  const float2 frhs = __half22float2(rhs);
+  return __floats2half2_rn(flhs.x < frhs.x ? flhs.x : frhs.x,
+                           flhs.y < frhs.y ? flhs.y : frhs.y);
+#endif
+}
+
+// Combines the two packed halves into one scalar at the end of a reduction
+__device__ __forceinline__ __half horizontal_add_half2(__half2 value)
+{
+#if __CUDA_ARCH__ >= 530
+  return __hadd(__low2half(value), __high2half(value));
+#else
+  return __float2half(__low2float(value) + __high2float(value));
+#endif
+}
+
+// Butterfly warp reductions that keep both halves packed the whole way down; every lane of
+// the warp returns the full result. Combine with the horizontal fold above (or a low/high
+// unpack for min/max) to produce the scalar.
+__device__ __forceinline__ __half2 warp_reduce_add_half2(__half2 value)
+{
+  for (int32_t offset = 16; offset > 0; offset >>= 1)
+    value = add_half2(value, __shfl_xor_sync(0xffffffff, value, offset));
+  return value;
+}
+
+__device__ __forceinline__ __half2 warp_reduce_max_half2(__half2 value)
+{
+  for (int32_t offset = 16; offset > 0; offset >>= 1)
+    value = max_half2(value, __shfl_xor_sync(0xffffffff, value, offset));
+  return value;
+}
+
+__device__ __forceinline__ __half2 warp_reduce_min_half2(__half2 value)
+{
+  for (int32_t offset = 16; offset > 0; offset >>= 1)
+    value = min_half2(value, __shfl_xor_sync(0xffffffff, value, offset));
+  return value;
+}
+
+#endif  // __CUDACC__
+
 }  // namespace cuda
 }  // namespace legate
@@ -0,0 +1,66 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "core/cuda/cuda_help.h"
+#include "core/cuda/graph_cache.h"
+
+namespace legate {
+namespace cuda {
+
+GraphCache::~GraphCache()
+{
+  for (auto& [key, exec] : graphs_) CHECK_CUDA(cudaGraphExecDestroy(exec));
+}
+
+bool GraphCache::replay(uint64_t key, cudaStream_t stream)
+{
+  auto finder = graphs_.find(key);
+  if (graphs_.end() == finder) return false;
+  CHECK_CUDA(cudaGraphLaunch(finder->second, stream));
+  return true;
+}
+
+void GraphCache::begin_capture(cudaStream_t stream)
+{
+  CHECK_CUDA(cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal));
+}
+
+void GraphCache::end_capture(uint64_t key, cudaStream_t stream)
+{
+  cudaGraph_t graph;
+  CHECK_CUDA(cudaStreamEndCapture(stream, &graph));
+  cudaGraphExec_t exec;
+  CHECK_CUDA(cudaGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+  CHECK_CUDA(cudaGraphDestroy(graph));
+
+  auto finder = graphs_.find(key);
+  if (finder != graphs_.end()) CHECK_CUDA(cudaGraphExecDestroy(finder->second));
+  graphs_[key] = exec;
+
+  // The captured work never executed, so run the freshly instantiated graph now
+  CHECK_CUDA(cudaGraphLaunch(exec, stream));
+}
+
+/*static*/ GraphCache& GraphCache::get_graph_cache()
+{
+  static GraphCache caches[LEGION_MAX_NUM_PROCS];
+  const auto proc = Legion::Processor::get_executing_processor();
+  auto proc_id    = proc.id & (LEGION_MAX_NUM_PROCS - 1);
+  return caches[proc_id];
+}
+
+}  // namespace cuda
+}  // namespace legate
@@ -0,0 +1,104 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <unordered_map>
+
+#include <cuda_runtime.h>
+#include "legion.h"
+
+/**
+ * @file
+ * @brief Class definition for legate::cuda::GraphCache
+ */
+
+namespace legate {
+namespace cuda {
+
+/**
+ * @ingroup task
+ * @brief A per-processor cache of instantiated CUDA graphs for repeated kernel sequences
+ *
+ * Short kernel sequences that repeat every iteration pay more in launch overhead than in
+ * kernel time. A task variant can opt in to capturing its stream work into a CUDA graph
+ * once and replaying the instantiated graph on subsequent executions:
+ *
+ * @code{.cpp}
+ * auto stream = StreamPool::get_stream_pool().get_stream();
+ * auto& cache = GraphCache::get_graph_cache();
+ * if (!cache.replay(key, stream)) {
+ *   cache.begin_capture(stream);
+ *   // ... launch kernels on stream ...
+ *   cache.end_capture(key, stream);
+ * }
+ * @endcode
+ *
+ * The key must identify everything the captured work depends on: the shapes of the
+ * arguments and the device addresses the kernels read and write. A replayed graph reuses
+ * the addresses baked in at capture time, so replay is only sound when those addresses are
+ * stable across invocations (e.g. when Legion maps the task to the same instances under
+ * trace replay); folding the base pointers into the key guarantees a changed mapping or
+ * shape simply misses, and the sequence runs and is captured afresh.
+ */
+class GraphCache {
+ public:
+  ~GraphCache();
+
+ public:
+  /**
+   * @brief Replays the cached graph for the key if one exists
+   *
+   * @param key Key identifying the captured work, covering argument shapes and the device
+   * addresses the kernels touch
+   * @param stream Stream to launch the replayed graph on
+   *
+   * @return true when a cached graph was launched, false otherwise
+   */
+  bool replay(uint64_t key, cudaStream_t stream);
+  /**
+   * @brief Starts capturing work submitted to the stream
+   *
+   * @param stream Stream whose subsequent work is captured
+   */
+  void begin_capture(cudaStream_t stream);
+  /**
+   * @brief Ends the capture, caches the instantiated graph under the key, and launches it
+   *
+   * Work submitted during capture does not execute, so this call also launches the new
+   * graph to perform the captured work for the current execution.
+   *
+   * @param key Key to cache the graph under
+   * @param stream Stream the capture was started on
+   */
+  void end_capture(uint64_t key, cudaStream_t stream);
+
+ public:
+  /**
+   * @brief Returns the graph cache for the executing processor
+   *
+   * The cache is alive throughout the program execution.
+   *
+   * @return A `GraphCache` object
+   */
+  static GraphCache& get_graph_cache();
+
+ private:
+  std::unordered_map<uint64_t, cudaGraphExec_t> graphs_{};
+};
+
+}  // namespace cuda
+}  // namespace legate
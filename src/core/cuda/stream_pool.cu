@@ -18,21 +18,52 @@
 #include "core/cuda/stream_pool.h"
 #include "core/runtime/runtime.h"
 
+#include "realm/cuda/cuda_module.h"
+
 namespace legate {
 namespace cuda {
 
+namespace {
+
+// Temporarily makes `device` the current device when it isn't already. Stream creation and
+// event recording land on the current device's context, so the pool switches around those
+// calls when it is asked for a device other than the owning processor's.
+class AutoDeviceScope {
+ public:
+  AutoDeviceScope(int32_t device) : device_(device)
+  {
+    CHECK_CUDA(cudaGetDevice(&previous_));
+    if (previous_ != device_) CHECK_CUDA(cudaSetDevice(device_));
+  }
+  ~AutoDeviceScope()
+  {
+    if (previous_ != device_) CHECK_CUDA(cudaSetDevice(previous_));
+  }
+
+ public:
+  AutoDeviceScope(const AutoDeviceScope&)            = delete;
+  AutoDeviceScope& operator=(const AutoDeviceScope&) = delete;
+
+ private:
+  int32_t device_{-1};
+  int32_t previous_{-1};
+};
+
+}  // namespace
+
 StreamView::~StreamView()
 {
   if (valid_ && Core::synchronize_stream_view) {
 #ifdef DEBUG_LEGATE
     CHECK_CUDA_STREAM(stream_);
 #else
-    CHECK_CUDA(cudaStreamSynchronize(stream_));
+    StreamPool::get_stream_pool().record_completion(stream_, device_);
 #endif
   }
 }
 
-StreamView::StreamView(StreamView&& rhs) : valid_(rhs.valid_), stream_(rhs.stream_)
+StreamView::StreamView(StreamView&& rhs)
+  : valid_(rhs.valid_), stream_(rhs.stream_), device_(rhs.device_)
 {
   rhs.valid_ = false;
 }
@@ -41,23 +72,178 @@ StreamView& StreamView::operator=(StreamView&& rhs)
 {
   valid_     = rhs.valid_;
   stream_    = rhs.stream_;
+  device_    = rhs.device_;
   rhs.valid_ = false;
   return *this;
 }
 
 StreamPool::~StreamPool()
 {
-  if (cached_stream_ != nullptr) CHECK_CUDA(cudaStreamDestroy(*cached_stream_));
+  // Streams and events may be destroyed from any device context, so no switching is needed
+  for (auto& streams : device_streams_) {
+    if (streams.cached_stream != nullptr) CHECK_CUDA(cudaStreamDestroy(*streams.cached_stream));
+    for (auto& worker_stream : streams.worker_streams)
+      if (worker_stream != nullptr) CHECK_CUDA(cudaStreamDestroy(*worker_stream));
+    if (streams.high_priority_stream != nullptr)
+      CHECK_CUDA(cudaStreamDestroy(*streams.high_priority_stream));
+    for (auto& event : streams.pending_events) {
+      CHECK_CUDA(cudaEventSynchronize(event));
+      CHECK_CUDA(cudaEventDestroy(event));
+    }
+    for (auto& event : streams.free_events) CHECK_CUDA(cudaEventDestroy(event));
+  }
+}
+
+void StreamPool::record_completion(cudaStream_t stream, int32_t device)
+{
+  if (device < 0) CHECK_CUDA(cudaGetDevice(&device));
+  auto& streams = device_streams(device);
+  reclaim_events(streams);
+  cudaEvent_t event;
+  {
+    // The event must be created and recorded in the device context its stream belongs to
+    AutoDeviceScope scope(device);
+    event = get_event(streams);
+    CHECK_CUDA(cudaEventRecord(event, stream));
+  }
+  auto* task_stream = Realm::Cuda::get_task_cuda_stream();
+  if (nullptr != task_stream) {
+    // Chaining the event onto the task stream makes the outstanding work part of what Realm
+    // already tracks for the task's completion, so the task thread keeps running while the
+    // GPU drains; the context synchronization Realm would otherwise do at task end to catch
+    // untracked work becomes unnecessary. Waiting on another device's event is legal, so
+    // this also covers work handed out for the processor's peer devices
+    CHECK_CUDA(cudaStreamWaitEvent(task_stream, event, 0));
+    Realm::Cuda::set_task_ctxsync_required(false);
+    streams.pending_events.push_back(event);
+  } else {
+    // Not inside a GPU task, so there's no Realm stream to hand the tracking to
+    CHECK_CUDA(cudaEventSynchronize(event));
+    streams.free_events.push_back(event);
+  }
+}
+
+cudaEvent_t StreamPool::get_event(DeviceStreams& streams)
+{
+  if (!streams.free_events.empty()) {
+    auto event = streams.free_events.back();
+    streams.free_events.pop_back();
+    return event;
+  }
+  cudaEvent_t event;
+  CHECK_CUDA(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  return event;
+}
+
+void StreamPool::reclaim_events(DeviceStreams& streams)
+{
+  while (!streams.pending_events.empty()) {
+    auto event  = streams.pending_events.front();
+    auto status = cudaEventQuery(event);
+    if (cudaErrorNotReady == status) break;
+    CHECK_CUDA(status);
+    streams.pending_events.pop_front();
+    streams.free_events.push_back(event);
+  }
+}
+
+void StreamPool::enable_peer_access(int32_t device)
+{
+  device_streams(device).peer_access_enabled = true;
+  int32_t num_devices                        = 0;
+  CHECK_CUDA(cudaGetDeviceCount(&num_devices));
+  AutoDeviceScope scope(device);
+  for (int32_t peer = 0; peer < num_devices; ++peer) {
+    if (peer == device) continue;
+    int32_t can_access = 0;
+    CHECK_CUDA(cudaDeviceCanAccessPeer(&can_access, device, peer));
+    if (!can_access) continue;
+    auto result = cudaDeviceEnablePeerAccess(peer, 0);
+    // Realm or another library may have mapped the peer already
+    if (cudaErrorPeerAccessAlreadyEnabled == result) {
+      static_cast<void>(cudaGetLastError());
+      continue;
+    }
+    CHECK_CUDA(result);
+  }
 }
 
 StreamView StreamPool::get_stream()
 {
-  if (nullptr == cached_stream_) {
+  int32_t device = 0;
+  CHECK_CUDA(cudaGetDevice(&device));
+  return get_stream(device);
+}
+
+StreamView StreamPool::get_stream(int32_t device)
+{
+  auto& streams = device_streams(device);
+  if (!streams.peer_access_enabled) enable_peer_access(device);
+  if (nullptr == streams.cached_stream) {
+    AutoDeviceScope scope(device);
     cudaStream_t stream;
     CHECK_CUDA(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
-    cached_stream_ = std::make_unique<cudaStream_t>(stream);
+    streams.cached_stream = std::make_unique<cudaStream_t>(stream);
+  }
+  return StreamView(*streams.cached_stream, device);
+}
+
+StreamView StreamPool::get_next_stream()
+{
+  int32_t device = 0;
+  CHECK_CUDA(cudaGetDevice(&device));
+  return get_next_stream(device);
+}
+
+StreamView StreamPool::get_next_stream(int32_t device)
+{
+  auto& streams = device_streams(device);
+  if (!streams.peer_access_enabled) enable_peer_access(device);
+  auto& worker_stream = streams.worker_streams[streams.next_worker];
+  streams.next_worker = (streams.next_worker + 1) % NUM_WORKER_STREAMS;
+  if (nullptr == worker_stream) {
+    AutoDeviceScope scope(device);
+    cudaStream_t stream;
+    CHECK_CUDA(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+    worker_stream = std::make_unique<cudaStream_t>(stream);
+  }
+  return StreamView(*worker_stream, device);
+}
+
+StreamView StreamPool::get_high_priority_stream()
+{
+  int32_t device = 0;
+  CHECK_CUDA(cudaGetDevice(&device));
+  return get_high_priority_stream(device);
+}
+
+StreamView StreamPool::get_high_priority_stream(int32_t device)
+{
+  auto& streams = device_streams(device);
+  if (!streams.peer_access_enabled) enable_peer_access(device);
+  if (nullptr == streams.high_priority_stream) {
+    AutoDeviceScope scope(device);
+    int32_t least_priority    = 0;
+    int32_t greatest_priority = 0;
+    CHECK_CUDA(cudaDeviceGetStreamPriorityRange(&least_priority, &greatest_priority));
+    cudaStream_t stream;
+    CHECK_CUDA(cudaStreamCreateWithPriority(&stream, cudaStreamNonBlocking, greatest_priority));
+    streams.high_priority_stream = std::make_unique<cudaStream_t>(stream);
   }
-  return StreamView(*cached_stream_);
+  return StreamView(*streams.high_priority_stream, device);
+}
+
+StreamPool::DeviceStreams& StreamPool::device_streams(int32_t device)
+{
+  if (device_streams_.empty()) {
+    int32_t num_devices = 0;
+    CHECK_CUDA(cudaGetDeviceCount(&num_devices));
+    device_streams_.resize(num_devices);
+  }
+#ifdef DEBUG_LEGATE
+  assert(device >= 0 && static_cast<size_t>(device) < device_streams_.size());
+#endif
+  return device_streams_[device];
 }
 
 /*static*/ StreamPool& StreamPool::get_stream_pool()
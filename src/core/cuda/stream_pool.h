@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
+#include <vector>
 
 #include <cuda_runtime.h>
 #include "legion.h"
@@ -33,8 +35,11 @@ namespace cuda {
  * @ingroup task
  * @brief A simple wrapper around CUDA streams to inject auxiliary features
  *
- * When `LEGATE_SYNC_STREAM_VIEW` is set to 1, every `StreamView` synchronizes the CUDA stream
- * that it wraps when it is destroyed.
+ * When `LEGATE_SYNC_STREAM_VIEW` is set to 1, every `StreamView` makes sure on destruction
+ * that the work on the CUDA stream it wraps is tracked: a pooled event is recorded on the
+ * stream and the executing task's Realm stream is made to wait on it, so the task thread
+ * keeps running while the GPU drains. In debug mode the destructor synchronizes the stream
+ * instead, so kernel errors surface inside the task that issued them.
  */
 struct StreamView {
  public:
@@ -42,8 +47,13 @@ struct StreamView {
    * @brief Creates a `StreamView` with a raw CUDA stream
    *
    * @param stream Raw CUDA stream to wrap
+   * @param device Device that `stream` belongs to; `-1` means the device that is current
+   * when the view is destroyed
    */
-  StreamView(cudaStream_t stream) : valid_(true), stream_(stream) {}
+  StreamView(cudaStream_t stream, int32_t device = -1)
+    : valid_(true), stream_(stream), device_(device)
+  {
+  }
   ~StreamView();
 
  public:
@@ -65,6 +75,7 @@ struct StreamView {
  private:
   bool valid_;
   cudaStream_t stream_;
+  int32_t device_{-1};
 };
 
 /**
@@ -79,10 +90,61 @@ struct StreamPool {
   /**
    * @brief Returns a `StreamView` in the pool
    *
-   * @return A `StreamView` object. Currently, all stream views returned from this pool are backed
-   * by the same CUDA stream.
+   * @return A `StreamView` object. All stream views returned from this call for a given device
+   * are backed by the same CUDA stream, so work submitted through them executes in program
+   * order.
    */
   StreamView get_stream();
+  /**
+   * @brief Returns a `StreamView` backed by `device`'s default stream in the pool
+   *
+   * Use this overload from task bodies that drive multiple GPUs from one processor (e.g. P2P
+   * pipelines); the parameterless overload always resolves to the caller's current device.
+   * The pool creates the stream in the right device context, but the caller is still
+   * responsible for making `device` current before launching kernels on it.
+   *
+   * @param device Device the stream should belong to
+   *
+   * @return A `StreamView` object backed by `device`'s default stream
+   */
+  StreamView get_stream(int32_t device);
+  /**
+   * @brief Returns a `StreamView` from a small round-robin set of streams
+   *
+   * Work handed out through this call can overlap with work on other streams from this pool,
+   * including the default one returned by `get_stream`. Callers must order dependent work
+   * across streams themselves (e.g. with events); use `get_stream` when program order is
+   * required. Note also that non-stream-ordered `DeferredBuffer`s (see `core/data/buffer.h`)
+   * must not be handed between streams without synchronization.
+   *
+   * @return A `StreamView` object backed by the next stream in the round-robin lane
+   */
+  StreamView get_next_stream();
+  /**
+   * @brief Same as `get_next_stream`, but for `device`'s round-robin lane
+   *
+   * @param device Device the stream should belong to
+   *
+   * @return A `StreamView` object backed by the next stream in `device`'s round-robin lane
+   */
+  StreamView get_next_stream(int32_t device);
+  /**
+   * @brief Returns a `StreamView` backed by a high-priority stream
+   *
+   * Intended for latency-critical copies that should jump ahead of bulk work queued on the
+   * other lanes. The same cross-stream ordering caveats as `get_next_stream` apply.
+   *
+   * @return A `StreamView` object backed by the pool's high-priority stream
+   */
+  StreamView get_high_priority_stream();
+  /**
+   * @brief Same as `get_high_priority_stream`, but for `device`
+   *
+   * @param device Device the stream should belong to
+   *
+   * @return A `StreamView` object backed by `device`'s high-priority stream
+   */
+  StreamView get_high_priority_stream(int32_t device);
 
  public:
   /**
@@ -94,11 +156,51 @@ struct StreamPool {
    */
   static StreamPool& get_stream_pool();
 
+ public:
+  // Used by ~StreamView: records a pooled event on the stream and hands completion tracking
+  // to the executing task's Realm stream, falling back to a blocking wait when there is none.
+  // `device` is the device the stream belongs to; -1 means the caller's current device
+  void record_completion(cudaStream_t stream, int32_t device = -1);
+
+ private:
+  static constexpr int32_t NUM_WORKER_STREAMS = 4;
+
+ private:
+  // Each device the pool is asked for gets its own stream lanes and event lists, so task
+  // bodies that drive multiple GPUs from one processor are not funneled through whichever
+  // device happened to be current at the pool's first use
+  struct DeviceStreams {
+    // The default stream stays unique per device: all `get_stream` callers share it, which
+    // is what keeps the use of non-stream-ordered `DeferredBuffer`s in `core/data/buffer.h`
+    // safe. The worker and high-priority lanes are opt-in for callers that manage their own
+    // cross-stream ordering.
+    std::unique_ptr<cudaStream_t> cached_stream{nullptr};
+    std::unique_ptr<cudaStream_t> worker_streams[NUM_WORKER_STREAMS];
+    std::unique_ptr<cudaStream_t> high_priority_stream{nullptr};
+    uint32_t next_worker{0};
+    // Events are recycled through a free list to avoid the create/destroy cost per stream
+    // view; in-flight ones sit on the pending list until a later query finds them complete.
+    // The lists are per-device because an event can only be recorded on streams of the
+    // device it was created on
+    std::vector<cudaEvent_t> free_events{};
+    std::deque<cudaEvent_t> pending_events{};
+    bool peer_access_enabled{false};
+  };
+
+ private:
+  DeviceStreams& device_streams(int32_t device);
+  cudaEvent_t get_event(DeviceStreams& streams);
+  void reclaim_events(DeviceStreams& streams);
+  // Enables CUDA peer access from `device` to every visible peer the hardware supports, so
+  // inter-GPU copies take the direct NVLink/PCIe path even when Realm has not established
+  // one. Runs once per device, on its first stream request.
+  void enable_peer_access(int32_t device);
+
  private:
-  // For now we keep only one stream in the pool
-  // TODO: If this ever changes, the use of non-stream-ordered `DeferredBuffer`s
-  // in `core/data/buffer.h` will no longer be safe.
-  std::unique_ptr<cudaStream_t> cached_stream_{nullptr};
+  // Lazily sized to the visible device count on the first stream request. The pool is
+  // per-processor and each Realm processor runs on a dedicated thread, so none of this
+  // needs locking
+  std::vector<DeviceStreams> device_streams_{};
 };
 
 }  // namespace cuda
@@ -17,8 +17,64 @@
 #include "core/data/allocator.h"
 #include "legate.h"
 
+#ifdef LEGATE_USE_CUDA
+#include "core/cuda/cuda_help.h"
+
+#include <mutex>
+#endif
+
 namespace legate {
 
+namespace {
+
+constexpr size_t MIN_SIZE_CLASS = 16;
+
+#ifdef LEGATE_USE_CUDA
+
+// A process-wide pool of pinned host blocks for H2D/D2H staging. Blocks are registered once
+// via cudaHostAlloc and recycled forever after; free lists are kept per processor so tasks
+// running concurrently on different processors reuse blocks they (or their predecessors on
+// the same processor) touched last
+class PinnedStagingPool {
+ public:
+  void* allocate(size_t capacity)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& free_list = free_lists_[Legion::Processor::get_executing_processor().id][capacity];
+      if (!free_list.empty()) {
+        void* ptr = free_list.back();
+        free_list.pop_back();
+        return ptr;
+      }
+    }
+    void* ptr = nullptr;
+    CHECK_CUDA(cudaHostAlloc(&ptr, capacity, cudaHostAllocDefault));
+    return ptr;
+  }
+
+  void release(void* ptr, size_t capacity)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_lists_[Legion::Processor::get_executing_processor().id][capacity].push_back(ptr);
+  }
+
+ public:
+  static PinnedStagingPool& get_pool()
+  {
+    static PinnedStagingPool pool;
+    return pool;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<uint64_t, std::unordered_map<size_t, std::vector<void*>>> free_lists_;
+};
+
+#endif  // LEGATE_USE_CUDA
+
+}  // namespace
+
 ScopedAllocator::ScopedAllocator(Memory::Kind kind, bool scoped, size_t alignment)
   : target_kind_(kind), scoped_(scoped), alignment_(alignment)
 {
@@ -27,26 +83,72 @@ ScopedAllocator::ScopedAllocator(Memory::Kind kind, bool scoped, size_t alignmen
 ScopedAllocator::~ScopedAllocator()
 {
   if (scoped_) {
-    for (auto& pair : buffers_) { pair.second.destroy(); }
+    for (auto& pair : buffers_) { pair.second.buffer.destroy(); }
     buffers_.clear();
+    for (auto& pair : free_lists_) {
+      for (auto& buffer : pair.second) { buffer.destroy(); }
+    }
+    free_lists_.clear();
   }
+#ifdef LEGATE_USE_CUDA
+  for (auto& pair : pinned_blocks_)
+    PinnedStagingPool::get_pool().release(const_cast<void*>(pair.first), pair.second);
+  pinned_blocks_.clear();
+#endif
+}
+
+size_t ScopedAllocator::size_class(size_t bytes) const
+{
+  size_t result = MIN_SIZE_CLASS;
+  while (result < bytes) result <<= 1;
+  return result;
 }
 
 void* ScopedAllocator::allocate(size_t bytes)
 {
   if (bytes == 0) return nullptr;
 
-  ByteBuffer buffer = create_buffer<int8_t>(bytes, target_kind_, alignment_);
+  size_t capacity = size_class(bytes);
+
+#ifdef LEGATE_USE_CUDA
+  // Z_COPY allocations from scoped allocators stage H2D/D2H transfers; serve them from the
+  // persistent pinned pool so the memory stays registered across scopes. Unscoped allocations
+  // must survive until the task finishes and cannot be handed back to a shared pool, so they
+  // keep going through the runtime.
+  if (scoped_ && Memory::Kind::Z_COPY_MEM == target_kind_) {
+    void* ptr           = PinnedStagingPool::get_pool().allocate(capacity);
+    pinned_blocks_[ptr] = capacity;
+    return ptr;
+  }
+#endif
+
+  ByteBuffer buffer;
+
+  auto finder = free_lists_.find(capacity);
+  if (finder != free_lists_.end() && !finder->second.empty()) {
+    buffer = finder->second.back();
+    finder->second.pop_back();
+  } else {
+    buffer = create_buffer<int8_t>(capacity, target_kind_, alignment_);
+  }
 
   void* ptr = buffer.ptr(0);
 
-  buffers_[ptr] = buffer;
+  buffers_[ptr] = Allocation{buffer, capacity};
   return ptr;
 }
 
 void ScopedAllocator::deallocate(void* ptr)
 {
-  ByteBuffer buffer;
+#ifdef LEGATE_USE_CUDA
+  auto pinned_finder = pinned_blocks_.find(ptr);
+  if (pinned_finder != pinned_blocks_.end()) {
+    PinnedStagingPool::get_pool().release(ptr, pinned_finder->second);
+    pinned_blocks_.erase(pinned_finder);
+    return;
+  }
+#endif
+
   auto finder = buffers_.find(ptr);
   assert(finder != buffers_.end());
   if (finder == buffers_.end()) {
@@ -54,9 +156,9 @@ void ScopedAllocator::deallocate(void* ptr)
     LEGATE_ABORT;
   }
 
-  buffer = finder->second;
+  Allocation allocation = finder->second;
   buffers_.erase(finder);
-  buffer.destroy();
+  free_lists_[allocation.capacity].push_back(allocation.buffer);
 }
 
 }  // namespace legate
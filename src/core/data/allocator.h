@@ -19,6 +19,7 @@
 #include "core/data/buffer.h"
 
 #include <unordered_map>
+#include <vector>
 
 /**
  * @file
@@ -35,6 +36,10 @@ namespace legate {
  * the raw pointer to it. By default, all allocations are deallocated when the allocator is
  * destroyed, and can optionally be made alive until the task finishes by making the allocator
  * unscoped.
+ *
+ * When CUDA is enabled, scoped allocations of kind `Z_COPY_MEM` are served from a persistent
+ * per-processor pool of pinned host blocks instead of fresh `Buffer`s, so H2D/D2H staging
+ * reuses registered memory across allocator scopes.
  */
 class ScopedAllocator {
  public:
@@ -77,11 +82,26 @@ class ScopedAllocator {
    */
   void deallocate(void* ptr);
 
+ private:
+  // Allocations are rounded up to power-of-two size classes and deallocated buffers are parked
+  // on a per-class free list instead of being destroyed, so the allocate/deallocate churn of
+  // temporary workspaces recycles Realm instances within the scope rather than recreating them
+  size_t size_class(size_t bytes) const;
+
+  struct Allocation {
+    ByteBuffer buffer{};
+    size_t capacity{0};
+  };
+
  private:
   Memory::Kind target_kind_{Memory::Kind::SYSTEM_MEM};
   bool scoped_;
   size_t alignment_;
-  std::unordered_map<const void*, ByteBuffer> buffers_{};
+  std::unordered_map<const void*, Allocation> buffers_{};
+  std::unordered_map<size_t, std::vector<ByteBuffer>> free_lists_{};
+  // Pinned blocks borrowed from the process-wide staging pool, by capacity; only used for
+  // scoped Z_COPY_MEM allocations when CUDA is enabled
+  std::unordered_map<const void*, size_t> pinned_blocks_{};
 };
 
 }  // namespace legate
@@ -20,6 +20,12 @@
 
 #include "core/utilities/machine.h"
 #include "core/utilities/typedefs.h"
+#include "legate_defines.h"
+
+#ifdef LEGATE_USE_CUDA
+#include "core/cuda/cuda_help.h"
+#include "core/cuda/stream_pool.h"
+#endif
 
 /**
  * @file
@@ -59,6 +65,40 @@ namespace legate {
 template <typename VAL, int32_t DIM = 1>
 using Buffer = Legion::DeferredBuffer<VAL, DIM>;
 
+/**
+ * @ingroup data
+ * @brief Alignment, in bytes, guaranteed for allocations made through `create_buffer` unless
+ * the caller asks for a stronger one
+ *
+ * 64 bytes covers a full cache line and the widest SIMD extension in common use (AVX-512),
+ * so kernels can take aligned load/store paths on buffer pointers. The guarantee is part of
+ * the API: combine it with `assume_aligned` to let the compiler rely on it.
+ */
+inline constexpr size_t DEFAULT_BUFFER_ALIGNMENT = 64;
+
+/**
+ * @ingroup data
+ * @brief Marks a pointer as carrying an `ALIGN`-byte alignment guarantee, so the compiler can
+ * emit aligned vector loads and stores through it
+ *
+ * Equivalent to C++20 `std::assume_aligned`. The pointer must come from an allocation with at
+ * least `ALIGN`-byte alignment, e.g. the `ptr` of a buffer made by `create_buffer`, whose
+ * default guarantee is `DEFAULT_BUFFER_ALIGNMENT`; otherwise the behavior is undefined.
+ *
+ * @param ptr Pointer to mark
+ *
+ * @return The same pointer, carrying the alignment guarantee
+ */
+template <size_t ALIGN = DEFAULT_BUFFER_ALIGNMENT, typename VAL>
+__CUDA_HD__ inline VAL* assume_aligned(VAL* ptr)
+{
+#if defined(__CUDA_ARCH__) || !(defined(__GNUC__) || defined(__clang__))
+  return ptr;
+#else
+  return static_cast<VAL*>(__builtin_assume_aligned(ptr, ALIGN));
+#endif
+}
+
 /**
  * @ingroup data
  * @brief Creates a `Buffer` of specific extents
@@ -66,14 +106,15 @@ using Buffer = Legion::DeferredBuffer<VAL, DIM>;
  * @param extents Extents of the buffer
  * @param kind Kind of the target memory (optional). If not given, the runtime will pick
  * automatically based on the executing processor
- * @param alignment Alignment for the memory allocation (optional)
+ * @param alignment Alignment for the memory allocation (optional). Defaults to
+ * `DEFAULT_BUFFER_ALIGNMENT`; the allocation is guaranteed to honor whatever is passed here
  *
  * @return A `Buffer` object
  */
 template <typename VAL, int32_t DIM>
 Buffer<VAL, DIM> create_buffer(const Point<DIM>& extents,
                                Memory::Kind kind = Memory::Kind::NO_MEMKIND,
-                               size_t alignment  = 16)
+                               size_t alignment  = DEFAULT_BUFFER_ALIGNMENT)
 {
   if (Memory::Kind::NO_MEMKIND == kind) kind = find_memory_kind_for_executing_processor(false);
   auto hi = extents - Point<DIM>::ONES();
@@ -90,16 +131,85 @@ Buffer<VAL, DIM> create_buffer(const Point<DIM>& extents,
  * @param size Size of the buffdr
  * @param kind Kind of the target memory (optional). If not given, the runtime will pick
  * automatically based on the executing processor
- * @param alignment Alignment for the memory allocation (optional)
+ * @param alignment Alignment for the memory allocation (optional). Defaults to
+ * `DEFAULT_BUFFER_ALIGNMENT`; the allocation is guaranteed to honor whatever is passed here
  *
  * @return A 1D `Buffer` object
  */
 template <typename VAL>
 Buffer<VAL> create_buffer(size_t size,
                           Memory::Kind kind = Memory::Kind::NO_MEMKIND,
-                          size_t alignment  = 16)
+                          size_t alignment  = DEFAULT_BUFFER_ALIGNMENT)
 {
   return create_buffer<VAL, 1>(Point<1>(size), kind, alignment);
 }
 
+#ifdef LEGATE_USE_CUDA
+
+/**
+ * @ingroup data
+ * @brief A typed device buffer backed by stream-ordered CUDA allocation
+ *
+ * Unlike a `Buffer` in `GPU_FB_MEM`, whose backing instance is created eagerly through
+ * Realm, a `StreamOrderedBuffer` allocates with `cudaMallocAsync` on the task's stream and
+ * frees with `cudaFreeAsync`, so small device temporaries do not serialize on Realm
+ * instance creation. The allocation and all uses must stay ordered on the one stream the
+ * buffer was created with; `destroy()` must be called on the same stream before the task
+ * returns. `ptr` and the index operator mirror the corresponding `Buffer` methods.
+ */
+template <typename VAL>
+class StreamOrderedBuffer {
+ public:
+  StreamOrderedBuffer() {}
+  StreamOrderedBuffer(size_t size, cudaStream_t stream) : size_(size), stream_(stream)
+  {
+    CHECK_CUDA(cudaMallocAsync(reinterpret_cast<void**>(&data_), size * sizeof(VAL), stream_));
+  }
+
+ public:
+  /**
+   * @brief Returns a raw pointer to the allocation
+   *
+   * @return A raw pointer to the allocation
+   */
+  VAL* ptr(size_t offset = 0) const { return data_ + offset; }
+  __CUDA_HD__ VAL& operator[](size_t idx) const { return data_[idx]; }
+  size_t size() const { return size_; }
+
+ public:
+  /**
+   * @brief Releases the allocation back to the stream-ordered pool. The free is enqueued
+   * on the creation stream, so kernels already launched on that stream can still use the
+   * buffer safely.
+   */
+  void destroy()
+  {
+    if (nullptr == data_) return;
+    CHECK_CUDA(cudaFreeAsync(data_, stream_));
+    data_ = nullptr;
+  }
+
+ private:
+  size_t size_{0};
+  cudaStream_t stream_{};
+  VAL* data_{nullptr};
+};
+
+/**
+ * @ingroup data
+ * @brief Creates a `StreamOrderedBuffer` of a specific size on a stream
+ *
+ * @param size Size of the buffer, in elements
+ * @param stream Stream on which the buffer is allocated and must be used and destroyed
+ *
+ * @return A `StreamOrderedBuffer` object
+ */
+template <typename VAL>
+StreamOrderedBuffer<VAL> create_async_buffer(size_t size, const cuda::StreamView& stream)
+{
+  return StreamOrderedBuffer<VAL>(size, stream);
+}
+
+#endif  // LEGATE_USE_CUDA
+
 }  // namespace legate
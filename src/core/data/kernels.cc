@@ -0,0 +1,236 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "core/data/kernels.h"
+
+#include <cstring>
+
+#include "core/type/type_traits.h"
+#include "core/utilities/dispatch.h"
+
+#ifdef LEGATE_USE_CUDA
+#include "core/cuda/cuda_help.h"
+#include "core/cuda/stream_pool.h"
+#endif
+
+namespace legate {
+namespace kernel {
+
+#ifdef LEGATE_USE_CUDA
+namespace detail {
+
+void fill_on_device(void* dst, const void* value, size_t elem_size, size_t volume, cudaStream_t);
+
+}  // namespace detail
+#endif
+
+namespace {
+
+// A layout is flat-iterable when its strides are exactly the row-major strides of the rect,
+// in which case the kernels below run a single loop over the volume
+template <int DIM>
+bool is_dense_row_major(const Point<DIM>& extents, const size_t strides[DIM])
+{
+  size_t expected = 1;
+  for (int32_t dim = DIM - 1; dim >= 0; --dim) {
+    if (extents[dim] > 1 && strides[dim] != expected) return false;
+    expected *= extents[dim];
+  }
+  return true;
+}
+
+bool on_gpu()
+{
+#ifdef LEGATE_USE_CUDA
+  return Processor::get_executing_processor().kind() == Processor::Kind::TOC_PROC;
+#else
+  return false;
+#endif
+}
+
+// CPU variants must not spawn threads of their own, so the OpenMP loops are conditional on
+// actually running on an OpenMP processor
+#if defined(LEGATE_USE_OPENMP) && defined(_OPENMP)
+bool on_omp()
+{
+  return Processor::get_executing_processor().kind() == Processor::Kind::OMP_PROC;
+}
+#endif
+
+struct fill_fn {
+  template <Type::Code CODE, int DIM>
+  void operator()(Store& dst, const Scalar& scalar)
+  {
+    using T = legate_type_of<CODE>;
+
+    auto rect = dst.shape<DIM>();
+    if (rect.empty()) return;
+    auto acc   = dst.write_accessor<T, DIM>(rect);
+    auto value = scalar.value<T>();
+
+    size_t strides[DIM];
+    T* base            = acc.ptr(rect, strides);
+    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
+    size_t volume      = rect.volume();
+
+    if (on_gpu()) {
+#ifdef LEGATE_USE_CUDA
+#ifdef DEBUG_LEGATE
+      assert(is_dense_row_major<DIM>(extents, strides));
+#endif
+      detail::fill_on_device(
+        base, &value, sizeof(T), volume, cuda::StreamPool::get_stream_pool().get_stream());
+#endif
+      return;
+    }
+
+    if (is_dense_row_major<DIM>(extents, strides)) {
+#if defined(LEGATE_USE_OPENMP) && defined(_OPENMP)
+#pragma omp parallel for schedule(static) if (on_omp())
+#endif
+      for (int64_t idx = 0; idx < static_cast<int64_t>(volume); ++idx) base[idx] = value;
+    } else
+      for (PointInRectIterator<DIM> itr(rect); itr.valid(); ++itr) acc[*itr] = value;
+  }
+};
+
+struct copy_fn {
+  template <Type::Code CODE, int DIM>
+  void operator()(Store& dst, const Store& src)
+  {
+    using T = legate_type_of<CODE>;
+
+    auto rect = dst.shape<DIM>();
+#ifdef DEBUG_LEGATE
+    assert(rect == src.shape<DIM>());
+#endif
+    if (rect.empty()) return;
+    auto wr_acc = dst.write_accessor<T, DIM>(rect);
+    auto rd_acc = src.read_accessor<T, DIM>(rect);
+
+    size_t wr_strides[DIM];
+    size_t rd_strides[DIM];
+    T* wr_base         = wr_acc.ptr(rect, wr_strides);
+    const T* rd_base   = rd_acc.ptr(rect, rd_strides);
+    Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
+    size_t volume      = rect.volume();
+
+    bool dense = is_dense_row_major<DIM>(extents, wr_strides) &&
+                 is_dense_row_major<DIM>(extents, rd_strides);
+
+    if (on_gpu()) {
+#ifdef LEGATE_USE_CUDA
+#ifdef DEBUG_LEGATE
+      assert(dense);
+#endif
+      CHECK_CUDA(cudaMemcpyAsync(wr_base,
+                                 rd_base,
+                                 volume * sizeof(T),
+                                 cudaMemcpyDeviceToDevice,
+                                 cuda::StreamPool::get_stream_pool().get_stream()));
+#endif
+      return;
+    }
+
+    if (dense)
+      memcpy(wr_base, rd_base, volume * sizeof(T));
+    else
+      for (PointInRectIterator<DIM> itr(rect); itr.valid(); ++itr) wr_acc[*itr] = rd_acc[*itr];
+  }
+};
+
+template <int DIM>
+struct cast_body_fn {
+  template <Type::Code SRC_CODE, Type::Code DST_CODE>
+  void operator()(Store& dst, const Store& src)
+  {
+    using SRC = legate_type_of<SRC_CODE>;
+    using DST = legate_type_of<DST_CODE>;
+
+    if constexpr (std::is_convertible<SRC, DST>::value) {
+      auto rect = dst.shape<DIM>();
+#ifdef DEBUG_LEGATE
+      assert(rect == src.shape<DIM>());
+#endif
+      if (rect.empty()) return;
+      auto wr_acc = dst.write_accessor<DST, DIM>(rect);
+      auto rd_acc = src.read_accessor<SRC, DIM>(rect);
+
+      size_t wr_strides[DIM];
+      size_t rd_strides[DIM];
+      DST* wr_base       = wr_acc.ptr(rect, wr_strides);
+      const SRC* rd_base = rd_acc.ptr(rect, rd_strides);
+      Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
+      size_t volume      = rect.volume();
+
+      if (is_dense_row_major<DIM>(extents, wr_strides) &&
+          is_dense_row_major<DIM>(extents, rd_strides)) {
+#if defined(LEGATE_USE_OPENMP) && defined(_OPENMP)
+#pragma omp parallel for schedule(static) if (on_omp())
+#endif
+        for (int64_t idx = 0; idx < static_cast<int64_t>(volume); ++idx)
+          wr_base[idx] = static_cast<DST>(rd_base[idx]);
+      } else
+        for (PointInRectIterator<DIM> itr(rect); itr.valid(); ++itr)
+          wr_acc[*itr] = static_cast<DST>(rd_acc[*itr]);
+    } else
+      // The dispatch tables instantiate all pairs; inconvertible ones are unreachable by
+      // contract
+      LEGATE_ABORT;
+  }
+};
+
+struct cast_fn {
+  template <int DIM>
+  void operator()(Store& dst, const Store& src)
+  {
+    type_type_dispatch(src.code(), dst.code(), cast_body_fn<DIM>{}, dst, src);
+  }
+};
+
+}  // namespace
+
+void fill(Store& dst, const Scalar& value)
+{
+#ifdef DEBUG_LEGATE
+  assert(dst.is_writable());
+  assert(dst.code() == value.type().code);
+#endif
+  double_dispatch(dst.dim(), dst.code(), fill_fn{}, dst, value);
+}
+
+void copy(Store& dst, const Store& src)
+{
+#ifdef DEBUG_LEGATE
+  assert(dst.is_writable() && src.is_readable());
+  assert(dst.code() == src.code() && dst.dim() == src.dim());
+#endif
+  double_dispatch(dst.dim(), dst.code(), copy_fn{}, dst, src);
+}
+
+void cast(Store& dst, const Store& src)
+{
+#ifdef DEBUG_LEGATE
+  assert(dst.is_writable() && src.is_readable());
+  assert(dst.dim() == src.dim());
+  assert(!on_gpu());
+#endif
+  if (dst.code() == src.code()) return copy(dst, src);
+  dim_dispatch(dst.dim(), cast_fn{}, dst, src);
+}
+
+}  // namespace kernel
+}  // namespace legate
@@ -0,0 +1,58 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "core/cuda/cuda_help.h"
+
+namespace legate {
+namespace kernel {
+namespace detail {
+
+namespace {
+
+// The fill value travels by value in the launch arguments, sized for the widest primitive
+// type (complex128), so no staging allocation is needed
+struct FillValue {
+  int8_t bytes[16];
+};
+
+__global__ void fill_elements(int8_t* dst, FillValue value, size_t elem_size, size_t volume)
+{
+  for (size_t idx = threadIdx.x + blockIdx.x * static_cast<size_t>(blockDim.x); idx < volume;
+       idx += blockDim.x * static_cast<size_t>(gridDim.x))
+    for (size_t pos = 0; pos < elem_size; ++pos) dst[idx * elem_size + pos] = value.bytes[pos];
+}
+
+}  // namespace
+
+void fill_on_device(void* dst, const void* value, size_t elem_size, size_t volume, cudaStream_t stream)
+{
+  assert(elem_size <= sizeof(FillValue));
+  FillValue fill_value;
+  memcpy(fill_value.bytes, value, elem_size);
+
+  auto config = cuda::launch_config(fill_elements, volume);
+  fill_elements<<<config.num_blocks, config.threads_per_block, 0, stream>>>(
+    static_cast<int8_t*>(dst), fill_value, elem_size, volume);
+  CHECK_CUDA_STREAM(stream);
+}
+
+}  // namespace detail
+}  // namespace kernel
+}  // namespace legate
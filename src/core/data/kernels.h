@@ -0,0 +1,73 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "core/data/scalar.h"
+#include "core/data/store.h"
+
+/**
+ * @file
+ * @brief Shared fill/copy/cast kernels over stores
+ */
+
+namespace legate {
+namespace kernel {
+
+/**
+ * @ingroup data
+ * @brief Fills a store with a scalar value
+ *
+ * The kernels in this namespace are meant to be called from inside task variants, where the
+ * stores are already mapped; they replace the fill/copy/cast loops that each library would
+ * otherwise write on its own. Contiguous row-major instances take a flat loop that the
+ * compiler can vectorize (parallelized with OpenMP when the variant runs on an OpenMP
+ * processor); other affine layouts fall back to an element walk. On GPU processors the fill
+ * runs on the task's cached stream and requires a contiguous instance.
+ *
+ * @param dst Store to fill; must be writable and have the same type as the value
+ * @param value Value to fill the store with
+ */
+void fill(Store& dst, const Scalar& value);
+
+/**
+ * @ingroup data
+ * @brief Copies the contents of one store to another of the same type and shape
+ *
+ * Contiguous same-layout copies reduce to a single memcpy (a stream-ordered device copy on
+ * GPU processors); other affine layouts fall back to an element walk on CPU and OpenMP
+ * processors.
+ *
+ * @param dst Store to copy into; must be writable
+ * @param src Store to copy from; must be readable and have the same type and shape as `dst`
+ */
+void copy(Store& dst, const Store& src);
+
+/**
+ * @ingroup data
+ * @brief Copies the contents of one store to another, converting the element type
+ *
+ * Conversions are performed with `static_cast`, so any pair of convertible element types is
+ * supported (narrowing included). Casts are available on CPU and OpenMP processors only;
+ * GPU variants should keep their own typed conversion kernels.
+ *
+ * @param dst Store to cast into; must be writable
+ * @param src Store to cast from; must be readable and have the same shape as `dst`
+ */
+void cast(Store& dst, const Store& src);
+
+}  // namespace kernel
+}  // namespace legate
@@ -18,23 +18,31 @@
 
 namespace legate {
 
-Scalar::Scalar(const Scalar& other) : own_(other.own_), type_(other.type_->clone()) { copy(other); }
+Scalar::Scalar(const Scalar& other) : own_(other.own_), type_(other.type_) { copy(other); }
 
-Scalar::Scalar(Scalar&& other) : own_(other.own_), type_(std::move(other.type_)), data_(other.data_)
+Scalar::Scalar(Scalar&& other) : own_(other.own_), type_(std::move(other.type_))
 {
+  // an inline value cannot be stolen by pointer; it has to move into this scalar's storage
+  if (other.is_inline()) {
+    memcpy(inline_storage_, other.inline_storage_, sizeof(inline_storage_));
+    data_ = inline_storage_;
+  } else {
+    data_ = other.data_;
+  }
   other.own_  = false;
   other.type_ = nullptr;
   other.data_ = nullptr;
 }
 
-Scalar::Scalar(std::unique_ptr<Type> type, const void* data) : type_(std::move(type)), data_(data)
+Scalar::Scalar(std::shared_ptr<const Type> type, const void* data)
+  : type_(std::move(type)), data_(data)
 {
 }
 
-Scalar::Scalar(const std::string& string) : own_(true), type_(string_type())
+Scalar::Scalar(const std::string& string) : own_(true), type_(intern_string_type())
 {
   auto data_size                  = sizeof(char) * string.size();
-  auto buffer                     = malloc(sizeof(uint32_t) + data_size);
+  auto buffer                     = allocate_buffer(sizeof(uint32_t) + data_size);
   *static_cast<uint32_t*>(buffer) = string.size();
   memcpy(static_cast<int8_t*>(buffer) + sizeof(uint32_t), string.data(), data_size);
   data_ = buffer;
@@ -42,7 +50,7 @@ Scalar::Scalar(const std::string& string) : own_(true), type_(string_type())
 
 Scalar::~Scalar()
 {
-  if (own_)
+  if (own_ && !is_inline())
     // We know we own this buffer
     free(const_cast<void*>(data_));
 }
@@ -50,7 +58,7 @@ Scalar::~Scalar()
 Scalar& Scalar::operator=(const Scalar& other)
 {
   own_  = other.own_;
-  type_ = other.type_->clone();
+  type_ = other.type_;
   copy(other);
   return *this;
 }
@@ -59,13 +67,19 @@ void Scalar::copy(const Scalar& other)
 {
   if (other.own_) {
     auto size   = other.size();
-    auto buffer = malloc(size);
+    auto buffer = allocate_buffer(size);
     memcpy(buffer, other.data_, size);
     data_ = buffer;
   } else
     data_ = other.data_;
 }
 
+void* Scalar::allocate_buffer(size_t size)
+{
+  if (size <= sizeof(inline_storage_)) return inline_storage_;
+  return malloc(size);
+}
+
 size_t Scalar::size() const
 {
   if (type_->code == Type::Code::STRING)
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "core/type/type_traits.h"
 #include "core/utilities/span.h"
 #include "core/utilities/typedefs.h"
@@ -54,7 +56,7 @@ class Scalar {
    * @param type Type of the scalar(s)
    * @param data Allocation containing the data.
    */
-  Scalar(std::unique_ptr<Type> type, const void* data);
+  Scalar(std::shared_ptr<const Type> type, const void* data);
   ~Scalar();
 
  public:
@@ -76,7 +78,7 @@ class Scalar {
    * @param value A scalar value to create a `Scalar` with
    */
   template <typename T>
-  Scalar(T value, std::unique_ptr<Type> type);
+  Scalar(T value, std::shared_ptr<const Type> type);
   /**
    * @brief Creates an owned scalar from a string. The value from the
    * original string will be copied.
@@ -133,6 +135,19 @@ class Scalar {
    */
   template <typename VAL>
   Span<const VAL> values() const;
+  /**
+   * @brief Returns a span directly over the `Scalar`'s backing allocation, with no copy.
+   *
+   * The span aliases the backing allocation, which for a shared `Scalar` can be the task's
+   * argument buffer itself; it stays valid only as long as the allocation does, so callers
+   * that outlive the `Scalar` must copy. For string scalars, `span<char>()` returns the
+   * character payload without the length prefix; for all other types this is equivalent to
+   * `values()`.
+   *
+   * @return A span over the values stored in the `Scalar`
+   */
+  template <typename VAL>
+  Span<const VAL> span() const;
   /**
    * @brief Returns a raw pointer to the backing allocation
    *
@@ -140,10 +155,19 @@ class Scalar {
    */
   const void* ptr() const { return data_; }
 
+ private:
+  // Small-buffer optimization: owned values no larger than the inline storage are kept inside
+  // the Scalar itself (launcher paths create millions of 4-16 byte owned scalars), in which
+  // case data_ points at inline_storage_ and the destructor has nothing to free
+  void* allocate_buffer(size_t size);
+  bool is_inline() const { return data_ == inline_storage_; }
+
  private:
   bool own_{false};
-  std::unique_ptr<Type> type_{nullptr};
+  // Types are immutable and interned, so copies of a scalar share the handle
+  std::shared_ptr<const Type> type_{nullptr};
   const void* data_;
+  alignas(alignof(std::max_align_t)) int8_t inline_storage_[16];
 };
 
 }  // namespace legate
@@ -17,35 +17,37 @@
 namespace legate {
 
 template <typename T>
-Scalar::Scalar(T value) : own_(true), type_(primitive_type(legate_type_code_of<T>))
+Scalar::Scalar(T value) : own_(true), type_(intern_primitive_type(legate_type_code_of<T>))
 {
   static_assert(legate_type_code_of<T> != Type::Code::FIXED_ARRAY);
   static_assert(legate_type_code_of<T> != Type::Code::STRUCT);
   static_assert(legate_type_code_of<T> != Type::Code::STRING);
   static_assert(legate_type_code_of<T> != Type::Code::INVALID);
-  auto buffer = malloc(sizeof(T));
+  auto buffer = allocate_buffer(sizeof(T));
   memcpy(buffer, &value, sizeof(T));
   data_ = buffer;
 }
 
 template <typename T>
-Scalar::Scalar(T value, std::unique_ptr<Type> type) : own_(true), type_(std::move(type))
+Scalar::Scalar(T value, std::shared_ptr<const Type> type) : own_(true), type_(std::move(type))
 {
   if (type_->code == Type::Code::INVALID)
     throw std::invalid_argument("Invalid type cannot be used");
   if (type_->size() != sizeof(T))
     throw std::invalid_argument("Size of the value doesn't match with the type");
-  auto buffer = malloc(sizeof(T));
+  auto buffer = allocate_buffer(sizeof(T));
   memcpy(buffer, &value, sizeof(T));
   data_ = buffer;
 }
 
 template <typename T>
 Scalar::Scalar(const std::vector<T>& values)
-  : own_(true), type_(fixed_array_type(primitive_type(legate_type_code_of<T>), values.size()))
+  : own_(true),
+    type_(intern_type(
+      fixed_array_type(intern_primitive_type(legate_type_code_of<T>), values.size())))
 {
   auto size   = type_->size();
-  auto buffer = malloc(size);
+  auto buffer = allocate_buffer(size);
   memcpy(buffer, values.data(), size);
   data_ = buffer;
 }
@@ -93,6 +95,22 @@ Span<const VAL> Scalar::values() const
   }
 }
 
+template <typename VAL>
+Span<const VAL> Scalar::span() const
+{
+  return values<VAL>();
+}
+
+template <>
+inline Span<const char> Scalar::span() const
+{
+  if (type_->code != Type::Code::STRING) return values<char>();
+  // Strings are stored as a 32-bit length followed by the characters; unlike value<std::string>,
+  // the characters are handed out in place
+  auto len = *static_cast<const uint32_t*>(data_);
+  return Span<const char>(static_cast<const char*>(data_) + sizeof(uint32_t), len);
+}
+
 template <>
 inline Legion::DomainPoint Scalar::value<Legion::DomainPoint>() const
 {
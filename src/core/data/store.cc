@@ -16,6 +16,8 @@
 
 #include "core/data/store.h"
 
+#include <unordered_map>
+
 #include "core/data/buffer.h"
 #include "core/utilities/dispatch.h"
 #include "core/utilities/machine.h"
@@ -31,16 +33,14 @@ namespace legate {
 RegionField::RegionField(int32_t dim, const Legion::PhysicalRegion& pr, Legion::FieldID fid)
   : dim_(dim), pr_(pr), fid_(fid)
 {
-  auto priv  = pr.get_privilege();
-  readable_  = static_cast<bool>(priv & LEGION_READ_PRIV);
-  writable_  = static_cast<bool>(priv & LEGION_WRITE_PRIV);
-  reducible_ = static_cast<bool>(priv & LEGION_REDUCE) || (readable_ && writable_);
 }
 
 RegionField::RegionField(RegionField&& other) noexcept
-  : dim_(other.dim_),
+  : accessor_cache_(std::move(other.accessor_cache_)),
+    dim_(other.dim_),
     pr_(other.pr_),
     fid_(other.fid_),
+    privileges_loaded_(other.privileges_loaded_),
     readable_(other.readable_),
     writable_(other.writable_),
     reducible_(other.reducible_)
@@ -49,15 +49,26 @@ RegionField::RegionField(RegionField&& other) noexcept
 
 RegionField& RegionField::operator=(RegionField&& other) noexcept
 {
-  dim_       = other.dim_;
-  pr_        = other.pr_;
-  fid_       = other.fid_;
-  readable_  = other.readable_;
-  writable_  = other.writable_;
-  reducible_ = other.reducible_;
+  accessor_cache_    = std::move(other.accessor_cache_);
+  dim_               = other.dim_;
+  pr_                = other.pr_;
+  fid_               = other.fid_;
+  privileges_loaded_ = other.privileges_loaded_;
+  readable_          = other.readable_;
+  writable_          = other.writable_;
+  reducible_         = other.reducible_;
   return *this;
 }
 
+void RegionField::load_privileges() const
+{
+  auto priv          = pr_.get_privilege();
+  readable_          = static_cast<bool>(priv & LEGION_READ_PRIV);
+  writable_          = static_cast<bool>(priv & LEGION_WRITE_PRIV);
+  reducible_         = static_cast<bool>(priv & LEGION_REDUCE) || (readable_ && writable_);
+  privileges_loaded_ = true;
+}
+
 bool RegionField::valid() const
 {
   return pr_.get_logical_region() != Legion::LogicalRegion::NO_REGION;
@@ -132,35 +143,67 @@ FutureWrapper::FutureWrapper(bool read_only,
                              Domain domain,
                              Legion::Future future,
                              bool initialize /*= false*/)
-  : read_only_(read_only), field_size_(field_size), domain_(domain), future_(future)
+  : read_only_(read_only),
+    field_size_(field_size),
+    domain_(domain),
+    future_(future),
+    initialize_(initialize)
+{
+}
+
+FutureWrapper::FutureWrapper(uint32_t field_size, Domain domain, const void* inline_data)
+  : read_only_(true), field_size_(field_size), domain_(domain), inline_data_(inline_data)
 {
-  if (!read_only) {
+}
+
+void FutureWrapper::materialize_buffer() const
+{
+  // Note on lifetime: these buffers cannot be pooled across task executions, however tempting
+  // that is for iterative kernels that materialize identically shaped futures every step. A
+  // finalized buffer is consumed by Legion as the task's return value, and any other deferred
+  // value is reclaimed by the runtime when the task completes, so a pooled handle would be
+  // dangling by the next task. The backing memory comes from Realm's eager allocator, which
+  // already recycles same-sized blocks across allocations.
+  if (buffer_ready_ || (read_only_ && nullptr == inline_data_)) return;
 #ifdef DEBUG_LEGATE
-    assert(!initialize || future_.get_untyped_size() == field_size);
+  assert(!initialize_ || future_.get_untyped_size() == field_size_);
 #endif
-    auto mem_kind = find_memory_kind_for_executing_processor(
+  auto mem_kind = find_memory_kind_for_executing_processor(
 #ifdef LEGATE_NO_FUTURES_ON_FB
-      true
+    true
 #else
-      false
+    false
 #endif
-    );
-    if (initialize) {
-      auto p_init_value = future_.get_buffer(mem_kind);
+  );
+  if (initialize_) {
+    auto p_init_value = future_.get_buffer(mem_kind);
 #ifdef LEGATE_USE_CUDA
-      if (mem_kind == Memory::Kind::GPU_FB_MEM) {
-        // TODO: This should be done by Legion
-        buffer_ = Legion::UntypedDeferredValue(field_size, mem_kind);
-        AccessorWO<int8_t, 1> acc(buffer_, field_size, false);
-        auto stream = cuda::StreamPool::get_stream_pool().get_stream();
-        CHECK_CUDA(
-          cudaMemcpyAsync(acc.ptr(0), p_init_value, field_size, cudaMemcpyDeviceToDevice, stream));
-      } else
+    if (mem_kind == Memory::Kind::GPU_FB_MEM) {
+      // TODO: This should be done by Legion
+      buffer_ = Legion::UntypedDeferredValue(field_size_, mem_kind);
+      AccessorWO<int8_t, 1> acc(buffer_, field_size_, false);
+      auto stream = cuda::StreamPool::get_stream_pool().get_stream();
+      CHECK_CUDA(
+        cudaMemcpyAsync(acc.ptr(0), p_init_value, field_size_, cudaMemcpyDeviceToDevice, stream));
+    } else
 #endif
-        buffer_ = Legion::UntypedDeferredValue(field_size, mem_kind, p_init_value);
+      buffer_ = Legion::UntypedDeferredValue(field_size_, mem_kind, p_init_value);
+  } else if (nullptr != inline_data_) {
+    // Inlined bytes live in the argument blob on the host, so reaching a framebuffer-resident
+    // buffer takes an explicit host-to-device copy
+#ifdef LEGATE_USE_CUDA
+    if (mem_kind == Memory::Kind::GPU_FB_MEM) {
+      buffer_ = Legion::UntypedDeferredValue(field_size_, mem_kind);
+      AccessorWO<int8_t, 1> acc(buffer_, field_size_, false);
+      auto stream = cuda::StreamPool::get_stream_pool().get_stream();
+      CHECK_CUDA(
+        cudaMemcpyAsync(acc.ptr(0), inline_data_, field_size_, cudaMemcpyHostToDevice, stream));
     } else
-      buffer_ = Legion::UntypedDeferredValue(field_size, mem_kind);
-  }
+#endif
+      buffer_ = Legion::UntypedDeferredValue(field_size_, mem_kind, inline_data_);
+  } else
+    buffer_ = Legion::UntypedDeferredValue(field_size_, mem_kind);
+  buffer_ready_ = true;
 }
 
 FutureWrapper::FutureWrapper(const FutureWrapper& other) noexcept
@@ -168,45 +211,94 @@ FutureWrapper::FutureWrapper(const FutureWrapper& other) noexcept
     field_size_(other.field_size_),
     domain_(other.domain_),
     future_(other.future_),
+    initialize_(other.initialize_),
+    inline_data_(other.inline_data_),
+    buffer_ready_(other.buffer_ready_),
     buffer_(other.buffer_)
 {
 }
 
 FutureWrapper& FutureWrapper::operator=(const FutureWrapper& other) noexcept
 {
-  read_only_  = other.read_only_;
-  field_size_ = other.field_size_;
-  domain_     = other.domain_;
-  future_     = other.future_;
-  buffer_     = other.buffer_;
+  read_only_    = other.read_only_;
+  field_size_   = other.field_size_;
+  domain_       = other.domain_;
+  future_       = other.future_;
+  initialize_   = other.initialize_;
+  inline_data_  = other.inline_data_;
+  buffer_ready_ = other.buffer_ready_;
+  buffer_       = other.buffer_;
   return *this;
 }
 
 Domain FutureWrapper::domain() const { return domain_; }
 
+namespace {
+
+// Reduction ops are immutable once registered, so the runtime lookup can be memoized. Each
+// Realm processor runs on a dedicated thread, so a thread_local cache needs no locking.
+const Legion::ReductionOp* cached_reduction_op(int32_t redop_id)
+{
+  static thread_local std::unordered_map<int32_t, const Legion::ReductionOp*> cache;
+  auto finder = cache.find(redop_id);
+  if (cache.end() != finder) return finder->second;
+  auto* redop     = Legion::Runtime::get_reduction_op(redop_id);
+  cache[redop_id] = redop;
+  return redop;
+}
+
+#ifdef LEGATE_USE_CUDA
+// Keeps a framebuffer-resident copy of each reduction identity. Tree reductions initialize
+// many futures per step, and paying a host-to-device transfer for every one of them turns
+// the initialization latency-bound; after the first use the fill is a device-to-device copy
+const void* device_identity(int32_t redop_id,
+                            const void* identity,
+                            size_t size,
+                            cudaStream_t stream)
+{
+  static thread_local std::unordered_map<int32_t, const void*> cache;
+  auto finder = cache.find(redop_id);
+  if (cache.end() != finder) return finder->second;
+  void* staged{nullptr};
+  CHECK_CUDA(cudaMalloc(&staged, size));
+  CHECK_CUDA(cudaMemcpyAsync(staged, identity, size, cudaMemcpyHostToDevice, stream));
+  cache[redop_id] = staged;
+  return staged;
+}
+#endif
+
+}  // namespace
+
 void FutureWrapper::initialize_with_identity(int32_t redop_id)
 {
+  materialize_buffer();
   auto untyped_acc = AccessorWO<int8_t, 1>(buffer_, field_size_);
   auto ptr         = untyped_acc.ptr(0);
 
-  auto redop = Legion::Runtime::get_reduction_op(redop_id);
+  auto redop = cached_reduction_op(redop_id);
 #ifdef DEBUG_LEGATE
   assert(redop->sizeof_lhs == field_size_);
 #endif
   auto identity = redop->identity;
 #ifdef LEGATE_USE_CUDA
   if (buffer_.get_instance().get_location().kind() == Memory::Kind::GPU_FB_MEM) {
-    auto stream = cuda::StreamPool::get_stream_pool().get_stream();
-    CHECK_CUDA(cudaMemcpyAsync(ptr, identity, field_size_, cudaMemcpyHostToDevice, stream));
+    auto stream          = cuda::StreamPool::get_stream_pool().get_stream();
+    auto* p_dev_identity = device_identity(redop_id, identity, field_size_, stream);
+    CHECK_CUDA(
+      cudaMemcpyAsync(ptr, p_dev_identity, field_size_, cudaMemcpyDeviceToDevice, stream));
   } else
 #endif
     memcpy(ptr, identity, field_size_);
 }
 
-ReturnValue FutureWrapper::pack() const { return ReturnValue(buffer_, field_size_); }
+ReturnValue FutureWrapper::pack() const
+{
+  materialize_buffer();
+  return ReturnValue(buffer_, field_size_);
+}
 
 Store::Store(int32_t dim,
-             std::unique_ptr<Type> type,
+             std::shared_ptr<const Type> type,
              int32_t redop_id,
              FutureWrapper future,
              std::shared_ptr<TransformStack>&& transform)
@@ -222,7 +314,7 @@ Store::Store(int32_t dim,
 }
 
 Store::Store(int32_t dim,
-             std::unique_ptr<Type> type,
+             std::shared_ptr<const Type> type,
              int32_t redop_id,
              RegionField&& region_field,
              std::shared_ptr<TransformStack>&& transform)
@@ -234,13 +326,12 @@ Store::Store(int32_t dim,
     region_field_(std::forward<RegionField>(region_field)),
     transform_(std::forward<decltype(transform)>(transform))
 {
-  readable_  = region_field_.is_readable();
-  writable_  = region_field_.is_writable();
-  reducible_ = region_field_.is_reducible();
+  // Privileges are queried lazily from the region field on the first is_readable/is_writable/
+  // is_reducible call
 }
 
 Store::Store(int32_t dim,
-             std::unique_ptr<Type> type,
+             std::shared_ptr<const Type> type,
              UnboundRegionField&& unbound_field,
              std::shared_ptr<TransformStack>&& transform)
   : is_future_(false),
@@ -22,10 +22,19 @@
 #include "core/type/type_info.h"
 #include "core/type/type_traits.h"
 #include "core/utilities/machine.h"
+#include "core/utilities/span.h"
 #include "core/utilities/typedefs.h"
 #include "legate_defines.h"
 #include "legion.h"
 
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <type_traits>
+#include <typeindex>
+#include <vector>
+
 /** @defgroup data Data abstractions and allocators
  */
 
@@ -54,6 +63,8 @@ class RegionField {
 
  public:
   int32_t dim() const { return dim_; }
+  const Legion::PhysicalRegion& get_physical_region() const { return pr_; }
+  Legion::FieldID get_field_id() const { return fid_; }
 
  private:
   template <typename ACC, int32_t N>
@@ -153,9 +164,42 @@ class RegionField {
   Domain domain() const;
 
  public:
-  bool is_readable() const { return readable_; }
-  bool is_writable() const { return writable_; }
-  bool is_reducible() const { return reducible_; }
+  // Privileges are looked up from the runtime on first request rather than at unpacking,
+  // so stores that a task variant never touches don't pay for the query
+  bool is_readable() const
+  {
+    if (!privileges_loaded_) load_privileges();
+    return readable_;
+  }
+  bool is_writable() const
+  {
+    if (!privileges_loaded_) load_privileges();
+    return writable_;
+  }
+  bool is_reducible() const
+  {
+    if (!privileges_loaded_) load_privileges();
+    return reducible_;
+  }
+
+ private:
+  // Accessor construction (privilege checks, instance layout resolution) costs microseconds
+  // that templated kernels re-deriving accessors pay on every call, so completed accessors are
+  // memoized here. The concrete accessor type encodes the element type, dimension, and
+  // privilege; the transform flag and the construction bounds complete the key. The transform
+  // itself and the redop id are not keyed: both are fixed for the store backed by this
+  // RegionField. Tasks access a RegionField from a single thread, so the cache is unguarded.
+  struct AccessorCacheEntry {
+    std::shared_ptr<void> accessor{nullptr};
+    Domain bounds{};
+  };
+  mutable std::map<std::pair<std::type_index, bool>, AccessorCacheEntry> accessor_cache_{};
+
+  template <typename ACC, typename FN>
+  ACC cached_accessor(bool with_transform, const Domain& bounds, FN&& create) const;
+
+ private:
+  void load_privileges() const;
 
  private:
   int32_t dim_{-1};
@@ -163,9 +207,10 @@ class RegionField {
   Legion::FieldID fid_{-1U};
 
  private:
-  bool readable_{false};
-  bool writable_{false};
-  bool reducible_{false};
+  mutable bool privileges_loaded_{false};
+  mutable bool readable_{false};
+  mutable bool writable_{false};
+  mutable bool reducible_{false};
 };
 
 class UnboundRegionField {
@@ -191,6 +236,8 @@ class UnboundRegionField {
  public:
   template <typename T, int32_t DIM>
   void bind_data(Buffer<T, DIM>& buffer, const Point<DIM>& extents);
+  template <typename T, int32_t DIM>
+  void bind_external_data(T* buffer, const Point<DIM>& extents);
   void bind_empty_data(int32_t dim);
 
  public:
@@ -214,6 +261,10 @@ class FutureWrapper {
                 Domain domain,
                 Legion::Future future,
                 bool initialize = false);
+  // Wraps a completed future whose payload the launcher copied into the task argument blob.
+  // The pointer aliases the blob, which Legion keeps alive for the task's duration, so reads
+  // go straight to the inlined bytes with no future subscription
+  FutureWrapper(uint32_t field_size, Domain domain, const void* inline_data);
 
  public:
   FutureWrapper(const FutureWrapper& other) noexcept;
@@ -250,7 +301,7 @@ class FutureWrapper {
   template <int32_t DIM>
   Rect<DIM> shape() const;
   Domain domain() const;
-  bool valid() const { return future_.valid(); }
+  bool valid() const { return future_.valid() || nullptr != inline_data_; }
 
  public:
   void initialize_with_identity(int32_t redop_id);
@@ -258,14 +309,25 @@ class FutureWrapper {
  public:
   ReturnValue pack() const;
 
+ private:
+  void materialize_buffer() const;
+
  private:
   bool read_only_{true};
   uint32_t field_size_{0};
   Domain domain_{};
   Legion::Future future_{};
-  Legion::UntypedDeferredValue buffer_{};
+  // The backing buffer for a writable future is allocated on first access rather than at
+  // unpacking; initialize_ records whether it should be seeded with the future's value
+  bool initialize_{false};
+  const void* inline_data_{nullptr};
+  mutable bool buffer_ready_{false};
+  mutable Legion::UntypedDeferredValue buffer_{};
 };
 
+template <typename T>
+class GrowableBuffer;
+
 /**
  * @ingroup data
  *
@@ -275,17 +337,17 @@ class Store {
  public:
   Store() {}
   Store(int32_t dim,
-        std::unique_ptr<Type> type,
+        std::shared_ptr<const Type> type,
         int32_t redop_id,
         FutureWrapper future,
         std::shared_ptr<TransformStack>&& transform = nullptr);
   Store(int32_t dim,
-        std::unique_ptr<Type> type,
+        std::shared_ptr<const Type> type,
         int32_t redop_id,
         RegionField&& region_field,
         std::shared_ptr<TransformStack>&& transform = nullptr);
   Store(int32_t dim,
-        std::unique_ptr<Type> type,
+        std::shared_ptr<const Type> type,
         UnboundRegionField&& unbound_field,
         std::shared_ptr<TransformStack>&& transform = nullptr);
 
@@ -470,6 +532,90 @@ class Store {
   template <typename OP, bool EXCLUSIVE, int32_t DIM, bool VALIDATE_TYPE = true>
   AccessorRD<OP, EXCLUSIVE, DIM> reduce_accessor(const Rect<DIM>& bounds) const;
 
+ public:
+  /**
+   * @brief Returns a read-only contiguous view on the store's data, flattened in row-major
+   * order. Valid only when the backing instance is dense row-major; throws
+   * `std::invalid_argument` otherwise. The density check runs once here, so hot loops can
+   * iterate (or hand the pointer to BLAS) without per-element accessor arithmetic.
+   *
+   * @tparam T Element type
+   *
+   * @tparam DIM Number of dimensions
+   *
+   * @tparam VALIDATE_TYPE If `true` (default), validates type and number of dimensions
+   *
+   * @return A contiguous view on the store's data
+   */
+  template <typename T, int32_t DIM, bool VALIDATE_TYPE = true>
+  Span<const T> span() const;
+  /**
+   * @brief Returns a writable contiguous view on the store's data, flattened in row-major
+   * order. Valid only when the backing instance is dense row-major; throws
+   * `std::invalid_argument` otherwise.
+   *
+   * @tparam T Element type
+   *
+   * @tparam DIM Number of dimensions
+   *
+   * @tparam VALIDATE_TYPE If `true` (default), validates type and number of dimensions
+   *
+   * @return A writable contiguous view on the store's data
+   */
+  template <typename T, int32_t DIM, bool VALIDATE_TYPE = true>
+  Span<T> read_write_span() const;
+  /**
+   * @brief Returns a read-only strided view on the store's data. Unlike `span`, this only
+   * requires the backing instance to be affine, exposing the per-dimension strides to the
+   * caller (e.g. as the leading dimension for BLAS).
+   *
+   * @tparam T Element type
+   *
+   * @tparam DIM Number of dimensions
+   *
+   * @tparam VALIDATE_TYPE If `true` (default), validates type and number of dimensions
+   *
+   * @return A strided view on the store's data
+   */
+  template <typename T, int32_t DIM, bool VALIDATE_TYPE = true>
+  StridedSpan<const T, DIM> strided_span() const;
+  /**
+   * @brief Returns a writable strided view on the store's data.
+   *
+   * @tparam T Element type
+   *
+   * @tparam DIM Number of dimensions
+   *
+   * @tparam VALIDATE_TYPE If `true` (default), validates type and number of dimensions
+   *
+   * @return A writable strided view on the store's data
+   */
+  template <typename T, int32_t DIM, bool VALIDATE_TYPE = true>
+  StridedSpan<T, DIM> read_write_strided_span() const;
+
+ public:
+  /**
+   * @brief Issues software prefetch hints for an upcoming subrectangle of the store, so
+   * tile-based kernels can overlap the memory latency of the next tile with computation on
+   * the current one (e.g. a double-buffered pipeline over a large store).
+   *
+   * One hint is issued per cache line of the subrectangle, walking it row by row along the
+   * instance's contiguous dimension. Prefetches are hints and never affect correctness: the
+   * call is a no-op for future- or unbound-backed stores, for stores without read privileges,
+   * for an empty intersection with the store's shape, and in device code, where prefetching
+   * is the kernel's concern.
+   *
+   * @tparam T Element type
+   *
+   * @tparam DIM Number of dimensions
+   *
+   * @tparam VALIDATE_TYPE If `true` (default), validates type and number of dimensions
+   *
+   * @param bounds Subrectangle to prefetch; intersected with the store's shape
+   */
+  template <typename T, int32_t DIM, bool VALIDATE_TYPE = true>
+  void prefetch(const Rect<DIM>& bounds) const;
+
  public:
   /**
    * @brief Creates a buffer of specified extents for the unbound store. The returned
@@ -485,6 +631,19 @@ class Store {
    */
   template <typename T, int32_t DIM>
   Buffer<T, DIM> create_output_buffer(const Point<DIM>& extents, bool bind_buffer = false);
+  /**
+   * @brief Creates a growable output buffer for the unbound store. Valid only when the
+   * store is 1D. Unlike `create_output_buffer`, the extents need not be known up front:
+   * elements are appended one at a time and the buffer grows by fixed-size chunks on
+   * demand, so tasks producing unpredictably sized outputs do not need a separate
+   * counting pass. The store is bound when `finalize` is called on the returned buffer.
+   *
+   * @param chunk_size Number of elements added to the capacity whenever the buffer grows
+   *
+   * @return A growable output buffer for the store
+   */
+  template <typename T>
+  GrowableBuffer<T> create_growable_output_buffer(size_t chunk_size = 4096);
 
  public:
   /**
@@ -501,6 +660,27 @@ class Store {
    */
   Domain domain() const;
 
+ public:
+  /**
+   * @brief Creates a zero-copy view on a subrectangle of the store
+   *
+   * The view shares the store's backing region field and simply composes a domain
+   * restriction onto its transform stack, so no data moves. Its `shape` is the intersection
+   * of `bounds` with the store's shape (possibly empty), expressed in the same coordinate
+   * space as the parent's, so points and accessors remain interchangeable between the two.
+   * Kernels that work on a subrectangle (halo exclusion, block panels) can thus take a
+   * `Store` and iterate its tight shape instead of carrying separate bounds around. Valid
+   * only on region-backed stores; futures and unbound stores cannot be sliced.
+   *
+   * @tparam DIM Number of dimensions
+   *
+   * @param bounds Subrectangle to restrict the view to; intersected with the store's shape
+   *
+   * @return A store viewing only the given subrectangle of this store's data
+   */
+  template <int32_t DIM>
+  Store subview(const Rect<DIM>& bounds) const;
+
  public:
   /**
    * @brief Indicates whether the store can have a read accessor
@@ -508,21 +688,30 @@ class Store {
    * @return true The store can have a read accessor
    * @return false The store cannot have a read accesor
    */
-  bool is_readable() const { return readable_; }
+  bool is_readable() const
+  {
+    return !is_future_ && !is_unbound_store_ ? region_field_.is_readable() : readable_;
+  }
   /**
    * @brief Indicates whether the store can have a write accessor
    *
    * @return true The store can have a write accessor
    * @return false The store cannot have a write accesor
    */
-  bool is_writable() const { return writable_; }
+  bool is_writable() const
+  {
+    return !is_future_ && !is_unbound_store_ ? region_field_.is_writable() : writable_;
+  }
   /**
    * @brief Indicates whether the store can have a reduction accessor
    *
    * @return true The store can have a reduction accessor
    * @return false The store cannot have a reduction accesor
    */
-  bool is_reducible() const { return reducible_; }
+  bool is_reducible() const
+  {
+    return !is_future_ && !is_unbound_store_ ? region_field_.is_reducible() : reducible_;
+  }
 
  public:
   /**
@@ -554,6 +743,25 @@ class Store {
    */
   template <typename T, int32_t DIM>
   void bind_data(Buffer<T, DIM>& buffer, const Point<DIM>& extents);
+  /**
+   * @brief Binds an external allocation to the store, making it the store's backing
+   * without a copy. Valid only when the store is unbound and has not yet been bound to
+   * another buffer.
+   *
+   * The memory must be reachable from host tasks (e.g. an mmap'd file region or a
+   * pre-pinned host buffer) and laid out in row-major order over the given extents. The
+   * runtime wraps it in an external instance rather than allocating and copying, which is
+   * what makes file ingest an attach instead of a read-and-copy; in exchange the caller
+   * must keep the allocation alive and unmodified for as long as the runtime may access
+   * the store's data, which in general means until runtime shutdown.
+   *
+   * @param buffer External allocation to bind to the store
+   *
+   * @param extents Extents of the data in the allocation
+   *
+   */
+  template <typename T, int32_t DIM>
+  void bind_external_data(T* buffer, const Point<DIM>& extents);
   /**
    * @brief Makes the unbound store empty. Valid only when the store is unbound and
    * has not yet been bound to another buffer.
@@ -599,7 +807,7 @@ class Store {
   bool is_future_{false};
   bool is_unbound_store_{false};
   int32_t dim_{-1};
-  std::unique_ptr<Type> type_{nullptr};
+  std::shared_ptr<const Type> type_{nullptr};
   int32_t redop_id_{-1};
 
  private:
@@ -616,6 +824,157 @@ class Store {
   bool reducible_{false};
 };
 
+/**
+ * @ingroup data
+ *
+ * @brief A growable output buffer for 1D unbound stores
+ *
+ * A `GrowableBuffer` accumulates elements appended by the task into fixed-size chunks
+ * allocated on demand, then consolidates them into a single buffer of the exact size and
+ * binds it to the store when `finalize` is called. Appends must happen from code running
+ * on a processor that can directly address the store's target memory; i.e., the buffer is
+ * meant for CPU and OpenMP task variants.
+ *
+ * Objects of this class should be created via `Store::create_growable_output_buffer`.
+ */
+template <typename T>
+class GrowableBuffer {
+ public:
+  GrowableBuffer(Store* store, size_t chunk_size);
+
+ public:
+  /**
+   * @brief Appends an element to the buffer, growing it by a chunk if necessary
+   *
+   * @param value Value to append
+   */
+  void append(const T& value);
+  /**
+   * @brief Returns the number of elements appended so far
+   *
+   * @return Number of elements in the buffer
+   */
+  size_t size() const;
+  /**
+   * @brief Consolidates the chunks into a single buffer of the exact size and binds it
+   * to the store. Must be called exactly once; no elements can be appended afterwards.
+   */
+  void finalize();
+
+ private:
+  void grow();
+
+ private:
+  Store* store_;
+  size_t chunk_size_;
+  std::vector<Buffer<T>> chunks_{};
+  T* cur_ptr_{nullptr};
+  size_t cur_count_{0};
+  bool finalized_{false};
+};
+
+/**
+ * @ingroup data
+ *
+ * @brief A typed view on a store that resolves all runtime checks at construction
+ *
+ * Accessor creation on a `Store` validates the type and dimensionality, re-tests the
+ * transform, and (for dense access) re-derives the instance layout on every call. A
+ * `StoreView` performs all of that once when it is constructed and then exposes unchecked,
+ * inlineable element access, so kernels can hoist the checks out of their setup paths
+ * entirely by creating one view per store per task.
+ *
+ * @tparam T Element type
+ *
+ * @tparam DIM Number of dimensions
+ *
+ * @tparam PRIV Privilege with which elements are accessed; one of `READ_ONLY`,
+ * `WRITE_DISCARD`, or `READ_WRITE`. Reductions should keep using `reduce_accessor`.
+ */
+template <typename T, int32_t DIM, Legion::PrivilegeMode PRIV>
+class StoreView {
+  static_assert(PRIV == READ_ONLY || PRIV == WRITE_DISCARD || PRIV == READ_WRITE,
+                "StoreView supports only the READ_ONLY, WRITE_DISCARD, and READ_WRITE "
+                "privileges");
+
+ public:
+  using Accessor = std::conditional_t<
+    PRIV == READ_ONLY,
+    AccessorRO<T, DIM>,
+    std::conditional_t<PRIV == WRITE_DISCARD, AccessorWO<T, DIM>, AccessorRW<T, DIM>>>;
+  using Pointer = std::conditional_t<PRIV == READ_ONLY, const T*, T*>;
+
+ public:
+  /**
+   * @brief Creates a view on a store. Type, dimensionality, transform, and density are
+   * all resolved here, once.
+   *
+   * @param store Store to create a view on
+   */
+  StoreView(const Store& store);
+
+ public:
+  /**
+   * @brief Returns the view's shape
+   *
+   * @return The view's shape
+   */
+  const Rect<DIM>& shape() const { return shape_; }
+  /**
+   * @brief Returns the number of elements in the view
+   *
+   * @return Number of elements in the view
+   */
+  size_t volume() const { return shape_.volume(); }
+  /**
+   * @brief Indicates whether the view is empty
+   *
+   * @return true The view is empty
+   * @return false The view has at least one element
+   */
+  bool empty() const { return shape_.empty(); }
+  /**
+   * @brief Indicates whether the view's instance is dense row-major, in which case `ptr`
+   * returns a valid pointer
+   *
+   * @return true The instance is dense row-major
+   * @return false The instance is not dense row-major
+   */
+  bool dense() const { return dense_; }
+
+ public:
+  /**
+   * @brief Accesses an element. No bounds, type, or dimension checks are performed.
+   *
+   * @param p Point identifying the element
+   *
+   * @return A reference to the element
+   */
+  decltype(auto) operator[](const Point<DIM>& p) const { return accessor_[p]; }
+  /**
+   * @brief Returns a raw pointer to the view's data. Valid only when `dense()` is true;
+   * `nullptr` otherwise.
+   *
+   * @return A raw pointer to the view's data
+   */
+  Pointer ptr() const { return ptr_; }
+  /**
+   * @brief Returns the underlying accessor, for passing to device kernels
+   *
+   * @return The underlying accessor
+   */
+  const Accessor& accessor() const { return accessor_; }
+
+ private:
+  static Accessor create_accessor(const Store& store);
+
+ private:
+  Accessor accessor_;
+  Rect<DIM> shape_;
+  Pointer ptr_{nullptr};
+  bool dense_{false};
+};
+
 }  // namespace legate
 
 #include "core/data/store.inl"
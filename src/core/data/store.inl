@@ -16,42 +16,61 @@
 
 namespace legate {
 
+template <typename ACC, typename FN>
+ACC RegionField::cached_accessor(bool with_transform, const Domain& bounds, FN&& create) const
+{
+  auto& entry = accessor_cache_[std::make_pair(std::type_index(typeid(ACC)), with_transform)];
+  if (nullptr == entry.accessor || entry.bounds != bounds) {
+    entry.accessor = std::make_shared<ACC>(create());
+    entry.bounds   = bounds;
+  }
+  return *static_cast<ACC*>(entry.accessor.get());
+}
+
 template <typename T, int DIM>
 AccessorRO<T, DIM> RegionField::read_accessor() const
 {
-  return AccessorRO<T, DIM>(pr_, fid_);
+  return cached_accessor<AccessorRO<T, DIM>>(
+    false, Domain(), [&]() { return AccessorRO<T, DIM>(pr_, fid_); });
 }
 
 template <typename T, int DIM>
 AccessorWO<T, DIM> RegionField::write_accessor() const
 {
-  return AccessorWO<T, DIM>(pr_, fid_);
+  return cached_accessor<AccessorWO<T, DIM>>(
+    false, Domain(), [&]() { return AccessorWO<T, DIM>(pr_, fid_); });
 }
 
 template <typename T, int DIM>
 AccessorRW<T, DIM> RegionField::read_write_accessor() const
 {
-  return AccessorRW<T, DIM>(pr_, fid_);
+  return cached_accessor<AccessorRW<T, DIM>>(
+    false, Domain(), [&]() { return AccessorRW<T, DIM>(pr_, fid_); });
 }
 
 template <typename OP, bool EXCLUSIVE, int DIM>
 AccessorRD<OP, EXCLUSIVE, DIM> RegionField::reduce_accessor(int32_t redop_id) const
 {
-  return AccessorRD<OP, EXCLUSIVE, DIM>(pr_, fid_, redop_id);
+  return cached_accessor<AccessorRD<OP, EXCLUSIVE, DIM>>(
+    false, Domain(), [&]() { return AccessorRD<OP, EXCLUSIVE, DIM>(pr_, fid_, redop_id); });
 }
 
 template <typename T, int DIM>
 AccessorRO<T, DIM> RegionField::read_accessor(const Legion::DomainAffineTransform& transform) const
 {
   using ACC = AccessorRO<T, DIM>;
-  return dim_dispatch(transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, transform);
+  return cached_accessor<ACC>(true, Domain(), [&]() {
+    return dim_dispatch(transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, transform);
+  });
 }
 
 template <typename T, int DIM>
 AccessorWO<T, DIM> RegionField::write_accessor(const Legion::DomainAffineTransform& transform) const
 {
   using ACC = AccessorWO<T, DIM>;
-  return dim_dispatch(transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, transform);
+  return cached_accessor<ACC>(true, Domain(), [&]() {
+    return dim_dispatch(transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, transform);
+  });
 }
 
 template <typename T, int DIM>
@@ -59,7 +78,9 @@ AccessorRW<T, DIM> RegionField::read_write_accessor(
   const Legion::DomainAffineTransform& transform) const
 {
   using ACC = AccessorRW<T, DIM>;
-  return dim_dispatch(transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, transform);
+  return cached_accessor<ACC>(true, Domain(), [&]() {
+    return dim_dispatch(transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, transform);
+  });
 }
 
 template <typename OP, bool EXCLUSIVE, int DIM>
@@ -67,33 +88,40 @@ AccessorRD<OP, EXCLUSIVE, DIM> RegionField::reduce_accessor(
   int32_t redop_id, const Legion::DomainAffineTransform& transform) const
 {
   using ACC = AccessorRD<OP, EXCLUSIVE, DIM>;
-  return dim_dispatch(
-    transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, redop_id, transform);
+  return cached_accessor<ACC>(true, Domain(), [&]() {
+    return dim_dispatch(
+      transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, redop_id, transform);
+  });
 }
 
 template <typename T, int DIM>
 AccessorRO<T, DIM> RegionField::read_accessor(const Rect<DIM>& bounds) const
 {
-  return AccessorRO<T, DIM>(pr_, fid_, bounds);
+  return cached_accessor<AccessorRO<T, DIM>>(
+    false, Domain(bounds), [&]() { return AccessorRO<T, DIM>(pr_, fid_, bounds); });
 }
 
 template <typename T, int DIM>
 AccessorWO<T, DIM> RegionField::write_accessor(const Rect<DIM>& bounds) const
 {
-  return AccessorWO<T, DIM>(pr_, fid_, bounds);
+  return cached_accessor<AccessorWO<T, DIM>>(
+    false, Domain(bounds), [&]() { return AccessorWO<T, DIM>(pr_, fid_, bounds); });
 }
 
 template <typename T, int DIM>
 AccessorRW<T, DIM> RegionField::read_write_accessor(const Rect<DIM>& bounds) const
 {
-  return AccessorRW<T, DIM>(pr_, fid_, bounds);
+  return cached_accessor<AccessorRW<T, DIM>>(
+    false, Domain(bounds), [&]() { return AccessorRW<T, DIM>(pr_, fid_, bounds); });
 }
 
 template <typename OP, bool EXCLUSIVE, int DIM>
 AccessorRD<OP, EXCLUSIVE, DIM> RegionField::reduce_accessor(int32_t redop_id,
                                                             const Rect<DIM>& bounds) const
 {
-  return AccessorRD<OP, EXCLUSIVE, DIM>(pr_, fid_, redop_id, bounds);
+  return cached_accessor<AccessorRD<OP, EXCLUSIVE, DIM>>(false, Domain(bounds), [&]() {
+    return AccessorRD<OP, EXCLUSIVE, DIM>(pr_, fid_, redop_id, bounds);
+  });
 }
 
 template <typename T, int32_t DIM>
@@ -101,8 +129,10 @@ AccessorRO<T, DIM> RegionField::read_accessor(const Rect<DIM>& bounds,
                                               const Legion::DomainAffineTransform& transform) const
 {
   using ACC = AccessorRO<T, DIM>;
-  return dim_dispatch(
-    transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, transform, bounds);
+  return cached_accessor<ACC>(true, Domain(bounds), [&]() {
+    return dim_dispatch(
+      transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, transform, bounds);
+  });
 }
 
 template <typename T, int32_t DIM>
@@ -110,8 +140,10 @@ AccessorWO<T, DIM> RegionField::write_accessor(const Rect<DIM>& bounds,
                                                const Legion::DomainAffineTransform& transform) const
 {
   using ACC = AccessorWO<T, DIM>;
-  return dim_dispatch(
-    transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, transform, bounds);
+  return cached_accessor<ACC>(true, Domain(bounds), [&]() {
+    return dim_dispatch(
+      transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, transform, bounds);
+  });
 }
 
 template <typename T, int32_t DIM>
@@ -119,8 +151,10 @@ AccessorRW<T, DIM> RegionField::read_write_accessor(
   const Rect<DIM>& bounds, const Legion::DomainAffineTransform& transform) const
 {
   using ACC = AccessorRW<T, DIM>;
-  return dim_dispatch(
-    transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, transform, bounds);
+  return cached_accessor<ACC>(true, Domain(bounds), [&]() {
+    return dim_dispatch(
+      transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, transform, bounds);
+  });
 }
 
 template <typename OP, bool EXCLUSIVE, int DIM>
@@ -128,8 +162,10 @@ AccessorRD<OP, EXCLUSIVE, DIM> RegionField::reduce_accessor(
   int32_t redop_id, const Rect<DIM>& bounds, const Legion::DomainAffineTransform& transform) const
 {
   using ACC = AccessorRD<OP, EXCLUSIVE, DIM>;
-  return dim_dispatch(
-    transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, redop_id, transform, bounds);
+  return cached_accessor<ACC>(true, Domain(bounds), [&]() {
+    return dim_dispatch(
+      transform.transform.m, trans_accessor_fn<ACC, DIM>{}, pr_, fid_, redop_id, transform, bounds);
+  });
 }
 
 template <int32_t DIM>
@@ -144,11 +180,13 @@ AccessorRO<T, DIM> FutureWrapper::read_accessor() const
 #ifdef DEBUG_LEGATE
   assert(sizeof(T) == field_size_);
 #endif
-  if (read_only_) {
+  if (read_only_ && nullptr == inline_data_) {
     auto memkind = Memory::Kind::NO_MEMKIND;
     return AccessorRO<T, DIM>(future_, memkind);
-  } else
+  } else {
+    materialize_buffer();
     return AccessorRO<T, DIM>(buffer_);
+  }
 }
 
 template <typename T, int DIM>
@@ -158,6 +196,7 @@ AccessorWO<T, DIM> FutureWrapper::write_accessor() const
   assert(sizeof(T) == field_size_);
   assert(!read_only_);
 #endif
+  materialize_buffer();
   return AccessorWO<T, DIM>(buffer_);
 }
 
@@ -168,6 +207,7 @@ AccessorRW<T, DIM> FutureWrapper::read_write_accessor() const
   assert(sizeof(T) == field_size_);
   assert(!read_only_);
 #endif
+  materialize_buffer();
   return AccessorRW<T, DIM>(buffer_);
 }
 
@@ -178,6 +218,7 @@ AccessorRD<OP, EXCLUSIVE, DIM> FutureWrapper::reduce_accessor(int32_t redop_id)
   assert(sizeof(typename OP::LHS) == field_size_);
   assert(!read_only_);
 #endif
+  materialize_buffer();
   return AccessorRD<OP, EXCLUSIVE, DIM>(buffer_);
 }
 
@@ -187,11 +228,13 @@ AccessorRO<T, DIM> FutureWrapper::read_accessor(const Rect<DIM>& bounds) const
 #ifdef DEBUG_LEGATE
   assert(sizeof(T) == field_size_);
 #endif
-  if (read_only_) {
+  if (read_only_ && nullptr == inline_data_) {
     auto memkind = Memory::Kind::NO_MEMKIND;
     return AccessorRO<T, DIM>(future_, bounds, memkind);
-  } else
+  } else {
+    materialize_buffer();
     return AccessorRO<T, DIM>(buffer_, bounds);
+  }
 }
 
 template <typename T, int DIM>
@@ -201,6 +244,7 @@ AccessorWO<T, DIM> FutureWrapper::write_accessor(const Rect<DIM>& bounds) const
   assert(sizeof(T) == field_size_);
   assert(!read_only_);
 #endif
+  materialize_buffer();
   return AccessorWO<T, DIM>(buffer_, bounds);
 }
 
@@ -211,6 +255,7 @@ AccessorRW<T, DIM> FutureWrapper::read_write_accessor(const Rect<DIM>& bounds) c
   assert(sizeof(T) == field_size_);
   assert(!read_only_);
 #endif
+  materialize_buffer();
   return AccessorRW<T, DIM>(buffer_, bounds);
 }
 
@@ -222,6 +267,7 @@ AccessorRD<OP, EXCLUSIVE, DIM> FutureWrapper::reduce_accessor(int32_t redop_id,
   assert(sizeof(typename OP::LHS) == field_size_);
   assert(!read_only_);
 #endif
+  materialize_buffer();
   return AccessorRD<OP, EXCLUSIVE, DIM>(buffer_, bounds);
 }
 
@@ -237,9 +283,16 @@ VAL FutureWrapper::scalar() const
 #ifdef DEBUG_LEGATE
   assert(sizeof(VAL) == field_size_);
 #endif
-  if (!read_only_)
+  if (!read_only_) {
+    materialize_buffer();
     return buffer_.operator Legion::DeferredValue<VAL>().read();
-  else
+  } else if (nullptr != inline_data_) {
+    // The launcher inlined the value into the argument blob; a memcpy handles the blob's
+    // lack of alignment guarantees
+    VAL result;
+    memcpy(&result, inline_data_, sizeof(VAL));
+    return result;
+  } else
     return future_.get_result<VAL>();
 }
 
@@ -269,6 +322,40 @@ void UnboundRegionField::bind_data(Buffer<T, DIM>& buffer, const Point<DIM>& ext
   bound_ = true;
 }
 
+template <typename T, int32_t DIM>
+void UnboundRegionField::bind_external_data(T* buffer, const Point<DIM>& extents)
+{
+#ifdef DEBUG_LEGATE
+  assert(!bound_);
+#endif
+  Rect<DIM> bounds(Point<DIM>::ZEROES(), extents - Point<DIM>::ONES());
+
+  // Wrap the caller's memory in an external Realm instance with a row-major layout over
+  // the extents, then hand that instance to the output region the same way bind_data hands
+  // over a deferred buffer. The caller owns the allocation's lifetime.
+  Realm::ExternalMemoryResource resource(
+    reinterpret_cast<uintptr_t>(buffer), bounds.volume() * sizeof(T), false /*read_only*/);
+
+  std::map<Legion::FieldID, size_t> field_sizes{{fid_, sizeof(T)}};
+  Realm::InstanceLayoutConstraints constraints(field_sizes, 0 /*block_size, 0 == SOA*/);
+  int dim_order[DIM];
+  // Innermost dimension first, i.e. row-major, matching the ordering the core mapper
+  // requests by default
+  for (int32_t dim = 0; dim < DIM; ++dim) dim_order[dim] = DIM - 1 - dim;
+  auto* layout = Realm::InstanceLayoutGeneric::choose_instance_layout<DIM, coord_t>(
+    Realm::IndexSpace<DIM, coord_t>(bounds), constraints, dim_order);
+
+  Realm::RegionInstance instance;
+  Realm::RegionInstance::create_external_instance(
+    instance, resource.suggested_memory(), layout, resource, Realm::ProfilingRequestSet())
+    .wait();
+
+  out_.return_data(DomainPoint(extents), fid_, instance);
+  // We will use this value only when the unbound store is 1D
+  update_num_elements(extents[0]);
+  bound_ = true;
+}
+
 template <typename T>
 void Store::check_accessor_type() const
 {
@@ -428,6 +515,134 @@ AccessorRD<OP, EXCLUSIVE, DIM> Store::reduce_accessor(const Rect<DIM>& bounds) c
   return region_field_.reduce_accessor<OP, EXCLUSIVE, DIM>(redop_id_, bounds);
 }
 
+namespace detail {
+
+// Row-major density check over strides reported in elements; dimensions of extent 1 are
+// excluded, as their strides never participate in address computation
+template <int32_t DIM>
+inline bool is_dense_row_major(const size_t strides[], const Rect<DIM>& rect)
+{
+  size_t stride = 1;
+  for (int32_t dim = DIM - 1; dim >= 0; --dim) {
+    size_t extent = rect.hi[dim] - rect.lo[dim] + 1;
+    if (extent != 1 && strides[dim] != stride) return false;
+    stride *= extent;
+  }
+  return true;
+}
+
+// One prefetch hint per cache line of a contiguous byte range; compiles away on toolchains
+// without __builtin_prefetch and in device code, where prefetching is the kernel's concern
+inline void prefetch_span(const void* ptr, size_t bytes)
+{
+#if !defined(__CUDA_ARCH__) && (defined(__GNUC__) || defined(__clang__))
+  constexpr size_t cache_line = 64;
+  const char* cur             = static_cast<const char*>(ptr);
+  const char* end             = cur + bytes;
+  for (; cur < end; cur += cache_line) __builtin_prefetch(cur, 0 /*read*/, 3 /*high locality*/);
+#else
+  static_cast<void>(ptr);
+  static_cast<void>(bytes);
+#endif
+}
+
+}  // namespace detail
+
+template <typename T, int32_t DIM, bool VALIDATE_TYPE>
+Span<const T> Store::span() const
+{
+  auto acc  = read_accessor<T, DIM, VALIDATE_TYPE>();
+  auto rect = shape<DIM>();
+  if (rect.empty()) return Span<const T>(nullptr, 0);
+  size_t strides[DIM];
+  const T* base = acc.ptr(rect, strides);
+  if (!detail::is_dense_row_major<DIM>(strides, rect))
+    throw std::invalid_argument(
+      "Dense span requested on a store whose instance is not dense row-major. Use strided_span "
+      "or an accessor instead.");
+  return Span<const T>(base, rect.volume());
+}
+
+template <typename T, int32_t DIM, bool VALIDATE_TYPE>
+Span<T> Store::read_write_span() const
+{
+  auto acc  = read_write_accessor<T, DIM, VALIDATE_TYPE>();
+  auto rect = shape<DIM>();
+  if (rect.empty()) return Span<T>(nullptr, 0);
+  size_t strides[DIM];
+  T* base = acc.ptr(rect, strides);
+  if (!detail::is_dense_row_major<DIM>(strides, rect))
+    throw std::invalid_argument(
+      "Dense span requested on a store whose instance is not dense row-major. Use strided_span "
+      "or an accessor instead.");
+  return Span<T>(base, rect.volume());
+}
+
+template <typename T, int32_t DIM, bool VALIDATE_TYPE>
+StridedSpan<const T, DIM> Store::strided_span() const
+{
+  auto acc  = read_accessor<T, DIM, VALIDATE_TYPE>();
+  auto rect = shape<DIM>();
+  if (rect.empty()) return StridedSpan<const T, DIM>();
+  size_t strides[DIM];
+  size_t extents[DIM];
+  const T* base = acc.ptr(rect, strides);
+  for (int32_t dim = 0; dim < DIM; ++dim) extents[dim] = rect.hi[dim] - rect.lo[dim] + 1;
+  return StridedSpan<const T, DIM>(base, strides, extents);
+}
+
+template <typename T, int32_t DIM, bool VALIDATE_TYPE>
+StridedSpan<T, DIM> Store::read_write_strided_span() const
+{
+  auto acc  = read_write_accessor<T, DIM, VALIDATE_TYPE>();
+  auto rect = shape<DIM>();
+  if (rect.empty()) return StridedSpan<T, DIM>();
+  size_t strides[DIM];
+  size_t extents[DIM];
+  T* base = acc.ptr(rect, strides);
+  for (int32_t dim = 0; dim < DIM; ++dim) extents[dim] = rect.hi[dim] - rect.lo[dim] + 1;
+  return StridedSpan<T, DIM>(base, strides, extents);
+}
+
+template <typename T, int32_t DIM, bool VALIDATE_TYPE>
+void Store::prefetch(const Rect<DIM>& bounds) const
+{
+  // only region-backed stores have a mapped instance to prefetch, and the hints go through a
+  // read accessor, so stores without read privileges are left alone
+  if (is_future_ || is_unbound_store_ || !is_readable()) return;
+  auto rect = shape<DIM>().intersection(bounds);
+  if (rect.empty()) return;
+  auto acc = read_accessor<T, DIM, VALIDATE_TYPE>(rect);
+  size_t strides[DIM];
+  const T* base = acc.ptr(rect, strides);
+
+  // Walk the subrectangle row by row along the unit-stride dimension, covering each row with
+  // cache-line-granular hints; instances without a unit-stride dimension (e.g. slices of the
+  // non-contiguous dimensions) get one hint per element instead
+  int32_t unit_dim = -1;
+  for (int32_t dim = 0; dim < DIM; ++dim)
+    if (strides[dim] == 1) unit_dim = dim;
+
+  if (unit_dim >= 0) {
+    const size_t row_bytes =
+      static_cast<size_t>(rect.hi[unit_dim] - rect.lo[unit_dim] + 1) * sizeof(T);
+    Rect<DIM> row_starts  = rect;
+    row_starts.hi[unit_dim] = row_starts.lo[unit_dim];
+    for (PointInRectIterator<DIM> itr(row_starts); itr.valid(); ++itr) {
+      const T* row = base;
+      for (int32_t dim = 0; dim < DIM; ++dim) row += ((*itr)[dim] - rect.lo[dim]) * strides[dim];
+      detail::prefetch_span(row, row_bytes);
+    }
+  } else {
+    for (PointInRectIterator<DIM> itr(rect); itr.valid(); ++itr) {
+      const T* elem = base;
+      for (int32_t dim = 0; dim < DIM; ++dim)
+        elem += ((*itr)[dim] - rect.lo[dim]) * strides[dim];
+      detail::prefetch_span(elem, sizeof(T));
+    }
+  }
+}
+
 template <typename T, int32_t DIM>
 Buffer<T, DIM> Store::create_output_buffer(const Point<DIM>& extents, bool bind_buffer /*= false*/)
 {
@@ -448,6 +663,27 @@ Rect<DIM> Store::shape() const
   }
 }
 
+template <int32_t DIM>
+Store Store::subview(const Rect<DIM>& bounds) const
+{
+  check_shape_dimension(DIM);
+  if (is_future_ || is_unbound_store_)
+    throw std::invalid_argument("Subviews can be created only on region-backed stores");
+  auto rect = shape<DIM>().intersection(bounds);
+  // Push the restriction onto a new stack node whose parent is shared with this store, so
+  // the view costs one allocation and no data movement
+  auto parent    = transform_;
+  auto transform = std::make_shared<TransformStack>(std::make_unique<Slice>(Domain(rect)),
+                                                    std::move(parent));
+  return Store(dim_,
+               type_,
+               redop_id_,
+               RegionField(region_field_.dim(),
+                           region_field_.get_physical_region(),
+                           region_field_.get_field_id()),
+               std::move(transform));
+}
+
 template <typename VAL>
 VAL Store::scalar() const
 {
@@ -463,4 +699,102 @@ void Store::bind_data(Buffer<T, DIM>& buffer, const Point<DIM>& extents)
   unbound_field_.bind_data(buffer, extents);
 }
 
+template <typename T, int32_t DIM>
+void Store::bind_external_data(T* buffer, const Point<DIM>& extents)
+{
+  check_valid_binding();
+  check_buffer_dimension(DIM);
+  unbound_field_.bind_external_data(buffer, extents);
+}
+
+template <typename T>
+GrowableBuffer<T> Store::create_growable_output_buffer(size_t chunk_size /*= 4096*/)
+{
+  check_valid_binding();
+  check_buffer_dimension(1);
+  return GrowableBuffer<T>(this, chunk_size);
+}
+
+template <typename T>
+GrowableBuffer<T>::GrowableBuffer(Store* store, size_t chunk_size)
+  : store_(store), chunk_size_(chunk_size)
+{
+#ifdef DEBUG_LEGATE
+  assert(chunk_size_ > 0);
+#endif
+}
+
+template <typename T>
+void GrowableBuffer<T>::append(const T& value)
+{
+  if (cur_count_ == chunk_size_ || nullptr == cur_ptr_) grow();
+  cur_ptr_[cur_count_++] = value;
+}
+
+template <typename T>
+size_t GrowableBuffer<T>::size() const
+{
+  return chunks_.empty() ? 0 : (chunks_.size() - 1) * chunk_size_ + cur_count_;
+}
+
+template <typename T>
+void GrowableBuffer<T>::grow()
+{
+  // Chunks are created through the output region so they live in the same memory as the
+  // consolidated buffer the store will eventually be bound to
+  chunks_.push_back(store_->create_output_buffer<T, 1>(Point<1>(chunk_size_), false));
+  cur_ptr_   = chunks_.back().ptr(0);
+  cur_count_ = 0;
+}
+
+template <typename T>
+void GrowableBuffer<T>::finalize()
+{
+#ifdef DEBUG_LEGATE
+  assert(!finalized_);
+#endif
+  finalized_ = true;
+
+  size_t total = size();
+  if (0 == total) {
+    store_->bind_empty_data();
+    return;
+  }
+
+  auto result   = store_->create_output_buffer<T, 1>(Point<1>(total), false);
+  T* out        = result.ptr(0);
+  size_t offset = 0;
+  for (auto& chunk : chunks_) {
+    size_t count = std::min(chunk_size_, total - offset);
+    memcpy(out + offset, chunk.ptr(0), count * sizeof(T));
+    offset += count;
+    chunk.destroy();
+  }
+  chunks_.clear();
+  store_->bind_data(result, Point<1>(total));
+}
+
+template <typename T, int32_t DIM, Legion::PrivilegeMode PRIV>
+typename StoreView<T, DIM, PRIV>::Accessor StoreView<T, DIM, PRIV>::create_accessor(
+  const Store& store)
+{
+  if constexpr (PRIV == READ_ONLY)
+    return store.read_accessor<T, DIM>();
+  else if constexpr (PRIV == WRITE_DISCARD)
+    return store.write_accessor<T, DIM>();
+  else
+    return store.read_write_accessor<T, DIM>();
+}
+
+template <typename T, int32_t DIM, Legion::PrivilegeMode PRIV>
+StoreView<T, DIM, PRIV>::StoreView(const Store& store)
+  : accessor_(create_accessor(store)), shape_(store.shape<DIM>())
+{
+  if (shape_.empty()) return;
+  size_t strides[DIM];
+  ptr_   = accessor_.ptr(shape_, strides);
+  dense_ = detail::is_dense_row_major<DIM>(strides, shape_);
+  if (!dense_) ptr_ = nullptr;
+}
+
 }  // namespace legate
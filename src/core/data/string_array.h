@@ -0,0 +1,195 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <cstring>
+#include <vector>
+
+#include "core/data/buffer.h"
+#include "core/data/store.h"
+#include "core/utilities/span.h"
+
+/**
+ * @file
+ * @brief Offset-based layout for variable-length string data
+ */
+namespace legate {
+
+/**
+ * @ingroup data
+ * @brief A read-only view on variable-length string data stored in the Arrow binary layout
+ *
+ * The layout is two plain stores: a 1-D `chars` store holding every string's bytes back to
+ * back, and a 1-D `offsets` store of `size() + 1` monotonically non-decreasing offsets into
+ * it, where element `idx` occupies bytes `[offsets[idx], offsets[idx + 1])`. This is the
+ * same representation Arrow uses for its string (`int32_t` offsets) and large string
+ * (`int64_t` offsets) arrays, so columns can be attached or copied to and from Arrow
+ * buffers without repacking, and string tasks stream one contiguous byte payload instead
+ * of chasing per-element heap pointers.
+ *
+ * Both stores must be 1-D and map to dense row-major instances, which is what the mapper
+ * produces for freshly created or attached 1-D regions; elements are then returned as
+ * spans aliasing the instance directly, with no per-element allocation or copy. Empty
+ * strings are naturally represented by equal consecutive offsets.
+ *
+ * @tparam OFFSET Offset element type; `int32_t` matches Arrow's string arrays and
+ * `int64_t` its large string arrays
+ */
+template <typename OFFSET = int32_t>
+class StringArrayView {
+  static_assert(std::is_same<OFFSET, int32_t>::value || std::is_same<OFFSET, int64_t>::value,
+                "Arrow-compatible string offsets must be int32_t or int64_t");
+
+ public:
+  /**
+   * @brief Creates a view from an offsets store and a character payload store
+   *
+   * @param offsets 1-D store of `size() + 1` offsets into the payload
+   * @param chars 1-D store of the concatenated string bytes
+   */
+  StringArrayView(const Store& offsets, const Store& chars)
+    : offsets_(offsets), chars_(chars)
+  {
+#ifdef DEBUG_LEGATE
+    assert(offsets_.dense() && chars_.dense());
+    assert(offsets_.volume() >= 1);
+    for (size_t idx = 0; idx + 1 < offsets_.volume(); ++idx)
+      assert(offsets_.ptr()[idx] <= offsets_.ptr()[idx + 1]);
+    assert(static_cast<size_t>(offsets_.ptr()[offsets_.volume() - 1]) <= chars_.volume());
+#endif
+  }
+
+ public:
+  /**
+   * @brief Returns the number of strings in the view
+   *
+   * @return Number of strings
+   */
+  size_t size() const { return offsets_.volume() - 1; }
+  /**
+   * @brief Indicates whether the view holds no strings
+   *
+   * @return true The view is empty
+   * @return false The view has at least one string
+   */
+  bool empty() const { return size() == 0; }
+
+ public:
+  /**
+   * @brief Returns a string's bytes as a span aliasing the payload store. No bounds checks
+   * are performed.
+   *
+   * @param idx Index of the string
+   *
+   * @return A span over the string's bytes
+   */
+  Span<const char> operator[](size_t idx) const
+  {
+    const OFFSET lo = offsets_.ptr()[idx];
+    const OFFSET hi = offsets_.ptr()[idx + 1];
+    return Span<const char>(reinterpret_cast<const char*>(chars_.ptr()) + lo,
+                            static_cast<size_t>(hi - lo));
+  }
+  /**
+   * @brief Returns the entire concatenated payload, for kernels that scan every byte
+   * (hashing, casing, validation, ...) without caring about element boundaries
+   *
+   * @return A span over all string bytes
+   */
+  Span<const char> chars() const
+  {
+    return Span<const char>(reinterpret_cast<const char*>(chars_.ptr()),
+                            static_cast<size_t>(offsets_.ptr()[size()]));
+  }
+  /**
+   * @brief Returns the raw offsets, one more than `size()` of them
+   *
+   * @return A span over the offsets
+   */
+  Span<const OFFSET> offsets() const
+  {
+    return Span<const OFFSET>(offsets_.ptr(), offsets_.volume());
+  }
+
+ private:
+  StoreView<OFFSET, 1, READ_ONLY> offsets_;
+  StoreView<int8_t, 1, READ_ONLY> chars_;
+};
+
+/**
+ * @ingroup data
+ * @brief A writer that packs variable-length strings into the Arrow binary layout
+ *
+ * Producing tasks bind an unbound 1-D `offsets` store and an unbound 1-D `chars` store,
+ * append strings one by one, and the writer lays the bytes out contiguously with the
+ * matching offsets, so the output is directly consumable by `StringArrayView` (and by
+ * Arrow) with no repacking pass. The stores are bound when the writer is destroyed.
+ *
+ * @tparam OFFSET Offset element type, as in `StringArrayView`
+ */
+template <typename OFFSET = int32_t>
+class StringArrayWriter {
+ public:
+  /**
+   * @brief Creates a writer targeting two unbound stores
+   *
+   * @param offsets Unbound 1-D store to receive `size() + 1` offsets
+   * @param chars Unbound 1-D store to receive the concatenated bytes
+   */
+  StringArrayWriter(Store& offsets, Store& chars) : offsets_(offsets), chars_(chars)
+  {
+    offsets_vec_.push_back(0);
+  }
+  ~StringArrayWriter()
+  {
+    auto offsets_buf =
+      offsets_.create_output_buffer<OFFSET, 1>(Point<1>(offsets_vec_.size()), true);
+    memcpy(offsets_buf.ptr(0), offsets_vec_.data(), offsets_vec_.size() * sizeof(OFFSET));
+    if (chars_vec_.empty())
+      chars_.bind_empty_data();
+    else {
+      auto chars_buf = chars_.create_output_buffer<int8_t, 1>(Point<1>(chars_vec_.size()), true);
+      memcpy(chars_buf.ptr(0), chars_vec_.data(), chars_vec_.size());
+    }
+  }
+
+ public:
+  /**
+   * @brief Appends one string
+   *
+   * @param element Bytes of the string to append
+   */
+  void append(Span<const char> element)
+  {
+    chars_vec_.insert(chars_vec_.end(), element.ptr(), element.ptr() + element.size());
+    offsets_vec_.push_back(static_cast<OFFSET>(chars_vec_.size()));
+  }
+  /**
+   * @brief Returns the number of strings appended so far
+   *
+   * @return Number of strings
+   */
+  size_t size() const { return offsets_vec_.size() - 1; }
+
+ private:
+  Store& offsets_;
+  Store& chars_;
+  std::vector<OFFSET> offsets_vec_{};
+  std::vector<char> chars_vec_{};
+};
+
+}  // namespace legate
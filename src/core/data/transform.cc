@@ -14,10 +14,43 @@
  *
  */
 
+#include <algorithm>
+
 #include "core/data/transform.h"
+#include "core/utilities/serializer.h"
 
 namespace legate {
 
+namespace {
+
+// Computes a multiplier/shift pair such that for any 0 <= n < 2^63,
+// n / divisor == (high 64 bits of n * multiplier) >> shift (Granlund & Montgomery's round-up
+// method). With shift = 63 + ceil(log2(divisor)), the multiplier always fits in 64 bits.
+// A zero multiplier marks division by one, which needs no work at all.
+void compute_magic_division(uint64_t divisor, uint64_t& multiplier, uint32_t& shift)
+{
+  if (1 == divisor) {
+    multiplier = 0;
+    shift      = 0;
+    return;
+  }
+  uint32_t log = 0;
+  while ((uint64_t(1) << log) < divisor) ++log;
+  auto numerator = static_cast<unsigned __int128>(1) << (63 + log);
+  multiplier     = static_cast<uint64_t>((numerator + divisor - 1) / divisor);
+  shift          = log - 1;
+}
+
+inline int64_t magic_divide(int64_t n, uint64_t multiplier, uint32_t shift)
+{
+  if (0 == multiplier) return n;
+  auto high = static_cast<uint64_t>(
+    (static_cast<unsigned __int128>(static_cast<uint64_t>(n)) * multiplier) >> 64);
+  return static_cast<int64_t>(high >> shift);
+}
+
+}  // namespace
+
 Legion::DomainAffineTransform combine(const Legion::DomainAffineTransform& lhs,
                                       const Legion::DomainAffineTransform& rhs)
 {
@@ -49,15 +82,28 @@ Legion::DomainAffineTransform TransformStack::inverse_transform(int32_t in_dim)
 #ifdef DEBUG_LEGATE
   assert(transform_ != nullptr);
 #endif
+  if (in_dim == cached_in_dim_) return cached_inverse_;
+
   auto result  = transform_->inverse_transform(in_dim);
   auto out_dim = transform_->target_ndim(in_dim);
 
-  if (parent_->identity())
-    return result;
-  else {
+  if (!parent_->identity()) {
     auto parent = parent_->inverse_transform(out_dim);
-    return combine(parent, result);
+    result      = combine(parent, result);
+  }
+  cached_in_dim_  = in_dim;
+  cached_inverse_ = result;
+  return result;
+}
+
+void TransformStack::pack(Serializer& serializer) const
+{
+  if (identity()) {
+    serializer.pack<int32_t>(-1);
+    return;
   }
+  transform_->pack(serializer);
+  parent_->pack(serializer);
 }
 
 void TransformStack::print(std::ostream& out) const
@@ -84,6 +130,8 @@ std::unique_ptr<StoreTransform> TransformStack::pop()
     transform_ = std::move(parent_->transform_);
     parent_    = std::move(parent_->parent_);
   }
+  // the flattened inverse no longer matches the stack
+  cached_in_dim_ = -1;
   return std::move(result);
 }
 
@@ -129,6 +177,13 @@ Legion::DomainAffineTransform Shift::inverse_transform(int32_t in_dim) const
   return result;
 }
 
+void Shift::pack(Serializer& serializer) const
+{
+  serializer.pack<int32_t>(LEGATE_CORE_TRANSFORM_SHIFT);
+  serializer.pack(dim_);
+  serializer.pack(offset_);
+}
+
 void Shift::print(std::ostream& out) const
 {
   out << "Shift(";
@@ -186,6 +241,13 @@ Legion::DomainAffineTransform Promote::inverse_transform(int32_t in_dim) const
   return result;
 }
 
+void Promote::pack(Serializer& serializer) const
+{
+  serializer.pack<int32_t>(LEGATE_CORE_TRANSFORM_PROMOTE);
+  serializer.pack(extra_dim_);
+  serializer.pack(dim_size_);
+}
+
 void Promote::print(std::ostream& out) const
 {
   out << "Promote(";
@@ -247,6 +309,13 @@ Legion::DomainAffineTransform Project::inverse_transform(int32_t in_dim) const
   return result;
 }
 
+void Project::pack(Serializer& serializer) const
+{
+  serializer.pack<int32_t>(LEGATE_CORE_TRANSFORM_PROJECT);
+  serializer.pack(dim_);
+  serializer.pack(coord_);
+}
+
 void Project::print(std::ostream& out) const
 {
   out << "Project(";
@@ -316,6 +385,12 @@ void print_vector(std::ostream& out, const std::vector<T>& vec)
 }
 }  // anonymous namespace
 
+void Transpose::pack(Serializer& serializer) const
+{
+  serializer.pack<int32_t>(LEGATE_CORE_TRANSFORM_TRANSPOSE);
+  serializer.pack(axes_);
+}
+
 void Transpose::print(std::ostream& out) const
 {
   out << "Transpose(";
@@ -340,39 +415,58 @@ void Transpose::find_imaginary_dims(std::vector<int32_t>& dims) const
 }
 
 Delinearize::Delinearize(int32_t dim, std::vector<int64_t>&& sizes)
-  : dim_(dim), sizes_(std::move(sizes)), strides_(sizes_.size(), 1), volume_(1)
+  : dim_(dim),
+    sizes_(std::move(sizes)),
+    strides_(sizes_.size(), 1),
+    volume_(1),
+    magic_multipliers_(sizes_.size(), 0),
+    magic_shifts_(sizes_.size(), 0)
 {
   for (int32_t dim = sizes_.size() - 2; dim >= 0; --dim)
     strides_[dim] = strides_[dim + 1] * sizes_[dim + 1];
   for (auto size : sizes_) volume_ *= size;
+  // The strides are fixed for the transform's lifetime, so the expensive division setup
+  // happens once here and every point inversion becomes a multiply and shift
+  for (size_t idx = 0; idx < strides_.size(); ++idx)
+    compute_magic_division(strides_[idx], magic_multipliers_[idx], magic_shifts_[idx]);
 }
 
 Domain Delinearize::transform(const Domain& input) const
 {
-  auto delinearize = [](const auto dim, const auto ndim, const auto& strides, const Domain& input) {
-    Domain output;
-    output.dim     = input.dim - 1 + ndim;
-    int32_t in_dim = 0;
-    for (int32_t in_dim = 0, out_dim = 0; in_dim < input.dim; ++in_dim) {
-      if (in_dim == dim) {
-        auto lo = input.rect_data[in_dim];
-        auto hi = input.rect_data[input.dim + in_dim];
-        for (auto stride : strides) {
+  Domain output;
+  output.dim = input.dim - 1 + static_cast<int32_t>(sizes_.size());
+  for (int32_t in_dim = 0, out_dim = 0; in_dim < input.dim; ++in_dim) {
+    if (in_dim == dim_) {
+      auto lo = input.rect_data[in_dim];
+      auto hi = input.rect_data[input.dim + in_dim];
+      if (lo >= 0 && hi >= 0) {
+        for (size_t idx = 0; idx < strides_.size(); ++idx) {
+          auto lo_q = magic_divide(lo, magic_multipliers_[idx], magic_shifts_[idx]);
+          auto hi_q = magic_divide(hi, magic_multipliers_[idx], magic_shifts_[idx]);
+          output.rect_data[out_dim]              = lo_q;
+          output.rect_data[output.dim + out_dim] = hi_q;
+          lo -= lo_q * strides_[idx];
+          hi -= hi_q * strides_[idx];
+          ++out_dim;
+        }
+      } else {
+        // Negative coordinates (possible under a preceding shift) keep the hardware division,
+        // whose truncation toward zero the magic inverses do not reproduce
+        for (auto stride : strides_) {
           output.rect_data[out_dim]              = lo / stride;
           output.rect_data[output.dim + out_dim] = hi / stride;
           lo                                     = lo % stride;
           hi                                     = hi % stride;
           ++out_dim;
         }
-      } else {
-        output.rect_data[out_dim]              = input.rect_data[in_dim];
-        output.rect_data[output.dim + out_dim] = input.rect_data[input.dim + in_dim];
-        ++out_dim;
       }
+    } else {
+      output.rect_data[out_dim]              = input.rect_data[in_dim];
+      output.rect_data[output.dim + out_dim] = input.rect_data[input.dim + in_dim];
+      ++out_dim;
     }
-    return output;
-  };
-  return delinearize(dim_, sizes_.size(), strides_, input);
+  }
+  return output;
 }
 
 Legion::DomainAffineTransform Delinearize::inverse_transform(int32_t in_dim) const
@@ -400,6 +494,13 @@ Legion::DomainAffineTransform Delinearize::inverse_transform(int32_t in_dim) con
   return result;
 }
 
+void Delinearize::pack(Serializer& serializer) const
+{
+  serializer.pack<int32_t>(LEGATE_CORE_TRANSFORM_DELINEARIZE);
+  serializer.pack(dim_);
+  serializer.pack(sizes_);
+}
+
 void Delinearize::print(std::ostream& out) const
 {
   out << "Delinearize(";
@@ -416,6 +517,55 @@ int32_t Delinearize::target_ndim(int32_t source_ndim) const
 
 void Delinearize::find_imaginary_dims(std::vector<int32_t>&) const {}
 
+Slice::Slice(const Domain& bounds) : bounds_(bounds) {}
+
+Domain Slice::transform(const Domain& input) const
+{
+#ifdef DEBUG_LEGATE
+  assert(input.dim == bounds_.dim);
+#endif
+  auto result = input;
+  for (int32_t dim = 0; dim < result.dim; ++dim) {
+    result.rect_data[dim] = std::max(result.rect_data[dim], bounds_.rect_data[dim]);
+    result.rect_data[dim + result.dim] =
+      std::min(result.rect_data[dim + result.dim], bounds_.rect_data[dim + result.dim]);
+  }
+  return result;
+}
+
+Legion::DomainAffineTransform Slice::inverse_transform(int32_t in_dim) const
+{
+  assert(in_dim == bounds_.dim);
+  // The subview keeps the parent's coordinate space, so points map back unchanged
+  Legion::DomainTransform transform;
+  transform.m = in_dim;
+  transform.n = in_dim;
+  for (int32_t i = 0; i < in_dim; ++i)
+    for (int32_t j = 0; j < in_dim; ++j)
+      transform.matrix[i * in_dim + j] = static_cast<coord_t>(i == j);
+
+  DomainPoint offset;
+  offset.dim = in_dim;
+  for (int32_t i = 0; i < in_dim; ++i) offset[i] = 0;
+
+  Legion::DomainAffineTransform result;
+  result.transform = transform;
+  result.offset    = offset;
+  return result;
+}
+
+void Slice::pack(Serializer& serializer) const
+{
+  // Slices are created on the task side and have no wire format
+  LEGATE_ABORT;
+}
+
+void Slice::print(std::ostream& out) const { out << "Slice(bounds: " << bounds_ << ")"; }
+
+int32_t Slice::target_ndim(int32_t source_ndim) const { return source_ndim; }
+
+void Slice::find_imaginary_dims(std::vector<int32_t>&) const {}
+
 std::ostream& operator<<(std::ostream& out, const Transform& transform)
 {
   transform.print(out);
@@ -22,9 +22,13 @@
 
 namespace legate {
 
+class Serializer;
+
 struct Transform {
   virtual Domain transform(const Domain& input) const                           = 0;
   virtual Legion::DomainAffineTransform inverse_transform(int32_t in_dim) const = 0;
+  // Packs the transform in the wire format that unpack_transform expects
+  virtual void pack(Serializer& serializer) const                               = 0;
   virtual void print(std::ostream& out) const                                   = 0;
 };
 
@@ -43,8 +47,18 @@ struct TransformStack : public Transform {
  public:
   virtual Domain transform(const Domain& input) const override;
   virtual Legion::DomainAffineTransform inverse_transform(int32_t in_dim) const override;
+  virtual void pack(Serializer& serializer) const override;
   virtual void print(std::ostream& out) const override;
 
+ public:
+  // Transforms a batch of points in one call. Code preparing indirect copies converts many
+  // points at once, and going through inverse_transform per point would recompose the affine
+  // form each time; this applies the flattened form (matrix of the composed stack mapping
+  // N-dimensional store points to M-dimensional region points) in a fixed-dimension loop the
+  // compiler can unroll and vectorize. `outputs` may alias `inputs` when M == N.
+  template <int32_t M, int32_t N>
+  void transform_points(const Point<N>* inputs, Point<M>* outputs, size_t count) const;
+
  public:
   std::unique_ptr<StoreTransform> pop();
   bool identity() const { return nullptr == transform_; }
@@ -58,6 +72,12 @@ struct TransformStack : public Transform {
  private:
   std::unique_ptr<StoreTransform> transform_{nullptr};
   std::shared_ptr<TransformStack> parent_{nullptr};
+  // inverse_transform composes one affine transform per stack entry, and deep
+  // promote->transpose->project chains recompose on every store unpacking; the flattened
+  // result is cached on first use for the input dimension it was requested with (stores ask
+  // with their own dimension, so one entry suffices). Invalidated by pop().
+  mutable int32_t cached_in_dim_{-1};
+  mutable Legion::DomainAffineTransform cached_inverse_{};
 };
 
 class Shift : public StoreTransform {
@@ -67,6 +87,7 @@ class Shift : public StoreTransform {
  public:
   virtual Domain transform(const Domain& input) const override;
   virtual Legion::DomainAffineTransform inverse_transform(int32_t in_dim) const override;
+  virtual void pack(Serializer& serializer) const override;
   virtual void print(std::ostream& out) const override;
 
  public:
@@ -87,6 +108,7 @@ class Promote : public StoreTransform {
  public:
   virtual Domain transform(const Domain& input) const override;
   virtual Legion::DomainAffineTransform inverse_transform(int32_t in_dim) const override;
+  virtual void pack(Serializer& serializer) const override;
   virtual void print(std::ostream& out) const override;
 
  public:
@@ -108,6 +130,7 @@ class Project : public StoreTransform {
  public:
   virtual Domain transform(const Domain& domain) const override;
   virtual Legion::DomainAffineTransform inverse_transform(int32_t in_dim) const override;
+  virtual void pack(Serializer& serializer) const override;
   virtual void print(std::ostream& out) const override;
 
  public:
@@ -128,6 +151,7 @@ class Transpose : public StoreTransform {
  public:
   virtual Domain transform(const Domain& domain) const override;
   virtual Legion::DomainAffineTransform inverse_transform(int32_t in_dim) const override;
+  virtual void pack(Serializer& serializer) const override;
   virtual void print(std::ostream& out) const override;
 
  public:
@@ -147,6 +171,7 @@ class Delinearize : public StoreTransform {
  public:
   virtual Domain transform(const Domain& domain) const override;
   virtual Legion::DomainAffineTransform inverse_transform(int32_t in_dim) const override;
+  virtual void pack(Serializer& serializer) const override;
   virtual void print(std::ostream& out) const override;
 
  public:
@@ -160,8 +185,74 @@ class Delinearize : public StoreTransform {
   std::vector<int64_t> sizes_;
   std::vector<int64_t> strides_;
   int64_t volume_;
+  // Magic-number multiplicative inverses of strides_ (see transform.cc), computed once at
+  // construction so point inversion avoids hardware division
+  std::vector<uint64_t> magic_multipliers_;
+  std::vector<uint32_t> magic_shifts_;
+};
+
+// Restricts the store's domain to a subrectangle without changing its coordinate space.
+// Unlike the other transforms, a Slice is created on the task side (by Store::subview) and
+// never travels on the wire.
+class Slice : public StoreTransform {
+ public:
+  Slice(const Domain& bounds);
+
+ public:
+  virtual Domain transform(const Domain& domain) const override;
+  virtual Legion::DomainAffineTransform inverse_transform(int32_t in_dim) const override;
+  virtual void pack(Serializer& serializer) const override;
+  virtual void print(std::ostream& out) const override;
+
+ public:
+  virtual int32_t target_ndim(int32_t source_ndim) const override;
+
+ public:
+  virtual void find_imaginary_dims(std::vector<int32_t>&) const override;
+
+ private:
+  Domain bounds_;
 };
 
 std::ostream& operator<<(std::ostream& out, const Transform& transform);
 
+template <int32_t M, int32_t N>
+void TransformStack::transform_points(const Point<N>* inputs,
+                                      Point<M>* outputs,
+                                      size_t count) const
+{
+  if constexpr (M == N) {
+    // An identity stack has no flattened form; the points pass through unchanged
+    if (identity()) {
+      if (inputs != outputs)
+        for (size_t idx = 0; idx < count; ++idx) outputs[idx] = inputs[idx];
+      return;
+    }
+  }
+
+  auto affine = inverse_transform(N);
+#ifdef DEBUG_LEGATE
+  assert(affine.transform.m == M && affine.transform.n == N);
+#endif
+  // Copy the affine form into dense local arrays once, so the hot loop reads from storage
+  // whose extent the compiler can see
+  coord_t matrix[M][N];
+  coord_t offset[M];
+  for (int32_t i = 0; i < M; ++i) {
+    offset[i] = affine.offset[i];
+    for (int32_t j = 0; j < N; ++j) matrix[i][j] = affine.transform.matrix[i * N + j];
+  }
+
+  for (size_t idx = 0; idx < count; ++idx) {
+    const auto point = inputs[idx];
+    Point<M> result;
+    for (int32_t i = 0; i < M; ++i) {
+      coord_t sum = offset[i];
+      for (int32_t j = 0; j < N; ++j) sum += matrix[i][j] * point[j];
+      result[i] = sum;
+    }
+    outputs[idx] = result;
+  }
+}
+
 }  // namespace legate
@@ -14,8 +14,168 @@
  *
  */
 
+#include "core/runtime/perf_counters.h"
 #include "core/runtime/runtime.h"
 
+#include <cassert>
+#include <cstring>
+
+#include "core/legate_c.h"
+#include "core/utilities/typedefs.h"
+
+#include "legion/legion_c.h"
+#include "legion/legion_c_util.h"
+
 void legate_parse_config(void) { legate::Core::parse_config(); }
 
 void legate_shutdown(void) { legate::Core::shutdown(); }
+
+void legate_early_cleanup(void) { legate::Core::early_release(); }
+
+uint32_t legate_perf_counter_register(const char* name)
+{
+  return legate::PerfCounters::get_counters()->register_counter(name);
+}
+
+uint64_t legate_perf_counter_read(uint32_t counter_id)
+{
+  return legate::PerfCounters::get_counters()->read(counter_id);
+}
+
+namespace {
+
+// Walks the packed operation buffer. Fields are packed without padding, so every read goes
+// through a memcpy instead of a typed dereference
+class BatchReader {
+ public:
+  BatchReader(const void* buffer) : start_(static_cast<const int8_t*>(buffer)), ptr_(start_) {}
+
+  template <typename T>
+  T read()
+  {
+    T value;
+    memcpy(&value, ptr_, sizeof(T));
+    ptr_ += sizeof(T);
+    return value;
+  }
+
+  const void* read_bytes(size_t size)
+  {
+    const void* result = ptr_;
+    ptr_ += size;
+    return result;
+  }
+
+  size_t consumed() const { return static_cast<size_t>(ptr_ - start_); }
+
+ private:
+  const int8_t* start_;
+  const int8_t* ptr_;
+};
+
+Legion::LogicalRegion unpack_region(BatchReader& reader)
+{
+  legion_logical_region_t handle;
+  handle.index_space.id       = reader.read<uint32_t>();
+  handle.index_space.tid      = reader.read<uint32_t>();
+  handle.index_space.type_tag = reader.read<uint32_t>();
+  handle.field_space.id       = reader.read<uint32_t>();
+  handle.tree_id              = reader.read<uint32_t>();
+  return Legion::CObjectWrapper::unwrap(handle);
+}
+
+}  // namespace
+
+uint32_t legate_submit_batch(const void* buffer,
+                             uint64_t buffer_size,
+                             void** out_futures,
+                             uint32_t out_future_capacity)
+{
+  auto runtime = Legion::Runtime::get_runtime();
+  auto ctx     = Legion::Runtime::get_context();
+
+  BatchReader reader(buffer);
+  uint32_t num_futures_out = 0;
+
+  auto num_ops = reader.read<uint32_t>();
+  for (uint32_t op_idx = 0; op_idx < num_ops; ++op_idx) {
+    auto kind = reader.read<int32_t>();
+    switch (kind) {
+      case LEGATE_CORE_BATCH_OP_TASK: {
+        auto task_id     = reader.read<uint32_t>();
+        auto mapper_id   = reader.read<uint32_t>();
+        auto mapping_tag = reader.read<uint32_t>();
+        auto arglen      = reader.read<uint32_t>();
+        const void* args = reader.read_bytes(arglen);
+
+        Legion::TaskLauncher launcher(task_id,
+                                      Legion::TaskArgument(args, arglen),
+                                      Legion::Predicate::TRUE_PRED,
+                                      mapper_id,
+                                      mapping_tag);
+
+        auto num_futures = reader.read<uint32_t>();
+        for (uint32_t idx = 0; idx < num_futures; ++idx) {
+          legion_future_t handle{reinterpret_cast<void*>(reader.read<uint64_t>())};
+          launcher.add_future(*Legion::CObjectWrapper::unwrap(handle));
+        }
+
+        auto num_reqs = reader.read<uint32_t>();
+        for (uint32_t idx = 0; idx < num_reqs; ++idx) {
+          auto region    = unpack_region(reader);
+          auto parent    = unpack_region(reader);
+          auto privilege = reader.read<uint32_t>();
+          auto coherence = static_cast<Legion::CoherenceProperty>(reader.read<uint32_t>());
+          auto redop     = reader.read<uint32_t>();
+          auto req_tag   = reader.read<uint32_t>();
+
+          Legion::RegionRequirement req;
+          if (redop != 0)
+            req = Legion::RegionRequirement(region, redop, coherence, parent, req_tag);
+          else
+            req = Legion::RegionRequirement(
+              region, static_cast<Legion::PrivilegeMode>(privilege), coherence, parent, req_tag);
+
+          auto num_fields = reader.read<uint32_t>();
+          for (uint32_t fidx = 0; fidx < num_fields; ++fidx) req.add_field(reader.read<uint32_t>());
+          launcher.add_region_requirement(req);
+        }
+
+        auto wants_future = reader.read<bool>();
+        auto future       = runtime->execute_task(ctx, launcher);
+        if (wants_future && num_futures_out < out_future_capacity)
+          out_futures[num_futures_out++] =
+            Legion::CObjectWrapper::wrap(new Legion::Future(future)).impl;
+        break;
+      }
+      case LEGATE_CORE_BATCH_OP_FENCE: {
+        auto mapping = reader.read<bool>();
+        if (mapping)
+          runtime->issue_mapping_fence(ctx);
+        else
+          runtime->issue_execution_fence(ctx);
+        break;
+      }
+      case LEGATE_CORE_BATCH_OP_DISCARD: {
+        auto region = unpack_region(reader);
+        auto parent = unpack_region(reader);
+        Legion::DiscardLauncher launcher(region, parent);
+        auto num_fields = reader.read<uint32_t>();
+        for (uint32_t fidx = 0; fidx < num_fields; ++fidx)
+          launcher.add_field(reader.read<uint32_t>());
+        runtime->discard_fields(ctx, launcher);
+        break;
+      }
+      default: {
+        legate::log_legate.error("Invalid operation kind %d in batch submission", kind);
+        LEGATE_ABORT;
+      }
+    }
+  }
+#ifdef DEBUG_LEGATE
+  assert(reader.consumed() == buffer_size);
+#else
+  static_cast<void>(buffer_size);
+#endif
+  return num_futures_out;
+}
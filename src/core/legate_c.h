@@ -44,6 +44,7 @@ typedef enum legate_core_proj_id_t {
 typedef enum legate_core_shard_id_t {
   LEGATE_CORE_TOPLEVEL_TASK_SHARD_ID = 0,
   LEGATE_CORE_LINEARIZE_SHARD_ID     = 1,
+  LEGATE_CORE_WEIGHTED_SHARD_ID      = 2,
   // All sharding functors starting from LEGATE_CORE_FIRST_DYNAMIC_FUNCTOR should match the
   // projection functor of the same id. The sharding functor limit is thus the same as the
   // projection functor limit.
@@ -63,8 +64,30 @@ typedef enum legate_core_tunable_t {
   LEGATE_CORE_TUNABLE_FIELD_REUSE_FREQUENCY,
   LEGATE_CORE_TUNABLE_MAX_LRU_LENGTH,
   LEGATE_CORE_TUNABLE_NCCL_NEEDS_BARRIER,
+  LEGATE_CORE_TUNABLE_MAPPER_CACHE_HITS,
+  LEGATE_CORE_TUNABLE_MAPPER_CACHE_MISSES,
+  LEGATE_CORE_TUNABLE_MAPPER_GROUP_CONSOLIDATIONS,
+  LEGATE_CORE_TUNABLE_MAPPER_ALLOC_FAILURES,
+  LEGATE_CORE_TUNABLE_MAPPER_LIVE_INSTANCE_BYTES,
+  LEGATE_CORE_TUNABLE_MAPPER_INSTANCE_HIGH_WATER,
+  LEGATE_CORE_TUNABLE_ADAPTED_MIN_SHARD_VOLUME,
+  LEGATE_CORE_TUNABLE_STARTUP_BATCH,
 } legate_core_tunable_t;
 
+// Order of the values packed in the LEGATE_CORE_TUNABLE_STARTUP_BATCH response. All values
+// are widened to 64 bits, so the response is a uint64_t array indexed by this enum.
+typedef enum legate_core_startup_tunable_t {
+  LEGATE_CORE_STARTUP_TUNABLE_WINDOW_SIZE = 0,
+  LEGATE_CORE_STARTUP_TUNABLE_NCCL_NEEDS_BARRIER,
+  LEGATE_CORE_STARTUP_TUNABLE_NUM_NODES,
+  LEGATE_CORE_STARTUP_TUNABLE_FIELD_REUSE_FREQUENCY,
+  LEGATE_CORE_STARTUP_TUNABLE_FIELD_REUSE_SIZE,
+  LEGATE_CORE_STARTUP_TUNABLE_MAX_LRU_LENGTH,
+  LEGATE_CORE_STARTUP_TUNABLE_MAX_PENDING_EXCEPTIONS,
+  LEGATE_CORE_STARTUP_TUNABLE_PRECISE_EXCEPTION_TRACE,
+  LEGATE_CORE_STARTUP_TUNABLE_NUM_VALUES,
+} legate_core_startup_tunable_t;
+
 typedef enum legate_core_variant_t {
   LEGATE_NO_VARIANT = 0,
   LEGATE_CPU_VARIANT,
@@ -129,6 +152,12 @@ typedef enum legate_core_reduction_op_id_t {
   LEGATE_CORE_MAX_REDUCTION_OP_ID = 1,
 } legate_core_reduction_op_id_t;
 
+typedef enum legate_core_batch_op_kind_t {
+  LEGATE_CORE_BATCH_OP_TASK    = 0,
+  LEGATE_CORE_BATCH_OP_FENCE   = 1,
+  LEGATE_CORE_BATCH_OP_DISCARD = 2,
+} legate_core_batch_op_kind_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -136,6 +165,12 @@ extern "C" {
 void legate_parse_config(void);
 void legate_shutdown(void);
 
+// Starts tearing down communicator state and cached mapper instances on a background
+// thread, overlapping cleanup with tasks still running in the job's tail. Callers promise
+// that no task launched afterwards uses a communicator; legate_shutdown waits for the
+// teardown to finish.
+void legate_early_cleanup(void);
+
 void legate_core_perform_registration(void);
 
 void legate_register_affine_projection_functor(
@@ -147,10 +182,51 @@ void legate_create_sharding_functor_using_projection(
 // TODO: the return type should be legion_point_transform_functor_t
 void* legate_linearizing_point_transform_functor();
 
+// Registers (or looks up) a named counter in the core performance counter registry and
+// returns its id. Counters accumulate into per-thread padded slots; reads aggregate across
+// threads. All registered counters are printed at shutdown.
+uint32_t legate_perf_counter_register(const char* name);
+
+uint64_t legate_perf_counter_read(uint32_t counter_id);
+
+// Registers per-point weight hints for the weighted sharding functor
+// (LEGATE_CORE_WEIGHTED_SHARD_ID). The hints apply to launch domains whose volume matches
+// `volume` and are read in linearized point order; points then shard by balanced prefix-sum
+// splits of the weights instead of uniformly. Launch domains without a registered hint fall
+// back to the uniform linearized split.
+void legate_sharding_set_weights(uint64_t volume, const uint64_t* weights);
+
 void legate_cpucoll_finalize(void);
 
 int legate_cpucoll_initcomm(void);
 
+// Submits a buffer of encoded operations in a single call, so fine-grained workloads pay
+// one FFI crossing per batch instead of one per operation. The buffer holds a uint32
+// operation count followed by the operations back to back, each starting with an int32
+// legate_core_batch_op_kind_t:
+//
+//   TASK:    uint32 task_id, uint32 mapper_id, uint32 mapping_tag,
+//            uint32 arglen + raw argument bytes,
+//            uint32 num_futures + uint64 future impl pointers,
+//            uint32 num_reqs, each req being
+//              uint32 index_space_id, uint32 index_space_tid, uint32 index_space_type_tag,
+//              uint32 field_space_id, uint32 tree_id (then the same five for the parent),
+//              uint32 privilege, uint32 coherence, uint32 redop (0 if not a reduction),
+//              uint32 req_tag, uint32 num_fields + uint32 field ids,
+//            bool wants_future
+//   FENCE:   bool mapping (mapping fence if set, execution fence otherwise)
+//   DISCARD: the five-uint32 region and parent encodings above,
+//            uint32 num_fields + uint32 field ids
+//
+// All fields are packed without padding, so the buffer can be written directly from Python
+// with a BufferBuilder. Futures produced by task records with wants_future set are written
+// to out_futures (impl pointers, in submission order) up to out_future_capacity; the return
+// value is the number written. Must be called from the top-level task.
+uint32_t legate_submit_batch(const void* buffer,
+                             uint64_t buffer_size,
+                             void** out_futures,
+                             uint32_t out_future_capacity);
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,8 +14,15 @@
  *
  */
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
 #include <sstream>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 
 #include "legion/legion_mapping.h"
@@ -24,10 +31,16 @@
 #include "core/data/store.h"
 #include "core/mapping/base_mapper.h"
 #include "core/mapping/instance_manager.h"
+#include "core/mapping/mapper_stats.h"
+#include "core/mapping/mapper_trace.h"
 #include "core/mapping/operation.h"
 #include "core/runtime/projection.h"
+#include "core/runtime/runtime.h"
 #include "core/runtime/shard.h"
+#include "core/task/task_stats.h"
+#include "core/utilities/async_logging.h"
 #include "core/utilities/linearize.h"
+#include "env_defaults.h"
 #include "legate_defines.h"
 
 namespace legate {
@@ -35,16 +48,25 @@ namespace mapping {
 
 namespace {
 
-const std::vector<StoreTarget>& default_store_targets(Processor::Kind kind)
+const std::vector<StoreTarget>& default_store_targets(Processor::Kind kind, bool has_socket_mem)
 {
+  // On NUMA machines, CPU and OpenMP tasks both prefer the socket memory local to their target
+  // processor; instances then land on the socket the task runs on instead of all piling up on
+  // one system memory
   static const std::map<Processor::Kind, std::vector<StoreTarget>> defaults = {
     {Processor::Kind::TOC_PROC, {StoreTarget::FBMEM, StoreTarget::ZCMEM}},
     {Processor::Kind::OMP_PROC, {StoreTarget::SOCKETMEM, StoreTarget::SYSMEM}},
+    {Processor::Kind::LOC_PROC, {StoreTarget::SOCKETMEM, StoreTarget::SYSMEM}},
+  };
+  static const std::map<Processor::Kind, std::vector<StoreTarget>> defaults_no_socket_mem = {
+    {Processor::Kind::TOC_PROC, {StoreTarget::FBMEM, StoreTarget::ZCMEM}},
+    {Processor::Kind::OMP_PROC, {StoreTarget::SYSMEM}},
     {Processor::Kind::LOC_PROC, {StoreTarget::SYSMEM}},
   };
 
-  auto finder = defaults.find(kind);
-  if (defaults.end() == finder) LEGATE_ABORT;
+  const auto& table = has_socket_mem ? defaults : defaults_no_socket_mem;
+  auto finder       = table.find(kind);
+  if (table.end() == finder) LEGATE_ABORT;
   return finder->second;
 }
 
@@ -67,6 +89,136 @@ std::string log_mappable(const Legion::Mappable& mappable, bool prefix_only = fa
   return ss.str();
 }
 
+uint32_t postmap_replication_threshold()
+{
+  // The value is the number of read fetches after which a field counts as hot; 0 (the
+  // default) disables the policy
+  static const uint32_t threshold = extract_env("LEGATE_POSTMAP_REPLICATION", 0, 0);
+  return threshold;
+}
+
+bool work_stealing_enabled()
+{
+  // Stealing moves tasks off the processors chosen by the library's machine scope, so it is
+  // strictly opt-in
+  static const bool enabled = extract_env("LEGATE_WORK_STEALING", 0, 0) != 0;
+  return enabled;
+}
+
+TaskTarget calibrated_task_target(const Task& legate_task,
+                                  const std::vector<TaskTarget>& options,
+                                  const char* task_name,
+                                  TaskTarget chosen)
+{
+  // A prediction based on fewer samples than this is noise, not calibration
+  constexpr uint64_t MIN_CALIBRATION_SAMPLES = 8;
+
+  // The work volume is the total number of elements the task touches, matching what the task
+  // wrapper records alongside each execution time
+  uint64_t volume  = 0;
+  auto add_volumes = [&volume](const std::vector<Store>& stores) {
+    for (auto& store : stores) {
+      if (store.is_future() || store.unbound()) continue;
+      volume += store.domain().get_volume();
+    }
+  };
+  add_volumes(legate_task.inputs());
+  add_volumes(legate_task.outputs());
+  add_volumes(legate_task.reductions());
+  if (0 == volume) return chosen;
+
+  auto* stats        = detail::TaskStats::get_task_stats();
+  TaskTarget best    = chosen;
+  uint64_t best_time = 0;
+  bool have_best     = false;
+  for (auto& option : options) {
+    uint64_t time_ns = 0;
+    if (!stats->predict_time_ns(
+          task_name, to_kind(option), volume, MIN_CALIBRATION_SAMPLES, time_ns))
+      // A kind with no measurements near this volume wins outright, so the warmup phase
+      // explores every variant before the model starts deciding
+      return option;
+    if (!have_best || time_ns < best_time) {
+      have_best = true;
+      best_time = time_ns;
+      best      = option;
+    }
+  }
+  return best;
+}
+
+bool cpu_proc_groups_enabled()
+{
+  // Ragged slices pin each point task to one CPU, so one slow point leaves its sibling cores
+  // idle. With this on, CPU tasks are instead handed every CPU that may legally run them and
+  // Legion turns the list into a processor group, letting Realm execute each task on whichever
+  // member frees up first. Opt-in because it trades cache and NUMA affinity for load balance
+  static const bool enabled = extract_env("LEGATE_CPU_PROC_GROUPS", 0, 0) != 0;
+  return enabled;
+}
+
+bool ooc_spill_enabled()
+{
+  // Out-of-core fallback: when a memory stays full even after cold-instance eviction,
+  // allocations overflow into Realm's disk memory (backed by local storage, sized with
+  // -ll:dsize) and Legion pages the data back on next use. Opt-in because disk-speed
+  // instances can silently slow down a run that would rather fail fast
+  static const bool enabled = extract_env("LEGATE_OOC_SPILL", 0, 0) != 0;
+  return enabled;
+}
+
+uint32_t backlog_heartbeat_period()
+{
+  // The value is the heartbeat period in seconds; 0 (the default) disables it. The heartbeat
+  // reuses the work-stealing gossip purely for stall diagnosis, so it can be turned on without
+  // also enabling stealing
+  static const uint32_t seconds = extract_env("LEGATE_BACKLOG_HEARTBEAT", 0, 0);
+  return seconds;
+}
+
+// Checks a scratch container out of a thread-local free list and returns it on scope exit, so
+// the container's capacity survives across mapper calls and group bookkeeping stops hitting
+// the allocator on every map_task. A checked-out buffer is exclusively owned, which keeps this
+// safe under SERIALIZED_REENTRANT: a mapper call preempted at a runtime call can't have its
+// scratch clobbered by whatever runs in the meantime, as that call pops its own buffer.
+template <typename T>
+class ScratchBuffer {
+ public:
+  ScratchBuffer()
+  {
+    auto& pool = free_list();
+    if (pool.empty())
+      buffer_ = std::make_unique<T>();
+    else {
+      buffer_ = std::move(pool.back());
+      pool.pop_back();
+    }
+  }
+  ~ScratchBuffer()
+  {
+    buffer_->clear();
+    free_list().push_back(std::move(buffer_));
+  }
+
+ public:
+  ScratchBuffer(const ScratchBuffer&)            = delete;
+  ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+
+ public:
+  T& operator*() { return *buffer_; }
+  T* operator->() { return buffer_.get(); }
+
+ private:
+  static std::vector<std::unique_ptr<T>>& free_list()
+  {
+    static thread_local std::vector<std::unique_ptr<T>> pool{};
+    return pool;
+  }
+
+ private:
+  std::unique_ptr<T> buffer_;
+};
+
 }  // namespace
 
 BaseMapper::BaseMapper(mapping::Mapper* legate_mapper,
@@ -86,6 +238,8 @@ BaseMapper::BaseMapper(mapping::Mapper* legate_mapper,
   ss << context->get_library_name() << " on Node " << machine.local_node;
   mapper_name = ss.str();
 
+  detail::AsyncLoggingBackend::attach(logger);
+
   legate_mapper_->set_machine(this);
 }
 
@@ -114,6 +268,9 @@ BaseMapper::~BaseMapper()
         100.0 * double(pair.second) / capacity);
     }
   }
+  const char* show_stats = getenv("LEGATE_SHOW_MAPPER_STATS");
+  if (show_stats != nullptr && atoi(show_stats) > 0)
+    MapperStats::get_mapper_stats()->dump(logger);
 }
 
 std::string BaseMapper::create_logger_name() const
@@ -174,6 +331,10 @@ void BaseMapper::select_task_options(const Legion::Mapping::MapperContext ctx,
   }
 
   auto target = legate_mapper_->task_target(legate_task, options);
+  // With calibration on, measured per-variant throughput overrides the static preference once
+  // every candidate kind has been sampled near this task's volume
+  if (Core::calibrate_targets && options.size() > 1)
+    target = calibrated_task_target(legate_task, options, task.get_task_name(), target);
   // The initial processor just needs to have the same kind as the eventual target of this task
   output.initial_proc = machine.procs(target).front();
 
@@ -194,10 +355,11 @@ void BaseMapper::slice_task(const Legion::Mapping::MapperContext ctx,
                             const SliceTaskInput& input,
                             SliceTaskOutput& output)
 {
+  MapperTracer::Scope trace_scope("slice_task");
+
   Task legate_task(&task, context, runtime, ctx);
 
   auto& machine_desc = legate_task.machine_desc();
-  auto local_range   = machine.slice(legate_task.target(), machine_desc);
 
   Legion::ProjectionID projection = 0;
   for (auto& req : task.regions)
@@ -205,6 +367,39 @@ void BaseMapper::slice_task(const Legion::Mapping::MapperContext ctx,
       projection = req.projection;
       break;
     }
+
+  // Get the domain for the sharding space also
+  Domain sharding_domain = task.index_domain;
+  if (task.sharding_space.exists())
+    sharding_domain = runtime->get_index_space_domain(ctx, task.sharding_space);
+
+  SliceCacheKey cache_key;
+  auto append_domain = [&cache_key](const Domain& domain) {
+    cache_key.push_back(domain.dim);
+    for (int32_t dim = 0; dim < domain.dim; ++dim) {
+      cache_key.push_back(domain.lo()[dim]);
+      cache_key.push_back(domain.hi()[dim]);
+    }
+  };
+  cache_key.push_back(static_cast<int64_t>(legate_task.target()));
+  cache_key.push_back(projection);
+  append_domain(input.domain);
+  append_domain(sharding_domain);
+  cache_key.push_back(static_cast<int64_t>(machine_desc.preferred_target));
+  for (auto& [target, range] : machine_desc.processor_ranges) {
+    cache_key.push_back(static_cast<int64_t>(target));
+    cache_key.push_back(range.low);
+    cache_key.push_back(range.high);
+    cache_key.push_back(range.per_node_count);
+  }
+
+  auto finder = slice_caches.find(cache_key);
+  if (finder != slice_caches.end()) {
+    output.slices = finder->second;
+    return;
+  }
+
+  auto local_range = machine.slice(legate_task.target(), machine_desc);
   auto key_functor = find_legate_projection_functor(projection);
 
   // For multi-node cases we should already have been sharded so we
@@ -212,11 +407,6 @@ void BaseMapper::slice_task(const Legion::Mapping::MapperContext ctx,
   // them and round-robin them across the local processors here
   output.slices.reserve(input.domain.get_volume());
 
-  // Get the domain for the sharding space also
-  Domain sharding_domain = task.index_domain;
-  if (task.sharding_space.exists())
-    sharding_domain = runtime->get_index_space_domain(ctx, task.sharding_space);
-
   auto lo                    = key_functor->project_point(sharding_domain.lo(), sharding_domain);
   auto hi                    = key_functor->project_point(sharding_domain.hi(), sharding_domain);
   uint32_t total_tasks_count = linearize(lo, hi, hi) + 1;
@@ -229,6 +419,8 @@ void BaseMapper::slice_task(const Legion::Mapping::MapperContext ctx,
     output.slices.push_back(
       TaskSlice(Domain(itr.p, itr.p), local_range[idx], false /*recurse*/, false /*stealable*/));
   }
+
+  slice_caches[std::move(cache_key)] = output.slices;
 }
 
 bool BaseMapper::has_variant(const Legion::Mapping::MapperContext ctx,
@@ -238,17 +430,35 @@ bool BaseMapper::has_variant(const Legion::Mapping::MapperContext ctx,
   return find_variant(ctx, task, to_kind(target)).has_value();
 }
 
+static int32_t variant_kind_index(Processor::Kind kind)
+{
+  switch (kind) {
+    case Processor::LOC_PROC: return 0;
+    case Processor::TOC_PROC: return 1;
+    case Processor::OMP_PROC: return 2;
+    default: return -1;
+  }
+}
+
 std::optional<Legion::VariantID> BaseMapper::find_variant(const Legion::Mapping::MapperContext ctx,
                                                           const Legion::Task& task,
                                                           Processor::Kind kind)
 {
-  const VariantCacheKey key(task.task_id, kind);
-  auto finder = variants.find(key);
-  if (finder != variants.end()) return finder->second;
+#ifdef DEBUG_LEGATE
+  assert(context->valid_task_id(task.task_id));
+#endif
+  const auto local_id   = static_cast<size_t>(context->get_local_task_id(task.task_id));
+  const auto kind_index = variant_kind_index(kind);
+#ifdef DEBUG_LEGATE
+  assert(kind_index >= 0);
+#endif
+  if (local_id >= variant_cache.size()) variant_cache.resize(local_id + 1);
+  auto& entry = variant_cache[local_id];
+  if (entry.resolved[kind_index]) return entry.variants[kind_index];
 
   // Haven't seen it before so let's look it up to make sure it exists
   std::vector<Legion::VariantID> avail_variants;
-  runtime->find_valid_variants(ctx, key.first, avail_variants, key.second);
+  runtime->find_valid_variants(ctx, task.task_id, avail_variants, kind);
   std::optional<Legion::VariantID> result;
   for (auto vid : avail_variants) {
 #ifdef DEBUG_LEGATE
@@ -264,7 +474,8 @@ std::optional<Legion::VariantID> BaseMapper::find_variant(const Legion::Mapping:
       default: LEGATE_ABORT;  // unhandled variant kind
     }
   }
-  variants[key] = result;
+  entry.variants[kind_index] = result;
+  entry.resolved[kind_index] = true;
   return result;
 }
 
@@ -273,6 +484,7 @@ void BaseMapper::map_task(const Legion::Mapping::MapperContext ctx,
                           const MapTaskInput& input,
                           MapTaskOutput& output)
 {
+  MapperTracer::Scope trace_scope("map_task");
 #ifdef DEBUG_LEGATE
   logger.debug() << "Entering map_task for "
                  << Legion::Mapping::Utilities::to_string(runtime, ctx, task);
@@ -281,6 +493,14 @@ void BaseMapper::map_task(const Legion::Mapping::MapperContext ctx,
   // Should never be mapping the top-level task here
   assert(task.get_depth() > 0);
 
+  // Account for the mapping progress and wake up the scheduler if it deferred the ready queue
+  // waiting for a bigger batch
+  tasks_in_flight--;
+  if (defer_select_tasks_to_map.exists()) {
+    runtime->trigger_mapper_event(ctx, defer_select_tasks_to_map);
+    defer_select_tasks_to_map = Legion::Mapping::MapperEvent();
+  }
+
   // Let's populate easy outputs first
   auto variant = find_variant(ctx, task, task.target_proc.kind());
 #ifdef DEBUG_LEGATE
@@ -304,7 +524,63 @@ void BaseMapper::map_task(const Legion::Mapping::MapperContext ctx,
     output.target_procs.push_back(local_range.first());
   }
 
-  const auto& options = default_store_targets(task.target_proc.kind());
+  if (cpu_proc_groups_enabled() && task.target_proc.kind() == Processor::LOC_PROC &&
+      !output.target_procs.empty()) {
+    // Expand the chosen CPU into all of its siblings within the library's machine scope,
+    // restricted to the same socket when NUMA information is available so instances stay
+    // local. Legion maps the multi-processor list onto a processor group, which gives us
+    // work-stealing within the node without touching application code
+    auto local_range    = machine.slice(legate_task.target(), legate_task.machine_desc());
+    const auto chosen   = output.target_procs.front();
+    const auto& sockets = machine.socket_memories();
+    const auto socket   = sockets.find(chosen);
+    output.target_procs.clear();
+    for (auto& proc : local_range.procs()) {
+      if (sockets.end() != socket) {
+        const auto finder = sockets.find(proc);
+        if (sockets.end() == finder || finder->second != socket->second) continue;
+      }
+      output.target_procs.push_back(proc);
+    }
+    if (output.target_procs.empty()) output.target_procs.push_back(chosen);
+  }
+
+  const auto& options = default_store_targets(task.target_proc.kind(), machine.has_socket_memory());
+
+  std::vector<StoreMapping> for_futures, for_unbound_stores, for_stores;
+  std::set<uint32_t> mapped_futures;
+
+  // Check if we already computed a mapping plan for this task signature; if so, we can rebuild
+  // the store mappings directly from the cached policies and skip the client mapper
+  auto plan_key    = compute_mapping_plan_key(task, *variant, legate_task);
+  auto plan_finder = mapping_plans.find(plan_key);
+  if (plan_finder != mapping_plans.end()) {
+    auto resolve_slot = [&legate_task](const std::pair<int32_t, uint32_t>& slot) -> const Store& {
+      switch (slot.first) {
+        case 0: return legate_task.inputs()[slot.second];
+        case 1: return legate_task.outputs()[slot.second];
+        case 2: return legate_task.reductions()[slot.second];
+      }
+      LEGATE_ABORT;  // unreachable
+      return legate_task.inputs().front();
+    };
+    for (auto& entry : plan_finder->second.entries) {
+      StoreMapping mapping;
+      mapping.policy = entry.policy;
+      for (auto& slot : entry.store_slots)
+        mapping.stores.push_back(std::cref(resolve_slot(slot)));
+      if (mapping.for_future()) {
+        mapped_futures.insert(mapping.store().future_index());
+        for_futures.push_back(std::move(mapping));
+      } else if (mapping.for_unbound_store())
+        for_unbound_stores.push_back(std::move(mapping));
+      else
+        for_stores.push_back(std::move(mapping));
+    }
+    map_legate_task_stores(
+      ctx, task, for_futures, for_unbound_stores, for_stores, mapped_futures.size(), output);
+    return;
+  }
 
   auto mappings = legate_mapper_->store_mappings(legate_task, options);
 
@@ -331,11 +607,15 @@ void BaseMapper::map_task(const Legion::Mapping::MapperContext ctx,
   for (auto& mapping : mappings) validate_colocation(mapping);
 #endif
 
-  std::vector<StoreMapping> for_futures, for_unbound_stores, for_stores;
-  std::set<uint32_t> mapped_futures;
   std::set<RegionField::Id> mapped_regions;
 
   for (auto& mapping : mappings) {
+    if (AllocPolicy::VIRTUAL == mapping.policy.allocation &&
+        (mapping.for_future() || mapping.for_unbound_store())) {
+      logger.error("Mapper %s requested a virtual mapping for a future-backed or unbound store",
+                   get_mapper_name());
+      LEGATE_ABORT;
+    }
     if (mapping.for_future()) {
       auto fut_idx = mapping.store().future_index();
       // Only need to map Future-backed Stores corresponding to inputs (i.e. one of task.futures)
@@ -409,8 +689,88 @@ void BaseMapper::map_task(const Legion::Mapping::MapperContext ctx,
   }
 #endif
 
+  // Record the plan so repeat launches of the same task signature skip the recomputation
+  {
+    auto find_slot = [&legate_task](const Store& store) -> std::pair<int32_t, uint32_t> {
+      auto index_in = [&store](const std::vector<Store>& stores) -> int64_t {
+        if (stores.empty()) return -1;
+        const auto* base = stores.data();
+        if (&store >= base && &store < base + stores.size()) return &store - base;
+        return -1;
+      };
+      int64_t idx;
+      if ((idx = index_in(legate_task.inputs())) >= 0) return {0, static_cast<uint32_t>(idx)};
+      if ((idx = index_in(legate_task.outputs())) >= 0) return {1, static_cast<uint32_t>(idx)};
+      if ((idx = index_in(legate_task.reductions())) >= 0) return {2, static_cast<uint32_t>(idx)};
+      LEGATE_ABORT;  // store mappings must refer to the task's stores
+      return {0, 0};
+    };
+    MappingPlan plan;
+    auto record_mappings = [&](const std::vector<StoreMapping>& mappings) {
+      for (auto& mapping : mappings) {
+        MappingPlan::Entry entry;
+        entry.policy = mapping.policy;
+        for (auto& store : mapping.stores) entry.store_slots.push_back(find_slot(store.get()));
+        plan.entries.push_back(std::move(entry));
+      }
+    };
+    record_mappings(for_futures);
+    record_mappings(for_unbound_stores);
+    record_mappings(for_stores);
+    // Crude bound on the cache size; plans are small, but we don't want unbounded growth when
+    // the workload keeps generating fresh task signatures
+    if (mapping_plans.size() >= 1024) mapping_plans.clear();
+    mapping_plans[std::move(plan_key)] = std::move(plan);
+  }
+
+  map_legate_task_stores(
+    ctx, task, for_futures, for_unbound_stores, for_stores, mapped_futures.size(), output);
+}
+
+BaseMapper::MappingPlanKey BaseMapper::compute_mapping_plan_key(const Legion::Task& task,
+                                                                Legion::VariantID variant,
+                                                                const Task& legate_task) const
+{
+  MappingPlanKey key;
+  key.push_back(task.task_id);
+  key.push_back(variant);
+  key.push_back(task.target_proc.kind());
+  auto append_stores = [&key](const std::vector<Store>& stores) {
+    key.push_back(stores.size());
+    for (auto& store : stores) {
+      key.push_back(store.is_future());
+      key.push_back(store.unbound());
+      key.push_back(store.dim());
+      key.push_back(store.is_reduction() ? store.redop() : 0);
+      if (store.is_future())
+        key.push_back(store.future_index());
+      else {
+        key.push_back(store.requirement_index());
+        // Store shapes participate in the key, as client mappers can pick policies based on them
+        if (!store.unbound()) {
+          auto domain = store.domain();
+          for (int32_t dim = 0; dim < domain.dim; ++dim)
+            key.push_back(domain.hi()[dim] - domain.lo()[dim] + 1);
+        }
+      }
+    }
+  };
+  append_stores(legate_task.inputs());
+  append_stores(legate_task.outputs());
+  append_stores(legate_task.reductions());
+  return key;
+}
+
+void BaseMapper::map_legate_task_stores(const Legion::Mapping::MapperContext ctx,
+                                        const Legion::Task& task,
+                                        std::vector<StoreMapping>& for_futures,
+                                        std::vector<StoreMapping>& for_unbound_stores,
+                                        std::vector<StoreMapping>& for_stores,
+                                        size_t num_futures,
+                                        MapTaskOutput& output)
+{
   // Map future-backed stores
-  output.future_locations.resize(mapped_futures.size());
+  output.future_locations.resize(num_futures);
   for (auto& mapping : for_futures) {
     auto fut_idx       = mapping.store().future_index();
     StoreTarget target = mapping.policy.target;
@@ -445,6 +805,21 @@ void BaseMapper::map_task(const Legion::Mapping::MapperContext ctx,
     output_map[&task.regions[idx]] = &output.chosen_instances[idx];
 
   map_legate_stores(ctx, task, for_stores, task.target_proc, output_map);
+
+  // Ask for the postmap callback when this task reads a field that consumers keep fetching;
+  // postmap_task then fans the data out to the recorded consumer memories
+  const auto threshold = postmap_replication_threshold();
+  if (threshold > 0)
+    for (auto& req : task.regions) {
+      if (req.privilege != LEGION_READ_ONLY || req.privilege_fields.size() != 1) continue;
+      auto finder =
+        read_fetch_profiles.find({req.region.get_tree_id(), *req.privilege_fields.begin()});
+      if (read_fetch_profiles.end() == finder) continue;
+      if (finder->second.fetches >= threshold && finder->second.consumers.size() > 1) {
+        output.postmap_task = true;
+        break;
+      }
+    }
 }
 
 void BaseMapper::replicate_task(const Legion::Mapping::MapperContext ctx,
@@ -461,10 +836,173 @@ void BaseMapper::map_legate_stores(const Legion::Mapping::MapperContext ctx,
                                    Processor target_proc,
                                    OutputMap& output_map)
 {
+  apply_usage_profiles(mappable, mappings);
+
+  // Peel off virtually mapped stores first: they get the virtual instance instead of a
+  // physical one, and the runtime serves their reads through composite views
+  bool has_virtual = false;
+  for (auto& mapping : mappings)
+    has_virtual = has_virtual || AllocPolicy::VIRTUAL == mapping.policy.allocation;
+  if (has_virtual) {
+    ScratchBuffer<std::vector<StoreMapping>> physical;
+    physical->reserve(mappings.size());
+    for (auto& mapping : mappings) {
+      if (AllocPolicy::VIRTUAL != mapping.policy.allocation) {
+        physical->push_back(std::move(mapping));
+        continue;
+      }
+      for (auto* req : mapping.requirements()) {
+        if (req->redop != 0) {
+          logger.error("Mapper %s requested a virtual mapping for a reduction requirement",
+                       get_mapper_name());
+          LEGATE_ABORT;
+        }
+        output_map[req]->push_back(Legion::Mapping::PhysicalInstance::get_virtual_instance());
+      }
+    }
+    // Swap rather than move, so the caller's old storage goes back to the pool with the scratch
+    mappings.swap(*physical);
+  }
+
+  // Tasks that pass the same store as several arguments (our self-join and in-place update
+  // patterns) carry multiple requirements over the same region and fields. Coalesce mappings
+  // whose requirements cover the same data under the same policy by merging their stores into
+  // one representative mapping: the store gets mapped once, and the fan-out loop below pushes
+  // the shared instance to every requirement slot. Without this, the duplicates run redundant
+  // instance searches and, since lookups all happen before any instance is recorded, can each
+  // create their own instance for the same data.
+  if (mappings.size() > 1) {
+    // A mapping's coverage is the set of (region, redop, fields) triples over its requirements;
+    // two mappings with equal coverage and equal policies are interchangeable. Requirements with
+    // different reduction operators never coalesce, as their instances have different layouts.
+    using ReqKey =
+      std::tuple<Legion::LogicalRegion, Legion::ReductionOpID, std::set<Legion::FieldID>>;
+    std::map<std::vector<ReqKey>, std::vector<uint32_t>> candidates;
+    ScratchBuffer<std::vector<StoreMapping>> unique_scratch;
+    auto& unique = *unique_scratch;
+    unique.reserve(mappings.size());
+    for (auto& mapping : mappings) {
+      auto reqs = mapping.requirements();
+      if (reqs.empty()) {
+        unique.push_back(std::move(mapping));
+        continue;
+      }
+      std::vector<ReqKey> key;
+      key.reserve(reqs.size());
+      for (auto* req : reqs) key.emplace_back(req->region, req->redop, req->privilege_fields);
+      std::sort(key.begin(), key.end());
+      auto& group        = candidates[std::move(key)];
+      StoreMapping* repr = nullptr;
+      for (auto idx : group)
+        if (unique[idx].policy == mapping.policy) {
+          repr = &unique[idx];
+          break;
+        }
+      if (nullptr == repr) {
+        group.push_back(unique.size());
+        unique.push_back(std::move(mapping));
+        continue;
+      }
+#ifdef DEBUG_LEGATE
+      std::stringstream reqs_ss;
+      for (auto req_idx : mapping.requirement_indices()) reqs_ss << " " << req_idx;
+      logger.debug() << log_mappable(mappable)
+                     << ": coalesced duplicate mapping for reqs:" << reqs_ss.str();
+#endif
+      repr->stores.insert(repr->stores.end(), mapping.stores.begin(), mapping.stores.end());
+    }
+    mappings.swap(unique);
+  }
+
   auto try_mapping = [&](bool can_fail) {
     const Legion::Mapping::PhysicalInstance NO_INST{};
-    std::vector<Legion::Mapping::PhysicalInstance> instances;
-    for (auto& mapping : mappings) {
+    ScratchBuffer<std::vector<Legion::Mapping::PhysicalInstance>> instances_scratch;
+    auto& instances = *instances_scratch;
+    instances.assign(mappings.size(), NO_INST);
+
+    // First pass: look up cached instances for all stores and acquire them in one batched
+    // runtime call, so tasks with many region requirements don't pay for a long serial chain
+    // of acquire_instance calls
+    ScratchBuffer<std::vector<Legion::Mapping::PhysicalInstance>> lookups_scratch;
+    auto& lookups = *lookups_scratch;
+    lookups.assign(mappings.size(), NO_INST);
+    auto lookup_range = [&](uint32_t lo, uint32_t hi) {
+      for (uint32_t idx = lo; idx < hi; ++idx) {
+        auto& mapping                            = mappings[idx];
+        auto reqs                                = mapping.requirements();
+        Legion::Mapping::PhysicalInstance result = NO_INST;
+        if (find_legate_store(ctx, mapping, reqs, target_proc, result)) lookups[idx] = result;
+      }
+    };
+    // The lookups never call into the mapper runtime and the instance managers take their locks
+    // in shared mode, so for wide tasks we can fan this pass out across threads; only the
+    // acquire/create steps below have to stay on the mapper thread
+    const uint32_t num_mappings                  = mappings.size();
+    constexpr uint32_t PARALLEL_LOOKUP_THRESHOLD = 16;
+    const uint32_t num_workers = std::min<uint32_t>(std::thread::hardware_concurrency(), 4);
+    if (num_mappings >= PARALLEL_LOOKUP_THRESHOLD && num_workers > 1) {
+      std::vector<std::thread> workers;
+      const uint32_t chunk = (num_mappings + num_workers - 1) / num_workers;
+      for (uint32_t widx = 0; widx < num_workers; ++widx) {
+        const uint32_t lo = widx * chunk;
+        const uint32_t hi = std::min(num_mappings, lo + chunk);
+        if (lo >= hi) break;
+        workers.emplace_back(lookup_range, lo, hi);
+      }
+      for (auto& worker : workers) worker.join();
+    } else
+      lookup_range(0, num_mappings);
+
+    ScratchBuffer<std::vector<Legion::Mapping::PhysicalInstance>> cached_scratch;
+    ScratchBuffer<std::vector<uint32_t>> cached_indices_scratch;
+    auto& cached         = *cached_scratch;
+    auto& cached_indices = *cached_indices_scratch;
+    for (uint32_t idx = 0; idx < num_mappings; ++idx)
+      if (NO_INST != lookups[idx]) {
+        cached.push_back(lookups[idx]);
+        cached_indices.push_back(idx);
+      }
+    if (!cached.empty()) {
+      ScratchBuffer<std::vector<Legion::Mapping::PhysicalInstance>> acquired_scratch;
+      auto& acquired = *acquired_scratch;
+      acquired       = cached;
+      runtime->acquire_and_filter_instances(ctx, acquired);
+#ifdef DEBUG_LEGATE
+      logger.debug() << log_mappable(mappable) << ": batch-acquired " << acquired.size() << "/"
+                     << cached.size() << " cached instances";
+#endif
+      // Collected instances are purged in batches after the scan: a phase transition can kill
+      // many cached instances at once, and erasing them one by one would take the managers'
+      // exclusive locks once per instance in the middle of the mapping path
+      ScratchBuffer<std::vector<Legion::Mapping::PhysicalInstance>> dead_reduction_scratch;
+      ScratchBuffer<std::vector<Legion::Mapping::PhysicalInstance>> dead_local_scratch;
+      auto& dead_reduction = *dead_reduction_scratch;
+      auto& dead_local     = *dead_local_scratch;
+      for (uint32_t idx = 0; idx < cached.size(); ++idx) {
+        auto& instance = cached[idx];
+        if (std::find(acquired.begin(), acquired.end(), instance) != acquired.end())
+          instances[cached_indices[idx]] = instance;
+        else {
+          // The instance has been collected since we found it; purge it from the manager so the
+          // creation pass below makes a fresh one
+          auto reqs = mappings[cached_indices[idx]].requirements();
+          if ((*reqs.begin())->redop != 0)
+            dead_reduction.push_back(instance);
+          else
+            dead_local.push_back(instance);
+        }
+      }
+      reduction_instances->erase(dead_reduction);
+      local_instances->erase(dead_local);
+      auto* tracker = MemoryUsageTracker::get_tracker();
+      for (auto& dead : dead_reduction) tracker->record_deallocation(dead);
+      for (auto& dead : dead_local) tracker->record_deallocation(dead);
+    }
+
+    // Second pass: create the instances we couldn't find in the cache
+    for (uint32_t mapping_idx = 0; mapping_idx < mappings.size(); ++mapping_idx) {
+      if (NO_INST != instances[mapping_idx]) continue;
+      auto& mapping                            = mappings[mapping_idx];
       Legion::Mapping::PhysicalInstance result = NO_INST;
       auto reqs                                = mapping.requirements();
       while (map_legate_store(ctx, mappable, mapping, reqs, target_proc, result, can_fail)) {
@@ -472,7 +1010,12 @@ void BaseMapper::map_legate_stores(const Legion::Mapping::MapperContext ctx,
 #ifdef DEBUG_LEGATE
           assert(can_fail);
 #endif
-          for (auto& instance : instances) runtime->release_instance(ctx, instance);
+          // Release everything acquired so far in one grouped runtime call instead of a
+          // serial chain of per-instance releases
+          std::vector<Legion::Mapping::PhysicalInstance> to_release;
+          for (auto& instance : instances)
+            if (NO_INST != instance) to_release.push_back(instance);
+          if (!to_release.empty()) runtime->release_instances(ctx, to_release);
           return false;
         }
 #ifdef DEBUG_LEGATE
@@ -490,16 +1033,14 @@ void BaseMapper::map_legate_stores(const Legion::Mapping::MapperContext ctx,
         logger.debug() << log_mappable(mappable) << ": failed to acquire instance " << result
                        << " for reqs:" << reqs_ss.str();
 #endif
-        if ((*reqs.begin())->redop != 0) {
-          Legion::Mapping::AutoLock lock(ctx, reduction_instances->manager_lock());
+        if ((*reqs.begin())->redop != 0)
           reduction_instances->erase(result);
-        } else {
-          Legion::Mapping::AutoLock lock(ctx, local_instances->manager_lock());
+        else
           local_instances->erase(result);
-        }
+        MemoryUsageTracker::get_tracker()->record_deallocation(result);
         result = NO_INST;
       }
-      instances.push_back(result);
+      instances[mapping_idx] = result;
     }
 
     // If we're here, all stores are mapped and instances are all acquired
@@ -530,12 +1071,39 @@ void BaseMapper::map_legate_stores(const Legion::Mapping::MapperContext ctx,
   }
 }
 
+void BaseMapper::apply_usage_profiles(const Legion::Mappable& mappable,
+                                      std::vector<StoreMapping>& mappings)
+{
+  for (auto& mapping : mappings) {
+    if (UsageProfile::WRITE_ONCE != mapping.policy.profile || mapping.policy.exact) continue;
+
+    int32_t priv = LEGION_NO_ACCESS;
+    for (auto* req : mapping.requirements()) priv |= req->privilege;
+    if (!(priv & LEGION_WRITE_PRIV)) continue;
+
+    // A write-once store gets a tight instance right away; this is the policy that
+    // tighten_write_policies would converge to after a failed first mapping, so declaring the
+    // profile just skips the wasted attempt and the bloated intermediate instance
+#ifdef DEBUG_LEGATE
+    std::stringstream reqs_ss;
+    for (auto req_idx : mapping.requirement_indices()) reqs_ss << " " << req_idx;
+    logger.debug() << log_mappable(mappable)
+                   << ": pre-tightened write-once mapping policy for reqs:" << reqs_ss.str();
+#endif
+    mapping.policy.exact = true;
+  }
+}
+
 void BaseMapper::tighten_write_policies(const Legion::Mappable& mappable,
                                         std::vector<StoreMapping>& mappings)
 {
   for (auto& mapping : mappings) {
     // If the policy is exact, there's nothing we can tighten
     if (mapping.policy.exact) continue;
+    // Accumulate-heavy stores keep their lenient policies: a tight instance would only
+    // invalidate the shared one they keep hitting, trading one failed mapping now for a
+    // remap on every future update
+    if (UsageProfile::ACCUMULATE == mapping.policy.profile) continue;
 
     int32_t priv = LEGION_NO_ACCESS;
     for (auto* req : mapping.requirements()) priv |= req->privilege;
@@ -552,6 +1120,49 @@ void BaseMapper::tighten_write_policies(const Legion::Mappable& mappable,
   }
 }
 
+bool BaseMapper::find_legate_store(const Legion::Mapping::MapperContext ctx,
+                                   const StoreMapping& mapping,
+                                   const std::set<const Legion::RegionRequirement*>& reqs,
+                                   Processor target_proc,
+                                   Legion::Mapping::PhysicalInstance& result)
+{
+  if (reqs.empty()) return false;
+  // Instance caching is only done for single-region mappings; coalesced duplicate requirements
+  // count as one region here, as they all name the same one
+  for (auto* req : reqs)
+    if (req->region != (*reqs.begin())->region) return false;
+
+  const auto& policy = mapping.policy;
+  std::set<Legion::FieldID> fields;
+  for (auto& store : mapping.stores) {
+    if (store.get().is_future()) return false;
+    fields.insert(store.get().region_field().field_id());
+  }
+
+  auto region        = (*reqs.begin())->region;
+  auto target_memory = machine.get_memory(target_proc, policy.target);
+
+  auto redop = (*reqs.begin())->redop;
+  if (redop != 0) {
+    // We reuse reduction instances only for GPU tasks
+    if (fields.size() != 1) return false;
+    if (target_proc.kind() != Processor::TOC_PROC) return false;
+    return reduction_instances->find_instance(
+      redop, region, *fields.begin(), target_memory, result, policy);
+  }
+  // A colocation group's instance is recorded once per field; the cached copy is usable only
+  // if every field's lookup lands on that same multi-field instance
+  Legion::Mapping::PhysicalInstance found{};
+  for (auto fid : fields) {
+    Legion::Mapping::PhysicalInstance inst{};
+    if (!local_instances->find_instance(region, fid, target_memory, inst, policy)) return false;
+    if (found.exists() && inst != found) return false;
+    found = inst;
+  }
+  result = found;
+  return true;
+}
+
 bool BaseMapper::map_legate_store(const Legion::Mapping::MapperContext ctx,
                                   const Legion::Mappable& mappable,
                                   const StoreMapping& mapping,
@@ -563,8 +1174,13 @@ bool BaseMapper::map_legate_store(const Legion::Mapping::MapperContext ctx,
   if (reqs.empty()) return false;
 
   const auto& policy = mapping.policy;
-  std::vector<Legion::LogicalRegion> regions;
-  for (auto* req : reqs) regions.push_back(req->region);
+  ScratchBuffer<std::vector<Legion::LogicalRegion>> regions_scratch;
+  auto& regions = *regions_scratch;
+  // Coalesced duplicate requirements name the same region; the instance managers should see
+  // each region only once
+  for (auto* req : reqs)
+    if (std::find(regions.begin(), regions.end(), req->region) == regions.end())
+      regions.push_back(req->region);
   auto target_memory = machine.get_memory(target_proc, policy.target);
 
   auto redop = (*reqs.begin())->redop;
@@ -586,9 +1202,8 @@ bool BaseMapper::map_legate_store(const Legion::Mapping::MapperContext ctx,
 
   // If we're making a reduction instance:
   if (redop != 0) {
-    // We need to hold the instance manager lock as we're about to try
-    // to find an instance
-    Legion::Mapping::AutoLock reduction_lock(ctx, reduction_instances->manager_lock());
+    // The instance managers take their locks internally; lookups run in shared mode so
+    // concurrently mapping contexts don't serialize on the manager.
 
     // This whole process has to appear atomic
     runtime->disable_reentrant(ctx);
@@ -637,28 +1252,43 @@ bool BaseMapper::map_legate_store(const Legion::Mapping::MapperContext ctx,
           reduction_instances->record_instance(redop, regions.front(), fid, result, policy);
         }
       }
+      MemoryUsageTracker::get_tracker()->record_allocation(
+        context->get_library_name(), result, target_memory, footprint);
       runtime->enable_reentrant(ctx);
       // We already did the acquire
       return false;
     }
     if (!can_fail)
-      report_failed_mapping(mappable, mapping.requirement_index(), target_memory, redop, footprint);
+      for (auto req_idx : mapping.requirement_indices())
+        report_failed_mapping(mappable, req_idx, target_memory, redop, footprint);
     return true;
   }
 
-  Legion::Mapping::AutoLock lock(ctx, local_instances->manager_lock());
   runtime->disable_reentrant(ctx);
-  // See if we already have it in our local instances
-  if (fields.size() == 1 && regions.size() == 1 &&
-      local_instances->find_instance(
-        regions.front(), fields.front(), target_memory, result, policy)) {
+  // See if we already have it in our local instances; a multi-field mapping is cached only if
+  // every field's lookup lands on the same colocated instance
+  if (regions.size() == 1) {
+    const Legion::Mapping::PhysicalInstance NO_INST{};
+    bool found = true;
+    for (auto fid : fields) {
+      Legion::Mapping::PhysicalInstance inst{};
+      if (!local_instances->find_instance(regions.front(), fid, target_memory, inst, policy) ||
+          (NO_INST != result && inst != result)) {
+        found = false;
+        break;
+      }
+      result = inst;
+    }
+    if (found && NO_INST != result) {
 #ifdef DEBUG_LEGATE
-    logger.debug() << "Operation " << mappable.get_unique_id() << ": reused cached instance "
-                   << result << " for " << regions.front();
+      logger.debug() << "Operation " << mappable.get_unique_id() << ": reused cached instance "
+                     << result << " for " << regions.front();
 #endif
-    runtime->enable_reentrant(ctx);
-    // Needs acquire to keep the runtime happy
-    return true;
+      runtime->enable_reentrant(ctx);
+      // Needs acquire to keep the runtime happy
+      return true;
+    }
+    result = NO_INST;
   }
 
   std::shared_ptr<RegionGroup> group{nullptr};
@@ -676,40 +1306,111 @@ bool BaseMapper::map_legate_store(const Legion::Mapping::MapperContext ctx,
     const Domain domain = runtime->get_index_space_domain(ctx, is);
     group =
       local_instances->find_region_group(regions.front(), domain, fid, target_memory, policy.exact);
-    regions = group->get_regions();
+    group->fill_regions(regions);
+  } else if (regions.size() == 1) {
+    // A colocation group of several fields skips the coalescing heuristic: the group must stay
+    // a singleton so that the lookups above, which run once per field, all land on the exact
+    // same recorded group and instance
+    auto is             = regions.front().get_index_space();
+    const Domain domain = runtime->get_index_space_domain(ctx, is);
+    group = std::make_shared<RegionGroup>(std::set<Legion::LogicalRegion>{regions.front()}, domain);
   }
 
   bool created     = false;
   bool success     = false;
   size_t footprint = 0;
 
-  switch (policy.allocation) {
-    case AllocPolicy::MAY_ALLOC: {
-      success = runtime->find_or_create_physical_instance(ctx,
-                                                          target_memory,
-                                                          layout_constraints,
-                                                          regions,
-                                                          result,
-                                                          created,
-                                                          true /*acquire*/,
-                                                          LEGION_GC_DEFAULT_PRIORITY,
-                                                          policy.exact /*tight bounds*/,
-                                                          &footprint);
-      break;
+  auto try_create = [&]() {
+    switch (policy.allocation) {
+      case AllocPolicy::MAY_ALLOC: {
+        success = runtime->find_or_create_physical_instance(ctx,
+                                                            target_memory,
+                                                            layout_constraints,
+                                                            regions,
+                                                            result,
+                                                            created,
+                                                            true /*acquire*/,
+                                                            LEGION_GC_DEFAULT_PRIORITY,
+                                                            policy.exact /*tight bounds*/,
+                                                            &footprint);
+        break;
+      }
+      case AllocPolicy::MUST_ALLOC: {
+        success = runtime->create_physical_instance(ctx,
+                                                    target_memory,
+                                                    layout_constraints,
+                                                    regions,
+                                                    result,
+                                                    true /*acquire*/,
+                                                    LEGION_GC_DEFAULT_PRIORITY,
+                                                    policy.exact /*tight bounds*/,
+                                                    &footprint);
+        break;
+      }
+      default: LEGATE_ABORT;  // should never get here
     }
-    case AllocPolicy::MUST_ALLOC: {
-      success = runtime->create_physical_instance(ctx,
-                                                  target_memory,
-                                                  layout_constraints,
-                                                  regions,
-                                                  result,
-                                                  true /*acquire*/,
-                                                  LEGION_GC_DEFAULT_PRIORITY,
-                                                  policy.exact /*tight bounds*/,
-                                                  &footprint);
-      break;
+  };
+  try_create();
+
+  if (!success) {
+    // Before giving up, proactively release cold cached instances from the target memory and
+    // retry the allocation once. Evicted instances are removed from the manager and demoted to
+    // the lowest GC priority so Legion can reclaim them for the new allocation.
+    auto victims = local_instances->release_cold_instances(target_memory, footprint);
+    if (!victims.empty()) {
+#ifdef DEBUG_LEGATE
+      logger.debug() << "Operation " << mappable.get_unique_id() << ": released "
+                     << victims.size() << " cold instances on memory " << target_memory
+                     << " and retrying allocation";
+#endif
+      for (auto& victim : victims) {
+        runtime->set_garbage_collection_priority(ctx, victim, LEGION_GC_FIRST_PRIORITY);
+        MemoryUsageTracker::get_tracker()->record_deallocation(victim);
+      }
+      try_create();
+    }
+  }
+
+  if (!success && policy.target == StoreTarget::SOCKETMEM) {
+    // NUMA spill: the local socket memory is full even after eviction, so try the remote
+    // sockets and finally the system memory before giving up; a misplaced instance beats a
+    // failed mapping
+    std::set<Memory> tried{target_memory};
+    for (auto& pair : machine.socket_memories()) {
+      if (success) break;
+      if (tried.find(pair.second) != tried.end()) continue;
+      tried.insert(pair.second);
+      target_memory = pair.second;
+      try_create();
     }
-    default: LEGATE_ABORT;  // should never get here
+    if (!success && tried.find(machine.system_memory()) == tried.end()) {
+      target_memory = machine.system_memory();
+      try_create();
+    }
+#ifdef DEBUG_LEGATE
+    if (success)
+      logger.debug() << "Operation " << mappable.get_unique_id() << ": spilled instance to memory "
+                     << target_memory;
+#endif
+  }
+
+  if (!success && ooc_spill_enabled()) {
+    // Out-of-core spill: place the instance in a local disk-backed memory instead of failing.
+    // Legion tracks it like any other instance, so the data is fetched back into a fast memory
+    // the next time a task maps it there; until the pressure drops, access runs at storage
+    // bandwidth, which beats not running at all
+    Legion::Machine::MemoryQuery disks(legion_machine);
+    disks.local_address_space();
+    for (auto memory : disks) {
+      if (memory.kind() != Memory::DISK_MEM && memory.kind() != Memory::FILE_MEM) continue;
+      target_memory = memory;
+      try_create();
+      if (success) break;
+    }
+    if (success)
+      logger.warning() << "Operation " << mappable.get_unique_id()
+                       << ": spilled instance to disk-backed memory " << target_memory
+                       << " (size: " << footprint << " bytes); expect storage-speed access";
   }
 
   if (success) {
@@ -725,11 +1426,31 @@ bool BaseMapper::map_legate_store(const Legion::Mapping::MapperContext ctx,
                      << " for " << *group;
     }
 #endif
-    // Only save the result for future use if it is not an external instance
+    // Only save the result for future use if it is not an external instance. A multi-field
+    // instance is recorded once per field, so per-field lookups and erasures keep working
     if (!result.is_external_instance() && group != nullptr) {
-      assert(fields.size() == 1);
-      auto fid = fields.front();
-      local_instances->record_instance(group, fid, result, policy);
+      ScratchBuffer<std::vector<Legion::Mapping::PhysicalInstance>> replaced;
+      for (auto fid : fields) {
+        local_instances->record_instance(group, fid, result, policy, *replaced);
+        // Instances the new one displaced from the cache are no longer held live by the mapper
+        for (auto& old : *replaced) MemoryUsageTracker::get_tracker()->record_deallocation(old);
+      }
+    }
+    if (created)
+      MemoryUsageTracker::get_tracker()->record_allocation(
+        context->get_library_name(), result, target_memory, footprint);
+    if (created && fields.size() == 1 && postmap_replication_threshold() > 0) {
+      // A fresh read-only instance means the data had to be copied in from wherever it was
+      // valid; count the fetch so hot fields get replicated through postmap_task
+      int32_t priv = LEGION_NO_ACCESS;
+      for (auto* req : reqs) priv |= req->privilege;
+      if ((priv & LEGION_READ_PRIV) && !(priv & LEGION_WRITE_PRIV)) {
+        for (auto* req : reqs) {
+          auto& rprofile = read_fetch_profiles[{req->region.get_tree_id(), fields.front()}];
+          rprofile.fetches++;
+          rprofile.consumers.insert(target_memory);
+        }
+      }
     }
     runtime->enable_reentrant(ctx);
     // We made it so no need for an acquire
@@ -739,6 +1460,9 @@ bool BaseMapper::map_legate_store(const Legion::Mapping::MapperContext ctx,
   runtime->enable_reentrant(ctx);
 
   // If we make it here then we failed entirely
+  MapperStats::get_mapper_stats()->allocation_failures++;
+  // Show where the memory went, so OOMs are diagnosable without rerunning under a profiler
+  MemoryUsageTracker::get_tracker()->dump(logger);
   if (!can_fail) {
     auto req_indices = mapping.requirement_indices();
     for (auto req_idx : req_indices)
@@ -820,8 +1544,83 @@ void BaseMapper::postmap_task(const Legion::Mapping::MapperContext ctx,
                               const PostMapInput& input,
                               PostMapOutput& output)
 {
-  // We should currently never get this call in Legate
-  LEGATE_ABORT;
+  // map_task requests this callback only for read replication of hot fields
+  const auto threshold = postmap_replication_threshold();
+#ifdef DEBUG_LEGATE
+  assert(threshold > 0);
+#endif
+
+  output.chosen_instances.resize(task.regions.size());
+  for (uint32_t idx = 0; idx < task.regions.size(); ++idx) {
+    auto& req = task.regions[idx];
+    // Replication follows the same single-field restriction as the instance cache
+    if (req.privilege != LEGION_READ_ONLY || req.privilege_fields.size() != 1) continue;
+    auto fid    = *req.privilege_fields.begin();
+    auto finder = read_fetch_profiles.find({req.region.get_tree_id(), fid});
+    if (read_fetch_profiles.end() == finder) continue;
+    auto& rprofile = finder->second;
+    if (rprofile.fetches < threshold || rprofile.consumers.size() <= 1) continue;
+
+    // Memories that already hold valid copies need no replicas
+    std::set<Memory> covered;
+    for (auto& instance : input.valid_instances[idx]) covered.insert(instance.get_location());
+    for (auto& instance : input.mapped_regions[idx]) covered.insert(instance.get_location());
+
+    const Store store(runtime, ctx, &req);
+    const Domain domain = runtime->get_index_space_domain(ctx, req.region.get_index_space());
+
+    for (auto& memory : rprofile.consumers) {
+      if (covered.count(memory) > 0) continue;
+
+      // Replicas use the same default layout and policy as default mappings, so later
+      // cache lookups from consumer tasks match them directly
+      StoreTarget target;
+      switch (memory.kind()) {
+        case Legion::Memory::GPU_FB_MEM: target = StoreTarget::FBMEM; break;
+        case Legion::Memory::Z_COPY_MEM: target = StoreTarget::ZCMEM; break;
+        case Legion::Memory::SOCKET_MEM: target = StoreTarget::SOCKETMEM; break;
+        default: target = StoreTarget::SYSMEM; break;
+      }
+      auto mapping = StoreMapping::default_mapping(store, target);
+      Legion::LayoutConstraintSet layout_constraints;
+      mapping.populate_layout_constraints(layout_constraints);
+
+      runtime->disable_reentrant(ctx);
+      auto group = local_instances->find_region_group(req.region, domain, fid, memory, false);
+      ScratchBuffer<std::vector<Legion::LogicalRegion>> regions;
+      group->fill_regions(*regions);
+      Legion::Mapping::PhysicalInstance result;
+      bool created     = false;
+      size_t footprint = 0;
+      // Replication is best effort: a failed allocation just leaves the consumers fetching
+      // from the owner as before
+      if (runtime->find_or_create_physical_instance(ctx,
+                                                    memory,
+                                                    layout_constraints,
+                                                    *regions,
+                                                    result,
+                                                    created,
+                                                    true /*acquire*/,
+                                                    LEGION_GC_DEFAULT_PRIORITY,
+                                                    false /*tight bounds*/,
+                                                    &footprint)) {
+        if (!result.is_external_instance()) {
+          ScratchBuffer<std::vector<Legion::Mapping::PhysicalInstance>> replaced;
+          local_instances->record_instance(group, fid, result, mapping.policy, *replaced);
+          for (auto& old : *replaced) MemoryUsageTracker::get_tracker()->record_deallocation(old);
+        }
+        if (created)
+          MemoryUsageTracker::get_tracker()->record_allocation(
+            context->get_library_name(), result, memory, footprint);
+#ifdef DEBUG_LEGATE
+        logger.debug() << "Task " << task.get_unique_id() << ": replicated read-only instance "
+                       << result << " for " << req.region << " into memory " << memory;
+#endif
+        output.chosen_instances[idx].push_back(result);
+      }
+      runtime->enable_reentrant(ctx);
+    }
+  }
 }
 
 void BaseMapper::select_task_sources(const Legion::Mapping::MapperContext ctx,
@@ -839,43 +1638,36 @@ using Bandwidth = uint32_t;
 
 // Source instance annotated with the memory bandwidth
 struct AnnotatedSourceInstance {
-  AnnotatedSourceInstance(Legion::Mapping::PhysicalInstance _instance, Bandwidth _bandwidth)
-    : instance(_instance), bandwidth(_bandwidth)
+  AnnotatedSourceInstance(Legion::Mapping::PhysicalInstance _instance,
+                          Bandwidth _bandwidth,
+                          bool _peer_framebuffer)
+    : instance(_instance), bandwidth(_bandwidth), peer_framebuffer(_peer_framebuffer)
   {
   }
   Legion::Mapping::PhysicalInstance instance;
   Bandwidth bandwidth;
+  // True when both the source and the target are framebuffers, so the copy can take the
+  // direct GPU-to-GPU path (peer access is enabled at stream pool initialization)
+  bool peer_framebuffer;
 };
 
-void find_source_instance_bandwidth(
-  std::vector<AnnotatedSourceInstance>& all_sources,     /* output */
-  std::map<Memory, Bandwidth>& source_memory_bandwidths, /* inout */
-  const Legion::Mapping::PhysicalInstance& source_instance,
-  const Memory& target_memory,
-  const Legion::Machine& machine)
-{
-  Memory source_memory = source_instance.get_location();
-  auto finder          = source_memory_bandwidths.find(source_memory);
-
-  uint32_t bandwidth{0};
-  if (source_memory_bandwidths.end() == finder) {
-    std::vector<Legion::MemoryMemoryAffinity> affinities;
-    machine.get_mem_mem_affinity(
-      affinities, source_memory, target_memory, false /*not just local affinities*/);
-    // affinities being empty means that there's no direct channel between the source
-    // and target memories, in which case we assign the smallest bandwidth
-    // TODO: Not all multi-hop copies are equal
-    if (!affinities.empty()) {
-#ifdef DEBUG_LEGATE
-      assert(affinities.size() == 1);
-#endif
-      bandwidth = affinities.front().bandwidth;
-    }
-    source_memory_bandwidths[source_memory] = bandwidth;
-  } else
-    bandwidth = finder->second;
-
-  all_sources.emplace_back(source_instance, bandwidth);
+void find_source_instance_bandwidth(std::vector<AnnotatedSourceInstance>& all_sources, /* output */
+                                    const Legion::Mapping::PhysicalInstance& source_instance,
+                                    const Memory& target_memory,
+                                    const std::map<std::pair<Memory, Memory>, uint32_t>& measured,
+                                    const Machine& machine)
+{
+  const auto source_memory = source_instance.get_location();
+  // A measured bandwidth from copy profiling takes precedence; otherwise the memory-to-memory
+  // affinity matrix precomputed at startup makes this a table lookup
+  auto finder               = measured.find({source_memory, target_memory});
+  const Bandwidth bandwidth = measured.end() != finder
+                                ? finder->second
+                                : machine.mem_bandwidth(source_memory, target_memory);
+  all_sources.emplace_back(source_instance,
+                           bandwidth,
+                           Memory::GPU_FB_MEM == source_memory.kind() &&
+                             Memory::GPU_FB_MEM == target_memory.kind());
 }
 
 }  // namespace
@@ -887,38 +1679,41 @@ void BaseMapper::legate_select_sources(
   const std::vector<Legion::Mapping::CollectiveView>& collective_sources,
   std::deque<Legion::Mapping::PhysicalInstance>& ranking)
 {
-  std::map<Memory, Bandwidth> source_memory_bandwidths;
   // For right now we'll rank instances by the bandwidth of the memory
   // they are in to the destination.
   // TODO: consider layouts when ranking source to help out the DMA system
   Memory target_memory = target.get_location();
-  // fill in a vector of the sources with their bandwidths
-  std::vector<AnnotatedSourceInstance> all_sources;
+  // fill in a vector of the sources with their bandwidths; the ranking scratch comes from the
+  // pool since this runs once per copy on the mapping path
+  ScratchBuffer<std::vector<AnnotatedSourceInstance>> all_sources_scratch;
+  auto& all_sources = *all_sources_scratch;
 
   for (uint32_t idx = 0; idx < sources.size(); idx++)
     find_source_instance_bandwidth(
-      all_sources, source_memory_bandwidths, sources[idx], target_memory, legion_machine);
+      all_sources, sources[idx], target_memory, measured_bandwidths, machine);
 
+  ScratchBuffer<std::vector<Legion::Mapping::PhysicalInstance>> source_instances_scratch;
+  auto& source_instances = *source_instances_scratch;
   for (uint32_t idx = 0; idx < collective_sources.size(); idx++) {
-    std::vector<Legion::Mapping::PhysicalInstance> source_instances;
+    source_instances.clear();
     collective_sources[idx].find_instances_nearest_memory(target_memory, source_instances);
 #ifdef DEBUG_LEGATE
     // there must exist at least one instance in the collective view
     assert(!source_instances.empty());
 #endif
     // we need only first instance if there are several
-    find_source_instance_bandwidth(all_sources,
-                                   source_memory_bandwidths,
-                                   source_instances.front(),
-                                   target_memory,
-                                   legion_machine);
+    find_source_instance_bandwidth(
+      all_sources, source_instances.front(), target_memory, measured_bandwidths, machine);
   }
 #ifdef DEBUG_LEGATE
   assert(!all_sources.empty());
 #endif
   if (all_sources.size() > 1)
-    // Sort source instances by their bandwidths
+    // Rank framebuffer-to-framebuffer copies above everything else, then by bandwidth.
+    // Realm may report no affinity between framebuffers it has not connected, which would
+    // otherwise rank a peer GPU below host memory and bounce the copy through the host.
     std::sort(all_sources.begin(), all_sources.end(), [](const auto& lhs, const auto& rhs) {
+      if (lhs.peer_framebuffer != rhs.peer_framebuffer) return lhs.peer_framebuffer;
       return lhs.bandwidth > rhs.bandwidth;
     });
   // Record all instances from the one of the largest bandwidth to that of the smallest
@@ -935,8 +1730,17 @@ void BaseMapper::report_profiling(const Legion::Mapping::MapperContext ctx,
 
 Legion::ShardingID BaseMapper::find_mappable_sharding_functor_id(const Legion::Mappable& mappable)
 {
+  // The sharding id sits in the mapper data blob behind the machine descriptor, and repeat
+  // launches of the same operation carry byte-identical blobs, so we cache the resolved id
+  // keyed by the raw bytes and skip the deserialization entirely
+  std::string key(static_cast<const char*>(mappable.mapper_data), mappable.mapper_data_size);
+  auto finder = sharding_functor_ids.find(key);
+  if (finder != sharding_functor_ids.end()) return finder->second;
+
   Mappable legate_mappable(&mappable);
-  return static_cast<Legion::ShardingID>(legate_mappable.sharding_id());
+  auto result = static_cast<Legion::ShardingID>(legate_mappable.sharding_id());
+  sharding_functor_ids[std::move(key)] = result;
+  return result;
 }
 
 void BaseMapper::select_sharding_functor(const Legion::Mapping::MapperContext ctx,
@@ -944,6 +1748,7 @@ void BaseMapper::select_sharding_functor(const Legion::Mapping::MapperContext ct
                                          const SelectShardingFunctorInput& input,
                                          SelectShardingFunctorOutput& output)
 {
+  MapperTracer::Scope trace_scope("select_sharding_functor");
   output.chosen_functor = find_mappable_sharding_functor_id(task);
 }
 
@@ -958,7 +1763,7 @@ void BaseMapper::map_inline(const Legion::Mapping::MapperContext ctx,
   else
     target_proc = machine.cpus().front();
 
-  auto store_target = default_store_targets(target_proc.kind()).front();
+  auto store_target = default_store_targets(target_proc.kind(), machine.has_socket_memory()).front();
 
 #ifdef DEBUG_LEGATE
   assert(inline_op.requirement.instance_fields.size() == 1);
@@ -999,49 +1804,84 @@ void BaseMapper::map_copy(const Legion::Mapping::MapperContext ctx,
 {
   Copy legate_copy(&copy, runtime, ctx);
   auto& machine_desc = legate_copy.machine_desc();
-  auto copy_target   = [&]() {
-    // If we're mapping an indirect copy and have data resident in GPU memory,
-    // map everything to CPU memory, as indirect copies on GPUs are currently
-    // extremely slow.
-    auto indirect =
-      !copy.src_indirect_requirements.empty() || !copy.dst_indirect_requirements.empty();
-    auto valid_targets = indirect ? machine_desc.valid_targets_except({TaskTarget::GPU})
+
+  // Get the domain for the sharding space also
+  Domain sharding_domain = copy.index_domain;
+  if (copy.is_index_space && copy.sharding_space.exists())
+    sharding_domain = runtime->get_index_space_domain(ctx, copy.sharding_space);
+
+  CopyPlanKey plan_key;
+  auto append_trees = [&plan_key](const std::vector<Legion::RegionRequirement>& reqs) {
+    plan_key.push_back(reqs.size());
+    for (auto& req : reqs) plan_key.push_back(req.region.get_tree_id());
+  };
+  append_trees(copy.src_requirements);
+  append_trees(copy.dst_requirements);
+  append_trees(copy.src_indirect_requirements);
+  append_trees(copy.dst_indirect_requirements);
+  plan_key.push_back(copy.is_index_space);
+  plan_key.push_back(sharding_domain.dim);
+  for (int32_t dim = 0; dim < sharding_domain.dim; ++dim) {
+    plan_key.push_back(sharding_domain.lo()[dim]);
+    plan_key.push_back(sharding_domain.hi()[dim]);
+  }
+  plan_key.push_back(static_cast<int64_t>(machine_desc.preferred_target));
+  for (auto& [target, range] : machine_desc.processor_ranges) {
+    plan_key.push_back(static_cast<int64_t>(target));
+    plan_key.push_back(range.low);
+    plan_key.push_back(range.high);
+    plan_key.push_back(range.per_node_count);
+  }
+
+  auto plan_finder = copy_plans.find(plan_key);
+  if (copy_plans.end() == plan_finder) {
+    CopyPlan plan;
+    plan.copy_target = [&]() {
+      // If we're mapping an indirect copy and have data resident in GPU memory,
+      // map everything to CPU memory, as indirect copies on GPUs are currently
+      // extremely slow.
+      auto indirect =
+        !copy.src_indirect_requirements.empty() || !copy.dst_indirect_requirements.empty();
+      auto valid_targets = indirect ? machine_desc.valid_targets_except({TaskTarget::GPU})
                                     : machine_desc.valid_targets();
-    // However, if the machine in the scope doesn't have any CPU or OMP as a fallback for
-    // indirect copies, we have no choice but using GPUs
-    if (valid_targets.empty()) {
+      // However, if the machine in the scope doesn't have any CPU or OMP as a fallback for
+      // indirect copies, we have no choice but using GPUs
+      if (valid_targets.empty()) {
 #ifdef DEBUG_LEGATE
-      assert(indirect);
+        assert(indirect);
 #endif
-      valid_targets = machine_desc.valid_targets();
+        valid_targets = machine_desc.valid_targets();
+      }
+      return valid_targets.front();
+    }();
+    if (copy.is_index_space) {
+      // FIXME: We might later have non-identity projections for copy requirements,
+      // in which case we should find the key store and use its projection functor
+      // for the linearization
+      auto* key_functor      = find_legate_projection_functor(0);
+      plan.lo                = key_functor->project_point(sharding_domain.lo(), sharding_domain);
+      plan.hi                = key_functor->project_point(sharding_domain.hi(), sharding_domain);
+      plan.total_tasks_count = linearize(plan.lo, plan.hi, plan.hi) + 1;
     }
-    return valid_targets.front();
-  }();
+    plan_finder = copy_plans.emplace(std::move(plan_key), std::move(plan)).first;
+  }
+  const auto& plan = plan_finder->second;
 
-  auto local_range = machine.slice(copy_target, machine_desc, true);
+  auto local_range = machine.slice(plan.copy_target, machine_desc, true);
   Processor target_proc;
   if (copy.is_index_space) {
-    Domain sharding_domain = copy.index_domain;
-    if (copy.sharding_space.exists())
-      sharding_domain = runtime->get_index_space_domain(ctx, copy.sharding_space);
-
-    // FIXME: We might later have non-identity projections for copy requirements,
-    // in which case we should find the key store and use its projection functor
-    // for the linearization
     auto* key_functor = find_legate_projection_functor(0);
-    auto lo           = key_functor->project_point(sharding_domain.lo(), sharding_domain);
-    auto hi           = key_functor->project_point(sharding_domain.hi(), sharding_domain);
     auto p            = key_functor->project_point(copy.index_point, sharding_domain);
 
-    uint32_t start_proc_id     = machine_desc.processor_range().low;
-    uint32_t total_tasks_count = linearize(lo, hi, hi) + 1;
-    auto idx =
-      linearize(lo, hi, p) * local_range.total_proc_count() / total_tasks_count + start_proc_id;
+    uint32_t start_proc_id = machine_desc.processor_range().low;
+    auto idx = linearize(plan.lo, plan.hi, p) * local_range.total_proc_count() /
+                 plan.total_tasks_count +
+               start_proc_id;
     target_proc = local_range[idx];
   } else
     target_proc = local_range.first();
 
-  auto store_target = default_store_targets(target_proc.kind()).front();
+  auto store_target = default_store_targets(target_proc.kind(), machine.has_socket_memory()).front();
 
   std::map<const Legion::RegionRequirement*, std::vector<Legion::Mapping::PhysicalInstance>*>
     output_map;
@@ -1079,6 +1919,14 @@ void BaseMapper::map_copy(const Legion::Mapping::MapperContext ctx,
     mappings.push_back(StoreMapping::default_mapping(store, store_target, false));
 
   map_legate_stores(ctx, copy, mappings, target_proc, output_map);
+
+  // Sample a fraction of the copies for profiling, so the source ranking can learn the
+  // bandwidths actually achieved instead of trusting the static affinity numbers
+  constexpr uint64_t COPY_PROFILING_SAMPLE_PERIOD = 16;
+  if (Core::profile_copies && 0 == copy_profiling_counter++ % COPY_PROFILING_SAMPLE_PERIOD) {
+    output.profiling_requests.add_measurement<Realm::ProfilingMeasurements::OperationMemoryUsage>();
+    output.profiling_requests.add_measurement<Realm::ProfilingMeasurements::OperationTimeline>();
+  }
 }
 
 void BaseMapper::select_copy_sources(const Legion::Mapping::MapperContext ctx,
@@ -1094,8 +1942,30 @@ void BaseMapper::report_profiling(const Legion::Mapping::MapperContext ctx,
                                   const Legion::Copy& copy,
                                   const CopyProfilingInfo& input)
 {
-  // No profiling for copies yet
-  LEGATE_ABORT;
+  using Realm::ProfilingMeasurements::OperationMemoryUsage;
+  using Realm::ProfilingMeasurements::OperationTimeline;
+
+  // Copies below this size are latency-bound and would drag the estimate down
+  constexpr size_t MIN_PROFILED_COPY_SIZE = 65536;
+
+  auto* usage    = input.profiling_responses.get_measurement<OperationMemoryUsage>();
+  auto* timeline = input.profiling_responses.get_measurement<OperationTimeline>();
+  if (nullptr != usage && nullptr != timeline && usage->size >= MIN_PROFILED_COPY_SIZE &&
+      timeline->complete_time > timeline->start_time) {
+    // bytes over nanoseconds, scaled to the MB/s units of the static affinity matrix
+    const uint64_t duration_ns = timeline->complete_time - timeline->start_time;
+    const uint64_t bandwidth   = usage->size * 1000 / duration_ns;
+    const auto key             = std::make_pair(usage->source, usage->target);
+    auto finder                = measured_bandwidths.find(key);
+    if (measured_bandwidths.end() == finder)
+      // First sample seeds the estimate
+      measured_bandwidths[key] = static_cast<uint32_t>(bandwidth);
+    else
+      // Exponential moving average smooths out transient congestion
+      finder->second = static_cast<uint32_t>((3ULL * finder->second + bandwidth) / 4);
+  }
+  delete usage;
+  delete timeline;
 }
 
 void BaseMapper::select_sharding_functor(const Legion::Mapping::MapperContext ctx,
@@ -1212,7 +2082,7 @@ void BaseMapper::map_partition(const Legion::Mapping::MapperContext ctx,
   else
     target_proc = machine.cpus().front();
 
-  auto store_target = default_store_targets(target_proc.kind()).front();
+  auto store_target = default_store_targets(target_proc.kind(), machine.has_socket_memory()).front();
 
 #ifdef DEBUG_LEGATE
   assert(partition.requirement.instance_fields.size() == 1);
@@ -1285,8 +2155,20 @@ void BaseMapper::map_future_map_reduction(const Legion::Mapping::MapperContext c
     // because they need serdez
     if (input.tag == LEGATE_CORE_JOIN_EXCEPTION_TAG)
       output.destination_memories.push_back(machine.zerocopy_memory());
-    else
-      for (auto& pair : machine.frame_buffers()) output.destination_memories.push_back(pair.second);
+    else {
+      // Framebuffer placement costs the host a device-to-host copy per future it consumes,
+      // which is a bad trade for small payloads. The mapper input doesn't expose per-reduction
+      // payload sizes, so the bound advertised through serdez_upper_bound stands in for them:
+      // when it fits under the threshold, results stay in zero-copy memory where the host
+      // reads them directly
+      static const uint32_t zcopy_threshold =
+        extract_env("LEGATE_ZCOPY_FUTURE_MAP_THRESHOLD", 0, 0);
+      if (LEGATE_MAX_SIZE_SCALAR_RETURN <= zcopy_threshold)
+        output.destination_memories.push_back(machine.zerocopy_memory());
+      else
+        for (auto& pair : machine.frame_buffers())
+          output.destination_memories.push_back(pair.second);
+    }
 #else
     output.destination_memories.push_back(machine.zerocopy_memory());
 #endif
@@ -1342,29 +2224,203 @@ void BaseMapper::select_tasks_to_map(const Legion::Mapping::MapperContext ctx,
                                      const SelectMappingInput& input,
                                      SelectMappingOutput& output)
 {
-  // Just map all the ready tasks
+  MapperTracer::Scope trace_scope("select_tasks_to_map");
+
+  static const size_t max_mapping_window =
+    extract_env("LEGATE_MAX_MAPPING_WINDOW", MAX_MAPPING_WINDOW_DEFAULT, MAX_MAPPING_WINDOW_TEST);
+
+  // When the ready queue is still growing and earlier selections are still being mapped, we
+  // hold off scheduling so the queue accumulates into a larger mapping batch. Deferring is safe
+  // only in that case: the pending map_task calls retrigger the deferral event, so the mapper
+  // is guaranteed to be invoked again. Dependency chains produce shallow queues with nothing in
+  // flight and keep mapping immediately, so they pay no extra latency.
+  const size_t depth = input.ready_tasks.size();
+  const bool defer   = depth > last_ready_queue_depth && depth < max_mapping_window &&
+                     tasks_in_flight.load() > 0;
+  last_ready_queue_depth = depth;
+
+  maybe_gossip_backlog(ctx, depth, static_cast<size_t>(tasks_in_flight.load()));
+
+  if (defer) {
+    if (!defer_select_tasks_to_map.exists())
+      defer_select_tasks_to_map = runtime->create_mapper_event(ctx);
+    output.deferral_event = defer_select_tasks_to_map;
+    return;
+  }
+
+  // Map all the ready tasks
   for (auto task : input.ready_tasks) output.map_tasks.insert(task);
+  tasks_in_flight += output.map_tasks.size();
+}
+
+void BaseMapper::maybe_gossip_backlog(const Legion::Mapping::MapperContext ctx,
+                                      size_t ready,
+                                      size_t in_flight)
+{
+  if ((!work_stealing_enabled() && 0 == backlog_heartbeat_period()) || machine.total_nodes <= 1)
+    return;
+
+  // Only re-broadcast on material changes (idle <-> loaded, or a 2x swing either way), so the
+  // gossip traffic stays negligible next to the task stream. With the heartbeat on we also
+  // re-broadcast at the configured rate, so peers never sit on a stale picture of this node
+  const uint32_t current = static_cast<uint32_t>(ready + in_flight);
+  bool material          = (0 == current) != (0 == last_gossiped_backlog) ||
+                  current > 2 * last_gossiped_backlog || 2 * current < last_gossiped_backlog;
+  const auto now = std::chrono::steady_clock::now();
+  if (backlog_heartbeat_period() > 0 &&
+      now - last_backlog_broadcast >= std::chrono::seconds(backlog_heartbeat_period()))
+    material = true;
+  if (!material) return;
+
+  last_gossiped_backlog  = current;
+  last_backlog_broadcast = now;
+  BacklogGossip message{
+    machine.local_node, static_cast<uint32_t>(ready), static_cast<uint32_t>(in_flight)};
+  runtime->broadcast(ctx, &message, sizeof(message));
+  if (backlog_heartbeat_period() > 0) check_for_stragglers();
+}
+
+void BaseMapper::check_for_stragglers()
+{
+  // One scan per heartbeat period is plenty; the point is catching a stall in minutes, not
+  // microseconds
+  const auto now = std::chrono::steady_clock::now();
+  if (now - last_straggler_check < std::chrono::seconds(backlog_heartbeat_period())) return;
+  last_straggler_check = now;
+
+  // One node holding a deep backlog while the fleet median is drained is the classic straggler
+  // signature: everyone else has run dry and is waiting on that node's mapper
+  std::vector<uint32_t> backlogs;
+  backlogs.push_back(last_gossiped_backlog);
+  for (auto& [node, gossip] : peer_backlogs) backlogs.push_back(gossip.backlog());
+  if (backlogs.size() < 2) return;
+  std::nth_element(backlogs.begin(), backlogs.begin() + backlogs.size() / 2, backlogs.end());
+  const uint32_t median = backlogs[backlogs.size() / 2];
+
+  constexpr uint32_t DIVERGENCE_FACTOR = 8;
+  constexpr uint32_t DIVERGENCE_FLOOR  = 16;
+  auto diverged                        = [&](uint32_t backlog) {
+    return backlog >= DIVERGENCE_FLOOR && backlog >= DIVERGENCE_FACTOR * std::max(median, 1u);
+  };
+  if (diverged(last_gossiped_backlog))
+    log_legate.warning(
+      "Mapper backlog on node %u (%u) is far above the fleet median (%u); this node is likely "
+      "stalling the machine",
+      machine.local_node,
+      last_gossiped_backlog,
+      median);
+  for (auto& [node, gossip] : peer_backlogs)
+    if (diverged(gossip.backlog()))
+      log_legate.warning(
+        "Mapper backlog on node %u (%u ready, %u in flight) is far above the fleet median (%u); "
+        "that node is likely stalling the machine",
+        node,
+        gossip.ready,
+        gossip.in_flight,
+        median);
 }
 
 void BaseMapper::select_steal_targets(const Legion::Mapping::MapperContext ctx,
                                       const SelectStealingInput& input,
                                       SelectStealingOutput& output)
 {
-  // Nothing to do, no stealing in the leagte mapper currently
+  if (!work_stealing_enabled()) return;
+  // Probe only when we have nothing left to do ourselves; stealing while loaded would just
+  // shuffle work around
+  if (last_ready_queue_depth > 0 || tasks_in_flight.load() > 0) return;
+  if (peer_backlogs.empty()) return;
+
+  if (!steal_targets_built) {
+    // Route steal probes to one processor per remote node, of the kind this machine prefers
+    auto kind = machine.has_gpus()   ? Processor::Kind::TOC_PROC
+                : machine.has_omps() ? Processor::Kind::OMP_PROC
+                                     : Processor::Kind::LOC_PROC;
+    Legion::Machine::ProcessorQuery query(legion_machine);
+    query.only_kind(kind);
+    for (auto proc : query) {
+      uint32_t node = proc.address_space();
+      if (node == machine.local_node) continue;
+      // Keeps the first processor found on each node
+      steal_targets_by_node.emplace(node, proc);
+    }
+    steal_targets_built = true;
+  }
+
+  // Peers with backlogs below the minimum are not worth the round trip
+  static const uint32_t min_backlog = extract_env("LEGATE_STEAL_MIN_BACKLOG", 2, 2);
+
+  bool found             = false;
+  uint32_t best_node     = 0;
+  uint32_t best_distance = 0;
+  uint32_t best_backlog  = 0;
+  for (auto& [node, gossip] : peer_backlogs) {
+    const uint32_t backlog = gossip.backlog();
+    if (backlog < min_backlog) continue;
+    auto finder = steal_targets_by_node.find(node);
+    if (steal_targets_by_node.end() == finder) continue;
+    if (input.blacklist.count(finder->second) > 0) continue;
+    // Realm exposes no rack topology, so node-id distance stands in for it: launchers typically
+    // lay ranks out so that nearby ids share a rack
+    uint32_t distance =
+      node > machine.local_node ? node - machine.local_node : machine.local_node - node;
+    if (!found || distance < best_distance ||
+        (distance == best_distance && backlog > best_backlog)) {
+      found         = true;
+      best_node     = node;
+      best_distance = distance;
+      best_backlog  = backlog;
+    }
+  }
+  if (found) output.targets.insert(steal_targets_by_node[best_node]);
 }
 
 void BaseMapper::permit_steal_request(const Legion::Mapping::MapperContext ctx,
                                       const StealRequestInput& input,
                                       StealRequestOutput& output)
 {
-  // Nothing to do, no stealing in the legate mapper currently
-  LEGATE_ABORT;
+  if (!work_stealing_enabled()) return;
+
+  // Moving a task also moves its data, so we only let go of tasks whose region arguments are
+  // small enough that shipping them is cheaper than leaving the task in the queue
+  static const size_t max_move_bytes = extract_env("LEGATE_STEAL_MAX_MOVE_BYTES", 1048576, 1048576);
+  // Grant at most half of what the thief can see so we don't starve ourselves
+  const size_t max_grants = std::max<size_t>(1, input.stealable_tasks.size() / 2);
+
+  for (auto task : input.stealable_tasks) {
+    // Point tasks of index launches are placed by the sharding functor; migrating them would
+    // break the alignment between shards, so only single tasks may move
+    if (task->is_index_space) continue;
+
+    size_t move_bytes = 0;
+    for (auto& req : task->regions) {
+      auto domain        = runtime->get_index_space_domain(ctx, req.region.get_index_space());
+      size_t field_bytes = 0;
+      for (auto fid : req.privilege_fields)
+        field_bytes += runtime->get_field_size(ctx, req.region.get_field_space(), fid);
+      move_bytes += domain.get_volume() * field_bytes;
+    }
+    if (move_bytes > max_move_bytes) continue;
+
+    output.stealable_tasks.insert(task);
+    if (output.stealable_tasks.size() >= max_grants) break;
+  }
 }
 
 void BaseMapper::handle_message(const Legion::Mapping::MapperContext ctx,
                                 const MapperMessage& message)
 {
-  // We shouldn't be receiving any messages currently
+  MapperStats::get_mapper_stats()->messages_handled++;
+  if (message.size == sizeof(BacklogGossip)) {
+    BacklogGossip gossip;
+    memcpy(&gossip, message.message, sizeof(gossip));
+    if (gossip.node != machine.local_node) {
+      peer_backlogs[gossip.node] = gossip;
+      // Idle nodes only ever hear about a straggler through incoming gossip, so scan here too
+      if (backlog_heartbeat_period() > 0) check_for_stragglers();
+    }
+    return;
+  }
+  // The backlog gossip is the only message we exchange currently
   LEGATE_ABORT;
 }
 
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -33,6 +35,7 @@ namespace mapping {
 class InstanceManager;
 class Machine;
 class ReductionInstanceManager;
+class Task;
 
 class BaseMapper : public Legion::Mapping::Mapper, public MachineQueryInterface {
  public:
@@ -252,13 +255,27 @@ class BaseMapper : public Legion::Mapping::Mapper, public MachineQueryInterface
  protected:
   using OutputMap =
     std::map<const Legion::RegionRequirement*, std::vector<Legion::Mapping::PhysicalInstance>*>;
+  void map_legate_task_stores(const Legion::Mapping::MapperContext ctx,
+                              const Legion::Task& task,
+                              std::vector<StoreMapping>& for_futures,
+                              std::vector<StoreMapping>& for_unbound_stores,
+                              std::vector<StoreMapping>& for_stores,
+                              size_t num_futures,
+                              MapTaskOutput& output);
   void map_legate_stores(const Legion::Mapping::MapperContext ctx,
                          const Legion::Mappable& mappable,
                          std::vector<StoreMapping>& mappings,
                          Processor target_proc,
                          OutputMap& output_map);
+  void apply_usage_profiles(const Legion::Mappable& mappable,
+                            std::vector<StoreMapping>& mappings);
   void tighten_write_policies(const Legion::Mappable& mappable,
                               std::vector<StoreMapping>& mappings);
+  bool find_legate_store(const Legion::Mapping::MapperContext ctx,
+                         const StoreMapping& mapping,
+                         const std::set<const Legion::RegionRequirement*>& reqs,
+                         Processor target_proc,
+                         Legion::Mapping::PhysicalInstance& result);
   bool map_legate_store(const Legion::Mapping::MapperContext ctx,
                         const Legion::Mappable& mappable,
                         const StoreMapping& mapping,
@@ -303,8 +320,116 @@ class BaseMapper : public Legion::Mapping::Mapper, public MachineQueryInterface
   std::string mapper_name;
 
  protected:
-  using VariantCacheKey = std::pair<Legion::TaskID, Processor::Kind>;
-  std::map<VariantCacheKey, std::optional<Legion::VariantID>> variants;
+  // Resolved variant ids never change after registration, and task ids are dense small
+  // integers within the library's id scope, so the cache is a table directly indexed by the
+  // local task id with one slot per processor kind, populated lazily on first resolution
+  static constexpr size_t NUM_VARIANT_KINDS = 3;  // CPU, GPU, OMP
+  struct VariantCacheEntry {
+    std::optional<Legion::VariantID> variants[NUM_VARIANT_KINDS];
+    bool resolved[NUM_VARIANT_KINDS] = {};
+  };
+  std::vector<VariantCacheEntry> variant_cache;
+
+ protected:
+  // Scheduling-window state for select_tasks_to_map. While earlier selections are still being
+  // mapped, a growing ready queue is deferred so that it accumulates into a larger mapping
+  // batch; every map_task retriggers the deferral event, so the in-flight tasks guarantee that
+  // the scheduler makes progress.
+  size_t last_ready_queue_depth{0};
+  std::atomic<int64_t> tasks_in_flight{0};
+  Legion::Mapping::MapperEvent defer_select_tasks_to_map{};
+
+ protected:
+  // Work-stealing state (opt-in via LEGATE_WORK_STEALING). Mappers gossip their backlog (ready
+  // queue plus in-flight tasks) to their peers on other nodes whenever it changes materially;
+  // an idle mapper consults the table to pick a loaded victim and Legion forwards the steal
+  // request to that node's permit_steal_request. The same gossip doubles as a heartbeat for
+  // stall diagnosis (opt-in via LEGATE_BACKLOG_HEARTBEAT): nodes re-broadcast at a low fixed
+  // rate even without material changes and warn when one node's backlog diverges from the
+  // fleet median.
+  struct BacklogGossip {
+    uint32_t node;
+    uint32_t ready;
+    uint32_t in_flight;
+    uint32_t backlog() const { return ready + in_flight; }
+  };
+  void maybe_gossip_backlog(const Legion::Mapping::MapperContext ctx,
+                            size_t ready,
+                            size_t in_flight);
+  void check_for_stragglers();
+  std::map<uint32_t, BacklogGossip> peer_backlogs;
+  uint32_t last_gossiped_backlog{0};
+  std::chrono::steady_clock::time_point last_backlog_broadcast{};
+  std::chrono::steady_clock::time_point last_straggler_check{};
+  // One representative target processor per remote node, for routing steal probes
+  std::map<uint32_t, Processor> steal_targets_by_node;
+  bool steal_targets_built{false};
+
+ protected:
+  // Read-replication state (opt-in via LEGATE_POSTMAP_REPLICATION). Every fresh instance
+  // created for a read-only requirement is a fetch from wherever the data was valid; the
+  // profiles count those fetches per region tree and field and remember the consumer
+  // memories. Once a field gets hot, readers request the postmap callback, which fans the
+  // data out to all recorded consumer memories in one broadcast instead of each consumer
+  // pulling from the owner separately
+  struct ReadFetchProfile {
+    uint32_t fetches{0};
+    std::set<Memory> consumers{};
+  };
+  using ReadFetchKey = std::pair<Legion::RegionTreeID, Legion::FieldID>;
+  std::map<ReadFetchKey, ReadFetchProfile> read_fetch_profiles;
+
+ protected:
+  // Cached result of the store-mapping computation in map_task. A plan records, for every store
+  // mapping the client mapper chose (plus the generated defaults), the mapping policy and the
+  // slots of the stores it covers, so repeat launches of the same task signature can rebuild
+  // their store mappings without calling store_mappings() again. Physical instances are not
+  // cached here; they are managed (and invalidated) by the instance managers.
+  struct MappingPlan {
+    struct Entry {
+      // (store kind, index) slots into Task::inputs()/outputs()/reductions()
+      std::vector<std::pair<int32_t, uint32_t>> store_slots{};
+      InstanceMappingPolicy policy{};
+    };
+    std::vector<Entry> entries{};
+  };
+  using MappingPlanKey = std::vector<int64_t>;
+  MappingPlanKey compute_mapping_plan_key(const Legion::Task& task,
+                                          Legion::VariantID variant,
+                                          const Task& legate_task) const;
+  std::map<MappingPlanKey, MappingPlan> mapping_plans;
+
+ protected:
+  // Cache of slice decompositions. Applications launch the same domain shapes repeatedly across
+  // iterations, and the slicing only depends on the launch domain, the sharding domain, the key
+  // projection, the target kind, and the machine scope, all of which are captured in the key.
+  using SliceCacheKey = std::vector<int64_t>;
+  std::map<SliceCacheKey, std::vector<Legion::Mapping::Mapper::TaskSlice>> slice_caches;
+
+ protected:
+  // Cached control-plane decisions for map_copy: the chosen copy target and the projected
+  // bounds of the sharding domain. Gather/scatter-heavy workloads issue structurally identical
+  // copies every timestep, and the cache lets them skip the target selection and the sharding
+  // projections; the instances themselves are remembered by the instance managers.
+  struct CopyPlan {
+    TaskTarget copy_target;
+    DomainPoint lo{}, hi{};
+    uint32_t total_tasks_count{0};
+  };
+  using CopyPlanKey = std::vector<int64_t>;
+  std::map<CopyPlanKey, CopyPlan> copy_plans;
+
+ protected:
+  // Sharding functor ids resolved in find_mappable_sharding_functor_id, keyed by the raw mapper
+  // data blob of the mappable
+  std::map<std::string, Legion::ShardingID> sharding_functor_ids;
+
+ protected:
+  // Online (source memory, target memory) bandwidth estimates from sampled copy profiling
+  // responses (LEGATE_PROFILE_COPIES). Where a measurement exists it overrides the static
+  // affinity number in legate_select_sources, which can mispredict on oversubscribed buses
+  std::map<std::pair<Memory, Memory>, uint32_t> measured_bandwidths;
+  uint64_t copy_profiling_counter{0};
 
  protected:
   InstanceManager* local_instances;
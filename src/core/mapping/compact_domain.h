@@ -0,0 +1,124 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <cstring>
+#include <ostream>
+
+#include "legion.h"
+
+#include "core/utilities/typedefs.h"
+
+namespace legate {
+namespace mapping {
+
+// A compact replacement for Legion::Domain in the mapper's caches. Legion::Domain reserves
+// space for LEGION_MAX_DIM dimensions regardless of the actual dimensionality, so with
+// hundreds of thousands of cached region groups the heap is dominated by mostly-empty
+// domain structs and the intersection loops keep missing cache walking them. Domains of up
+// to three dimensions (the overwhelming majority) are stored inline in a quarter of the
+// footprint; higher-dimensional ones fall back to a heap allocation.
+class CompactDomain {
+ public:
+  static constexpr int32_t MAX_INLINE_DIM = 3;
+
+ public:
+  CompactDomain() = default;
+  CompactDomain(const Domain& domain) : dim_(domain.dim)
+  {
+    auto* data = dim_ > MAX_INLINE_DIM ? (heap_ = new coord_t[2 * dim_]) : inline_;
+    memcpy(data, domain.rect_data, 2 * dim_ * sizeof(coord_t));
+  }
+  ~CompactDomain()
+  {
+    if (dim_ > MAX_INLINE_DIM) delete[] heap_;
+  }
+
+ public:
+  CompactDomain(const CompactDomain& other) : dim_(other.dim_)
+  {
+    auto* data = dim_ > MAX_INLINE_DIM ? (heap_ = new coord_t[2 * dim_]) : inline_;
+    memcpy(data, other.data(), 2 * dim_ * sizeof(coord_t));
+  }
+  CompactDomain(CompactDomain&& other) noexcept : dim_(other.dim_)
+  {
+    memcpy(inline_, other.inline_, sizeof(inline_));
+    other.dim_ = 0;
+  }
+  CompactDomain& operator=(const CompactDomain& other)
+  {
+    if (this == &other) return *this;
+    if (dim_ > MAX_INLINE_DIM) delete[] heap_;
+    dim_       = other.dim_;
+    auto* data = dim_ > MAX_INLINE_DIM ? (heap_ = new coord_t[2 * dim_]) : inline_;
+    memcpy(data, other.data(), 2 * dim_ * sizeof(coord_t));
+    return *this;
+  }
+  CompactDomain& operator=(CompactDomain&& other) noexcept
+  {
+    if (this == &other) return *this;
+    if (dim_ > MAX_INLINE_DIM) delete[] heap_;
+    dim_ = other.dim_;
+    memcpy(inline_, other.inline_, sizeof(inline_));
+    other.dim_ = 0;
+    return *this;
+  }
+
+ public:
+  int32_t dim() const { return dim_; }
+  coord_t lo(int32_t d) const { return data()[d]; }
+  coord_t hi(int32_t d) const { return data()[dim_ + d]; }
+
+ public:
+  template <int32_t DIM>
+  Rect<DIM> bounds() const
+  {
+    const auto* values = data();
+    Point<DIM> lo, hi;
+    for (int32_t d = 0; d < DIM; ++d) {
+      lo[d] = values[d];
+      hi[d] = values[dim_ + d];
+    }
+    return Rect<DIM>(lo, hi);
+  }
+  Domain to_domain() const
+  {
+    Domain result;
+    result.dim = dim_;
+    memcpy(result.rect_data, data(), 2 * dim_ * sizeof(coord_t));
+    return result;
+  }
+
+ private:
+  const coord_t* data() const { return dim_ > MAX_INLINE_DIM ? heap_ : inline_; }
+
+ private:
+  int32_t dim_{0};
+  union {
+    coord_t inline_[2 * MAX_INLINE_DIM];
+    coord_t* heap_;
+  };
+};
+
+inline std::ostream& operator<<(std::ostream& os, const CompactDomain& domain)
+{
+  os << domain.to_domain();
+  return os;
+}
+
+}  // namespace mapping
+}  // namespace legate
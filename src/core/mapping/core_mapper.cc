@@ -19,6 +19,8 @@
 
 #include "core/mapping/core_mapper.h"
 #include "core/mapping/machine.h"
+#include "core/mapping/mapper_stats.h"
+#include "core/task/task_stats.h"
 #ifdef LEGATE_USE_CUDA
 #include "core/comm/comm_nccl.h"
 #endif
@@ -57,6 +59,10 @@ class CoreMapper : public Mapper {
     const std::vector<legate::mapping::StoreTarget>& options) override;
   legate::Scalar tunable_value(legate::TunableID tunable_id) override;
 
+ private:
+  uint64_t field_reuse_size() const;
+  bool nccl_needs_barrier() const;
+
  private:
   const Machine machine;
   const int64_t min_gpu_chunk;
@@ -70,11 +76,91 @@ class CoreMapper : public Mapper {
   const uint32_t max_lru_length;
 };
 
+namespace {
+
+// The compiled-in defaults in env_defaults.h were tuned for roughly a 16GB framebuffer per
+// GPU and a few GB of host memory per core. When LEGATE_AUTO_CALIBRATE is on (the default),
+// the defaults are scaled by the ratio between the memory sizes discovered on this node and
+// those baselines, so nodes with very different cards each get sensible chunk sizes without
+// hand tuning. Explicit LEGATE_* settings and LEGATE_TEST always win over calibration.
+constexpr uint64_t CALIBRATION_BASELINE_FB      = uint64_t(16) << 30;
+constexpr uint64_t CALIBRATION_BASELINE_PER_CPU = uint64_t(4) << 30;
+constexpr uint64_t CALIBRATION_BASELINE_PER_OMP = uint64_t(32) << 30;
+
+bool auto_calibrate()
+{
+  return static_cast<bool>(
+    extract_env("LEGATE_AUTO_CALIBRATE", AUTO_CALIBRATE_DEFAULT, AUTO_CALIBRATE_TEST));
+}
+
+// Scales a default by actual/baseline, clamped to [1x, 8x] so calibration never shrinks a
+// documented default and never runs away on very large memories
+uint32_t scale_default(uint32_t default_value, uint64_t actual, uint64_t baseline)
+{
+  if (0 == actual) return default_value;
+  double ratio = static_cast<double>(actual) / static_cast<double>(baseline);
+  if (ratio < 1.0) ratio = 1.0;
+  if (ratio > 8.0) ratio = 8.0;
+  return static_cast<uint32_t>(static_cast<double>(default_value) * ratio);
+}
+
+// Mixed nodes calibrate against their smallest local framebuffer so every card stays safe
+uint64_t smallest_frame_buffer(const Machine& machine)
+{
+  uint64_t min_fb = 0;
+  for (auto& pair : machine.frame_buffers()) {
+    const uint64_t capacity = pair.second.capacity();
+    if (0 == min_fb || capacity < min_fb) min_fb = capacity;
+  }
+  return min_fb;
+}
+
+uint32_t calibrated_min_gpu_chunk(const Machine& machine)
+{
+  if (!auto_calibrate() || !machine.has_gpus()) return MIN_GPU_CHUNK_DEFAULT;
+  return scale_default(
+    MIN_GPU_CHUNK_DEFAULT, smallest_frame_buffer(machine), CALIBRATION_BASELINE_FB);
+}
+
+uint32_t calibrated_min_cpu_chunk(const Machine& machine)
+{
+  if (!auto_calibrate() || machine.cpus().empty()) return MIN_CPU_CHUNK_DEFAULT;
+  const uint64_t per_core = machine.system_memory().capacity() / machine.cpus().size();
+  return scale_default(MIN_CPU_CHUNK_DEFAULT, per_core, CALIBRATION_BASELINE_PER_CPU);
+}
+
+uint32_t calibrated_min_omp_chunk(const Machine& machine)
+{
+  if (!auto_calibrate() || !machine.has_omps()) return MIN_OMP_CHUNK_DEFAULT;
+  uint64_t local_mem = 0;
+  if (machine.has_socket_memory())
+    for (auto& pair : machine.socket_memories()) local_mem += pair.second.capacity();
+  else
+    local_mem = machine.system_memory().capacity();
+  const uint64_t per_group = local_mem / machine.omps().size();
+  return scale_default(MIN_OMP_CHUNK_DEFAULT, per_group, CALIBRATION_BASELINE_PER_OMP);
+}
+
+uint32_t calibrated_max_lru_length(const Machine& machine)
+{
+  if (!auto_calibrate() || !machine.has_gpus()) return MAX_LRU_LENGTH_DEFAULT;
+  // Deeper per-field LRUs only pay off when there is framebuffer headroom; cap the depth at
+  // 4x the default so eviction still keeps up
+  const uint32_t scaled = scale_default(
+    MAX_LRU_LENGTH_DEFAULT, smallest_frame_buffer(machine), CALIBRATION_BASELINE_FB);
+  return scaled < MAX_LRU_LENGTH_DEFAULT * 4 ? scaled : MAX_LRU_LENGTH_DEFAULT * 4;
+}
+
+}  // namespace
+
 CoreMapper::CoreMapper()
   : machine(),
-    min_gpu_chunk(extract_env("LEGATE_MIN_GPU_CHUNK", MIN_GPU_CHUNK_DEFAULT, MIN_GPU_CHUNK_TEST)),
-    min_cpu_chunk(extract_env("LEGATE_MIN_CPU_CHUNK", MIN_CPU_CHUNK_DEFAULT, MIN_CPU_CHUNK_TEST)),
-    min_omp_chunk(extract_env("LEGATE_MIN_OMP_CHUNK", MIN_OMP_CHUNK_DEFAULT, MIN_OMP_CHUNK_TEST)),
+    min_gpu_chunk(
+      extract_env("LEGATE_MIN_GPU_CHUNK", calibrated_min_gpu_chunk(machine), MIN_GPU_CHUNK_TEST)),
+    min_cpu_chunk(
+      extract_env("LEGATE_MIN_CPU_CHUNK", calibrated_min_cpu_chunk(machine), MIN_CPU_CHUNK_TEST)),
+    min_omp_chunk(
+      extract_env("LEGATE_MIN_OMP_CHUNK", calibrated_min_omp_chunk(machine), MIN_OMP_CHUNK_TEST)),
     window_size(extract_env("LEGATE_WINDOW_SIZE", WINDOW_SIZE_DEFAULT, WINDOW_SIZE_TEST)),
     max_pending_exceptions(extract_env("LEGATE_MAX_PENDING_EXCEPTIONS",
                                        MAX_PENDING_EXCEPTIONS_DEFAULT,
@@ -87,7 +173,7 @@ CoreMapper::CoreMapper()
     field_reuse_freq(
       extract_env("LEGATE_FIELD_REUSE_FREQ", FIELD_REUSE_FREQ_DEFAULT, FIELD_REUSE_FREQ_TEST)),
     max_lru_length(
-      extract_env("LEGATE_MAX_LRU_LENGTH", MAX_LRU_LENGTH_DEFAULT, MAX_LRU_LENGTH_TEST))
+      extract_env("LEGATE_MAX_LRU_LENGTH", calibrated_max_lru_length(machine), MAX_LRU_LENGTH_TEST))
 {
 }
 
@@ -104,6 +190,25 @@ std::vector<StoreMapping> CoreMapper::store_mappings(const Task& task,
   return {};
 }
 
+uint64_t CoreMapper::field_reuse_size() const
+{
+  // Multiply this by the total number of nodes and then scale by the frac
+  const uint64_t global_mem_size =
+    machine.has_gpus() ? machine.total_frame_buffer_size()
+                       : (machine.has_socket_memory() ? machine.total_socket_memory_size()
+                                                      : machine.system_memory().capacity());
+  return global_mem_size / field_reuse_frac;
+}
+
+bool CoreMapper::nccl_needs_barrier() const
+{
+#ifdef LEGATE_USE_CUDA
+  return machine.has_gpus() && comm::nccl::needs_barrier();
+#else
+  return false;
+#endif
+}
+
 Scalar CoreMapper::tunable_value(TunableID tunable_id)
 {
   switch (tunable_id) {
@@ -131,6 +236,30 @@ Scalar CoreMapper::tunable_value(TunableID tunable_id)
         // Make sure we can get at least 8KB elements on each CPU
         return Scalar(min_cpu_chunk);
     }
+    case LEGATE_CORE_TUNABLE_ADAPTED_MIN_SHARD_VOLUME: {
+      // Renegotiated MIN_SHARD_VOLUME: the control layer polls this between phases and
+      // repartitions accordingly. When the mean observed task duration (LEGATE_TASK_STATS)
+      // is below the granularity at which per-task launch overhead stays amortized, the
+      // static minimum is scaled up proportionally; fat tasks keep the static value, since
+      // the minimum is only a floor
+      constexpr uint64_t TARGET_TASK_NS            = 2000000;  // ~2ms
+      constexpr uint64_t MIN_ADAPTATION_SAMPLES    = 32;
+      constexpr int64_t MAX_ADAPTATION_SCALE       = 64;
+      const int64_t base                           = machine.has_gpus()   ? min_gpu_chunk
+                                                     : machine.has_omps() ? min_omp_chunk
+                                                                          : min_cpu_chunk;
+      const Processor::Kind kind                   = machine.has_gpus()   ? Processor::TOC_PROC
+                                                     : machine.has_omps() ? Processor::OMP_PROC
+                                                                          : Processor::LOC_PROC;
+      uint64_t mean_ns                             = 0;
+      if (!detail::TaskStats::get_task_stats()->mean_task_time_ns(
+            kind, MIN_ADAPTATION_SAMPLES, mean_ns) ||
+          mean_ns >= TARGET_TASK_NS)
+        return Scalar(base);
+      int64_t scale = static_cast<int64_t>(TARGET_TASK_NS / mean_ns);
+      if (scale > MAX_ADAPTATION_SCALE) scale = MAX_ADAPTATION_SCALE;
+      return Scalar(base * scale);
+    }
     case LEGATE_CORE_TUNABLE_HAS_SOCKET_MEM: {
       return machine.has_socket_memory();
     }
@@ -144,12 +273,7 @@ Scalar CoreMapper::tunable_value(TunableID tunable_id)
       return precise_exception_trace;
     }
     case LEGATE_CORE_TUNABLE_FIELD_REUSE_SIZE: {
-      // Multiply this by the total number of nodes and then scale by the frac
-      const uint64_t global_mem_size =
-        machine.has_gpus() ? machine.total_frame_buffer_size()
-                           : (machine.has_socket_memory() ? machine.total_socket_memory_size()
-                                                          : machine.system_memory().capacity());
-      return global_mem_size / field_reuse_frac;
+      return field_reuse_size();
     }
     case LEGATE_CORE_TUNABLE_FIELD_REUSE_FREQUENCY: {
       return field_reuse_freq;
@@ -158,11 +282,51 @@ Scalar CoreMapper::tunable_value(TunableID tunable_id)
       return max_lru_length;
     }
     case LEGATE_CORE_TUNABLE_NCCL_NEEDS_BARRIER: {
-#ifdef LEGATE_USE_CUDA
-      return machine.has_gpus() && comm::nccl::needs_barrier();
-#else
-      return false;
-#endif
+      return nccl_needs_barrier();
+    }
+    case LEGATE_CORE_TUNABLE_STARTUP_BATCH: {
+      // Everything the control layer consumes during startup, packed into one response.
+      // Each individual tunable query is a separate mapper invocation with a future round
+      // trip, which adds up at high node counts; this cuts the handshake to a single trip.
+      // Entries are ordered by legate_core_startup_tunable_t and widened to 64 bits.
+      std::vector<uint64_t> values(LEGATE_CORE_STARTUP_TUNABLE_NUM_VALUES, 0);
+      values[LEGATE_CORE_STARTUP_TUNABLE_WINDOW_SIZE]             = window_size;
+      values[LEGATE_CORE_STARTUP_TUNABLE_NCCL_NEEDS_BARRIER]      = nccl_needs_barrier();
+      values[LEGATE_CORE_STARTUP_TUNABLE_NUM_NODES]               = machine.total_nodes;
+      values[LEGATE_CORE_STARTUP_TUNABLE_FIELD_REUSE_FREQUENCY]   = field_reuse_freq;
+      values[LEGATE_CORE_STARTUP_TUNABLE_FIELD_REUSE_SIZE]        = field_reuse_size();
+      values[LEGATE_CORE_STARTUP_TUNABLE_MAX_LRU_LENGTH]          = max_lru_length;
+      values[LEGATE_CORE_STARTUP_TUNABLE_MAX_PENDING_EXCEPTIONS]  = max_pending_exceptions;
+      values[LEGATE_CORE_STARTUP_TUNABLE_PRECISE_EXCEPTION_TRACE] = precise_exception_trace;
+      return Scalar(values);
+    }
+    case LEGATE_CORE_TUNABLE_MAPPER_CACHE_HITS: {
+      return Scalar(uint64_t(MapperStats::get_mapper_stats()->find_instance_hits.load()));
+    }
+    case LEGATE_CORE_TUNABLE_MAPPER_CACHE_MISSES: {
+      return Scalar(uint64_t(MapperStats::get_mapper_stats()->find_instance_misses.load()));
+    }
+    case LEGATE_CORE_TUNABLE_MAPPER_GROUP_CONSOLIDATIONS: {
+      return Scalar(uint64_t(MapperStats::get_mapper_stats()->group_consolidations.load()));
+    }
+    case LEGATE_CORE_TUNABLE_MAPPER_ALLOC_FAILURES: {
+      return Scalar(uint64_t(MapperStats::get_mapper_stats()->allocation_failures.load()));
+    }
+    case LEGATE_CORE_TUNABLE_MAPPER_LIVE_INSTANCE_BYTES: {
+      // Report the memory kind most likely to run out: framebuffers on GPU machines, then
+      // socket memories, then the system memory
+      const auto kind = machine.has_gpus()
+                          ? Legion::Memory::GPU_FB_MEM
+                          : (machine.has_socket_memory() ? Legion::Memory::SOCKET_MEM
+                                                         : Legion::Memory::SYSTEM_MEM);
+      return Scalar(uint64_t(MemoryUsageTracker::get_tracker()->live_bytes(kind)));
+    }
+    case LEGATE_CORE_TUNABLE_MAPPER_INSTANCE_HIGH_WATER: {
+      const auto kind = machine.has_gpus()
+                          ? Legion::Memory::GPU_FB_MEM
+                          : (machine.has_socket_memory() ? Legion::Memory::SOCKET_MEM
+                                                         : Legion::Memory::SYSTEM_MEM);
+      return Scalar(uint64_t(MemoryUsageTracker::get_tracker()->high_water_mark(kind)));
     }
   }
   // Illegal tunable variable
@@ -14,8 +14,13 @@
  *
  */
 
+#include <algorithm>
+
 #include "core/mapping/instance_manager.h"
+#include "core/mapping/mapper_stats.h"
+#include "core/runtime/runtime.h"
 #include "core/utilities/dispatch.h"
+#include "env_defaults.h"
 
 namespace legate {
 namespace mapping {
@@ -34,11 +39,9 @@ RegionGroup::RegionGroup(std::set<Region>&& rs, const Domain bound)
 {
 }
 
-std::vector<RegionGroup::Region> RegionGroup::get_regions() const
+void RegionGroup::fill_regions(std::vector<Region>& result) const
 {
-  std::vector<Region> result;
-  result.insert(result.end(), regions.begin(), regions.end());
-  return std::move(result);
+  result.assign(regions.begin(), regions.end());
 }
 
 bool RegionGroup::subsumes(const RegionGroup* other)
@@ -68,9 +71,43 @@ std::ostream& operator<<(std::ostream& os, const RegionGroup& region_group)
   return os;
 }
 
+void InstanceSet::SpatialIndex::insert(RegionGroup* group)
+{
+  auto lo = group->bounding_box.lo(0);
+  auto hi = group->bounding_box.hi(0);
+  entries_.insert({lo, group});
+  max_extent_ = std::max(max_extent_, hi - lo + 1);
+}
+
+void InstanceSet::SpatialIndex::erase(RegionGroup* group)
+{
+  auto range = entries_.equal_range(group->bounding_box.lo(0));
+  for (auto it = range.first; it != range.second; ++it)
+    if (it->second == group) {
+      entries_.erase(it);
+      return;
+    }
+  // The group must have been in the index
+  assert(false);
+}
+
+void InstanceSet::SpatialIndex::find_overlapping(const Domain& bounds,
+                                                 std::vector<RegionGroup*>& result) const
+{
+  if (entries_.empty()) return;
+  auto lo = bounds.lo()[0];
+  auto hi = bounds.hi()[0];
+  // Any group whose low coordinate is below this point is too short to reach `bounds`
+  auto begin = entries_.lower_bound(lo - max_extent_ + 1);
+  auto end   = entries_.upper_bound(hi);
+  for (auto it = begin; it != end; ++it)
+    if (it->second->bounding_box.hi(0) >= lo) result.push_back(it->second);
+}
+
 bool InstanceSet::find_instance(Region region,
                                 Instance& result,
-                                const InstanceMappingPolicy& policy) const
+                                const InstanceMappingPolicy& policy,
+                                uint64_t stamp /*= 0*/) const
 {
   auto finder = groups_.find(region);
   if (finder == groups_.end()) return false;
@@ -83,7 +120,8 @@ bool InstanceSet::find_instance(Region region,
 
   auto& spec = ifinder->second;
   if (spec.policy.subsumes(policy)) {
-    result = spec.instance;
+    result        = spec.instance;
+    spec.last_use = stamp;
     return true;
   } else
     return false;
@@ -98,11 +136,12 @@ static inline bool too_big(size_t union_volume,
   return (union_volume - (my_volume + group_volume - intersect_volume)) > intersect_volume;
 }
 
+template <typename SpatialIndex>
 struct construct_overlapping_region_group_fn {
   template <int32_t DIM>
   RegionGroupP operator()(const InstanceSet::Region& region,
                           const Domain& domain,
-                          const std::map<RegionGroup*, InstanceSet::InstanceSpec>& instances)
+                          const SpatialIndex& spatial_index)
   {
     auto bound       = domain.bounds<DIM, coord_t>();
     size_t bound_vol = bound.volume();
@@ -112,46 +151,62 @@ struct construct_overlapping_region_group_fn {
     log_instmgr.debug() << "construct_overlapping_region_group( " << region << "," << domain << ")";
 #endif
 
-    for (const auto& pair : instances) {
-      auto& group = pair.first;
-
-      Rect<DIM> group_bbox = group->bounding_box.bounds<DIM, coord_t>();
+    // Each merge can grow the bounding box, which can bring new groups into overlap, so we
+    // re-query the spatial index until we reach a fixed point. Every group is still visited at
+    // most once, so the requery only pays for the candidates in the final bounding box.
+    std::set<RegionGroup*> visited;
+    std::vector<RegionGroup*> candidates;
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      candidates.clear();
+      spatial_index.find_overlapping(Domain(bound), candidates);
+
+      for (auto* group : candidates) {
+        if (visited.find(group) != visited.end()) continue;
+        visited.insert(group);
+
+        Rect<DIM> group_bbox = group->bounding_box.bounds<DIM>();
 #ifdef DEBUG_LEGATE
-      log_instmgr.debug() << "  check intersection with " << group_bbox;
+        log_instmgr.debug() << "  check intersection with " << group_bbox;
 #endif
-      auto intersect = bound.intersection(group_bbox);
-      if (intersect.empty()) {
+        auto intersect = bound.intersection(group_bbox);
+        if (intersect.empty()) {
 #ifdef DEBUG_LEGATE
-        log_instmgr.debug() << "    no intersection";
+          log_instmgr.debug() << "    no intersection";
 #endif
-        continue;
-      }
-
-      // Only allow merging if the bloating isn't "too big"
-      auto union_bbox      = bound.union_bbox(group_bbox);
-      size_t union_vol     = union_bbox.volume();
-      size_t group_vol     = group_bbox.volume();
-      size_t intersect_vol = intersect.volume();
-      if (too_big(union_vol, bound_vol, group_vol, intersect_vol)) {
+          continue;
+        }
+
+        // Only allow merging if the bloating isn't "too big"
+        auto union_bbox      = bound.union_bbox(group_bbox);
+        size_t union_vol     = union_bbox.volume();
+        size_t group_vol     = group_bbox.volume();
+        size_t intersect_vol = intersect.volume();
+        if (too_big(union_vol, bound_vol, group_vol, intersect_vol)) {
 #ifdef DEBUG_LEGATE
-        log_instmgr.debug() << "    too big to merge (union:" << union_bbox
-                            << ",bound:" << bound_vol << ",group:" << group_vol
-                            << ",intersect:" << intersect_vol << ")";
+          log_instmgr.debug() << "    too big to merge (union:" << union_bbox
+                              << ",bound:" << bound_vol << ",group:" << group_vol
+                              << ",intersect:" << intersect_vol << ")";
 #endif
-        continue;
-      }
-
-      // NOTE: It is critical that we maintain the invariant that if at least one region is mapped
-      // to a group in the instances_ table, that group is still present on the groups_ table, and
-      // thus there's at least one shared_ptr remaining that points to it. Otherwise we run the risk
-      // that a group pointer stored on the instances_ table points to a group that's been collected
-      regions.insert(group->regions.begin(), group->regions.end());
+          continue;
+        }
+
+        // NOTE: It is critical that we maintain the invariant that if at least one region is mapped
+        // to a group in the instances_ table, that group is still present on the groups_ table, and
+        // thus there's at least one shared_ptr remaining that points to it. Otherwise we run the
+        // risk that a group pointer stored on the instances_ table points to a group that's been
+        // collected
+        regions.insert(group->regions.begin(), group->regions.end());
 #ifdef DEBUG_LEGATE
-      log_instmgr.debug() << "    bounds updated: " << bound << " ~> " << union_bbox;
+        log_instmgr.debug() << "    bounds updated: " << bound << " ~> " << union_bbox;
 #endif
 
-      bound     = union_bbox;
-      bound_vol = union_vol;
+        bound     = union_bbox;
+        bound_vol = union_vol;
+        changed   = true;
+        MapperStats::get_mapper_stats()->group_consolidations++;
+      }
     }
 
     return std::make_shared<RegionGroup>(std::move(regions), Domain(bound));
@@ -164,17 +219,22 @@ RegionGroupP InstanceSet::construct_overlapping_region_group(const Region& regio
 {
   auto finder = groups_.find(region);
   if (finder == groups_.end())
-    return dim_dispatch(
-      domain.get_dim(), construct_overlapping_region_group_fn{}, region, domain, instances_);
+    return dim_dispatch(domain.get_dim(),
+                        construct_overlapping_region_group_fn<SpatialIndex>{},
+                        region,
+                        domain,
+                        spatial_index_);
   else {
     if (!exact || finder->second->regions.size() == 1) return finder->second;
     return std::make_shared<RegionGroup>(std::set<Region>{region}, domain);
   }
 }
 
-std::set<InstanceSet::Instance> InstanceSet::record_instance(RegionGroupP group,
-                                                             Instance instance,
-                                                             const InstanceMappingPolicy& policy)
+void InstanceSet::record_instance(RegionGroupP group,
+                                  Instance instance,
+                                  const InstanceMappingPolicy& policy,
+                                  std::vector<Instance>& replaced,
+                                  uint64_t stamp /*= 0*/)
 {
 #ifdef DEBUG_LEGATE
 #ifdef DEBUG_INSTANCE_MANAGER
@@ -184,15 +244,24 @@ std::set<InstanceSet::Instance> InstanceSet::record_instance(RegionGroupP group,
   dump_and_sanity_check();
 #endif
 
-  std::set<Instance> replaced;
+  // `replaced` is typically empty or a singleton, so a linear dedup over the caller's pooled
+  // vector beats a node-based set here
+  auto add_replaced = [&replaced, &instance](const Instance& old) {
+    if (old == instance) return;
+    if (std::find(replaced.begin(), replaced.end(), old) == replaced.end())
+      replaced.push_back(old);
+  };
   std::set<RegionGroupP> removed_groups;
 
   auto finder = instances_.find(group.get());
   if (finder != instances_.end()) {
-    replaced.insert(finder->second.instance);
+    add_replaced(finder->second.instance);
     finder->second = InstanceSpec(instance, policy);
-  } else
+  } else {
     instances_[group.get()] = InstanceSpec(instance, policy);
+    spatial_index_.insert(group.get());
+  }
+  instances_[group.get()].last_use = stamp;
 
   for (auto& region : group->regions) {
     auto finder = groups_.find(region);
@@ -219,21 +288,18 @@ std::set<InstanceSet::Instance> InstanceSet::record_instance(RegionGroupP group,
     }
     if (can_remove) {
       auto finder = instances_.find(removed_group.get());
-      replaced.insert(finder->second.instance);
+      add_replaced(finder->second.instance);
       instances_.erase(finder);
+      spatial_index_.erase(removed_group.get());
     }
   }
 
-  replaced.erase(instance);
-
 #ifdef DEBUG_LEGATE
 #ifdef DEBUG_INSTANCE_MANAGER
   log_instmgr.debug() << "===== after adding an entry " << *group << " ~> " << instance << " =====";
 #endif
   dump_and_sanity_check();
 #endif
-
-  return std::move(replaced);
 }
 
 bool InstanceSet::erase(Instance inst)
@@ -250,6 +316,7 @@ bool InstanceSet::erase(Instance inst)
     if (it->second.instance == inst) {
       auto to_erase = it++;
       filtered_groups.insert(to_erase->first);
+      spatial_index_.erase(to_erase->first);
       instances_.erase(to_erase);
     } else
       it++;
@@ -281,6 +348,13 @@ size_t InstanceSet::get_instance_size() const
   return sum;
 }
 
+void InstanceSet::find_eviction_candidates(std::vector<EvictionCandidate>& result) const
+{
+  for (auto& pair : instances_)
+    result.push_back(EvictionCandidate{
+      pair.second.instance, pair.second.last_use, pair.second.instance.get_instance_size()});
+}
+
 void InstanceSet::dump_and_sanity_check() const
 {
 #ifdef DEBUG_INSTANCE_MANAGER
@@ -295,21 +369,40 @@ void InstanceSet::dump_and_sanity_check() const
     assert(entry.second->regions.count(entry.first) > 0);
   }
   for (auto& entry : instances_) assert(found_groups.count(entry.first) > 0);
+  assert(spatial_index_.size() == instances_.size());
 }
 
 bool ReductionInstanceSet::find_instance(ReductionOpID& redop,
                                          Region& region,
                                          Instance& result,
-                                         const InstanceMappingPolicy& policy) const
+                                         const InstanceMappingPolicy& policy)
 {
   auto finder = instances_.find(region);
-  if (finder == instances_.end()) return false;
-  auto& spec = finder->second;
-  if (spec.policy == policy && spec.redop == redop) {
-    result = spec.instance;
+  if (finder != instances_.end()) {
+    auto& spec = finder->second;
+    if (spec.policy == policy && spec.redop == redop) {
+      result = spec.instance;
+      return true;
+    } else
+      return false;
+  }
+  // Pooled reuse: iterative solvers create a fresh subregion every epoch, so the exact lookup
+  // above keeps missing even though we hold an instance of the identical shape for the previous
+  // epoch. An instance recorded for another region of this field can be re-bound to the new
+  // region as long as it covers it, sparing the allocate/initialize cycle.
+  for (auto& entry : instances_) {
+    auto& spec = entry.second;
+    if (spec.redop != redop || !(spec.policy == policy)) continue;
+    if (!spec.instance.meets_regions({region})) continue;
+#ifdef DEBUG_LEGATE
+    log_instmgr.debug() << "re-bound reduction instance " << spec.instance << " from "
+                        << entry.first << " to " << region;
+#endif
+    result             = spec.instance;
+    instances_[region] = ReductionInstanceSpec(redop, result, policy);
     return true;
-  } else
-    return false;
+  }
+  return false;
 }
 
 void ReductionInstanceSet::record_instance(ReductionOpID& redop,
@@ -346,9 +439,16 @@ bool InstanceManager::find_instance(Region region,
                                     Instance& result,
                                     const InstanceMappingPolicy& policy)
 {
+  auto lock   = read_lock();
   auto finder = instance_sets_.find(FieldMemInfo(region.get_tree_id(), field_id, memory));
-  return policy.allocation != AllocPolicy::MUST_ALLOC && finder != instance_sets_.end() &&
-         finder->second.find_instance(region, result, policy);
+  bool found  = policy.allocation != AllocPolicy::MUST_ALLOC && finder != instance_sets_.end() &&
+               finder->second.find_instance(region, result, policy, ++use_clock_);
+  auto* stats = MapperStats::get_mapper_stats();
+  if (found)
+    stats->find_instance_hits++;
+  else
+    stats->find_instance_misses++;
+  return found;
 }
 
 RegionGroupP InstanceManager::find_region_group(const Region& region,
@@ -359,8 +459,16 @@ RegionGroupP InstanceManager::find_region_group(const Region& region,
 {
   FieldMemInfo key(region.get_tree_id(), field_id, memory);
 
+  // Tiny regions aren't worth consolidating: the bounding box unions and subsumption checks cost
+  // more than the redundant copies they might save, so we map them to exact standalone instances
+  static const size_t small_region_volume = extract_env(
+    "LEGATE_SMALL_REGION_VOLUME", SMALL_REGION_VOLUME_DEFAULT, SMALL_REGION_VOLUME_TEST);
+  if (domain.get_volume() < small_region_volume)
+    return std::make_shared<RegionGroup>(std::set<Region>{region}, domain);
+
   RegionGroupP result{nullptr};
 
+  auto lock   = read_lock();
   auto finder = instance_sets_.find(key);
   if (finder == instance_sets_.end() || exact)
     result = std::make_shared<RegionGroup>(std::set<Region>{region}, domain);
@@ -375,37 +483,98 @@ RegionGroupP InstanceManager::find_region_group(const Region& region,
   return std::move(result);
 }
 
-std::set<InstanceManager::Instance> InstanceManager::record_instance(
-  RegionGroupP group, FieldID fid, Instance instance, const InstanceMappingPolicy& policy)
+void InstanceManager::record_instance(RegionGroupP group,
+                                      FieldID fid,
+                                      Instance instance,
+                                      const InstanceMappingPolicy& policy,
+                                      std::vector<Instance>& replaced)
 {
   const auto mem = instance.get_location();
   const auto tid = instance.get_tree_id();
 
   FieldMemInfo key(tid, fid, mem);
-  return instance_sets_[key].record_instance(group, instance, policy);
+  replaced.clear();
+  auto lock = write_lock();
+  reverse_index_[instance].insert(key);
+  instance_sets_[key].record_instance(group, instance, policy, replaced, ++use_clock_);
 }
 
 void InstanceManager::erase(Instance inst)
 {
-  const auto mem = inst.get_location();
-  const auto tid = inst.get_tree_id();
+  auto lock = write_lock();
+  erase_nolock(inst);
+}
 
-  for (auto fit = instance_sets_.begin(); fit != instance_sets_.end(); /*nothing*/) {
-    if ((fit->first.memory != mem) || (fit->first.tid != tid)) {
-      fit++;
-      continue;
-    }
-    if (fit->second.erase(inst)) {
-      auto to_erase = fit++;
-      instance_sets_.erase(to_erase);
-    } else
-      fit++;
+void InstanceManager::erase(const std::vector<Instance>& instances)
+{
+  if (instances.empty()) return;
+  auto lock = write_lock();
+  for (auto& inst : instances) erase_nolock(inst);
+}
+
+void InstanceManager::erase_nolock(Instance inst)
+{
+  auto rfinder = reverse_index_.find(inst);
+  if (rfinder == reverse_index_.end()) return;
+
+  for (auto& key : rfinder->second) {
+    auto finder = instance_sets_.find(key);
+    if (finder == instance_sets_.end()) continue;
+    if (finder->second.erase(inst)) instance_sets_.erase(finder);
+  }
+  reverse_index_.erase(rfinder);
+}
+
+std::vector<InstanceManager::Instance> InstanceManager::release_cold_instances(Memory memory,
+                                                                               size_t footprint)
+{
+  std::vector<Instance> victims;
+  if (0 == footprint) return victims;
+
+  auto lock = write_lock();
+
+  std::vector<InstanceSet::EvictionCandidate> candidates;
+  for (auto& pair : instance_sets_)
+    if (pair.first.memory == memory) pair.second.find_eviction_candidates(candidates);
+
+  // The larger and the longer unused an instance is, the higher its eviction score
+  const uint64_t now = use_clock_;
+  auto score         = [&now](const InstanceSet::EvictionCandidate& candidate) {
+    return static_cast<double>(now - candidate.last_use) * candidate.size;
+  };
+  std::sort(candidates.begin(), candidates.end(), [&score](const auto& lhs, const auto& rhs) {
+    return score(lhs) > score(rhs);
+  });
+
+  size_t freed = 0;
+  for (auto& candidate : candidates) {
+    if (freed >= footprint) break;
+    // The same instance can be registered under multiple fields
+    if (std::find(victims.begin(), victims.end(), candidate.instance) != victims.end()) continue;
+#ifdef DEBUG_LEGATE
+    log_instmgr.debug() << "release cold instance " << candidate.instance
+                        << " (size: " << candidate.size << " bytes, last use: " << candidate.last_use
+                        << ")";
+#endif
+    victims.push_back(candidate.instance);
+    freed += candidate.size;
   }
+  for (auto& victim : victims) erase_nolock(victim);
+
+  return victims;
+}
+
+void InstanceManager::release_all()
+{
+  auto lock = write_lock();
+  instance_sets_.clear();
+  reverse_index_.clear();
 }
 
 std::map<Memory, size_t> InstanceManager::aggregate_instance_sizes() const
 {
   std::map<Memory, size_t> result;
+  auto lock = read_lock();
   for (auto& pair : instance_sets_) {
     auto& memory = pair.first.memory;
     if (result.find(memory) == result.end()) result[memory] = 0;
@@ -429,6 +598,8 @@ bool ReductionInstanceManager::find_instance(ReductionOpID& redop,
                                              Instance& result,
                                              const InstanceMappingPolicy& policy)
 {
+  // Needs exclusive access, as the lookup can re-bind a pooled instance to a new region
+  auto lock   = write_lock();
   auto finder = instance_sets_.find(FieldMemInfo(region.get_tree_id(), field_id, memory));
   return policy.allocation != AllocPolicy::MUST_ALLOC && finder != instance_sets_.end() &&
          finder->second.find_instance(redop, region, result, policy);
@@ -444,6 +615,8 @@ void ReductionInstanceManager::record_instance(ReductionOpID& redop,
   const auto tid = instance.get_tree_id();
 
   FieldMemInfo key(tid, fid, mem);
+  auto lock = write_lock();
+  reverse_index_[instance].insert(key);
   auto finder = instance_sets_.find(key);
   if (finder != instance_sets_.end())
     instance_sets_[key].record_instance(redop, region, instance, policy);
@@ -456,20 +629,35 @@ void ReductionInstanceManager::record_instance(ReductionOpID& redop,
 
 void ReductionInstanceManager::erase(Instance inst)
 {
-  const auto mem = inst.get_location();
-  const auto tid = inst.get_tree_id();
+  auto lock = write_lock();
+  erase_nolock(inst);
+}
 
-  for (auto fit = instance_sets_.begin(); fit != instance_sets_.end(); /*nothing*/) {
-    if ((fit->first.memory != mem) || (fit->first.tid != tid)) {
-      fit++;
-      continue;
-    }
-    if (fit->second.erase(inst)) {
-      auto to_erase = fit++;
-      instance_sets_.erase(to_erase);
-    } else
-      fit++;
+void ReductionInstanceManager::erase(const std::vector<Instance>& instances)
+{
+  if (instances.empty()) return;
+  auto lock = write_lock();
+  for (auto& inst : instances) erase_nolock(inst);
+}
+
+void ReductionInstanceManager::erase_nolock(Instance inst)
+{
+  auto rfinder = reverse_index_.find(inst);
+  if (rfinder == reverse_index_.end()) return;
+
+  for (auto& key : rfinder->second) {
+    auto finder = instance_sets_.find(key);
+    if (finder == instance_sets_.end()) continue;
+    if (finder->second.erase(inst)) instance_sets_.erase(finder);
   }
+  reverse_index_.erase(rfinder);
+}
+
+void ReductionInstanceManager::release_all()
+{
+  auto lock = write_lock();
+  instance_sets_.clear();
+  reverse_index_.clear();
 }
 
 /*static*/ ReductionInstanceManager* ReductionInstanceManager::get_instance_manager()
@@ -16,11 +16,15 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <vector>
 
 #include "legion.h"
 
+#include "core/mapping/compact_domain.h"
 #include "core/mapping/mapping.h"
 
 namespace legate {
@@ -40,12 +44,15 @@ struct RegionGroup {
   RegionGroup(RegionGroup&&)      = default;
 
  public:
-  std::vector<Region> get_regions() const;
+  // Fills `result` with the member regions, reusing whatever capacity the caller's vector
+  // already has; direct iteration over `regions` stays available for callers that don't need
+  // the contiguous form Legion's instance creation calls expect
+  void fill_regions(std::vector<Region>& result) const;
   bool subsumes(const RegionGroup* other);
 
  public:
   std::set<Region> regions;
-  Domain bounding_box;
+  CompactDomain bounding_box;
   std::map<const RegionGroup*, bool> subsumption_cache;
 };
 
@@ -66,31 +73,71 @@ struct InstanceSet {
 
     Instance instance{};
     InstanceMappingPolicy policy{};
+    // Logical timestamp of the last lookup that returned this instance. Updated under a shared
+    // lock, so concurrent readers can race on it, which is fine for an approximate recency signal.
+    mutable uint64_t last_use{0};
+  };
+
+  struct EvictionCandidate {
+    Instance instance{};
+    uint64_t last_use{0};
+    size_t size{0};
   };
 
  public:
-  bool find_instance(Region region, Instance& result, const InstanceMappingPolicy& policy) const;
+  bool find_instance(Region region,
+                     Instance& result,
+                     const InstanceMappingPolicy& policy,
+                     uint64_t stamp = 0) const;
   RegionGroupP construct_overlapping_region_group(const Region& region,
                                                   const Domain& domain,
                                                   bool exact) const;
 
  public:
-  std::set<Instance> record_instance(RegionGroupP group,
-                                     Instance instance,
-                                     const InstanceMappingPolicy& policy);
+  // Appends to `replaced` the instances this recording displaced from the set, deduplicated
+  // and never including `instance` itself
+  void record_instance(RegionGroupP group,
+                       Instance instance,
+                       const InstanceMappingPolicy& policy,
+                       std::vector<Instance>& replaced,
+                       uint64_t stamp = 0);
 
  public:
   bool erase(Instance inst);
 
  public:
   size_t get_instance_size() const;
+  void find_eviction_candidates(std::vector<EvictionCandidate>& result) const;
 
  private:
   void dump_and_sanity_check() const;
 
+ private:
+  // Interval index over the first dimension of group bounding boxes. Groups are keyed by the
+  // low coordinate of their bounding box and we remember the longest extent ever inserted, so
+  // an overlap query only needs to scan the window [lo - max_extent, hi] instead of the whole
+  // table. Remaining dimensions are checked by the exact intersection test on the caller side.
+  class SpatialIndex {
+   public:
+    void insert(RegionGroup* group);
+    void erase(RegionGroup* group);
+
+   public:
+    // Appends to `result` all groups whose bounding boxes potentially overlap with `bounds`
+    void find_overlapping(const Domain& bounds, std::vector<RegionGroup*>& result) const;
+
+   public:
+    size_t size() const { return entries_.size(); }
+
+   private:
+    std::multimap<coord_t, RegionGroup*> entries_;
+    coord_t max_extent_{0};
+  };
+
  private:
   std::map<RegionGroup*, InstanceSpec> instances_;
   std::map<Legion::LogicalRegion, RegionGroupP> groups_;
+  SpatialIndex spatial_index_;
 };
 
 class ReductionInstanceSet {
@@ -115,10 +162,12 @@ class ReductionInstanceSet {
   };
 
  public:
+  // Non-const because a lookup can re-bind a pooled instance, recorded for a now-stale region,
+  // to the queried region of the same shape
   bool find_instance(ReductionOpID& redop,
                      Region& region,
                      Instance& result,
-                     const InstanceMappingPolicy& policy) const;
+                     const InstanceMappingPolicy& policy);
 
  public:
   void record_instance(ReductionOpID& redop,
@@ -167,11 +216,23 @@ class BaseInstanceManager {
     Memory memory;
   };
 
- public:
-  Legion::Mapping::LocalLock& manager_lock() { return manager_lock_; }
+ protected:
+  // Lookups on the hot mapping path only read the tables, so they take the lock in shared mode
+  // and can proceed in parallel across mapper contexts; only mutations (record_instance/erase)
+  // need exclusive access. Note that a reader can still observe an instance that a concurrent
+  // writer is about to erase, but the callers already handle that case by retrying when the
+  // subsequent acquire fails.
+  std::shared_lock<std::shared_mutex> read_lock() const
+  {
+    return std::shared_lock<std::shared_mutex>(manager_lock_);
+  }
+  std::unique_lock<std::shared_mutex> write_lock() const
+  {
+    return std::unique_lock<std::shared_mutex>(manager_lock_);
+  }
 
  private:
-  Legion::Mapping::LocalLock manager_lock_{};
+  mutable std::shared_mutex manager_lock_{};
 };
 
 class InstanceManager : public BaseInstanceManager {
@@ -189,13 +250,31 @@ class InstanceManager : public BaseInstanceManager {
                                  FieldID field_id,
                                  Memory memory,
                                  bool exact = false);
-  std::set<Instance> record_instance(RegionGroupP group,
-                                     FieldID field_id,
-                                     Instance instance,
-                                     const InstanceMappingPolicy& policy = {});
+  // Overwrites `replaced` with the instances displaced from the cache, so the caller can drop
+  // its bookkeeping for them; takes the output by reference so a pooled vector can be reused
+  // across calls instead of materializing a fresh set on every map_task
+  void record_instance(RegionGroupP group,
+                       FieldID field_id,
+                       Instance instance,
+                       const InstanceMappingPolicy& policy,
+                       std::vector<Instance>& replaced);
 
  public:
   void erase(Instance inst);
+  // Erases a batch of instances under a single exclusive lock; phase transitions can kill
+  // thousands of instances at once and per-instance lock round-trips add up
+  void erase(const std::vector<Instance>& instances);
+
+ public:
+  // Picks cold instances in `memory` to release until at least `footprint` bytes are freed,
+  // removes them from the manager, and returns them so the caller can lower their GC priorities.
+  // Instances are ranked by a size/recency cost model: the larger and the longer unused an
+  // instance is, the sooner it gets evicted.
+  std::vector<Instance> release_cold_instances(Memory memory, size_t footprint);
+
+  // Drops every cached entry, for early teardown; in-flight mappings simply miss the cache
+  // afterwards and map fresh instances
+  void release_all();
 
  public:
   static InstanceManager* get_instance_manager();
@@ -203,8 +282,18 @@ class InstanceManager : public BaseInstanceManager {
  public:
   std::map<Memory, size_t> aggregate_instance_sizes() const;
 
+ private:
+  void erase_nolock(Instance inst);
+
  private:
   std::map<FieldMemInfo, InstanceSet> instance_sets_{};
+  // Reverse index from an instance to the keys of the sets it was recorded under, so erase
+  // jumps straight to the owning sets instead of scanning every set of the instance's tree
+  // and memory. Entries are a superset: an instance replaced within a set leaves its key
+  // behind until the instance itself is erased, which is harmless since erasing from a set
+  // that no longer holds the instance is a no-op.
+  std::map<Instance, std::set<FieldMemInfo>> reverse_index_{};
+  std::atomic<uint64_t> use_clock_{0};
 };
 
 class ReductionInstanceManager : public BaseInstanceManager {
@@ -227,12 +316,19 @@ class ReductionInstanceManager : public BaseInstanceManager {
 
  public:
   void erase(Instance inst);
+  void erase(const std::vector<Instance>& instances);
+  void release_all();
+
+ private:
+  void erase_nolock(Instance inst);
 
  public:
   static ReductionInstanceManager* get_instance_manager();
 
  private:
   std::map<FieldMemInfo, ReductionInstanceSet> instance_sets_{};
+  // Same superset reverse index as in InstanceManager
+  std::map<Instance, std::set<FieldMemInfo>> reverse_index_{};
 };
 
 }  // namespace mapping
@@ -149,7 +149,18 @@ const Processor& LocalProcessorRange::operator[](uint32_t idx) const
   return procs_[local_idx];
 }
 
-Machine::Machine()
+Machine::Machine() : Machine(shared_machine()) {}
+
+/*static*/ const Machine& Machine::shared_machine()
+{
+  // Walking the processor/memory queries and the affinity matrix is the expensive part of
+  // building the model; it is done once per process and every mapper's Machine is a copy of
+  // the result
+  static const Machine machine{from_queries_t{}};
+  return machine;
+}
+
+Machine::Machine(from_queries_t)
   : local_node(Realm::Network::my_node_id),
     total_nodes(Legion::Machine::get_machine().get_address_space_count())
 {
@@ -201,6 +212,35 @@ Machine::Machine()
     else
       socket_memories_[omp] = system_memory_;
   }
+  // CPU processors also get bound to their local socket memory, so plain CPU tasks stay
+  // NUMA-local as well
+  for (auto& cpu : cpus_) {
+    Legion::Machine::MemoryQuery sockmem(legion_machine);
+    sockmem.local_address_space().only_kind(Legion::Memory::SOCKET_MEM).best_affinity_to(cpu);
+    if (sockmem.count() > 0)
+      socket_memories_[cpu] = sockmem.first();
+    else
+      socket_memories_[cpu] = system_memory_;
+  }
+
+  // Precompute the memory-to-memory affinity matrix so source selection can do table lookups
+  // instead of querying the Legion machine on every copy
+  std::vector<Legion::MemoryMemoryAffinity> affinities;
+  legion_machine.get_mem_mem_affinity(
+    affinities, Memory::NO_MEMORY, Memory::NO_MEMORY, false /*not just local affinities*/);
+  for (auto& affinity : affinities) {
+    mem_bandwidths_[{affinity.m1, affinity.m2}] = affinity.bandwidth;
+    mem_bandwidths_[{affinity.m2, affinity.m1}] = affinity.bandwidth;
+  }
+}
+
+uint32_t Machine::mem_bandwidth(Memory source, Memory target) const
+{
+  auto finder = mem_bandwidths_.find({source, target});
+  // A miss means that there's no direct channel between the source and target memories, in which
+  // case we report the smallest bandwidth
+  // TODO: Not all multi-hop copies are equal
+  return mem_bandwidths_.end() == finder ? 0 : finder->second;
 }
 
 const std::vector<Processor>& Machine::procs(TaskTarget target) const
@@ -231,13 +271,35 @@ size_t Machine::total_socket_memory_size() const
 
 bool Machine::has_socket_memory() const
 {
-  return !socket_memories_.empty() &&
-         socket_memories_.begin()->second.kind() == Legion::Memory::SOCKET_MEM;
+  for (auto& pair : socket_memories_)
+    if (pair.second.kind() == Legion::Memory::SOCKET_MEM) return true;
+  return false;
 }
 
 LocalProcessorRange Machine::slice(TaskTarget target,
                                    const MachineDesc& machine_desc,
                                    bool fallback_to_global /*=false*/) const
+{
+  auto finder    = machine_desc.processor_ranges.find(target);
+  auto has_range = machine_desc.processor_ranges.end() != finder;
+  SliceCacheKey key{target,
+                    has_range,
+                    has_range ? finder->second.low : 0,
+                    has_range ? finder->second.high : 0,
+                    has_range ? finder->second.per_node_count : 0,
+                    fallback_to_global};
+
+  auto cached = slice_cache_.find(key);
+  if (slice_cache_.end() != cached) return cached->second;
+
+  auto result = compute_slice(target, machine_desc, fallback_to_global);
+  slice_cache_.emplace(std::move(key), result);
+  return result;
+}
+
+LocalProcessorRange Machine::compute_slice(TaskTarget target,
+                                           const MachineDesc& machine_desc,
+                                           bool fallback_to_global) const
 {
   const auto& local_procs = procs(target);
 
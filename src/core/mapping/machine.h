@@ -70,6 +70,8 @@ class LocalProcessorRange {
  public:
   const Processor& first() const { return *procs_.begin(); }
   const Processor& operator[](uint32_t idx) const;
+  // The local processors covered by this slice
+  const Span<const Processor>& procs() const { return procs_; }
 
  public:
   bool empty() const { return procs_.size() == 0; }
@@ -83,8 +85,17 @@ class LocalProcessorRange {
 
 class Machine {
  public:
+  // Copies from a process-wide model that walks the Legion machine queries only once, so
+  // constructing a Machine per mapper (one per library) stays cheap no matter how many
+  // libraries are loaded
   Machine();
 
+ private:
+  // Tag for the constructor that actually performs the machine queries
+  struct from_queries_t {};
+  explicit Machine(from_queries_t);
+  static const Machine& shared_machine();
+
  public:
   const std::vector<Processor>& cpus() const { return cpus_; }
   const std::vector<Processor>& gpus() const { return gpus_; }
@@ -108,6 +119,12 @@ class Machine {
  public:
   bool has_socket_memory() const;
 
+ public:
+  // Returns the bandwidth of the direct channel between the two memories, or 0 if there is none.
+  // The affinity matrix is precomputed at startup, so this is a table lookup rather than a
+  // Legion machine query.
+  uint32_t mem_bandwidth(Memory source, Memory target) const;
+
  public:
   Memory get_memory(Processor proc, StoreTarget target) const;
   Memory system_memory() const { return system_memory_; }
@@ -120,6 +137,11 @@ class Machine {
                             const MachineDesc& machine_desc,
                             bool fallback_to_global = false) const;
 
+ private:
+  LocalProcessorRange compute_slice(TaskTarget target,
+                                    const MachineDesc& machine_desc,
+                                    bool fallback_to_global) const;
+
  public:
   const uint32_t local_node;
   const uint32_t total_nodes;
@@ -133,6 +155,17 @@ class Machine {
   Memory system_memory_, zerocopy_memory_;
   std::map<Processor, Memory> frame_buffers_;
   std::map<Processor, Memory> socket_memories_;
+  std::map<std::pair<Memory, Memory>, uint32_t> mem_bandwidths_;
+
+ private:
+  // A slice is a pure function of the target, the machine descriptor's range for that
+  // target, and the fallback flag, so resolved slices are memoized on exactly that content:
+  // every launch in a scope carries the same descriptor and resolves with a lookup. The
+  // cached LocalProcessorRanges stay valid because their spans point into the processor
+  // vectors above, which never change after startup. Mapper calls on a mapper are
+  // serialized, so the cache needs no locking
+  using SliceCacheKey = std::tuple<TaskTarget, bool, uint32_t, uint32_t, uint32_t, bool>;
+  mutable std::map<SliceCacheKey, LocalProcessorRange> slice_cache_;
 };
 
 }  // namespace mapping
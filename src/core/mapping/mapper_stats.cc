@@ -0,0 +1,129 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+
+#include "core/mapping/mapper_stats.h"
+
+namespace legate {
+namespace mapping {
+
+void MapperStats::dump(Legion::Logger& logger) const
+{
+  logger.print("Mapper statistics:");
+  logger.print("  instance cache hits: %llu",
+               (unsigned long long)find_instance_hits.load());
+  logger.print("  instance cache misses: %llu",
+               (unsigned long long)find_instance_misses.load());
+  logger.print("  region group consolidations: %llu",
+               (unsigned long long)group_consolidations.load());
+  logger.print("  allocation failures: %llu",
+               (unsigned long long)allocation_failures.load());
+  logger.print("  messages handled: %llu", (unsigned long long)messages_handled.load());
+}
+
+/*static*/ MapperStats* MapperStats::get_mapper_stats()
+{
+  static MapperStats* stats{nullptr};
+
+  if (nullptr == stats) stats = new MapperStats();
+  return stats;
+}
+
+void MemoryUsageTracker::record_allocation(const std::string& library,
+                                           const Instance& instance,
+                                           Memory memory,
+                                           size_t size)
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  live_instances_[instance] = Record{library, memory, size};
+
+  auto& mem_usage = per_memory_[memory];
+  mem_usage.live += size;
+  mem_usage.high_water = std::max(mem_usage.high_water, mem_usage.live);
+
+  auto& lib_usage = per_library_[{library, memory}];
+  lib_usage.live += size;
+  lib_usage.high_water = std::max(lib_usage.high_water, lib_usage.live);
+}
+
+void MemoryUsageTracker::record_deallocation(const Instance& instance)
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  auto finder = live_instances_.find(instance);
+  if (live_instances_.end() == finder) return;
+  auto& record = finder->second;
+
+  per_memory_[record.memory].live -= record.size;
+  per_library_[{record.library, record.memory}].live -= record.size;
+  live_instances_.erase(finder);
+}
+
+uint64_t MemoryUsageTracker::live_bytes(Memory::Kind kind) const
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  uint64_t total = 0;
+  for (auto& [memory, usage] : per_memory_)
+    if (memory.kind() == kind) total += usage.live;
+  return total;
+}
+
+uint64_t MemoryUsageTracker::high_water_mark(Memory::Kind kind) const
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  uint64_t total = 0;
+  for (auto& [memory, usage] : per_memory_)
+    if (memory.kind() == kind) total += usage.high_water;
+  return total;
+}
+
+void MemoryUsageTracker::dump(Legion::Logger& logger) const
+{
+  static const char* memory_kinds[] = {
+#define MEM_NAMES(name, desc) desc,
+    REALM_MEMORY_KINDS(MEM_NAMES)
+#undef MEM_NAMES
+  };
+
+  std::lock_guard<std::mutex> lock(lock_);
+  logger.print("Instance memory usage:");
+  for (auto& [memory, usage] : per_memory_) {
+    logger.print("  memory " IDFMT " (%s): %llu live bytes, %llu high water (capacity %zd)",
+                 memory.id,
+                 memory_kinds[memory.kind()],
+                 (unsigned long long)usage.live,
+                 (unsigned long long)usage.high_water,
+                 memory.capacity());
+    for (auto& [key, lib_usage] : per_library_) {
+      if (key.second != memory) continue;
+      logger.print("    %s: %llu live bytes, %llu high water",
+                   key.first.c_str(),
+                   (unsigned long long)lib_usage.live,
+                   (unsigned long long)lib_usage.high_water);
+    }
+  }
+}
+
+/*static*/ MemoryUsageTracker* MemoryUsageTracker::get_tracker()
+{
+  static MemoryUsageTracker* tracker{nullptr};
+
+  if (nullptr == tracker) tracker = new MemoryUsageTracker();
+  return tracker;
+}
+
+}  // namespace mapping
+}  // namespace legate
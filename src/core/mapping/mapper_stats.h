@@ -0,0 +1,102 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "legion.h"
+
+namespace legate {
+namespace mapping {
+
+// Process-wide counters for the hot paths in the mappers. Increments are plain atomic bumps so
+// the instrumented paths stay cheap; the totals are only read at shutdown or when queried
+// through a tunable.
+struct MapperStats {
+ public:
+  // Instance cache lookups in InstanceManager::find_instance
+  std::atomic<uint64_t> find_instance_hits{0};
+  std::atomic<uint64_t> find_instance_misses{0};
+  // Region groups merged in InstanceSet::construct_overlapping_region_group
+  std::atomic<uint64_t> group_consolidations{0};
+  // Instance creations in BaseMapper::map_legate_store that failed even after eviction
+  std::atomic<uint64_t> allocation_failures{0};
+  // Mapper-to-mapper messages received in BaseMapper::handle_message
+  std::atomic<uint64_t> messages_handled{0};
+
+ public:
+  void dump(Legion::Logger& logger) const;
+
+ public:
+  static MapperStats* get_mapper_stats();
+};
+
+// Process-wide accounting of instances created by the library mappers: live bytes and
+// high-water mark per memory, attributed to the library whose mapper created each instance.
+// Allocations and deallocations are rare relative to cache lookups, so a plain mutex is enough
+// here; the hot find_instance path never touches the tracker.
+class MemoryUsageTracker {
+ public:
+  using Instance = Legion::Mapping::PhysicalInstance;
+  using Memory   = Legion::Memory;
+
+ public:
+  void record_allocation(const std::string& library,
+                         const Instance& instance,
+                         Memory memory,
+                         size_t size);
+  // Deallocations need no library argument; the tracker remembers which library created the
+  // instance, so instances handed across libraries by the shared instance managers are still
+  // attributed to their creator. Instances the tracker never saw are silently ignored
+  void record_deallocation(const Instance& instance);
+
+ public:
+  uint64_t live_bytes(Memory::Kind kind) const;
+  uint64_t high_water_mark(Memory::Kind kind) const;
+
+ public:
+  // Prints per-memory live/high-water totals and the per-library breakdown
+  void dump(Legion::Logger& logger) const;
+
+ public:
+  static MemoryUsageTracker* get_tracker();
+
+ private:
+  struct Usage {
+    uint64_t live{0};
+    uint64_t high_water{0};
+  };
+  struct Record {
+    std::string library{};
+    Memory memory{Memory::NO_MEMORY};
+    size_t size{0};
+  };
+
+ private:
+  mutable std::mutex lock_{};
+  std::map<Memory, Usage> per_memory_{};
+  std::map<std::pair<std::string, Memory>, Usage> per_library_{};
+  std::map<Instance, Record> live_instances_{};
+};
+
+}  // namespace mapping
+}  // namespace legate
@@ -0,0 +1,91 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "core/mapping/mapper_trace.h"
+#include "core/runtime/runtime.h"
+#include "env_defaults.h"
+
+#include "realm/network.h"
+
+namespace legate {
+namespace mapping {
+
+MapperTracer::Scope::Scope(const char* name)
+  : name_(name), begin_us_(Core::trace_mapping ? Realm::Clock::current_time_in_microseconds() : 0)
+{
+}
+
+MapperTracer::Scope::~Scope()
+{
+  if (!Core::trace_mapping) return;
+  get_tracer()->record(name_, begin_us_, Realm::Clock::current_time_in_microseconds());
+}
+
+void MapperTracer::record(const char* name, uint64_t begin_us, uint64_t end_us)
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  if (events_.empty()) {
+    const size_t capacity = extract_env(
+      "LEGATE_MAPPING_TRACE_EVENTS", MAPPING_TRACE_EVENTS_DEFAULT, MAPPING_TRACE_EVENTS_TEST);
+    events_.resize(std::max<size_t>(capacity, 1));
+  }
+  events_[next_] = Event{name, begin_us, end_us};
+  if (++next_ == events_.size()) {
+    next_    = 0;
+    wrapped_ = true;
+  }
+}
+
+void MapperTracer::dump() const
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  if (0 == next_ && !wrapped_) return;
+
+  const auto node_id = Realm::Network::my_node_id;
+  std::stringstream filename;
+  filename << "legate_mapping_trace_" << node_id << ".json";
+  std::ofstream out(filename.str());
+  if (!out) return;
+
+  // The ring buffer keeps the most recent events; when it wrapped, the oldest event sits at
+  // next_ rather than at the front
+  const size_t count = wrapped_ ? events_.size() : next_;
+  const size_t start = wrapped_ ? next_ : 0;
+  out << "{\"traceEvents\":[";
+  for (size_t idx = 0; idx < count; ++idx) {
+    const auto& event = events_[(start + idx) % events_.size()];
+    if (idx > 0) out << ",";
+    out << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":" << node_id
+        << ",\"tid\":0,\"ts\":" << event.begin_us << ",\"dur\":" << event.end_us - event.begin_us
+        << "}";
+  }
+  out << "]}";
+}
+
+/*static*/ MapperTracer* MapperTracer::get_tracer()
+{
+  static MapperTracer* tracer{nullptr};
+
+  if (nullptr == tracer) tracer = new MapperTracer();
+  return tracer;
+}
+
+}  // namespace mapping
+}  // namespace legate
@@ -0,0 +1,67 @@
+/* Copyright 2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "legion.h"
+
+namespace legate {
+namespace mapping {
+
+// A lightweight tracer for the mapping pipeline. Mapper entry points record begin/end
+// timestamps into a fixed-size per-node ring buffer, which gets dumped as Chrome trace-event
+// JSON at shutdown. Unlike Legion Spy, this is cheap enough to leave on in production runs;
+// it is toggled by LEGATE_MAPPING_TRACE (see Core::parse_config).
+class MapperTracer {
+ public:
+  struct Event {
+    // Name of the mapper entry point; must be a string literal
+    const char* name{nullptr};
+    uint64_t begin_us{0};
+    uint64_t end_us{0};
+  };
+
+ public:
+  // RAII guard that records one event spanning its own lifetime. A no-op when tracing is off.
+  class Scope {
+   public:
+    Scope(const char* name);
+    ~Scope();
+
+   private:
+    const char* name_;
+    uint64_t begin_us_;
+  };
+
+ public:
+  void record(const char* name, uint64_t begin_us, uint64_t end_us);
+  void dump() const;
+
+ public:
+  static MapperTracer* get_tracer();
+
+ private:
+  mutable std::mutex lock_;
+  std::vector<Event> events_;
+  size_t next_{0};
+  bool wrapped_{false};
+};
+
+}  // namespace mapping
+}  // namespace legate
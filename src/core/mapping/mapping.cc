@@ -23,6 +23,33 @@
 namespace legate {
 namespace mapping {
 
+namespace {
+
+// C and Fortran dimension orderings depend only on the store's dimension, so the vectors are
+// built once per dimension instead of being regenerated on every mapper call. The tables are
+// thread-local because different mappers may run on different processor threads.
+const std::vector<Legion::DimensionKind>& c_dimension_ordering(int32_t dim)
+{
+  static thread_local std::vector<Legion::DimensionKind> orderings[LEGION_MAX_DIM + 1];
+  auto& ordering = orderings[dim];
+  if (ordering.empty() && dim > 0)
+    for (int32_t idx = dim - 1; idx >= 0; --idx)
+      ordering.push_back(static_cast<Legion::DimensionKind>(DIM_X + idx));
+  return ordering;
+}
+
+const std::vector<Legion::DimensionKind>& fortran_dimension_ordering(int32_t dim)
+{
+  static thread_local std::vector<Legion::DimensionKind> orderings[LEGION_MAX_DIM + 1];
+  auto& ordering = orderings[dim];
+  if (ordering.empty() && dim > 0)
+    for (int32_t idx = 0; idx < dim; ++idx)
+      ordering.push_back(static_cast<Legion::DimensionKind>(DIM_X + idx));
+  return ordering;
+}
+
+}  // namespace
+
 DimOrdering::DimOrdering(Kind _kind, std::vector<int32_t>&& _dims)
   : kind(_kind), dims(std::forward<decltype(dims)>(_dims))
 {
@@ -62,15 +89,13 @@ void DimOrdering::populate_dimension_ordering(const Store& store,
   assert(!relative);
   switch (kind) {
     case Kind::C: {
-      auto dim = store.region_field().dim();
-      for (int32_t idx = dim - 1; idx >= 0; --idx)
-        ordering.push_back(static_cast<Legion::DimensionKind>(DIM_X + idx));
+      auto& cached = c_dimension_ordering(store.region_field().dim());
+      ordering.insert(ordering.end(), cached.begin(), cached.end());
       break;
     }
     case Kind::FORTRAN: {
-      auto dim = store.region_field().dim();
-      for (int32_t idx = 0; idx < dim; ++idx)
-        ordering.push_back(static_cast<Legion::DimensionKind>(DIM_X + idx));
+      auto& cached = fortran_dimension_ordering(store.region_field().dim());
+      ordering.insert(ordering.end(), cached.begin(), cached.end());
       break;
     }
     case Kind::CUSTOM: {
@@ -84,14 +109,15 @@ void DimOrdering::set_c_order() { kind = Kind::C; }
 
 void DimOrdering::set_fortran_order() { kind = Kind::FORTRAN; }
 
-void DimOrdering::set_custom_order(std::vector<int32_t>&& dims)
+void DimOrdering::set_custom_order(std::vector<int32_t>&& _dims)
 {
   kind = Kind::CUSTOM;
-  dims = std::forward<std::vector<int32_t>&&>(dims);
+  dims = std::move(_dims);
 }
 
 bool InstanceMappingPolicy::operator==(const InstanceMappingPolicy& other) const
 {
+  // the usage profile is advisory and doesn't make instances incompatible
   return target == other.target && allocation == other.allocation && layout == other.layout &&
          exact == other.exact && ordering == other.ordering;
 }
@@ -194,6 +220,24 @@ std::set<const Legion::RegionRequirement*> StoreMapping::requirements() const
   return std::move(reqs);
 }
 
+void StoreMapping::declare_access_order(std::vector<int32_t>&& dims)
+{
+#ifdef DEBUG_LEGATE
+  assert(!stores.empty());
+  // The declared traversal must name every dimension of the stores exactly once
+  std::vector<bool> seen(stores.front().get().dim(), false);
+  for (auto idx : dims) {
+    assert(idx >= 0 && idx < static_cast<int32_t>(seen.size()));
+    assert(!seen[idx]);
+    seen[idx] = true;
+  }
+  assert(dims.size() == seen.size());
+#endif
+  // The ordering constraint also lists dimensions fastest-varying first, so the declared
+  // traversal maps onto a custom dimension ordering directly
+  policy.ordering.set_custom_order(std::move(dims));
+}
+
 void StoreMapping::populate_layout_constraints(
   Legion::LayoutConstraintSet& layout_constraints) const
 {
@@ -225,5 +269,24 @@ void StoreMapping::populate_layout_constraints(
   return std::move(mapping);
 }
 
+/*static*/ StoreMapping StoreMapping::colocate(
+  std::vector<std::reference_wrapper<const Store>>&& stores,
+  StoreTarget target,
+  InstLayout layout,
+  bool exact)
+{
+#ifdef DEBUG_LEGATE
+  assert(!stores.empty());
+  auto& first_store = stores.front();
+  for (auto it = stores.begin() + 1; it != stores.end(); ++it)
+    assert(it->get().can_colocate_with(first_store));
+#endif
+  StoreMapping mapping{};
+  mapping.policy        = InstanceMappingPolicy::default_policy(target, exact);
+  mapping.policy.layout = layout;
+  mapping.stores        = std::move(stores);
+  return std::move(mapping);
+}
+
 }  // namespace mapping
 }  // namespace legate
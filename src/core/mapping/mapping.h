@@ -91,6 +91,16 @@ enum class AllocPolicy : int32_t {
    * @brief Indicates the store must be mapped to a fresh instance
    */
   MUST_ALLOC = 2,
+  /**
+   * @brief Indicates the store should not be materialized to a physical instance at all.
+   *
+   * Virtual mapping is for stores that a task merely passes through: the runtime serves
+   * reads through composite views of existing instances, saving both the memory and the
+   * copy that materialization would cost. Only region-backed stores can be mapped
+   * virtually; futures, unbound stores, and reduction requirements always need physical
+   * instances.
+   */
+  VIRTUAL = 3,
 };
 
 /**
@@ -109,6 +119,32 @@ enum class InstLayout : int32_t {
   AOS = 2,
 };
 
+/**
+ * @ingroup mapping
+ * @brief An enum class for expected store usage profiles
+ *
+ * Usage profiles are advisory: they let a library that knows its access patterns ahead of
+ * time steer instance policy decisions the mapper would otherwise converge on reactively
+ * over several remaps. They never affect whether two policies are considered equivalent.
+ */
+enum class UsageProfile : int32_t {
+  /**
+   * @brief No declared access pattern; the mapper uses its reactive heuristics
+   */
+  DEFAULT = 1,
+  /**
+   * @brief The store is written in full once and then only read. The mapper requests an
+   * exact instance on first touch, instead of discovering via failed mappings that a tight
+   * instance is needed to invalidate bloated ones
+   */
+  WRITE_ONCE = 2,
+  /**
+   * @brief The store receives many partial updates or reductions. The mapper keeps the
+   * policy lenient and never tightens it, so the shared instance survives across updates
+   */
+  ACCUMULATE = 3,
+};
+
 /**
  * @ingroup mapping
  * @brief A descriptor for dimension ordering
@@ -239,6 +275,12 @@ struct InstanceMappingPolicy {
    * must not have any extra elements not included in the store(s).
    */
   bool exact{false};
+  /**
+   * @brief Expected usage profile for the store(s). Advisory only: it steers how the
+   * mapper picks and adjusts the other policy fields but is ignored by policy equality
+   * and subsumption checks.
+   */
+  UsageProfile profile{UsageProfile::DEFAULT};
 
  public:
   InstanceMappingPolicy() {}
@@ -331,6 +373,21 @@ struct StoreMapping {
    */
   std::set<const Legion::RegionRequirement*> requirements() const;
 
+ public:
+  /**
+   * @brief Declares the order in which the task traverses the stores' dimensions and lays
+   * the instance out to match
+   *
+   * Kernels that iterate an instance against its layout (e.g. column-major reads through a
+   * row-major instance) run at a fraction of memory bandwidth; declaring the traversal gives
+   * them an instance whose leading dimension is the innermost loop. The hint applies to all
+   * stores of the mapping, must name every dimension of their domain exactly once, and is
+   * expressed in the root store's coordinate space, like a custom dimension ordering.
+   *
+   * @param dims Dimension indices in traversal order, fastest-varying dimension first
+   */
+  void declare_access_order(std::vector<int32_t>&& dims);
+
  private:
   friend class BaseMapper;
   void populate_layout_constraints(Legion::LayoutConstraintSet& layout_constraints) const;
@@ -346,6 +403,29 @@ struct StoreMapping {
    * @return A `StoreMapping` object
    */
   static StoreMapping default_mapping(const Store& store, StoreTarget target, bool exact = false);
+  /**
+   * @brief Creates a `StoreMapping` object that maps a group of stores into one multi-field
+   * instance
+   *
+   * Stores that are always touched together per element (a struct-of-arrays workload) pay one
+   * cache-unfriendly walk per store when each maps to its own instance. Declaring them as a
+   * colocation group maps them into a single instance holding all of their fields; `layout`
+   * picks where the field dimension goes: `InstLayout::AOS` interleaves the fields per element,
+   * `InstLayout::SOA` keeps each field's elements contiguous. All stores must be region-backed,
+   * come from the same region tree, and, if reductions, use the same reduction operator;
+   * futures and unbound stores cannot be colocated.
+   *
+   * @param stores Stores that make up the colocation group
+   * @param target Target memory type for the instance
+   * @param layout Field layout for the instance
+   * @param exact Indicates whether the policy should request an exact instance
+   *
+   * @return A `StoreMapping` object
+   */
+  static StoreMapping colocate(std::vector<std::reference_wrapper<const Store>>&& stores,
+                               StoreTarget target,
+                               InstLayout layout,
+                               bool exact = false);
 };
 
 /**
@@ -15,19 +15,63 @@
  */
 
 #include "core/mapping/operation.h"
+
+#include <deque>
+#include <unordered_map>
+
 #include "core/runtime/context.h"
 #include "core/utilities/deserializer.h"
 
 namespace legate {
 namespace mapping {
 
+namespace {
+
+struct MappableHeader {
+  MachineDesc machine_desc{};
+  uint32_t sharding_id{0};
+};
+
+// Legion consults the mapper about one operation several times (sharding, task options,
+// slicing, mapping), and each callback used to re-parse the machine descriptor from the
+// mapper data blob. Parsed headers are cached keyed by the operation's unique id. Callbacks
+// for one operation are temporally clustered, so a bounded window of recent operations is
+// enough; older entries are dropped in insertion order, as the mapper interface has no
+// per-operation teardown hook to evict on. Each handler thread has its own cache, so no
+// locking is needed.
+constexpr size_t HEADER_CACHE_CAPACITY = 128;
+
+const MappableHeader& find_mappable_header(const Legion::Mappable* mappable)
+{
+  static thread_local std::unordered_map<Legion::UniqueID, MappableHeader> cache;
+  static thread_local std::deque<Legion::UniqueID> insertion_order;
+
+  auto uid    = mappable->get_unique_id();
+  auto finder = cache.find(uid);
+  if (finder != cache.end()) return finder->second;
+
+  MapperDataDeserializer dez(mappable);
+  MappableHeader header;
+  header.machine_desc = dez.unpack<MachineDesc>();
+  header.sharding_id  = dez.unpack<uint32_t>();
+
+  if (insertion_order.size() >= HEADER_CACHE_CAPACITY) {
+    cache.erase(insertion_order.front());
+    insertion_order.pop_front();
+  }
+  insertion_order.push_back(uid);
+  return cache.emplace(uid, std::move(header)).first->second;
+}
+
+}  // namespace
+
 Mappable::Mappable() {}
 
 Mappable::Mappable(const Legion::Mappable* mappable)
 {
-  MapperDataDeserializer dez(mappable);
-  machine_desc_ = dez.unpack<MachineDesc>();
-  sharding_id_  = dez.unpack<uint32_t>();
+  auto& header  = find_mappable_header(mappable);
+  machine_desc_ = header.machine_desc;
+  sharding_id_  = header.sharding_id;
 }
 
 Task::Task(const Legion::Task* task,
@@ -36,11 +80,49 @@ Task::Task(const Legion::Task* task,
            const Legion::Mapping::MapperContext context)
   : Mappable(task), task_(task), library_(library)
 {
+  model_ = find_parsed_model(task, runtime, context);
+}
+
+// Same recipe as the header cache above, applied to the full task model: sharding, slicing,
+// and mapping all examine the same launch, and re-deserializing the store metadata for every
+// callback was the bulk of the mapper's parsing work
+constexpr size_t MODEL_CACHE_CAPACITY = 128;
+
+/*static*/ std::shared_ptr<Task::ParsedModel> Task::find_parsed_model(
+  const Legion::Task* task,
+  Legion::Mapping::MapperRuntime* runtime,
+  const Legion::Mapping::MapperContext context)
+{
+  static thread_local std::unordered_map<Legion::UniqueID, std::shared_ptr<ParsedModel>> cache;
+  static thread_local std::deque<Legion::UniqueID> insertion_order;
+
+  auto uid    = task->get_unique_id();
+  auto finder = cache.find(uid);
+  if (finder != cache.end()) {
+    auto& model = finder->second;
+    // Stores cache requirement pointers and the mapper context, which are only valid within
+    // the callback that parsed them, so a hit re-binds them to the current one. Scalars alias
+    // the launch's argument buffer, which is stable for the operation's lifetime.
+    for (auto& store : model->inputs) store.remap(runtime, context, task);
+    for (auto& store : model->outputs) store.remap(runtime, context, task);
+    for (auto& store : model->reductions) store.remap(runtime, context, task);
+    return model;
+  }
+
+  auto model = std::make_shared<ParsedModel>();
   TaskDeserializer dez(task, runtime, context);
-  inputs_     = dez.unpack<std::vector<Store>>();
-  outputs_    = dez.unpack<std::vector<Store>>();
-  reductions_ = dez.unpack<std::vector<Store>>();
-  scalars_    = dez.unpack<std::vector<Scalar>>();
+  model->inputs     = dez.unpack<std::vector<Store>>();
+  model->outputs    = dez.unpack<std::vector<Store>>();
+  model->reductions = dez.unpack<std::vector<Store>>();
+  model->scalars    = dez.unpack<std::vector<Scalar>>();
+
+  if (insertion_order.size() >= MODEL_CACHE_CAPACITY) {
+    cache.erase(insertion_order.front());
+    insertion_order.pop_front();
+  }
+  insertion_order.push_back(uid);
+  cache.emplace(uid, model);
+  return model;
 }
 
 int64_t Task::task_id() const { return library_->get_local_task_id(task_->task_id); }
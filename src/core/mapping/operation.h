@@ -77,19 +77,19 @@ class Task : public Mappable {
    *
    * @return Vector of store metadata objects
    */
-  const std::vector<Store>& inputs() const { return inputs_; }
+  const std::vector<Store>& inputs() const { return model_->inputs; }
   /**
    * @brief Returns metadata for the task's output stores
    *
    * @return Vector of store metadata objects
    */
-  const std::vector<Store>& outputs() const { return outputs_; }
+  const std::vector<Store>& outputs() const { return model_->outputs; }
   /**
    * @brief Returns metadata for the task's reduction stores
    *
    * @return Vector of store metadata objects
    */
-  const std::vector<Store>& reductions() const { return reductions_; }
+  const std::vector<Store>& reductions() const { return model_->reductions; }
   /**
    * @brief Returns the vector of the task's by-value arguments. Unlike `mapping::Store`
    * objects that have no access to data in the stores, the returned `Scalar` objects
@@ -97,7 +97,7 @@ class Task : public Mappable {
    *
    * @return Vector of `Scalar` objects
    */
-  const std::vector<Scalar>& scalars() const { return scalars_; }
+  const std::vector<Scalar>& scalars() const { return model_->scalars; }
 
  public:
   /**
@@ -115,8 +115,17 @@ class Task : public Mappable {
   const Legion::Task* task_;
 
  private:
-  std::vector<Store> inputs_, outputs_, reductions_;
-  std::vector<Scalar> scalars_;
+  // The parsed operation model is shared across all mapper callbacks that examine the same
+  // launch (sharding, slicing, mapping), so each launch is deserialized exactly once
+  struct ParsedModel {
+    std::vector<Store> inputs, outputs, reductions;
+    std::vector<Scalar> scalars;
+  };
+  static std::shared_ptr<ParsedModel> find_parsed_model(
+    const Legion::Task* task,
+    Legion::Mapping::MapperRuntime* runtime,
+    const Legion::Mapping::MapperContext context);
+  std::shared_ptr<ParsedModel> model_;
 };
 
 class Copy : public Mappable {
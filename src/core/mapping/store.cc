@@ -16,9 +16,25 @@
 
 #include "core/mapping/store.h"
 
+#include <unordered_map>
+
 namespace legate {
 namespace mapping {
 
+namespace {
+
+// Index space domains are immutable once created, but every mapper call re-queries them
+// through the mapper runtime, which is the expensive part of recomputing store metadata for
+// repeated launches. Mapper calls run on the mapper's own processor thread, so a
+// thread-local cache needs no locking.
+std::unordered_map<Legion::IndexSpaceID, Domain>& get_domain_cache()
+{
+  static thread_local std::unordered_map<Legion::IndexSpaceID, Domain> cache{};
+  return cache;
+}
+
+}  // namespace
+
 RegionField::RegionField(const Legion::RegionRequirement* req,
                          int32_t dim,
                          uint32_t idx,
@@ -37,7 +53,13 @@ bool RegionField::can_colocate_with(const RegionField& other) const
 Domain RegionField::domain(Legion::Mapping::MapperRuntime* runtime,
                            const Legion::Mapping::MapperContext context) const
 {
-  return runtime->get_index_space_domain(context, get_index_space());
+  auto index_space = get_index_space();
+  auto& cache      = get_domain_cache();
+  auto finder      = cache.find(index_space.get_id());
+  if (finder != cache.end()) return finder->second;
+  auto domain = runtime->get_index_space_domain(context, index_space);
+  cache[index_space.get_id()] = domain;
+  return domain;
 }
 
 Legion::IndexSpace RegionField::get_index_space() const { return req_->region.get_index_space(); }
@@ -47,7 +69,7 @@ FutureWrapper::FutureWrapper(uint32_t idx, const Domain& domain) : idx_(idx), do
 Domain FutureWrapper::domain() const { return domain_; }
 
 Store::Store(int32_t dim,
-             std::unique_ptr<Type> type,
+             std::shared_ptr<const Type> type,
              FutureWrapper future,
              std::shared_ptr<TransformStack>&& transform)
   : is_future_(true),
@@ -63,7 +85,7 @@ Store::Store(int32_t dim,
 Store::Store(Legion::Mapping::MapperRuntime* runtime,
              const Legion::Mapping::MapperContext context,
              int32_t dim,
-             std::unique_ptr<Type> type,
+             std::shared_ptr<const Type> type,
              int32_t redop_id,
              const RegionField& region_field,
              bool is_unbound_store,
@@ -127,6 +149,18 @@ uint32_t Store::requirement_index() const { return region_field().index(); }
 
 uint32_t Store::future_index() const { return future().index(); }
 
+void Store::remap(Legion::Mapping::MapperRuntime* runtime,
+                  const Legion::Mapping::MapperContext context,
+                  const Legion::Task* task)
+{
+  runtime_ = runtime;
+  context_ = context;
+  if (is_future_) return;
+  auto idx = region_field_.index();
+  region_field_.set_requirement(is_unbound_store_ ? &task->output_regions[idx]
+                                                  : &task->regions[idx]);
+}
+
 Domain Store::domain() const
 {
   assert(!unbound());
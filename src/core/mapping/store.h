@@ -60,6 +60,7 @@ class RegionField {
 
  public:
   const Legion::RegionRequirement* get_requirement() const { return req_; }
+  void set_requirement(const Legion::RegionRequirement* req) { req_ = req; }
   Legion::IndexSpace get_index_space() const;
 
  private:
@@ -101,13 +102,13 @@ class Store {
  public:
   Store() {}
   Store(int32_t dim,
-        std::unique_ptr<Type> type,
+        std::shared_ptr<const Type> type,
         FutureWrapper future,
         std::shared_ptr<TransformStack>&& transform = nullptr);
   Store(Legion::Mapping::MapperRuntime* runtime,
         const Legion::Mapping::MapperContext context,
         int32_t dim,
-        std::unique_ptr<Type> type,
+        std::shared_ptr<const Type> type,
         int32_t redop_id,
         const RegionField& region_field,
         bool is_unbound_store                       = false,
@@ -180,6 +181,15 @@ class Store {
   uint32_t requirement_index() const;
   uint32_t future_index() const;
 
+ public:
+  // Re-points the store at the current mapper callback's state. Parsed stores are cached
+  // across mapper invocations for the same operation, but the requirement pointer and the
+  // mapper context they hold are only valid within the callback that parsed them, so a cache
+  // hit re-binds them before the store is used again
+  void remap(Legion::Mapping::MapperRuntime* runtime,
+             const Legion::Mapping::MapperContext context,
+             const Legion::Task* task);
+
  public:
   /**
    * @brief Returns the store's domain
@@ -202,7 +212,7 @@ class Store {
   bool is_future_{false};
   bool is_unbound_store_{false};
   int32_t dim_{-1};
-  std::unique_ptr<Type> type_{nullptr};
+  std::shared_ptr<const Type> type_{nullptr};
   int32_t redop_id_{-1};
 
  private:
@@ -14,6 +14,12 @@
  *
  */
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include "legion.h"
 
 #include "core/data/buffer.h"
@@ -53,6 +59,8 @@ LibraryContext::LibraryContext(const std::string& library_name,
 {
   task_scope_ = ResourceIdScope(
     runtime_->generate_library_task_ids(library_name.c_str(), config.max_tasks), config.max_tasks);
+  // Task ids are dense within the scope, so the task table is indexed directly by them
+  tasks_.resize(config.max_tasks);
   redop_scope_ = ResourceIdScope(
     runtime_->generate_library_reduction_ids(library_name.c_str(), config.max_reduction_ops),
     config.max_reduction_ops);
@@ -160,55 +168,244 @@ void LibraryContext::register_task(int64_t local_task_id, std::unique_ptr<TaskIn
   log_legate.debug() << "[" << library_name_ << "] task " << local_task_id
                      << " (global id: " << task_id << "), " << *task_info;
 #endif
-  task_info->register_task(task_id);
-  tasks_.emplace(std::make_pair(local_task_id, std::move(task_info)));
+  task_info->register_task(runtime_, task_id);
+  tasks_[local_task_id] = std::move(task_info);
+}
+
+void LibraryContext::register_tasks(
+  std::vector<std::pair<int64_t, std::unique_ptr<TaskInfo>>>&& task_infos)
+{
+  // Resolve and validate all task ids before the first Legion call so an invalid id
+  // doesn't leave the batch half-registered
+  std::vector<Legion::TaskID> task_ids;
+  task_ids.reserve(task_infos.size());
+  for (auto& [local_task_id, task_info] : task_infos) {
+    auto task_id = get_task_id(local_task_id);
+    if (!task_scope_.in_scope(task_id))
+      throw InvalidTaskIdException(library_name_, local_task_id, task_scope_.size() - 1);
+    task_ids.push_back(task_id);
+  }
+
+  for (uint32_t idx = 0; idx < task_infos.size(); ++idx) {
+    auto& [local_task_id, task_info] = task_infos[idx];
+#ifdef DEBUG_LEGATE
+    log_legate.debug() << "[" << library_name_ << "] task " << local_task_id
+                       << " (global id: " << task_ids[idx] << "), " << *task_info;
+#endif
+    task_info->register_task(runtime_, task_ids[idx]);
+    tasks_[local_task_id] = std::move(task_info);
+  }
 }
 
 const TaskInfo* LibraryContext::find_task(int64_t local_task_id) const
 {
-  auto finder = tasks_.find(local_task_id);
-  return tasks_.end() == finder ? nullptr : finder->second.get();
+  if (local_task_id < 0 || local_task_id >= static_cast<int64_t>(tasks_.size())) return nullptr;
+  return tasks_[local_task_id].get();
+}
+
+std::vector<const TaskInfo*> LibraryContext::find_tasks(
+  const std::vector<int64_t>& local_task_ids) const
+{
+  std::vector<const TaskInfo*> result;
+  result.reserve(local_task_ids.size());
+  for (auto local_task_id : local_task_ids) result.push_back(find_task(local_task_id));
+  return result;
 }
 
+bool LibraryContext::is_fusable_task(int64_t local_task_id, LegateVariantCode vid) const
+{
+  auto* task_info = find_task(local_task_id);
+  if (nullptr == task_info) return false;
+  auto* variant = task_info->find_variant(vid);
+  return variant != nullptr && variant->options.fusable;
+}
+
+namespace {
+
+// Cached structure of a task argument blob. Repeated launches of a task ship byte-identical
+// blobs (in index launches every point task even shares the same one), so the structural
+// information recovered by the first full deserialization, namely the store and scalar
+// layouts, is cached and replayed by later invocations against their own regions and
+// futures, skipping the type and transform re-walks of a full parse.
+struct CachedTaskArgs {
+  std::vector<StoreArgRecord> inputs{};
+  std::vector<StoreArgRecord> outputs{};
+  std::vector<StoreArgRecord> reductions{};
+  std::vector<ScalarArgRecord> scalars{};
+  bool can_raise_exception{false};
+  bool is_index_space{false};
+  bool insert_barrier{false};
+  uint32_t num_comms{0};
+  // Copy of the blob the records were taken from, compared on every hit to guard against
+  // hash collisions
+  std::vector<int8_t> args{};
+};
+
+uint64_t hash_task_args(Legion::TaskID task_id, const void* args, size_t arglen)
+{
+  // FNV-1a over the task id and the raw blob
+  uint64_t result = 0xcbf29ce484222325ULL;
+  auto fold       = [&result](const void* data, size_t size) {
+    auto* ptr = static_cast<const uint8_t*>(data);
+    for (size_t idx = 0; idx < size; ++idx) result = (result ^ ptr[idx]) * 0x00000100000001b3ULL;
+  };
+  fold(&task_id, sizeof(task_id));
+  fold(args, arglen);
+  return result;
+}
+
+// Crude bound on the cache size, like the mapper's plan cache. Scalar values are part of the
+// blob, so a workload whose scalars change every launch (loop counters, relaxation factors,
+// shrinking extents) keeps generating fresh entries; without the bound each one would pin a
+// full blob copy for the life of the process.
+constexpr size_t LAYOUT_CACHE_CAPACITY = 1024;
+
+std::mutex layout_cache_lock{};
+std::unordered_map<uint64_t, std::shared_ptr<const CachedTaskArgs>> layout_cache{};
+
+// Returns the cached layout for the key, or null when there is none or the entry was taken
+// from a different blob. The returned reference keeps the entry alive even if the cache gets
+// cleared while the caller is still replaying it.
+std::shared_ptr<const CachedTaskArgs> find_cached_args(uint64_t key, const Legion::Task* task)
+{
+  const std::lock_guard<std::mutex> lock(layout_cache_lock);
+  auto finder = layout_cache.find(key);
+  if (layout_cache.end() == finder) return nullptr;
+  auto& entry = *finder->second;
+  if (entry.is_index_space != task->is_index_space || entry.args.size() != task->arglen ||
+      memcmp(entry.args.data(), task->args, task->arglen) != 0)
+    return nullptr;
+  return finder->second;
+}
+
+void record_cached_args(uint64_t key, CachedTaskArgs&& entry)
+{
+  const std::lock_guard<std::mutex> lock(layout_cache_lock);
+  if (layout_cache.size() >= LAYOUT_CACHE_CAPACITY) layout_cache.clear();
+  layout_cache.try_emplace(key, std::make_shared<const CachedTaskArgs>(std::move(entry)));
+}
+
+// Vector storage recycled across TaskContext constructions. Each Realm processor executes
+// its tasks on a dedicated thread, so thread-local pooling reuses capacity across
+// back-to-back task executions on the same processor without any synchronization; in
+// steady state context setup performs no heap allocation for these collections.
+struct ContextArena {
+  std::vector<Store> inputs{};
+  std::vector<Store> outputs{};
+  std::vector<Store> reductions{};
+  std::vector<Scalar> scalars{};
+  std::vector<comm::Communicator> comms{};
+};
+
+ContextArena& get_context_arena()
+{
+  static thread_local ContextArena arena{};
+  return arena;
+}
+
+}  // namespace
+
 TaskContext::TaskContext(const Legion::Task* task,
                          const std::vector<Legion::PhysicalRegion>& regions,
                          Legion::Context context,
                          Legion::Runtime* runtime)
   : task_(task), regions_(regions), context_(context), runtime_(runtime)
 {
+  {
+    // Borrow the pooled vectors so steady-state context setup reuses their capacity
+    auto& arena = get_context_arena();
+    inputs_     = std::move(arena.inputs);
+    outputs_    = std::move(arena.outputs);
+    reductions_ = std::move(arena.reductions);
+    scalars_    = std::move(arena.scalars);
+    comms_      = std::move(arena.comms);
+  }
+
   {
     mapping::MapperDataDeserializer dez(task);
     machine_desc_ = dez.unpack<mapping::MachineDesc>();
   }
 
-  TaskDeserializer dez(task, regions);
-  inputs_     = dez.unpack<std::vector<Store>>();
-  outputs_    = dez.unpack<std::vector<Store>>();
-  reductions_ = dez.unpack<std::vector<Store>>();
-  scalars_    = dez.unpack<std::vector<Scalar>>();
+  auto cache_key = hash_task_args(task->task_id, task->args, task->arglen);
+  auto cached    = find_cached_args(cache_key, task);
 
-  can_raise_exception_ = dez.unpack<bool>();
+  TaskDeserializer dez(task, regions);
 
   bool insert_barrier = false;
   Legion::PhaseBarrier arrival, wait;
-  if (task->is_index_space) {
-    insert_barrier = dez.unpack<bool>();
-    if (insert_barrier) {
-      arrival = dez.unpack<Legion::PhaseBarrier>();
-      wait    = dez.unpack<Legion::PhaseBarrier>();
+  if (nullptr != cached) {
+    auto replay_stores = [&dez](auto& records, auto& stores) {
+      stores.reserve(records.size());
+      for (auto& record : records) stores.push_back(dez.replay_store(record));
+    };
+    replay_stores(cached->inputs, inputs_);
+    replay_stores(cached->outputs, outputs_);
+    replay_stores(cached->reductions, reductions_);
+    scalars_.reserve(cached->scalars.size());
+    for (auto& record : cached->scalars) scalars_.push_back(dez.replay_scalar(record));
+
+    can_raise_exception_ = cached->can_raise_exception;
+    if (task->is_index_space) {
+      insert_barrier = cached->insert_barrier;
+      // Barriers and communicators travel in futures, which are per-invocation, so they
+      // are popped off this invocation's future list in the packing order
+      if (insert_barrier) {
+        arrival = dez.unpack<Legion::PhaseBarrier>();
+        wait    = dez.unpack<Legion::PhaseBarrier>();
+      }
+      comms_.reserve(cached->num_comms);
+      for (uint32_t idx = 0; idx < cached->num_comms; ++idx)
+        comms_.push_back(dez.unpack<comm::Communicator>());
     }
-    comms_ = dez.unpack<std::vector<comm::Communicator>>();
+  } else {
+    CachedTaskArgs entry;
+    auto unpack_stores = [&dez](auto& records, auto& stores) {
+      auto size = dez.unpack<uint32_t>();
+      records.resize(size);
+      stores.reserve(size);
+      for (uint32_t idx = 0; idx < size; ++idx) {
+        Store store;
+        dez.unpack_store(store, &records[idx]);
+        stores.push_back(std::move(store));
+      }
+    };
+    unpack_stores(entry.inputs, inputs_);
+    unpack_stores(entry.outputs, outputs_);
+    unpack_stores(entry.reductions, reductions_);
+    {
+      auto size = dez.unpack<uint32_t>();
+      entry.scalars.resize(size);
+      scalars_.reserve(size);
+      for (uint32_t idx = 0; idx < size; ++idx)
+        scalars_.push_back(dez.unpack_scalar(&entry.scalars[idx]));
+    }
+
+    can_raise_exception_      = dez.unpack<bool>();
+    entry.can_raise_exception = can_raise_exception_;
+    entry.is_index_space      = task->is_index_space;
+    if (task->is_index_space) {
+      insert_barrier = dez.unpack<bool>();
+      if (insert_barrier) {
+        arrival = dez.unpack<Legion::PhaseBarrier>();
+        wait    = dez.unpack<Legion::PhaseBarrier>();
+      }
+      comms_ = dez.unpack<std::vector<comm::Communicator>>();
+
+      entry.insert_barrier = insert_barrier;
+      entry.num_comms      = static_cast<uint32_t>(comms_.size());
+    }
+    entry.args.resize(task->arglen);
+    if (task->arglen > 0) memcpy(entry.args.data(), task->args, task->arglen);
+    record_cached_args(cache_key, std::move(entry));
   }
 
   // For reduction tree cases, some input stores may be mapped to NO_REGION
   // when the number of subregions isn't a multiple of the chosen radix.
   // To simplify the programming mode, we filter out those "invalid" stores out.
-  if (task_->tag == LEGATE_CORE_TREE_REDUCE_TAG) {
-    std::vector<Store> inputs;
-    for (auto& input : inputs_)
-      if (input.valid()) inputs.push_back(std::move(input));
-    inputs_.swap(inputs);
-  }
+  if (task_->tag == LEGATE_CORE_TREE_REDUCE_TAG)
+    inputs_.erase(
+      std::remove_if(inputs_.begin(), inputs_.end(), [](auto& input) { return !input.valid(); }),
+      inputs_.end());
 
   // CUDA drivers < 520 have a bug that causes deadlock under certain circumstances
   // if the application has multiple threads that launch blocking kernels, such as
@@ -231,6 +428,23 @@ TaskContext::TaskContext(const Legion::Task* task,
 #endif
 }
 
+TaskContext::~TaskContext()
+{
+  // Destroy this task's contents but hand the vectors' storage back to the pool so the
+  // next context on this processor starts with warm capacity
+  auto& arena = get_context_arena();
+  inputs_.clear();
+  outputs_.clear();
+  reductions_.clear();
+  scalars_.clear();
+  comms_.clear();
+  arena.inputs     = std::move(inputs_);
+  arena.outputs    = std::move(outputs_);
+  arena.reductions = std::move(reductions_);
+  arena.scalars    = std::move(scalars_);
+  arena.comms      = std::move(comms_);
+}
+
 bool TaskContext::is_single_task() const { return !task_->is_index_space; }
 
 DomainPoint TaskContext::get_task_index() const { return task_->index_point; }
@@ -168,7 +168,16 @@ class LibraryContext {
 
  public:
   void register_task(int64_t local_task_id, std::unique_ptr<TaskInfo> task_info);
+  // Bulk version of register_task that validates all task ids up front and registers the
+  // batch against a single runtime handle
+  void register_tasks(std::vector<std::pair<int64_t, std::unique_ptr<TaskInfo>>>&& task_infos);
   const TaskInfo* find_task(int64_t local_task_id) const;
+  // Batched version of find_task; out-of-range or unregistered ids resolve to null
+  std::vector<const TaskInfo*> find_tasks(const std::vector<int64_t>& local_task_ids) const;
+  // Returns true when the task's variant was registered as fusable (see
+  // VariantOptions::fusable); launch analysis uses this to find windows of consecutive
+  // launches that can execute as one task
+  bool is_fusable_task(int64_t local_task_id, LegateVariantCode vid) const;
 
  private:
   Legion::Runtime* runtime_;
@@ -181,7 +190,9 @@ class LibraryContext {
  private:
   Legion::MapperID mapper_id_;
   std::unique_ptr<mapping::Mapper> mapper_;
-  std::unordered_map<int64_t, std::unique_ptr<TaskInfo>> tasks_;
+  // Task ids are dense small integers within the library's id scope, so the table is
+  // directly indexed by the local task id; unregistered slots hold nulls
+  std::vector<std::unique_ptr<TaskInfo>> tasks_;
 };
 
 /**
@@ -194,6 +205,7 @@ class TaskContext {
               const std::vector<Legion::PhysicalRegion>& regions,
               Legion::Context context,
               Legion::Runtime* runtime);
+  ~TaskContext();
 
  public:
   /**
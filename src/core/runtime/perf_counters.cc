@@ -0,0 +1,84 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdexcept>
+
+#include "core/runtime/perf_counters.h"
+
+namespace legate {
+
+PerfCounters::CounterId PerfCounters::register_counter(const std::string& name)
+{
+  const std::lock_guard<std::mutex> lock(lock_);
+  for (uint32_t idx = 0; idx < names_.size(); ++idx)
+    if (names_[idx] == name) return idx;
+  if (names_.size() >= MAX_COUNTERS)
+    throw std::overflow_error("Exceeded the maximum number of performance counters");
+  names_.push_back(name);
+  return static_cast<CounterId>(names_.size() - 1);
+}
+
+PerfCounters::ThreadBlock* PerfCounters::thread_block()
+{
+  // Each thread resolves its block once; the registry keeps ownership so aggregation can
+  // walk all blocks, including those of threads that have since exited
+  static thread_local ThreadBlock* block{nullptr};
+  if (nullptr == block) {
+    auto owned = std::make_unique<ThreadBlock>();
+    block      = owned.get();
+    const std::lock_guard<std::mutex> lock(lock_);
+    blocks_.push_back(std::move(owned));
+  }
+  return block;
+}
+
+void PerfCounters::add(CounterId id, uint64_t delta)
+{
+#ifdef DEBUG_LEGATE
+  assert(id < MAX_COUNTERS);
+#endif
+  thread_block()->slots[id].value.fetch_add(delta, std::memory_order_relaxed);
+}
+
+uint64_t PerfCounters::read(CounterId id) const
+{
+  const std::lock_guard<std::mutex> lock(lock_);
+  uint64_t total = 0;
+  for (auto& block : blocks_) total += block->slots[id].value.load(std::memory_order_relaxed);
+  return total;
+}
+
+void PerfCounters::dump(Legion::Logger& logger) const
+{
+  const std::lock_guard<std::mutex> lock(lock_);
+  if (names_.empty()) return;
+  logger.print("Performance counters:");
+  for (uint32_t idx = 0; idx < names_.size(); ++idx) {
+    uint64_t total = 0;
+    for (auto& block : blocks_) total += block->slots[idx].value.load(std::memory_order_relaxed);
+    logger.print("  %s: %llu", names_[idx].c_str(), (unsigned long long)total);
+  }
+}
+
+/*static*/ PerfCounters* PerfCounters::get_counters()
+{
+  static PerfCounters* counters{nullptr};
+
+  if (nullptr == counters) counters = new PerfCounters();
+  return counters;
+}
+
+}  // namespace legate
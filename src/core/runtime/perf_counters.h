@@ -0,0 +1,134 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "legion.h"
+
+/**
+ * @file
+ * @brief Shared registry for named performance counters
+ */
+
+namespace legate {
+
+/**
+ * @ingroup runtime
+ * @brief A process-wide registry of named performance counters
+ *
+ * Core subsystems and client libraries register counters by name once and then accumulate
+ * into them from any thread. Each thread owns a cache-line-padded slot per counter, so
+ * increments on hot paths are uncontended relaxed atomic adds with no false sharing;
+ * aggregation across threads happens only on `read` and in the shutdown dump. Timers are
+ * counters by convention: accumulate elapsed nanoseconds (see `PerfTimer`) and name the
+ * counter accordingly.
+ *
+ * Counters are also reachable from Python through `legate_perf_counter_register` and
+ * `legate_perf_counter_read` in the C API.
+ */
+class PerfCounters {
+ public:
+  using CounterId = uint32_t;
+
+  static constexpr uint32_t MAX_COUNTERS = 256;
+
+ public:
+  /**
+   * @brief Registers a counter under the given name, or returns the existing id if the
+   * name is already registered
+   *
+   * @param name Counter name; shown verbatim in the shutdown dump
+   *
+   * @return Id to pass to `add` and `read`
+   */
+  CounterId register_counter(const std::string& name);
+  /**
+   * @brief Accumulates a value into the calling thread's slot of the counter
+   *
+   * @param id Counter id returned by `register_counter`
+   * @param delta Value to add
+   */
+  void add(CounterId id, uint64_t delta);
+  /**
+   * @brief Returns the counter's value aggregated across all threads
+   *
+   * @param id Counter id returned by `register_counter`
+   *
+   * @return Sum of all per-thread slots
+   */
+  uint64_t read(CounterId id) const;
+
+ public:
+  // Prints all registered counters with their aggregated values
+  void dump(Legion::Logger& logger) const;
+
+ public:
+  static PerfCounters* get_counters();
+
+ private:
+  struct alignas(64) Slot {
+    std::atomic<uint64_t> value{0};
+  };
+  struct ThreadBlock {
+    Slot slots[MAX_COUNTERS];
+  };
+  ThreadBlock* thread_block();
+
+ private:
+  mutable std::mutex lock_{};
+  std::vector<std::string> names_{};
+  std::vector<std::unique_ptr<ThreadBlock>> blocks_{};
+};
+
+/**
+ * @ingroup runtime
+ * @brief An RAII helper that accumulates the elapsed nanoseconds of its scope into a counter
+ *
+ * @code{.cpp}
+ * static auto counter_id = PerfCounters::get_counters()->register_counter("mylib.solve_ns");
+ * {
+ *   PerfTimer timer(counter_id);
+ *   // timed work
+ * }
+ * @endcode
+ */
+class PerfTimer {
+ public:
+  PerfTimer(PerfCounters::CounterId id) : id_(id), start_(std::chrono::steady_clock::now()) {}
+  ~PerfTimer()
+  {
+    const auto elapsed = std::chrono::steady_clock::now() - start_;
+    PerfCounters::get_counters()->add(
+      id_, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  }
+
+ public:
+  PerfTimer(const PerfTimer&)            = delete;
+  PerfTimer& operator=(const PerfTimer&) = delete;
+
+ private:
+  PerfCounters::CounterId id_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace legate
@@ -14,6 +14,7 @@
  *
  */
 
+#include <memory>
 #include <mutex>
 #include <numeric>
 #include <sstream>
@@ -65,10 +66,102 @@ class AffineFunctor : public LegateProjectionFunctor {
 
 LegateProjectionFunctor::LegateProjectionFunctor(Legion::Runtime* rt) : ProjectionFunctor(rt) {}
 
+namespace {
+
+// Upper bound on the total number of memoized projection results a functor keeps across all
+// of its tables; a table for a million-point launch stays cached while older tables get
+// evicted in FIFO order
+constexpr size_t MAX_CACHED_PROJECTIONS = 1 << 22;
+
+// Row-major rank of a point within a dense domain. Tables are built with the matching
+// delinearization below, so the two only need to agree with each other.
+size_t linearize_point(const DomainPoint& point, const Domain& domain)
+{
+  size_t idx = 0;
+  for (int32_t dim = 0; dim < domain.dim; ++dim) {
+    const size_t extent = domain.rect_data[dim + domain.dim] - domain.rect_data[dim] + 1;
+    idx                 = idx * extent + (point[dim] - domain.rect_data[dim]);
+  }
+  return idx;
+}
+
+DomainPoint delinearize_point(size_t idx, const Domain& domain)
+{
+  DomainPoint point;
+  point.dim = domain.dim;
+  for (int32_t dim = domain.dim - 1; dim >= 0; --dim) {
+    const size_t extent = domain.rect_data[dim + domain.dim] - domain.rect_data[dim] + 1;
+    point[dim]          = domain.rect_data[dim] + idx % extent;
+    idx /= extent;
+  }
+  return point;
+}
+
+}  // namespace
+
+struct LegateProjectionFunctor::ResultTable {
+  Legion::LogicalPartition partition;
+  Domain launch_domain;
+  std::vector<Legion::LogicalRegion> regions;
+};
+
+const LegateProjectionFunctor::ResultTable* LegateProjectionFunctor::find_or_build_table(
+  Legion::LogicalPartition upper_bound,
+  const Domain& launch_domain,
+  std::shared_ptr<const ResultTable>& owner)
+{
+  auto tables = std::atomic_load(&tables_);
+  if (tables != nullptr)
+    for (auto& table : *tables)
+      if (table->partition == upper_bound && table->launch_domain == launch_domain)
+        return table.get();
+
+  auto table          = std::make_shared<ResultTable>();
+  table->partition    = upper_bound;
+  table->launch_domain = launch_domain;
+  const size_t volume = launch_domain.get_volume();
+  table->regions.reserve(volume);
+  for (size_t idx = 0; idx < volume; ++idx) {
+    const DomainPoint dp = project_point(delinearize_point(idx, launch_domain), launch_domain);
+    table->regions.push_back(runtime->has_logical_subregion_by_color(upper_bound, dp)
+                               ? runtime->get_logical_subregion_by_color(upper_bound, dp)
+                               : Legion::LogicalRegion::NO_REGION);
+  }
+
+  {
+    const std::lock_guard<std::mutex> lock(tables_lock_);
+    auto current = std::atomic_load(&tables_);
+    auto updated = nullptr == current
+                     ? std::make_shared<std::vector<std::shared_ptr<const ResultTable>>>()
+                     : std::make_shared<std::vector<std::shared_ptr<const ResultTable>>>(*current);
+    updated->push_back(table);
+    size_t total = 0;
+    for (auto& entry : *updated) total += entry->regions.size();
+    while (total > MAX_CACHED_PROJECTIONS && updated->size() > 1) {
+      total -= updated->front()->regions.size();
+      updated->erase(updated->begin());
+    }
+    std::atomic_store(
+      &tables_,
+      std::shared_ptr<const std::vector<std::shared_ptr<const ResultTable>>>(std::move(updated)));
+  }
+
+  // The caller's reference keeps the table alive even if a concurrent insertion evicts it
+  owner = std::move(table);
+  return owner.get();
+}
+
 Legion::LogicalRegion LegateProjectionFunctor::project(Legion::LogicalPartition upper_bound,
                                                        const DomainPoint& point,
                                                        const Domain& launch_domain)
 {
+  if (launch_domain.dense() && launch_domain.get_volume() > 0 &&
+      launch_domain.get_volume() <= MAX_CACHED_PROJECTIONS) {
+    std::shared_ptr<const ResultTable> owner{nullptr};
+    auto* table = find_or_build_table(upper_bound, launch_domain, owner);
+    return table->regions[linearize_point(point, launch_domain)];
+  }
+
   const DomainPoint dp = project_point(point, launch_domain);
   if (runtime->has_logical_subregion_by_color(upper_bound, dp))
     return runtime->get_logical_subregion_by_color(upper_bound, dp);
@@ -159,10 +252,27 @@ struct IdentityFunctor : public LegateProjectionFunctor {
   }
 };
 
+using ProjectionFunctorTable = std::unordered_map<Legion::ProjectionID, LegateProjectionFunctor*>;
+
 static LegateProjectionFunctor* identity_functor{nullptr};
-static std::unordered_map<Legion::ProjectionID, LegateProjectionFunctor*> functor_table{};
+// The table is read-mostly: functors are registered a handful of times at startup but
+// looked up on every launch. Readers grab an immutable snapshot with an atomic load and
+// never take a lock; registration copies the current snapshot, adds the entry, and swaps
+// the new snapshot in under the lock, which only serializes writers.
+static std::shared_ptr<const ProjectionFunctorTable> functor_table =
+  std::make_shared<const ProjectionFunctorTable>();
 static std::mutex functor_table_lock{};
 
+static void record_legate_projection_functor(Legion::ProjectionID proj_id,
+                                             LegateProjectionFunctor* functor)
+{
+  const std::lock_guard<std::mutex> lock(functor_table_lock);
+  auto table        = std::make_shared<ProjectionFunctorTable>(*std::atomic_load(&functor_table));
+  (*table)[proj_id] = functor;
+  std::atomic_store(&functor_table,
+                    std::shared_ptr<const ProjectionFunctorTable>(std::move(table)));
+}
+
 struct create_affine_functor_fn {
   static void spec_to_string(std::stringstream& ss,
                              int32_t src_ndim,
@@ -217,8 +327,7 @@ struct create_affine_functor_fn {
 #endif
     runtime->register_projection_functor(proj_id, functor, true /*silence warnings*/);
 
-    const std::lock_guard<std::mutex> lock(functor_table_lock);
-    functor_table[proj_id] = functor;
+    record_legate_projection_functor(proj_id, functor);
   }
 };
 
@@ -229,10 +338,7 @@ void register_legate_core_projection_functors(Legion::Runtime* runtime,
   auto functor = new DelinearizationFunctor(runtime);
   log_legate.debug("Register delinearizing functor: functor: %p, id: %d", functor, proj_id);
   runtime->register_projection_functor(proj_id, functor, true /*silence warnings*/);
-  {
-    const std::lock_guard<std::mutex> lock(functor_table_lock);
-    functor_table[proj_id] = functor;
-  }
+  record_legate_projection_functor(proj_id, functor);
   identity_functor = new IdentityFunctor(runtime);
 }
 
@@ -240,8 +346,9 @@ LegateProjectionFunctor* find_legate_projection_functor(Legion::ProjectionID pro
                                                         bool allow_missing)
 {
   if (0 == proj_id) return identity_functor;
-  const std::lock_guard<std::mutex> lock(functor_table_lock);
-  auto result = functor_table[proj_id];
+  auto table  = std::atomic_load(&functor_table);
+  auto finder = table->find(proj_id);
+  auto result = table->end() == finder ? nullptr : finder->second;
   // If we're not OK with a missing projection functor, then throw an error.
   if (nullptr == result && !allow_missing) {
     log_legate.debug("Failed to find projection functor of id %d", proj_id);
@@ -18,6 +18,10 @@
 
 #include "legion.h"
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "core/runtime/context.h"
 #include "core/utilities/typedefs.h"
 
@@ -45,6 +49,19 @@ class LegateProjectionFunctor : public Legion::ProjectionFunctor {
  public:
   virtual DomainPoint project_point(const DomainPoint& point,
                                     const Domain& launch_domain) const = 0;
+
+ private:
+  // For a dense launch domain the projection results are enumerable, so they are computed
+  // once per (partition, launch domain) pair and shared across the launch's points, turning
+  // the per-point transform arithmetic and region tree lookups during dependence analysis
+  // into array reads. Readers grab an immutable snapshot of the table list with an atomic
+  // load; misses build a table and swap a new snapshot in under the lock.
+  struct ResultTable;
+  const ResultTable* find_or_build_table(Legion::LogicalPartition upper_bound,
+                                         const Domain& launch_domain,
+                                         std::shared_ptr<const ResultTable>& owner);
+  std::shared_ptr<const std::vector<std::shared_ptr<const ResultTable>>> tables_{};
+  std::mutex tables_lock_{};
 };
 
 void register_legate_core_projection_functors(Legion::Runtime* runtime,
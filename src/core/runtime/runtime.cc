@@ -14,15 +14,24 @@
  *
  */
 
+#include <future>
+#include <thread>
+
+#include "core/comm/coll.h"
 #include "core/comm/comm.h"
 #include "core/mapping/core_mapper.h"
 #include "core/mapping/default_mapper.h"
+#include "core/mapping/instance_manager.h"
+#include "core/mapping/mapper_trace.h"
 #include "core/runtime/context.h"
+#include "core/runtime/perf_counters.h"
 #include "core/runtime/projection.h"
 #include "core/runtime/shard.h"
 #include "core/task/exception.h"
 #include "core/task/task.h"
+#include "core/task/task_stats.h"
 #include "core/type/type_info.h"
+#include "core/utilities/async_logging.h"
 #include "core/utilities/deserializer.h"
 #include "core/utilities/machine.h"
 #include "core/utilities/nvtx_help.h"
@@ -48,6 +57,20 @@ static const char* const core_library_name = "legate.core";
 
 /*static*/ bool Core::warmup_nccl = false;
 
+/*static*/ bool Core::trace_mapping = false;
+
+/*static*/ bool Core::collect_task_stats = false;
+
+/*static*/ bool Core::profile_copies = false;
+
+/*static*/ bool Core::calibrate_targets = false;
+
+/*static*/ std::vector<Core::TaskHook> Core::task_hooks_{};
+
+/*static*/ std::vector<Core::RegistrationCallback> Core::deferred_callbacks_{};
+
+/*static*/ std::vector<std::function<void()>> Core::shutdown_callbacks_{};
+
 /*static*/ void Core::parse_config(void)
 {
 #ifndef LEGATE_USE_CUDA
@@ -87,6 +110,12 @@ static const char* const core_library_name = "legate.core";
   parse_variable("LEGATE_SYNC_STREAM_VIEW", synchronize_stream_view);
   parse_variable("LEGATE_LOG_MAPPING", log_mapping_decisions);
   parse_variable("LEGATE_WARMUP_NCCL", warmup_nccl);
+  parse_variable("LEGATE_MAPPING_TRACE", trace_mapping);
+  parse_variable("LEGATE_TASK_STATS", collect_task_stats);
+  parse_variable("LEGATE_PROFILE_COPIES", profile_copies);
+  parse_variable("LEGATE_CALIBRATE_TARGETS", calibrate_targets);
+  // The calibrated target selection is fed by the per-variant timing statistics
+  if (calibrate_targets) collect_task_stats = true;
 }
 
 static void extract_scalar_task(
@@ -99,7 +128,7 @@ static void extract_scalar_task(
   Legion::Runtime* runtime;
   Legion::Runtime::legion_task_preamble(args, arglen, p, task, regions, legion_context, runtime);
 
-  Core::show_progress(task, legion_context, runtime);
+  Core::on_task_start(task, legion_context, runtime);
 
   TaskContext context(task, *regions, legion_context, runtime);
   auto idx            = context.scalars()[0].value<int32_t>();
@@ -109,9 +138,93 @@ static void extract_scalar_task(
   value_and_size.finalize(legion_context);
 }
 
+namespace {
+
+// The in-flight early teardown, if any; shutdown waits on it before finishing
+std::future<void>& early_teardown()
+{
+  static std::future<void> future{};
+  return future;
+}
+
+// Shutdown callbacks are independent by contract, so they run concurrently and teardown
+// takes as long as the slowest one instead of the sum
+void run_shutdown_callbacks(std::vector<std::function<void()>>&& callbacks)
+{
+  if (callbacks.empty()) return;
+  std::vector<std::thread> workers;
+  workers.reserve(callbacks.size());
+  for (auto& callback : callbacks) workers.emplace_back(std::move(callback));
+  for (auto& worker : workers) worker.join();
+}
+
+}  // namespace
+
+/*static*/ void Core::add_shutdown_callback(std::function<void()> callback)
+{
+  shutdown_callbacks_.push_back(std::move(callback));
+}
+
+/*static*/ void Core::early_release(void)
+{
+  auto callbacks = std::move(shutdown_callbacks_);
+  shutdown_callbacks_.clear();
+  // Communicator state and the mapper's instance caches can die before the last tasks
+  // drain: remaining tasks simply miss the caches and map fresh instances, and the caller
+  // promises no further communicator uses
+  callbacks.emplace_back([]() {
+    comm::coll::collFinalize();
+    mapping::InstanceManager::get_instance_manager()->release_all();
+    mapping::ReductionInstanceManager::get_instance_manager()->release_all();
+  });
+  early_teardown() = std::async(
+    std::launch::async,
+    [](std::vector<std::function<void()>>&& callbacks) {
+      run_shutdown_callbacks(std::forward<decltype(callbacks)>(callbacks));
+    },
+    std::move(callbacks));
+}
+
 /*static*/ void Core::shutdown(void)
 {
-  // Nothing to do here yet...
+  // No-ops when early_release already drained the callbacks; otherwise this is where they run
+  run_shutdown_callbacks(std::move(shutdown_callbacks_));
+  shutdown_callbacks_.clear();
+  if (early_teardown().valid()) early_teardown().wait();
+
+  if (trace_mapping) mapping::MapperTracer::get_tracer()->dump();
+  if (collect_task_stats) detail::TaskStats::get_task_stats()->dump(log_legate);
+  // No-op unless some subsystem or library registered a counter
+  PerfCounters::get_counters()->dump(log_legate);
+}
+
+/*static*/ void Core::add_task_hook(TaskHook hook) { task_hooks_.push_back(hook); }
+
+/*static*/ void Core::run_deferred_registrations(Legion::Machine,
+                                                 Legion::Runtime*,
+                                                 const std::set<Processor>&)
+{
+  for (auto& callback : deferred_callbacks_) callback();
+  deferred_callbacks_.clear();
+}
+
+/*static*/ void Core::perform_deferred_registrations()
+{
+  if (deferred_callbacks_.empty()) return;
+  // Flushing the whole queue through one Legion registration step pays the cross-node
+  // registration fence once instead of once per library. Each flush needs a fresh dedup
+  // tag, as Legion otherwise drops repeated callbacks with the same function pointer.
+  static size_t next_dedup_tag = 1;
+  Legion::Runtime::perform_registration_callback(
+    run_deferred_registrations, true /*global*/, true /*dedup*/, next_dedup_tag++);
+}
+
+/*static*/ void Core::run_task_hooks(const Legion::Task* task,
+                                     Legion::Context ctx,
+                                     Legion::Runtime* runtime)
+{
+  show_progress(task, ctx, runtime);
+  for (auto& hook : task_hooks_) hook(task, ctx, runtime);
 }
 
 /*static*/ void Core::show_progress(const Legion::Task* task,
@@ -194,6 +307,37 @@ LibraryContext* Runtime::create_library(const std::string& library_name,
 
 uint32_t Runtime::get_type_uid() { return next_type_uid_++; }
 
+namespace {
+
+// Enough for the builtin ops over the core types without a regrowth
+constexpr size_t INITIAL_REDUCTION_TABLE_SIZE = 256;
+
+inline uint64_t pack_reduction_key(int32_t type_uid, int32_t op_kind)
+{
+  return (static_cast<uint64_t>(static_cast<uint32_t>(type_uid)) << 32) |
+         static_cast<uint32_t>(op_kind);
+}
+
+// Fibonacci hashing: one multiply spreads the packed key over the power-of-two table
+inline size_t hash_reduction_key(uint64_t key, size_t capacity)
+{
+  return static_cast<size_t>((key * UINT64_C(0x9E3779B97F4A7C15)) & (capacity - 1));
+}
+
+}  // namespace
+
+void Runtime::grow_reduction_table(size_t capacity)
+{
+  std::vector<ReductionOpEntry> table(capacity);
+  for (auto& entry : reduction_ops_) {
+    if (!entry.occupied) continue;
+    auto idx = hash_reduction_key(entry.key, capacity);
+    while (table[idx].occupied) idx = (idx + 1) & (capacity - 1);
+    table[idx] = entry;
+  }
+  reduction_ops_ = std::move(table);
+}
+
 void Runtime::record_reduction_operator(int32_t type_uid, int32_t op_kind, int32_t legion_op_id)
 {
 #ifdef DEBUG_LEGATE
@@ -202,33 +346,66 @@ void Runtime::record_reduction_operator(int32_t type_uid, int32_t op_kind, int32
                    op_kind,
                    legion_op_id);
 #endif
-  auto key    = std::make_pair(type_uid, op_kind);
-  auto finder = reduction_ops_.find(key);
-  if (finder != reduction_ops_.end()) {
-    std::stringstream ss;
-    ss << "Reduction op " << op_kind << " already exists for type " << type_uid;
-    throw std::invalid_argument(std::move(ss).str());
+  // Keep the load factor at 1/2 or below, so lookups stay at a probe or two
+  if ((num_reduction_ops_ + 1) * 2 > reduction_ops_.size())
+    grow_reduction_table(
+      std::max(reduction_ops_.size() * 2, INITIAL_REDUCTION_TABLE_SIZE));
+
+  const auto key = pack_reduction_key(type_uid, op_kind);
+  auto idx       = hash_reduction_key(key, reduction_ops_.size());
+  while (reduction_ops_[idx].occupied) {
+    if (reduction_ops_[idx].key == key) {
+      std::stringstream ss;
+      ss << "Reduction op " << op_kind << " already exists for type " << type_uid;
+      throw std::invalid_argument(std::move(ss).str());
+    }
+    idx = (idx + 1) & (reduction_ops_.size() - 1);
   }
-  reduction_ops_.emplace(std::make_pair(key, legion_op_id));
+  reduction_ops_[idx].key      = key;
+  reduction_ops_[idx].op_id    = legion_op_id;
+  reduction_ops_[idx].occupied = true;
+  ++num_reduction_ops_;
 }
 
 int32_t Runtime::find_reduction_operator(int32_t type_uid, int32_t op_kind) const
 {
-  auto key    = std::make_pair(type_uid, op_kind);
-  auto finder = reduction_ops_.find(key);
-  if (reduction_ops_.end() == finder) {
+  const auto key      = pack_reduction_key(type_uid, op_kind);
+  const auto capacity = reduction_ops_.size();
+  if (capacity > 0) {
+    auto idx = hash_reduction_key(key, capacity);
+    while (reduction_ops_[idx].occupied) {
+      if (reduction_ops_[idx].key == key) {
 #ifdef DEBUG_LEGATE
-    log_legate.debug("Can't find reduction op (type_uid: %d, op_kind: %d)", type_uid, op_kind);
+        log_legate.debug("Found reduction op %d (type_uid: %d, op_kind: %d)",
+                         reduction_ops_[idx].op_id,
+                         type_uid,
+                         op_kind);
 #endif
-    std::stringstream ss;
-    ss << "Reduction op " << op_kind << " does not exist for type " << type_uid;
-    throw std::invalid_argument(std::move(ss).str());
+        return reduction_ops_[idx].op_id;
+      }
+      idx = (idx + 1) & (capacity - 1);
+    }
   }
 #ifdef DEBUG_LEGATE
-  log_legate.debug(
-    "Found reduction op %d (type_uid: %d, op_kind: %d)", finder->second, type_uid, op_kind);
+  log_legate.debug("Can't find reduction op (type_uid: %d, op_kind: %d)", type_uid, op_kind);
 #endif
-  return finder->second;
+  std::stringstream ss;
+  ss << "Reduction op " << op_kind << " does not exist for type " << type_uid;
+  throw std::invalid_argument(std::move(ss).str());
+}
+
+void Runtime::begin_trace(uint32_t trace_id)
+{
+  auto runtime = Legion::Runtime::get_runtime();
+  auto ctx     = Legion::Runtime::get_context();
+  runtime->begin_trace(ctx, trace_id);
+}
+
+void Runtime::end_trace(uint32_t trace_id)
+{
+  auto runtime = Legion::Runtime::get_runtime();
+  auto ctx     = Legion::Runtime::get_context();
+  runtime->end_trace(ctx, trace_id);
 }
 
 /*static*/ Runtime* Runtime::get_runtime()
@@ -237,6 +414,13 @@ int32_t Runtime::find_reduction_operator(int32_t type_uid, int32_t op_kind) cons
   return &runtime;
 }
 
+TraceScope::TraceScope(uint32_t trace_id) : trace_id_(trace_id)
+{
+  Runtime::get_runtime()->begin_trace(trace_id_);
+}
+
+TraceScope::~TraceScope() { Runtime::get_runtime()->end_trace(trace_id_); }
+
 void register_legate_core_tasks(Legion::Machine machine,
                                 Legion::Runtime* runtime,
                                 LibraryContext* context)
@@ -314,6 +498,8 @@ extern void register_exception_reduction_op(Legion::Runtime* runtime,
                                            Legion::Runtime* runtime,
                                            const std::set<Processor>& local_procs)
 {
+  detail::AsyncLoggingBackend::attach(log_legate);
+
   ResourceConfig config;
   config.max_tasks       = LEGATE_CORE_NUM_TASK_IDS;
   config.max_projections = LEGATE_CORE_MAX_FUNCTOR_ID;
@@ -18,7 +18,9 @@
 
 #include "legion.h"
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include "core/runtime/resource.h"
 #include "core/task/exception.h"
@@ -49,11 +51,63 @@ struct Core {
  public:
   static void parse_config(void);
   static void shutdown(void);
+  /**
+   * @brief Registers a callback to run during shutdown
+   *
+   * Callbacks must be independent of one another: they run concurrently, so full teardown
+   * takes as long as the slowest callback instead of the sum of all of them.
+   *
+   * @param callback Callback to add
+   */
+  static void add_shutdown_callback(std::function<void()> callback);
+  /**
+   * @brief Starts tearing down resources early, on a background thread, so cleanup overlaps
+   * with whatever still runs in the job's tail
+   *
+   * Runs the registered shutdown callbacks, finalizes the CPU collective network, and drops
+   * the mapper's cached instance tables while outstanding tasks (e.g. final output I/O)
+   * drain. Callers promise that no task launched after this call uses a communicator.
+   * `shutdown` waits for the early teardown to finish, so calling this is always safe; when
+   * it is never called, everything runs at shutdown as before.
+   */
+  static void early_release(void);
   static void show_progress(const Legion::Task* task,
                             Legion::Context ctx,
                             Legion::Runtime* runtime);
   static void report_unexpected_exception(const Legion::Task* task, const legate::TaskException& e);
 
+ public:
+  /**
+   * @brief Type signature for per-task instrumentation hooks
+   */
+  using TaskHook = void (*)(const Legion::Task* task, Legion::Context ctx, Legion::Runtime* runtime);
+  /**
+   * @brief Registers a hook invoked at the start of every task execution. Hooks run only in
+   * debug builds and should be registered during library registration callbacks.
+   *
+   * @param hook Hook to add
+   */
+  static void add_task_hook(TaskHook hook);
+  // Instrumentation point called by every task wrapper. In release builds this inline is
+  // empty, so the call and its argument setup compile to nothing; in debug builds it runs
+  // the opt-in progress logging and any registered hooks.
+  static void on_task_start(const Legion::Task* task, Legion::Context ctx, Legion::Runtime* runtime)
+  {
+#ifdef DEBUG_LEGATE
+    run_task_hooks(task, ctx, runtime);
+#else
+    static_cast<void>(task);
+    static_cast<void>(ctx);
+    static_cast<void>(runtime);
+#endif
+  }
+
+ private:
+  static void run_task_hooks(const Legion::Task* task,
+                             Legion::Context ctx,
+                             Legion::Runtime* runtime);
+  static std::vector<TaskHook> task_hooks_;
+
  public:
   /**
    * @brief Type signature for registration callbacks
@@ -69,6 +123,31 @@ struct Core {
   template <RegistrationCallback CALLBACK>
   static void perform_registration();
 
+  /**
+   * @brief Queues a registration callback instead of performing it right away. Queued
+   * callbacks run in the order they were queued, so libraries that depend on another
+   * library's registrations should be queued after it.
+   *
+   * @tparam CALLBACK Registration callback to queue
+   */
+  template <RegistrationCallback CALLBACK>
+  static void defer_registration();
+
+  /**
+   * @brief Performs all queued registration callbacks through a single Legion
+   * registration step. Each perform_registration call pays a cross-node registration
+   * fence, so stacks with many libraries should queue their callbacks and flush them
+   * here once.
+   */
+  static void perform_deferred_registrations();
+
+ private:
+  static void run_deferred_registrations(Legion::Machine machine,
+                                         Legion::Runtime* runtime,
+                                         const std::set<Processor>& local_procs);
+  static std::vector<RegistrationCallback> deferred_callbacks_;
+  static std::vector<std::function<void()>> shutdown_callbacks_;
+
  public:
   // Configuration settings
   static bool show_progress_requested;
@@ -77,6 +156,10 @@ struct Core {
   static bool log_mapping_decisions;
   static bool has_socket_mem;
   static bool warmup_nccl;
+  static bool trace_mapping;
+  static bool collect_task_stats;
+  static bool profile_copies;
+  static bool calibrate_targets;
 };
 
 class Runtime {
@@ -95,6 +178,24 @@ class Runtime {
   void record_reduction_operator(int32_t type_uid, int32_t op_kind, int32_t legion_op_id);
   int32_t find_reduction_operator(int32_t type_uid, int32_t op_kind) const;
 
+ public:
+  /**
+   * @brief Starts a trace capture for the given id. All operations issued between this
+   * call and the matching end_trace are captured, and subsequent captures with the same
+   * id replay the recorded mapping and analysis instead of repeating them, which is
+   * essential for iterative computations with a fixed loop body.
+   *
+   * @param trace_id Application-chosen id for the trace; must be paired with an end_trace
+   * with the same id
+   */
+  void begin_trace(uint32_t trace_id);
+  /**
+   * @brief Ends the trace capture for the given id
+   *
+   * @param trace_id Id of the trace to end
+   */
+  void end_trace(uint32_t trace_id);
+
  public:
   static Runtime* get_runtime();
 
@@ -103,7 +204,42 @@ class Runtime {
 
  private:
   uint32_t next_type_uid_;
-  std::map<std::pair<int32_t, int32_t>, int32_t> reduction_ops_{};
+  // Reduction op resolution sits on every reduction launch and reduce_accessor construction,
+  // so the (type uid, op kind) ~> Legion op id mapping lives in a flat open-addressing table
+  // instead of a node-based map: a lookup is one hash and, at a load factor of at most 1/2,
+  // almost always a single probe. Linear probing over a power-of-two capacity.
+  struct ReductionOpEntry {
+    uint64_t key{0};
+    int32_t op_id{0};
+    bool occupied{false};
+  };
+  void grow_reduction_table(size_t capacity);
+  std::vector<ReductionOpEntry> reduction_ops_{};
+  size_t num_reduction_ops_{0};
+};
+
+/**
+ * @ingroup runtime
+ * @brief An RAII helper that delimits a trace capture over its scope
+ *
+ * @code{.cpp}
+ * for (int32_t iter = 0; iter < num_iters; ++iter) {
+ *   legate::TraceScope trace(MY_TRACE_ID);
+ *   // Operations issued here are captured on the first iteration and replayed afterwards
+ * }
+ * @endcode
+ */
+class TraceScope {
+ public:
+  TraceScope(uint32_t trace_id);
+  ~TraceScope();
+
+ public:
+  TraceScope(const TraceScope&)            = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+ private:
+  uint32_t trace_id_;
 };
 
 }  // namespace legate
@@ -39,4 +39,10 @@ template <Core::RegistrationCallback CALLBACK>
     detail::invoke_legate_registration_callback<CALLBACK>, true /*global*/);
 }
 
+template <Core::RegistrationCallback CALLBACK>
+/*static*/ void Core::defer_registration()
+{
+  deferred_callbacks_.push_back(CALLBACK);
+}
+
 }  // namespace legate
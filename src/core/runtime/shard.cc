@@ -14,6 +14,8 @@
  *
  */
 
+#include <algorithm>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 
@@ -82,6 +84,116 @@ class LinearizingShardingFunctor : public Legion::ShardingFunctor {
   }
 };
 
+// Per-point weight hints for the weighted sharding functor. A sharding functor only ever sees
+// the launch domain and a point, so the domain volume is the only identity a client can match
+// a hint against; hints for a volume are replaced wholesale when new measurements come in
+static std::unordered_map<size_t, std::shared_ptr<const std::vector<uint64_t>>>
+  sharding_weight_table;
+static std::mutex sharding_weight_lock;
+
+class WeightedShardingFunctor : public Legion::ShardingFunctor {
+ public:
+  virtual Legion::ShardID shard(const DomainPoint& p,
+                                const Domain& launch_space,
+                                const size_t total_shards)
+  {
+    const size_t size = launch_space.get_volume();
+    const size_t idx  = linearize(launch_space.lo(), launch_space.hi(), p);
+    const auto ends   = find_shard_ends(size, total_shards);
+    if (nullptr == ends) {
+      // No hint registered for this domain: fall back to the uniform linearized split
+      const size_t chunk = (size + total_shards - 1) / total_shards;
+      return idx / chunk;
+    }
+    // Shard s owns the linearized indices [ends[s - 1], ends[s])
+    return std::upper_bound(ends->begin(), ends->end(), idx) - ends->begin();
+  }
+
+  virtual bool is_invertible(void) const { return true; }
+
+  virtual void invert(Legion::ShardID shard,
+                      const Domain& shard_domain,
+                      const Domain& full_domain,
+                      const size_t total_shards,
+                      std::vector<DomainPoint>& points)
+  {
+    assert(shard_domain == full_domain);
+    const size_t size = shard_domain.get_volume();
+    size_t idx, lim;
+    const auto ends = find_shard_ends(size, total_shards);
+    if (nullptr == ends) {
+      const size_t chunk = (size + total_shards - 1) / total_shards;
+      idx                = shard * chunk;
+      lim                = std::min((shard + 1) * chunk, size);
+    } else {
+      idx = 0 == shard ? 0 : (*ends)[shard - 1];
+      lim = (*ends)[shard];
+    }
+    if (idx >= lim) return;
+    DomainPoint point = delinearize(shard_domain.lo(), shard_domain.hi(), idx);
+    for (; idx < lim; ++idx) {
+      points.push_back(point);
+      for (int dim = shard_domain.dim - 1; dim >= 0; --dim) {
+        if (point[dim] < shard_domain.hi()[dim]) {
+          point[dim]++;
+          break;
+        }
+        point[dim] = shard_domain.lo()[dim];
+      }
+    }
+  }
+
+ private:
+  // Returns the cached one-past-last linearized index of every shard for this (volume,
+  // total_shards) pair, or nullptr when no weights were registered for the volume
+  std::shared_ptr<const std::vector<size_t>> find_shard_ends(size_t volume, size_t total_shards)
+  {
+    std::shared_ptr<const std::vector<uint64_t>> weights;
+    {
+      const std::lock_guard<std::mutex> lock(sharding_weight_lock);
+      auto finder = sharding_weight_table.find(volume);
+      if (sharding_weight_table.end() == finder) return nullptr;
+      weights = finder->second;
+    }
+    if (weights->size() != volume) return nullptr;
+
+    const auto cache_key = std::make_pair(volume, total_shards);
+    {
+      const std::lock_guard<std::mutex> lock(ends_lock_);
+      auto finder = ends_cache_.find(cache_key);
+      if (ends_cache_.end() != finder && finder->second.weights == weights)
+        return finder->second.ends;
+    }
+
+    // Balanced prefix-sum split: the point with exclusive weight prefix P goes to shard
+    // floor(P * total_shards / total_weight), which hands every shard a nearly equal share of
+    // the total weight while keeping each shard contiguous in the linearized order
+    uint64_t total_weight = 0;
+    for (auto weight : *weights) total_weight += weight;
+    if (0 == total_weight) total_weight = 1;
+    auto ends       = std::make_shared<std::vector<size_t>>(total_shards, volume);
+    uint64_t prefix = 0;
+    size_t shard    = 0;
+    for (size_t idx = 0; idx < volume; ++idx) {
+      const auto target = std::min(
+        total_shards - 1, static_cast<size_t>(prefix * total_shards / total_weight));
+      while (shard < target) (*ends)[shard++] = idx;
+      prefix += (*weights)[idx];
+    }
+
+    const std::lock_guard<std::mutex> lock(ends_lock_);
+    ends_cache_[cache_key] = {std::move(weights), ends};
+    return ends;
+  }
+
+  struct CachedEnds {
+    std::shared_ptr<const std::vector<uint64_t>> weights;
+    std::shared_ptr<const std::vector<size_t>> ends;
+  };
+  std::mutex ends_lock_;
+  std::map<std::pair<size_t, size_t>, CachedEnds> ends_cache_;
+};
+
 void register_legate_core_sharding_functors(Legion::Runtime* runtime, const LibraryContext* context)
 {
   runtime->register_sharding_functor(context->get_sharding_id(LEGATE_CORE_TOPLEVEL_TASK_SHARD_ID),
@@ -95,6 +207,10 @@ void register_legate_core_sharding_functors(Legion::Runtime* runtime, const Libr
   functor_id_table[0] = sharding_id;
   // and for the delinearizing projection
   functor_id_table[context->get_projection_id(LEGATE_CORE_DELINEARIZE_PROJ_ID)] = sharding_id;
+
+  runtime->register_sharding_functor(context->get_sharding_id(LEGATE_CORE_WEIGHTED_SHARD_ID),
+                                     new WeightedShardingFunctor(),
+                                     true /*silence warnings*/);
 }
 
 class LegateShardingFunctor : public Legion::ShardingFunctor {
@@ -110,18 +226,41 @@ class LegateShardingFunctor : public Legion::ShardingFunctor {
   {
   }
 
+ private:
+  // Projected bounds, strides, and volume of a launch domain; computed once per
+  // (functor, domain) pair and reused for every point of the launch
+  struct LaunchDomainCache {
+    LaunchDomainCache(const Domain& domain, const DomainPoint& lo, const DomainPoint& hi)
+      : domain(domain), linearizer(lo, hi), task_count(linearizer.linearize(hi) + 1)
+    {
+    }
+    Domain domain;
+    RectLinearizer linearizer;
+    uint32_t task_count;
+  };
+
  public:
   virtual Legion::ShardID shard(const DomainPoint& p,
                                 const Domain& launch_space,
                                 const size_t total_shards) override
   {
-    auto lo                 = proj_functor_->project_point(launch_space.lo(), launch_space);
-    auto hi                 = proj_functor_->project_point(launch_space.hi(), launch_space);
+    // The launch domain is fixed for the lifetime of an operation while this functor is
+    // queried once per point, so everything that depends only on the domain is cached.
+    // The cache is thread-local because Legion can shard different operations concurrently.
+    static thread_local const LegateShardingFunctor* cached_functor{nullptr};
+    static thread_local std::unique_ptr<LaunchDomainCache> cache{nullptr};
+    if (cached_functor != this || nullptr == cache || cache->domain != launch_space) {
+      auto lo        = proj_functor_->project_point(launch_space.lo(), launch_space);
+      auto hi        = proj_functor_->project_point(launch_space.hi(), launch_space);
+      cache          = std::make_unique<LaunchDomainCache>(launch_space, lo, hi);
+      cached_functor = this;
+    }
+
     auto point              = proj_functor_->project_point(p, launch_space);
-    uint32_t task_count     = linearize(lo, hi, hi) + 1;
     uint32_t proc_count     = end_proc_id_ - start_proc_id_;
-    uint32_t global_proc_id = (linearize(lo, hi, point) * proc_count) / task_count + start_proc_id_;
-    auto shard_id           = global_proc_id / per_node_count_;
+    uint32_t global_proc_id =
+      (cache->linearizer.linearize(point) * proc_count) / cache->task_count + start_proc_id_;
+    auto shard_id = global_proc_id / per_node_count_;
 #ifdef DEBUG_LEGATE
     assert(shard_id < total_shards);
 #endif
@@ -183,4 +322,11 @@ void legate_create_sharding_functor_using_projection(Legion::ShardID shard_id,
   Legion::Runtime::perform_registration_callback(
     legate::sharding_functor_registration_callback, buffer, false /*global*/, false /*dedup*/);
 }
+
+void legate_sharding_set_weights(uint64_t volume, const uint64_t* weights)
+{
+  auto copy = std::make_shared<const std::vector<uint64_t>>(weights, weights + volume);
+  const std::lock_guard<std::mutex> lock(legate::sharding_weight_lock);
+  legate::sharding_weight_table[volume] = std::move(copy);
+}
 }
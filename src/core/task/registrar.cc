@@ -29,8 +29,7 @@ void TaskRegistrar::record_task(int64_t local_task_id, std::unique_ptr<TaskInfo>
 
 void TaskRegistrar::register_all_tasks(LibraryContext* context)
 {
-  for (auto& [local_task_id, task_info] : pending_task_infos_)
-    context->register_task(local_task_id, std::move(task_info));
+  context->register_tasks(std::move(pending_task_infos_));
   pending_task_infos_.clear();
 }
 
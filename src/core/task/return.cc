@@ -119,13 +119,101 @@ static void returned_exception_fold(const Legion::ReductionOp* reduction_op,
                                     const void* rhs_ptr)
 
 {
-  ReturnedException lhs, rhs;
-  lhs.legion_deserialize(lhs_ptr);
-  rhs.legion_deserialize(rhs_ptr);
-  JoinReturnedException::fold<true>(lhs, rhs);
-  pack_returned_exception(lhs, lhs_ptr, lhs_size);
+  // Both sides start with their status word, so the throw-free steady state is decided by
+  // peeking two bytes: if the right-hand side raised nothing there is nothing to fold, and
+  // if the left-hand side already raised it wins. Only an actual exception pays for
+  // materializing the message payload, and even then it is a wholesale copy of the
+  // serialized form rather than a deserialize/re-serialize round trip.
+  if (!*static_cast<const bool*>(rhs_ptr)) return;
+  if (*static_cast<const bool*>(lhs_ptr)) return;
+
+  auto* rhs          = static_cast<const int8_t*>(rhs_ptr);
+  uint32_t error_len =
+    *reinterpret_cast<const uint32_t*>(rhs + sizeof(bool) + sizeof(int32_t));
+  size_t rhs_size = sizeof(bool) + sizeof(int32_t) + sizeof(uint32_t) + error_len;
+  if (rhs_size > lhs_size) {
+    lhs_size = rhs_size;
+    lhs_ptr  = realloc(lhs_ptr, rhs_size);
+  }
+  memcpy(lhs_ptr, rhs_ptr, rhs_size);
+}
+
+#ifdef LEGATE_USE_CUDA
+namespace {
+
+// Packs values into the output buffer with at most one device-to-host copy: device-resident
+// values are first coalesced into one packed device staging buffer, so tasks returning many
+// small reductions don't pay a PCIe round trip per value. Host values are written in place.
+void pack_values_on_device(const std::vector<ReturnValue>& values, int8_t* ptr)
+{
+  size_t total_size  = 0;
+  size_t device_size = 0;
+  size_t num_device  = 0;
+  for (auto& ret : values) {
+    total_size += ret.size();
+    if (ret.is_device_value()) {
+      device_size += ret.size();
+      ++num_device;
+    }
+  }
+
+  auto stream = cuda::StreamPool::get_stream_pool().get_stream();
+
+  // With at most one device value there is nothing to coalesce
+  if (num_device <= 1) {
+    for (auto& ret : values) {
+      uint32_t size = ret.size();
+      if (ret.is_device_value())
+        CHECK_CUDA(cudaMemcpyAsync(ptr, ret.ptr(), size, cudaMemcpyDeviceToHost, stream));
+      else
+        memcpy(ptr, ret.ptr(), size);
+      ptr += size;
+    }
+    return;
+  }
+
+  auto staging          = create_buffer<int8_t>(device_size, Memory::Kind::GPU_FB_MEM);
+  int8_t* staging_base  = staging.ptr(0);
+  size_t staging_offset = 0;
+  for (auto& ret : values) {
+    uint32_t size = ret.size();
+    if (ret.is_device_value()) {
+      CHECK_CUDA(cudaMemcpyAsync(
+        staging_base + staging_offset, ret.ptr(), size, cudaMemcpyDeviceToDevice, stream));
+      staging_offset += size;
+    } else
+      memcpy(ptr, ret.ptr(), size);
+    ptr += size;
+  }
+  ptr -= total_size;
+
+  if (device_size == total_size) {
+    // All values are device-resident, so the packed staging buffer matches the output
+    // layout and can be copied out directly
+    CHECK_CUDA(cudaMemcpyAsync(ptr, staging_base, device_size, cudaMemcpyDeviceToHost, stream));
+    return;
+  }
+
+  // Device values interleave with host values in the output, so the single copy lands in a
+  // host staging area and the pieces are scattered to their final offsets
+  std::vector<int8_t> host_staging(device_size);
+  CHECK_CUDA(cudaMemcpyAsync(
+    host_staging.data(), staging_base, device_size, cudaMemcpyDeviceToHost, stream));
+  CHECK_CUDA(cudaStreamSynchronize(stream));
+  staging_offset = 0;
+  for (auto& ret : values) {
+    uint32_t size = ret.size();
+    if (ret.is_device_value()) {
+      memcpy(ptr, host_staging.data() + staging_offset, size);
+      staging_offset += size;
+    }
+    ptr += size;
+  }
 }
 
+}  // namespace
+#endif
+
 ReturnedException::ReturnedException(int32_t index, const std::string& error_message)
   : raised_(true), index_(index), error_message_(error_message)
 {
@@ -239,15 +327,7 @@ void ReturnValues::legion_serialize(void* buffer) const
 
 #ifdef LEGATE_USE_CUDA
   if (Processor::get_executing_processor().kind() == Processor::Kind::TOC_PROC) {
-    auto stream = cuda::StreamPool::get_stream_pool().get_stream();
-    for (auto ret : return_values_) {
-      uint32_t size = ret.size();
-      if (ret.is_device_value())
-        CHECK_CUDA(cudaMemcpyAsync(ptr, ret.ptr(), size, cudaMemcpyDeviceToHost, stream));
-      else
-        memcpy(ptr, ret.ptr(), size);
-      ptr += size;
-    }
+    pack_values_on_device(return_values_, ptr);
   } else
 #endif
   {
@@ -312,7 +392,12 @@ void ReturnValues::finalize(Legion::Context legion_context) const
   //        as doing so would require the packing to be chained up with all preceding kernels,
   //        potentially launched with different streams, within the task. Until we find
   //        the right approach, we simply synchronize the device before proceeding.
-  if (kind == Processor::TOC_PROC) CHECK_CUDA(cudaDeviceSynchronize());
+  if (kind == Processor::TOC_PROC) {
+    CHECK_CUDA(cudaDeviceSynchronize());
+    auto return_buffer = pack_on_device(legion_buffer_size());
+    return_buffer.finalize(legion_context);
+    return;
+  }
 #endif
 
   size_t return_size = legion_buffer_size();
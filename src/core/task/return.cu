@@ -0,0 +1,88 @@
+/* Copyright 2021-2022 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "core/cuda/cuda_help.h"
+#include "core/cuda/stream_pool.h"
+#include "core/data/buffer.h"
+#include "core/task/return.h"
+
+namespace legate {
+
+namespace {
+
+struct PackDesc {
+  const int8_t* src;
+  uint32_t size;
+  // Offset of the value in the output buffer, past the header
+  uint32_t offset;
+};
+
+__global__ void pack_return_values(int8_t* out, const PackDesc* descs, uint32_t num_values)
+{
+  for (uint32_t idx = 0; idx < num_values; ++idx) {
+    auto& desc = descs[idx];
+    for (uint32_t pos = threadIdx.x + blockIdx.x * blockDim.x; pos < desc.size;
+         pos += blockDim.x * gridDim.x)
+      out[desc.offset + pos] = desc.src[pos];
+  }
+}
+
+}  // namespace
+
+Legion::UntypedDeferredValue ReturnValues::pack_on_device(size_t return_size) const
+{
+  auto stream = cuda::StreamPool::get_stream_pool().get_stream();
+
+  auto num_values  = static_cast<uint32_t>(return_values_.size());
+  auto header_size = static_cast<uint32_t>(sizeof(uint32_t) * (num_values + 1));
+
+  // The header (value count and offsets) is assembled on the host; the value payloads are
+  // copied in place by the packing kernel. All values a GPU variant returns live in
+  // framebuffer or zero-copy memory, so their pointers are legal on the device.
+  std::vector<uint32_t> header(num_values + 1);
+  std::vector<PackDesc> descs(num_values);
+  header[0]       = num_values;
+  uint32_t offset = 0;
+  for (uint32_t idx = 0; idx < num_values; ++idx) {
+    auto& ret         = return_values_[idx];
+    descs[idx].src    = static_cast<const int8_t*>(ret.ptr());
+    descs[idx].size   = static_cast<uint32_t>(ret.size());
+    descs[idx].offset = header_size + offset;
+    offset += ret.size();
+    header[idx + 1] = offset;
+  }
+
+  auto result = Legion::UntypedDeferredValue(return_size, Memory::Kind::GPU_FB_MEM);
+  AccessorWO<int8_t, 1> acc(result, return_size, false);
+  int8_t* out = acc.ptr(0);
+
+  auto device_descs = create_buffer<PackDesc>(num_values, Memory::Kind::GPU_FB_MEM);
+  CHECK_CUDA(cudaMemcpyAsync(
+    device_descs.ptr(0), descs.data(), sizeof(PackDesc) * num_values, cudaMemcpyHostToDevice, stream));
+  CHECK_CUDA(cudaMemcpyAsync(out, header.data(), header_size, cudaMemcpyHostToDevice, stream));
+
+  auto config = cuda::launch_config(pack_return_values, offset);
+  pack_return_values<<<config.num_blocks, config.threads_per_block, 0, stream>>>(
+    out, device_descs.ptr(0), num_values);
+  CHECK_CUDA_STREAM(stream);
+
+  return result;
+}
+
+}  // namespace legate
@@ -18,6 +18,7 @@
 
 #include <vector>
 #include "core/utilities/typedefs.h"
+#include "legate_defines.h"
 
 namespace legate {
 
@@ -98,6 +99,14 @@ struct ReturnValues {
   // Calls the Legion postamble with an instance that packs all return values
   void finalize(Legion::Context legion_context) const;
 
+ private:
+#ifdef LEGATE_USE_CUDA
+  // Packs the values into a framebuffer-resident instance with a device kernel, so
+  // GPU-to-GPU consumers never stage the future through host memory; Legion materializes
+  // a host copy only when a CPU consumer demands one
+  Legion::UntypedDeferredValue pack_on_device(size_t return_size) const;
+#endif
+
  private:
   size_t buffer_size_{0};
   std::vector<ReturnValue> return_values_{};
@@ -18,6 +18,9 @@
 
 #include <cxxabi.h>
 
+#include <chrono>
+#include <optional>
+
 #include "realm/faults.h"
 
 #include "core/runtime/context.h"
@@ -25,6 +28,7 @@
 #include "core/task/exception.h"
 #include "core/task/registrar.h"
 #include "core/task/return.h"
+#include "core/task/task_stats.h"
 #include "core/utilities/deserializer.h"
 #include "core/utilities/nvtx_help.h"
 #include "core/utilities/typedefs.h"
@@ -59,17 +63,34 @@ void task_wrapper(VariantImpl variant_impl,
   Legion::Runtime::legion_task_preamble(args, arglen, p, task, regions, legion_context, runtime);
 
 #ifdef LEGATE_USE_CUDA
-  std::stringstream ss;
-  ss << task_name;
-  if (!task->get_provenance_string().empty()) ss << " : " + task->get_provenance_string();
-  std::string msg = ss.str();
-  nvtx::Range auto_range(msg.c_str());
+  // The range message carries the namespace-qualified task name (which attributes the task to
+  // its library), the kind of processor executing the variant, and the provenance when one is
+  // available. None of it is composed unless a profiler is actually attached.
+  std::optional<nvtx::Range> auto_range;
+  if (nvtx::annotations_enabled()) {
+    std::stringstream ss;
+    ss << task_name;
+    switch (p.kind()) {
+      case Processor::LOC_PROC: ss << " <CPU>"; break;
+      case Processor::TOC_PROC: ss << " <GPU>"; break;
+      case Processor::OMP_PROC: ss << " <OMP>"; break;
+      default: break;
+    }
+    if (!task->get_provenance_string().empty()) ss << " : " + task->get_provenance_string();
+    std::string msg = ss.str();
+    auto_range.emplace(msg.c_str());
+  }
 #endif
 
-  Core::show_progress(task, legion_context, runtime);
+  Core::on_task_start(task, legion_context, runtime);
 
   TaskContext context(task, *regions, legion_context, runtime);
 
+  // Wall time of the variant body; for GPU variants this is the launch-side time, as work
+  // left outstanding on streams at task end is tracked by Realm separately
+  const auto ts_start = Core::collect_task_stats ? std::chrono::steady_clock::now()
+                                                 : std::chrono::steady_clock::time_point{};
+
   ReturnValues return_values{};
   try {
     if (!Core::use_empty_task) (*variant_impl)(context);
@@ -84,6 +105,27 @@ void task_wrapper(VariantImpl variant_impl,
       Core::report_unexpected_exception(task, e);
   }
 
+  if (Core::collect_task_stats) {
+    const auto duration = std::chrono::steady_clock::now() - ts_start;
+    // The work volume is the total number of elements the task touched; it feeds the
+    // per-volume throughput model used by the calibrated target selection
+    uint64_t volume  = 0;
+    auto add_volumes = [&volume](const std::vector<Store>& stores) {
+      for (auto& store : stores) {
+        if (store.is_future() || store.is_unbound_store()) continue;
+        volume += store.domain().get_volume();
+      }
+    };
+    add_volumes(context.inputs());
+    add_volumes(context.outputs());
+    add_volumes(context.reductions());
+    TaskStats::get_task_stats()->record(
+      task_name,
+      p,
+      std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(),
+      volume);
+  }
+
   // Legion postamble
   return_values.finalize(legion_context);
 }
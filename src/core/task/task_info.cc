@@ -38,28 +38,24 @@ void TaskInfo::add_variant(LegateVariantCode vid,
                            const Legion::CodeDescriptor& code_desc,
                            const VariantOptions& options)
 {
+  assert(static_cast<size_t>(vid) < variants_.size());
 #ifdef DEBUG_LEGATE
-  assert(variants_.find(vid) == variants_.end());
+  assert(!variants_[vid].has_value());
 #endif
-  variants_.emplace(std::make_pair(vid, VariantInfo{body, code_desc, options}));
+  variants_[vid] = VariantInfo{body, code_desc, options};
 }
 
-const VariantInfo* TaskInfo::find_variant(LegateVariantCode vid) const
-{
-  auto finder = variants_.find(vid);
-  return finder != variants_.end() ? &finder->second : nullptr;
-}
-
-bool TaskInfo::has_variant(LegateVariantCode vid) const
+void TaskInfo::register_task(Legion::TaskID task_id)
 {
-  return variants_.find(vid) != variants_.end();
+  register_task(Legion::Runtime::get_runtime(), task_id);
 }
 
-void TaskInfo::register_task(Legion::TaskID task_id)
+void TaskInfo::register_task(Legion::Runtime* runtime, Legion::TaskID task_id)
 {
-  auto runtime = Legion::Runtime::get_runtime();
   runtime->attach_name(task_id, task_name_.c_str(), false /*mutable*/, true /*local_only*/);
-  for (auto& [vid, vinfo] : variants_) {
+  for (size_t vid = 0; vid < variants_.size(); ++vid) {
+    if (!variants_[vid].has_value()) continue;
+    auto& vinfo = *variants_[vid];
     Legion::TaskVariantRegistrar registrar(task_id, false /*global*/, VARIANT_NAMES[vid]);
     registrar.add_constraint(Legion::ProcessorConstraint(VARIANT_PROC_KINDS[vid]));
     vinfo.options.populate_registrar(registrar);
@@ -80,7 +76,9 @@ std::ostream& operator<<(std::ostream& os, const TaskInfo& info)
 {
   std::stringstream ss;
   ss << info.name() << " {";
-  for (auto [vid, vinfo] : info.variants_) ss << VARIANT_NAMES[vid] << ":[" << vinfo << "],";
+  for (size_t vid = 0; vid < info.variants_.size(); ++vid)
+    if (info.variants_[vid].has_value())
+      ss << VARIANT_NAMES[vid] << ":[" << *info.variants_[vid] << "],";
   ss << "}";
   os << std::move(ss).str();
   return os;
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <array>
+#include <optional>
+
 #include "core/task/variant_options.h"
 #include "core/utilities/typedefs.h"
 
@@ -39,16 +42,30 @@ class TaskInfo {
                    VariantImpl body,
                    const Legion::CodeDescriptor& code_desc,
                    const VariantOptions& options);
-  const VariantInfo* find_variant(LegateVariantCode vid) const;
-  bool has_variant(LegateVariantCode vid) const;
+  // Variant kinds are a tiny dense enum, so lookups on the task wrapper's entry path are a
+  // bounds check plus a load rather than a map traversal
+  const VariantInfo* find_variant(LegateVariantCode vid) const
+  {
+    const auto idx = static_cast<size_t>(vid);
+    return idx < variants_.size() && variants_[idx].has_value() ? &*variants_[idx] : nullptr;
+  }
+  bool has_variant(LegateVariantCode vid) const
+  {
+    const auto idx = static_cast<size_t>(vid);
+    return idx < variants_.size() && variants_[idx].has_value();
+  }
 
  public:
   void register_task(Legion::TaskID task_id);
+  // Registers against an already-resolved runtime handle; used by the bulk registration
+  // path to avoid a runtime lookup per task
+  void register_task(Legion::Runtime* runtime, Legion::TaskID task_id);
 
  private:
   friend std::ostream& operator<<(std::ostream& os, const TaskInfo& info);
   std::string task_name_;
-  std::map<LegateVariantCode, VariantInfo> variants_;
+  // Directly indexed by the variant code; slot 0 (LEGATE_NO_VARIANT) stays empty
+  std::array<std::optional<VariantInfo>, LEGATE_OMP_VARIANT + 1> variants_{};
 };
 
 }  // namespace legate
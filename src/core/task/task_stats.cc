@@ -0,0 +1,190 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include "core/task/task_stats.h"
+
+namespace legate {
+namespace detail {
+
+static size_t bucket_of(uint64_t duration_ns)
+{
+  const uint64_t us = duration_ns / 1000;
+  const size_t idx  = 63 - __builtin_clzll(us | 1);
+  return std::min(idx, TaskStats::NUM_BUCKETS - 1);
+}
+
+static size_t volume_bucket_of(uint64_t volume)
+{
+  const size_t idx = 63 - __builtin_clzll(volume | 1);
+  return std::min(idx, TaskStats::NUM_VOLUME_BUCKETS - 1);
+}
+
+static const char* kind_name(Processor::Kind kind)
+{
+  switch (kind) {
+    case Processor::LOC_PROC: return "CPU";
+    case Processor::TOC_PROC: return "GPU";
+    case Processor::OMP_PROC: return "OMP";
+    default: return "???";
+  }
+}
+
+void TaskStats::record(const std::string& task_name,
+                       Processor proc,
+                       uint64_t duration_ns,
+                       uint64_t volume)
+{
+  auto& slot = slots_[proc.id & (LEGION_MAX_NUM_PROCS - 1)];
+
+  Histogram* histogram = nullptr;
+  {
+    // Only the owning processor mutates the slot, so this lock is uncontended except for
+    // the one-off races with the shutdown dump
+    const std::lock_guard<std::mutex> lock(slot.lock);
+    slot.kind = proc.kind();
+    histogram = &slot.histograms[task_name];
+  }
+
+  histogram->buckets[bucket_of(duration_ns)].fetch_add(1, std::memory_order_relaxed);
+  histogram->count.fetch_add(1, std::memory_order_relaxed);
+  histogram->total_ns.fetch_add(duration_ns, std::memory_order_relaxed);
+
+  const size_t vbucket = volume_bucket_of(volume);
+  histogram->volume_samples[vbucket].fetch_add(1, std::memory_order_relaxed);
+  histogram->volume_ns[vbucket].fetch_add(duration_ns, std::memory_order_relaxed);
+  histogram->volume_elems[vbucket].fetch_add(volume, std::memory_order_relaxed);
+}
+
+bool TaskStats::predict_time_ns(const std::string& task_name,
+                                Processor::Kind kind,
+                                uint64_t volume,
+                                uint64_t min_samples,
+                                uint64_t& time_ns) const
+{
+  uint64_t samples[NUM_VOLUME_BUCKETS] = {};
+  uint64_t ns[NUM_VOLUME_BUCKETS]      = {};
+  uint64_t elems[NUM_VOLUME_BUCKETS]   = {};
+  for (auto& slot : slots_) {
+    const std::lock_guard<std::mutex> lock(slot.lock);
+    if (slot.kind != kind) continue;
+    auto finder = slot.histograms.find(task_name);
+    if (slot.histograms.end() == finder) continue;
+    for (size_t idx = 0; idx < NUM_VOLUME_BUCKETS; ++idx) {
+      samples[idx] += finder->second.volume_samples[idx].load(std::memory_order_relaxed);
+      ns[idx] += finder->second.volume_ns[idx].load(std::memory_order_relaxed);
+      elems[idx] += finder->second.volume_elems[idx].load(std::memory_order_relaxed);
+    }
+  }
+
+  // Widen the window around the requested volume until it holds enough measurements, so the
+  // prediction comes from the closest volumes we have actually run at
+  const int64_t center = static_cast<int64_t>(volume_bucket_of(volume));
+  const int64_t limit  = static_cast<int64_t>(NUM_VOLUME_BUCKETS);
+  for (int64_t radius = 0; radius < limit; ++radius) {
+    uint64_t total_samples = 0, total_ns = 0, total_elems = 0;
+    for (int64_t idx = center - radius; idx <= center + radius; ++idx) {
+      if (idx < 0 || idx >= limit) continue;
+      total_samples += samples[idx];
+      total_ns += ns[idx];
+      total_elems += elems[idx];
+    }
+    if (total_samples < min_samples) continue;
+    if (0 == total_ns || 0 == total_elems) return false;
+    // Scale by the measured throughput (elements per nanosecond) of the window
+    const double predicted = static_cast<double>(volume) * total_ns / total_elems;
+    time_ns                = std::max<uint64_t>(1, static_cast<uint64_t>(predicted));
+    return true;
+  }
+  return false;
+}
+
+bool TaskStats::mean_task_time_ns(Processor::Kind kind,
+                                  uint64_t min_samples,
+                                  uint64_t& mean_ns) const
+{
+  uint64_t count = 0, total_ns = 0;
+  for (auto& slot : slots_) {
+    const std::lock_guard<std::mutex> lock(slot.lock);
+    if (slot.kind != kind) continue;
+    for (auto& [name, histogram] : slot.histograms) {
+      count += histogram.count.load(std::memory_order_relaxed);
+      total_ns += histogram.total_ns.load(std::memory_order_relaxed);
+    }
+  }
+  if (count < min_samples || 0 == count) return false;
+  mean_ns = total_ns / count;
+  return true;
+}
+
+void TaskStats::dump(Legion::Logger& logger) const
+{
+  struct Aggregate {
+    uint64_t buckets[NUM_BUCKETS] = {};
+    uint64_t count{0};
+    uint64_t total_ns{0};
+  };
+  // Aggregated across processors by (task name, processor kind)
+  std::map<std::pair<std::string, Processor::Kind>, Aggregate> aggregates;
+  for (auto& slot : slots_) {
+    const std::lock_guard<std::mutex> lock(slot.lock);
+    for (auto& [name, histogram] : slot.histograms) {
+      auto& aggregate = aggregates[{name, slot.kind}];
+      for (size_t idx = 0; idx < NUM_BUCKETS; ++idx)
+        aggregate.buckets[idx] += histogram.buckets[idx].load(std::memory_order_relaxed);
+      aggregate.count += histogram.count.load(std::memory_order_relaxed);
+      aggregate.total_ns += histogram.total_ns.load(std::memory_order_relaxed);
+    }
+  }
+  if (aggregates.empty()) return;
+
+  std::vector<const std::pair<const std::pair<std::string, Processor::Kind>, Aggregate>*> order;
+  for (auto& entry : aggregates) order.push_back(&entry);
+  std::sort(order.begin(), order.end(), [](auto* lhs, auto* rhs) {
+    return lhs->second.total_ns > rhs->second.total_ns;
+  });
+
+  logger.print("Task execution statistics (hottest first):");
+  for (auto* entry : order) {
+    auto& aggregate = entry->second;
+    logger.print("  %s <%s>: %llu calls, total %.3f ms, mean %.3f us",
+                 entry->first.first.c_str(),
+                 kind_name(entry->first.second),
+                 (unsigned long long)aggregate.count,
+                 aggregate.total_ns / 1e6,
+                 aggregate.total_ns / 1e3 / aggregate.count);
+    std::stringstream ss;
+    for (size_t idx = 0; idx < NUM_BUCKETS; ++idx) {
+      if (0 == aggregate.buckets[idx]) continue;
+      ss << " [<" << (1ULL << (idx + 1)) << "us: " << aggregate.buckets[idx] << "]";
+    }
+    logger.print("   %s", ss.str().c_str());
+  }
+}
+
+/*static*/ TaskStats* TaskStats::get_task_stats()
+{
+  static TaskStats* stats{nullptr};
+
+  if (nullptr == stats) stats = new TaskStats();
+  return stats;
+}
+
+}  // namespace detail
+}  // namespace legate
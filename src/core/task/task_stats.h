@@ -0,0 +1,91 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "legion.h"
+
+namespace legate {
+namespace detail {
+
+// Per-variant execution time histograms, collected by the task wrapper when LEGATE_TASK_STATS
+// is set and dumped at shutdown. Each processor records into its own slot: a Legion processor
+// runs one task at a time, so bumps into an existing histogram are plain relaxed atomic adds
+// with no locking on the execution path; the per-slot mutex is taken only when a task name is
+// seen for the first time on that processor (and by the shutdown dump, which also aggregates
+// across slots).
+class TaskStats {
+ public:
+  // Buckets are log2 of the execution time in microseconds; the last bucket absorbs
+  // everything from ~35 minutes up
+  static constexpr size_t NUM_BUCKETS = 32;
+  // Volume buckets are log2 of the number of elements the task touched
+  static constexpr size_t NUM_VOLUME_BUCKETS = 44;
+
+  struct Histogram {
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets{};
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> total_ns{0};
+    // Samples, time, and elements per volume bucket; this is the throughput model behind the
+    // calibrated processor-kind selection in the mapper
+    std::array<std::atomic<uint64_t>, NUM_VOLUME_BUCKETS> volume_samples{};
+    std::array<std::atomic<uint64_t>, NUM_VOLUME_BUCKETS> volume_ns{};
+    std::array<std::atomic<uint64_t>, NUM_VOLUME_BUCKETS> volume_elems{};
+  };
+
+ public:
+  void record(const std::string& task_name,
+              Processor proc,
+              uint64_t duration_ns,
+              uint64_t volume);
+  // Predicts how long `task_name` would take on `kind` for `volume` elements, from the
+  // measured throughput in the volume buckets around `volume` (widening the window until it
+  // holds `min_samples` measurements). Returns false while the variant is still uncalibrated
+  bool predict_time_ns(const std::string& task_name,
+                       Processor::Kind kind,
+                       uint64_t volume,
+                       uint64_t min_samples,
+                       uint64_t& time_ns) const;
+  // Mean execution time across every task recorded on processors of `kind`; returns false
+  // until at least `min_samples` executions have been measured
+  bool mean_task_time_ns(Processor::Kind kind, uint64_t min_samples, uint64_t& mean_ns) const;
+  // Prints per-variant counts, totals, and histograms, hottest variants first. GPU variants
+  // measure the launching wrapper's wall time, which excludes work left outstanding on
+  // streams at task end.
+  void dump(Legion::Logger& logger) const;
+
+ public:
+  static TaskStats* get_task_stats();
+
+ private:
+  struct ProcessorSlot {
+    mutable std::mutex lock{};
+    Processor::Kind kind{Processor::NO_KIND};
+    // A node-based map keeps references to histograms stable across insertions, so a
+    // recording thread can keep bumping a histogram while new names are added
+    std::map<std::string, Histogram> histograms{};
+  };
+  ProcessorSlot slots_[LEGION_MAX_NUM_PROCS];
+};
+
+}  // namespace detail
+}  // namespace legate
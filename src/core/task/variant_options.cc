@@ -42,6 +42,18 @@ VariantOptions& VariantOptions::with_concurrent(bool _concurrent)
   return *this;
 }
 
+VariantOptions& VariantOptions::with_replicable(bool _replicable)
+{
+  replicable = _replicable;
+  return *this;
+}
+
+VariantOptions& VariantOptions::with_fusable(bool _fusable)
+{
+  fusable = _fusable;
+  return *this;
+}
+
 VariantOptions& VariantOptions::with_return_size(size_t _return_size)
 {
   return_size = _return_size;
@@ -54,6 +66,7 @@ void VariantOptions::populate_registrar(Legion::TaskVariantRegistrar& registrar)
   registrar.set_inner(inner);
   registrar.set_idempotent(idempotent);
   registrar.set_concurrent(concurrent);
+  registrar.set_replicable(replicable);
 }
 
 std::ostream& operator<<(std::ostream& os, const VariantOptions& options)
@@ -61,7 +74,10 @@ std::ostream& operator<<(std::ostream& os, const VariantOptions& options)
   std::stringstream ss;
   ss << "(";
   if (options.leaf) ss << "leaf,";
+  if (options.idempotent) ss << "idempotent,";
   if (options.concurrent) ss << "concurrent,";
+  if (options.replicable) ss << "replicable,";
+  if (options.fusable) ss << "fusable,";
   ss << options.return_size << ")";
   os << std::move(ss).str();
   return os;
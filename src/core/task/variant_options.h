@@ -38,11 +38,28 @@ struct VariantOptions {
    */
   bool leaf{true};
   bool inner{false};
+  /**
+   * @brief If the flag is `true`, the variant is free of observable side effects and Legion
+   * may re-execute it (e.g. for speculative replay or resilience) without changing the
+   * program's outcome. `false` by default.
+   */
   bool idempotent{false};
   /**
    * @brief If the flag is `true`, the variant needs a concurrent task launch. `false` by default.
    */
   bool concurrent{false};
+  /**
+   * @brief If the flag is `true`, the variant is safe to replicate in control-replicated
+   * executions, allowing the scheduler to skip the analysis that otherwise guards it.
+   * `false` by default.
+   */
+  bool replicable{false};
+  /**
+   * @brief If the flag is `true`, the variant performs a pure elementwise computation and
+   * may be fused with adjacent fusable launches over the same launch domain. `false` by
+   * default.
+   */
+  bool fusable{false};
   /**
    * @brief Maximum aggregate size for scalar output values. 4096 by default.
    */
@@ -62,6 +79,18 @@ struct VariantOptions {
    * @param `concurrent` A new value for the `concurrent` flag
    */
   VariantOptions& with_concurrent(bool concurrent);
+  /**
+   * @brief Changes the value of the `replicable` flag
+   *
+   * @param `replicable` A new value for the `replicable` flag
+   */
+  VariantOptions& with_replicable(bool replicable);
+  /**
+   * @brief Changes the value of the `fusable` flag
+   *
+   * @param `fusable` A new value for the `fusable` flag
+   */
+  VariantOptions& with_fusable(bool fusable);
   /**
    * @brief Sets a maximum aggregate size for scalar output values
    *
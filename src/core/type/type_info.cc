@@ -14,6 +14,8 @@
  *
  */
 
+#include <iterator>
+#include <mutex>
 #include <numeric>
 #include <unordered_map>
 
@@ -61,9 +63,24 @@ const std::unordered_map<Type::Code, std::string> TYPE_NAMES = {
 
 const char* _VARIABLE_SIZE_ERROR_MESSAGE = "Variable-size element type cannot be used";
 
+uint64_t hash_combine(uint64_t seed, uint64_t value)
+{
+  return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+uint64_t code_hash(Type::Code code) { return hash_combine(0, static_cast<uint64_t>(code)); }
+
+template <typename Types>
+uint64_t struct_hash(const Types& field_types, bool align)
+{
+  uint64_t result = code_hash(Type::Code::STRUCT);
+  for (auto& field_type : field_types) result = hash_combine(result, field_type->hash());
+  return hash_combine(result, static_cast<uint64_t>(align));
+}
+
 }  // namespace
 
-Type::Type(Code c) : code(c) {}
+Type::Type(Code c, uint64_t hash) : code(c), hash_(hash) {}
 
 void Type::record_reduction_operator(int32_t op_kind, int32_t global_op_id) const
 {
@@ -75,7 +92,7 @@ int32_t Type::find_reduction_operator(int32_t op_kind) const
   return Runtime::get_runtime()->find_reduction_operator(uid(), op_kind);
 }
 
-PrimitiveType::PrimitiveType(Code code) : Type(code), size_(SIZEOF.at(code)) {}
+PrimitiveType::PrimitiveType(Code code) : Type(code, code_hash(code)), size_(SIZEOF.at(code)) {}
 
 int32_t PrimitiveType::uid() const { return static_cast<int32_t>(code); }
 
@@ -83,12 +100,19 @@ std::unique_ptr<Type> PrimitiveType::clone() const { return std::make_unique<Pri
 
 std::string PrimitiveType::to_string() const { return TYPE_NAMES.at(code); }
 
-ExtensionType::ExtensionType(int32_t uid, Type::Code code) : Type(code), uid_(uid) {}
+ExtensionType::ExtensionType(int32_t uid, Type::Code code, uint64_t hash)
+  : Type(code, hash), uid_(uid)
+{
+}
 
 FixedArrayType::FixedArrayType(int32_t uid,
-                               std::unique_ptr<Type> element_type,
+                               std::shared_ptr<const Type> element_type,
                                uint32_t N) noexcept(false)
-  : ExtensionType(uid, Type::Code::FIXED_ARRAY),
+  : ExtensionType(uid,
+                  Type::Code::FIXED_ARRAY,
+                  hash_combine(hash_combine(code_hash(Type::Code::FIXED_ARRAY),
+                                            element_type->hash()),
+                               N)),
     element_type_(std::move(element_type)),
     N_(N),
     size_(element_type_->size() * N)
@@ -98,7 +122,8 @@ FixedArrayType::FixedArrayType(int32_t uid,
 
 std::unique_ptr<Type> FixedArrayType::clone() const
 {
-  return std::make_unique<FixedArrayType>(uid_, element_type_->clone(), N_);
+  // Types are immutable, so the clone can share the element type handle
+  return std::make_unique<FixedArrayType>(uid_, element_type_, N_);
 }
 
 std::string FixedArrayType::to_string() const
@@ -111,7 +136,17 @@ std::string FixedArrayType::to_string() const
 StructType::StructType(int32_t uid,
                        std::vector<std::unique_ptr<Type>>&& field_types,
                        bool align) noexcept(false)
-  : ExtensionType(uid, Type::Code::STRUCT),
+  : StructType(uid,
+               std::vector<std::shared_ptr<const Type>>(std::make_move_iterator(field_types.begin()),
+                                                        std::make_move_iterator(field_types.end())),
+               align)
+{
+}
+
+StructType::StructType(int32_t uid,
+                       std::vector<std::shared_ptr<const Type>>&& field_types,
+                       bool align) noexcept(false)
+  : ExtensionType(uid, Type::Code::STRUCT, struct_hash(field_types, align)),
     aligned_(align),
     alignment_(1),
     size_(0),
@@ -144,8 +179,8 @@ StructType::StructType(int32_t uid,
 
 std::unique_ptr<Type> StructType::clone() const
 {
-  std::vector<std::unique_ptr<Type>> field_types;
-  for (auto& field_type : field_types_) field_types.push_back(field_type->clone());
+  // Types are immutable, so the clone can share the field type handles
+  auto field_types = field_types_;
   return std::make_unique<StructType>(uid_, std::move(field_types), aligned_);
 }
 
@@ -163,7 +198,25 @@ std::string StructType::to_string() const
 
 const Type& StructType::field_type(uint32_t field_idx) const { return *field_types_.at(field_idx); }
 
-StringType::StringType() : Type(Type::Code::STRING) {}
+bool FixedArrayType::equal(const Type& other) const
+{
+  // operator== has already matched the type codes
+  auto& casted = static_cast<const FixedArrayType&>(other);
+  return N_ == casted.N_ && *element_type_ == *casted.element_type_;
+}
+
+bool StructType::equal(const Type& other) const
+{
+  // operator== has already matched the type codes
+  auto& casted = static_cast<const StructType&>(other);
+  if (aligned_ != casted.aligned_ || field_types_.size() != casted.field_types_.size())
+    return false;
+  for (uint32_t idx = 0; idx < field_types_.size(); ++idx)
+    if (*field_types_[idx] != *casted.field_types_[idx]) return false;
+  return true;
+}
+
+StringType::StringType() : Type(Type::Code::STRING, code_hash(Type::Code::STRING)) {}
 
 int32_t StringType::uid() const { return static_cast<int32_t>(code); }
 
@@ -178,7 +231,7 @@ std::unique_ptr<Type> primitive_type(Type::Code code)
 
 std::unique_ptr<Type> string_type() { return std::make_unique<StringType>(); }
 
-std::unique_ptr<Type> fixed_array_type(std::unique_ptr<Type> element_type,
+std::unique_ptr<Type> fixed_array_type(std::shared_ptr<const Type> element_type,
                                        uint32_t N) noexcept(false)
 {
   // We use UIDs of the following format for "common" fixed array types
@@ -202,6 +255,49 @@ std::unique_ptr<Type> struct_type(std::vector<std::unique_ptr<Type>>&& field_typ
                                       align);
 }
 
+std::shared_ptr<const Type> intern_primitive_type(Type::Code code)
+{
+  static const std::unordered_map<Type::Code, std::shared_ptr<const Type>> CANONICAL = []() {
+    std::unordered_map<Type::Code, std::shared_ptr<const Type>> result;
+    for (auto& pair : SIZEOF) result[pair.first] = std::make_shared<PrimitiveType>(pair.first);
+    return result;
+  }();
+  return CANONICAL.at(code);
+}
+
+std::shared_ptr<const Type> intern_string_type()
+{
+  static const std::shared_ptr<const Type> CANONICAL = std::make_shared<StringType>();
+  return CANONICAL;
+}
+
+std::shared_ptr<const Type> intern_type(std::unique_ptr<Type> type)
+{
+  if (type->is_primitive()) return intern_primitive_type(type->code);
+  if (Type::Code::STRING == type->code) return intern_string_type();
+
+  // Extension types are interned by their unique ID; deserialization and mapping can run
+  // concurrently, so the registry is guarded
+  static std::mutex mutex;
+  static std::unordered_map<int32_t, std::shared_ptr<const Type>> registry;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto finder = registry.find(type->uid());
+  if (finder != registry.end()) return finder->second;
+  std::shared_ptr<const Type> result = std::move(type);
+  registry[result->uid()]            = result;
+  return result;
+}
+
+bool operator==(const Type& lhs, const Type& rhs)
+{
+  if (&lhs == &rhs) return true;
+  if (lhs.code != rhs.code || lhs.hash() != rhs.hash()) return false;
+  return lhs.equal(rhs);
+}
+
+bool operator!=(const Type& lhs, const Type& rhs) { return !(lhs == rhs); }
+
 std::ostream& operator<<(std::ostream& ostream, const Type::Code& code)
 {
   ostream << static_cast<int32_t>(code);
@@ -74,7 +74,7 @@ class Type {
   };
 
  protected:
-  Type(Code code);
+  Type(Code code, uint64_t hash);
 
  public:
   virtual ~Type() {}
@@ -130,6 +130,28 @@ class Type {
    */
   virtual bool is_primitive() const = 0;
 
+  /**
+   * @brief Returns a 64-bit structural hash of the type
+   *
+   * The hash is computed once at construction, covers the entire structure of the type
+   * (but not its unique ID), and is stable within a process, so equality checks can
+   * short-circuit on hash mismatch and containers can key on types directly.
+   *
+   * @return Structural hash of the type
+   */
+  uint64_t hash() const { return hash_; }
+
+  /**
+   * @brief Compares the type with another type structurally. Called by `operator==` only
+   * after the type codes and hashes have already matched.
+   *
+   * @param other Type to compare against
+   *
+   * @return true The types are structurally equal
+   * @return false Otherwise
+   */
+  virtual bool equal(const Type& other) const { return uid() == other.uid(); }
+
   /**
    * @brief Records a reduction operator.
    *
@@ -153,8 +175,21 @@ class Type {
   int32_t find_reduction_operator(int32_t op_kind) const;
 
   const Code code;
+
+ private:
+  const uint64_t hash_;
 };
 
+/**
+ * @ingroup types
+ * @brief Compares two types structurally
+ *
+ * Short-circuits on the cached structural hashes before walking the type trees.
+ */
+bool operator==(const Type& lhs, const Type& rhs);
+
+bool operator!=(const Type& lhs, const Type& rhs);
+
 /**
  * @ingroup types
  * @brief A class for primitive data types
@@ -201,7 +236,7 @@ class StringType : public Type {
  */
 class ExtensionType : public Type {
  public:
-  ExtensionType(int32_t uid, Type::Code code);
+  ExtensionType(int32_t uid, Type::Code code, uint64_t hash = 0);
   int32_t uid() const override { return uid_; }
   bool is_primitive() const override { return false; }
 
@@ -222,7 +257,7 @@ class FixedArrayType : public ExtensionType {
    * @param element_type Type of the array elements
    * @param N Size of the array
    */
-  FixedArrayType(int32_t uid, std::unique_ptr<Type> element_type, uint32_t N) noexcept(false);
+  FixedArrayType(int32_t uid, std::shared_ptr<const Type> element_type, uint32_t N) noexcept(false);
   uint32_t size() const override { return size_; }
   uint32_t alignment() const override { return element_type_->alignment(); }
   bool variable_size() const override { return false; }
@@ -240,9 +275,10 @@ class FixedArrayType : public ExtensionType {
    * @return Element type
    */
   const Type& element_type() const { return *element_type_; }
+  bool equal(const Type& other) const override;
 
  private:
-  const std::unique_ptr<Type> element_type_;
+  const std::shared_ptr<const Type> element_type_;
   const uint32_t N_;
   const uint32_t size_;
 };
@@ -261,6 +297,9 @@ class StructType : public ExtensionType {
    * @param align Optional boolean flag indicating whether the struct fields should be aligned.
    *              false by default.
    */
+  StructType(int32_t uid,
+             std::vector<std::shared_ptr<const Type>>&& field_types,
+             bool align = false) noexcept(false);
   StructType(int32_t uid,
              std::vector<std::unique_ptr<Type>>&& field_types,
              bool align = false) noexcept(false);
@@ -290,12 +329,13 @@ class StructType : public ExtensionType {
    * @return false Fields are compact
    */
   bool aligned() const { return aligned_; }
+  bool equal(const Type& other) const override;
 
  private:
   bool aligned_;
   uint32_t size_;
   uint32_t alignment_;
-  std::vector<std::unique_ptr<Type>> field_types_{};
+  std::vector<std::shared_ptr<const Type>> field_types_{};
   std::vector<uint32_t> offsets_{};
 };
 
@@ -328,7 +368,7 @@ std::unique_ptr<Type> string_type();
  *
  * @return Type object
  */
-std::unique_ptr<Type> fixed_array_type(std::unique_ptr<Type> element_type,
+std::unique_ptr<Type> fixed_array_type(std::shared_ptr<const Type> element_type,
                                        uint32_t N) noexcept(false);
 
 /**
@@ -342,6 +382,41 @@ std::unique_ptr<Type> fixed_array_type(std::unique_ptr<Type> element_type,
 std::unique_ptr<Type> struct_type(std::vector<std::unique_ptr<Type>>&& field_types,
                                   bool align = false) noexcept(false);
 
+/**
+ * @ingroup types
+ * @brief Returns the canonical shared handle for a primitive type
+ *
+ * Interned handles are immutable and live for the duration of the program, so repeated
+ * lookups are allocation-free.
+ *
+ * @param code Type code. Must be one of the primitive types.
+ *
+ * @return A shared immutable handle to the canonical type instance
+ */
+std::shared_ptr<const Type> intern_primitive_type(Type::Code code);
+
+/**
+ * @ingroup types
+ * @brief Returns the canonical shared handle for the string type
+ *
+ * @return A shared immutable handle to the canonical type instance
+ */
+std::shared_ptr<const Type> intern_string_type();
+
+/**
+ * @ingroup types
+ * @brief Canonicalizes a type behind a shared immutable handle
+ *
+ * Primitive and string types are routed to their canonical instances; extension types are
+ * interned by their unique ID, so every appearance of the same type after the first one
+ * resolves to the already registered instance.
+ *
+ * @param type Type to canonicalize
+ *
+ * @return A shared immutable handle to the canonical type instance
+ */
+std::shared_ptr<const Type> intern_type(std::unique_ptr<Type> type);
+
 std::ostream& operator<<(std::ostream&, const Type::Code&);
 
 std::ostream& operator<<(std::ostream&, const Type&);
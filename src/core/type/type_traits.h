@@ -217,4 +217,118 @@ struct is_complex_type<complex<float>> : std::true_type {};
 template <>
 struct is_complex_type<complex<double>> : std::true_type {};
 
+/**
+ * @ingroup util
+ * @brief Width in bytes of the widest SIMD vector unit on the target architecture
+ *
+ * Resolved at compile time from the architecture macros the compiler defines for its
+ * target, so kernels compiled for different targets in a fat binary each see their own
+ * width. On architectures without a known vector unit a 128-bit width is assumed; the
+ * constant steers loop blocking and is safe to over- or under-state.
+ */
+#if defined(__AVX512F__)
+constexpr size_t SIMD_WIDTH_BYTES = 64;
+#elif defined(__AVX2__) || defined(__AVX__)
+constexpr size_t SIMD_WIDTH_BYTES = 32;
+#else
+constexpr size_t SIMD_WIDTH_BYTES = 16;
+#endif
+
+/**
+ * @ingroup util
+ * @brief A predicate that holds if values of the type code vectorize on the host
+ *
+ * True for the fixed-width integral and floating point type codes. `BOOL`, `FLOAT16`, and
+ * the complex type codes do not map onto host vector lanes directly and stay scalar.
+ */
+template <Type::Code CODE>
+struct is_vectorizable {
+  static constexpr bool value = (is_integral<CODE>::value || is_floating_point<CODE>::value) &&
+                                !std::is_same<legate_type_of<CODE>, bool>::value &&
+                                !std::is_same<legate_type_of<CODE>, __half>::value;
+};
+
+namespace detail {
+
+template <typename T, bool VECTORIZABLE>
+struct SimdLanes {
+  static constexpr size_t value = SIMD_WIDTH_BYTES / sizeof(T);
+};
+
+template <typename T>
+struct SimdLanes<T, false> {
+  static constexpr size_t value = 1;
+};
+
+template <typename T>
+struct SimdVector {
+  using type = T;
+};
+
+#if !defined(__CUDACC__) && (defined(__GNUC__) || defined(__clang__))
+// GCC ignores the vector_size attribute on a dependent type, so the vectorizable types are
+// enumerated explicitly
+#define LEGATE_SIMD_VECTOR_OF(T)                                 \
+  template <>                                                    \
+  struct SimdVector<T> {                                         \
+    using type = T __attribute__((vector_size(SIMD_WIDTH_BYTES))); \
+  };
+LEGATE_SIMD_VECTOR_OF(int8_t)
+LEGATE_SIMD_VECTOR_OF(int16_t)
+LEGATE_SIMD_VECTOR_OF(int32_t)
+LEGATE_SIMD_VECTOR_OF(int64_t)
+LEGATE_SIMD_VECTOR_OF(uint8_t)
+LEGATE_SIMD_VECTOR_OF(uint16_t)
+LEGATE_SIMD_VECTOR_OF(uint32_t)
+LEGATE_SIMD_VECTOR_OF(uint64_t)
+LEGATE_SIMD_VECTOR_OF(float)
+LEGATE_SIMD_VECTOR_OF(double)
+#undef LEGATE_SIMD_VECTOR_OF
+#endif
+
+}  // namespace detail
+
+/**
+ * @ingroup util
+ * @brief Preferred number of elements of the type code processed per vector operation
+ *
+ * `SIMD_WIDTH_BYTES / sizeof(type)` for vectorizable type codes and 1 otherwise, so loops
+ * can block by this count unconditionally.
+ */
+template <Type::Code CODE>
+struct simd_lanes {
+  static constexpr size_t value =
+    detail::SimdLanes<legate_type_of<CODE>, is_vectorizable<CODE>::value>::value;
+};
+
+/**
+ * @ingroup util
+ * @brief A predicate that holds if the target fuses multiply-add into one instruction for
+ * the type code
+ *
+ * Kernels can use it to pick between an FMA-shaped accumulation and a separately rounded
+ * multiply-add when the two differ numerically.
+ */
+template <Type::Code CODE>
+struct has_fast_fma {
+#if defined(__FMA__) || defined(__AVX512F__) || defined(__ARM_FEATURE_FMA)
+  static constexpr bool value =
+    is_floating_point<CODE>::value && !std::is_same<legate_type_of<CODE>, __half>::value;
+#else
+  static constexpr bool value = false;
+#endif
+};
+
+/**
+ * @ingroup util
+ * @brief A naturally aligned vector of `simd_lanes` elements of the type code
+ *
+ * Defined via the GNU vector extension, so the usual arithmetic operators apply lane-wise.
+ * Falls back to the plain scalar type for non-vectorizable type codes and where the
+ * extension is unavailable (device code, other compilers), so code written against it
+ * degrades to scalar rather than failing to compile.
+ */
+template <Type::Code CODE>
+using simd_vector_of = typename detail::SimdVector<legate_type_of<CODE>>::type;
+
 }  // namespace legate
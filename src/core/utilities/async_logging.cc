@@ -0,0 +1,171 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "core/utilities/async_logging.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+namespace legate {
+namespace detail {
+
+/*static*/ bool AsyncLoggingBackend::enabled()
+{
+  static const bool enabled = [] {
+    const char* value = std::getenv("LEGATE_ASYNC_LOGGING");
+    return value != nullptr && std::atoi(value) > 0;
+  }();
+  return enabled;
+}
+
+/*static*/ void AsyncLoggingBackend::attach(Logger& logger)
+{
+  if (!enabled()) return;
+  logger.add_stream(get_backend(),
+                    Realm::Logger::LEVEL_SPEW,
+                    false /*delete_when_done*/,
+                    false /*flush_each_write*/);
+}
+
+/*static*/ AsyncLoggingBackend* AsyncLoggingBackend::get_backend()
+{
+  // Leaked intentionally: producer threads can log during process teardown, after static
+  // destructors would have torn the backend down
+  static AsyncLoggingBackend* backend = new AsyncLoggingBackend();
+  return backend;
+}
+
+AsyncLoggingBackend::AsyncLoggingBackend() : drainer_([this] { drain_loop(); }) {}
+
+AsyncLoggingBackend::~AsyncLoggingBackend()
+{
+  shutdown_.store(true);
+  if (drainer_.joinable()) drainer_.join();
+}
+
+void AsyncLoggingBackend::log_msg(Realm::Logger::LoggingLevel level,
+                                  const std::string& name,
+                                  const char* msgdata,
+                                  size_t msglen)
+{
+  // Format on the calling thread, where the level and logger name are at hand; the expensive
+  // part deferred to the drainer is the write
+  std::string record;
+  record.reserve(name.size() + msglen + 16);
+  record += '{';
+  record += std::to_string(static_cast<int32_t>(level));
+  record += "}{";
+  record += name;
+  record += "}: ";
+  record.append(msgdata, msglen);
+  record += '\n';
+
+  if (!local_ring()->try_enqueue(record.data(), record.size()))
+    // The ring is full; falling back to a synchronous write beats dropping the record
+    fwrite(record.data(), 1, record.size(), stderr);
+}
+
+void AsyncLoggingBackend::flush()
+{
+  // The drainer is the only consumer, so wait for it to catch up instead of draining here;
+  // flushes come from error paths where a bounded wait is acceptable
+  auto* ring = local_ring();
+  for (int32_t iter = 0; iter < 1000 && !ring->empty(); ++iter)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  fflush(stderr);
+}
+
+AsyncLoggingBackend::Ring* AsyncLoggingBackend::local_ring()
+{
+  static thread_local Ring* ring = [&] {
+    auto owned = std::make_unique<Ring>();
+    auto* raw  = owned.get();
+    std::lock_guard<std::mutex> lock(rings_lock_);
+    rings_.push_back(std::move(owned));
+    return raw;
+  }();
+  return ring;
+}
+
+void AsyncLoggingBackend::drain_loop()
+{
+  while (!shutdown_.load()) {
+    size_t drained = 0;
+    {
+      std::lock_guard<std::mutex> lock(rings_lock_);
+      for (auto& ring : rings_) drained += ring->drain(stderr);
+    }
+    if (drained > 0)
+      fflush(stderr);
+    else
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  // Final sweep so records enqueued between the last pass and shutdown still come out
+  std::lock_guard<std::mutex> lock(rings_lock_);
+  for (auto& ring : rings_) ring->drain(stderr);
+  fflush(stderr);
+}
+
+bool AsyncLoggingBackend::Ring::try_enqueue(const char* data, size_t len)
+{
+  auto head = head_.load(std::memory_order_relaxed);
+  auto tail = tail_.load(std::memory_order_acquire);
+  auto size = static_cast<uint32_t>(len);
+  if (sizeof(size) + len > CAPACITY - (head - tail)) return false;
+  write_bytes(head, &size, sizeof(size));
+  write_bytes(head + sizeof(size), data, len);
+  head_.store(head + sizeof(size) + len, std::memory_order_release);
+  return true;
+}
+
+size_t AsyncLoggingBackend::Ring::drain(std::FILE* out)
+{
+  auto tail    = tail_.load(std::memory_order_relaxed);
+  auto head    = head_.load(std::memory_order_acquire);
+  size_t count = 0;
+  std::vector<char> record;
+  while (tail < head) {
+    uint32_t size = 0;
+    read_bytes(tail, &size, sizeof(size));
+    record.resize(size);
+    read_bytes(tail + sizeof(size), record.data(), size);
+    fwrite(record.data(), 1, size, out);
+    tail += sizeof(size) + size;
+    ++count;
+  }
+  tail_.store(tail, std::memory_order_release);
+  return count;
+}
+
+void AsyncLoggingBackend::Ring::write_bytes(size_t offset, const void* data, size_t len)
+{
+  auto pos   = offset % CAPACITY;
+  auto chunk = std::min(len, CAPACITY - pos);
+  memcpy(buffer_.get() + pos, data, chunk);
+  if (chunk < len) memcpy(buffer_.get(), static_cast<const char*>(data) + chunk, len - chunk);
+}
+
+void AsyncLoggingBackend::Ring::read_bytes(size_t offset, void* data, size_t len) const
+{
+  auto pos   = offset % CAPACITY;
+  auto chunk = std::min(len, CAPACITY - pos);
+  memcpy(data, buffer_.get() + pos, chunk);
+  if (chunk < len) memcpy(static_cast<char*>(data) + chunk, buffer_.get(), len - chunk);
+}
+
+}  // namespace detail
+}  // namespace legate
@@ -0,0 +1,100 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "legion.h"
+
+#include "core/utilities/typedefs.h"
+
+namespace legate {
+namespace detail {
+
+// Asynchronous logging backend: formatting a record and writing it to the output file
+// synchronously on the calling thread perturbs timing enough that turning on mapper debug
+// logging can mask the very races being chased. When enabled, records are instead enqueued
+// into a lock-free single-producer single-consumer ring buffer owned by the calling thread
+// and written out by a background drainer thread, so the instrumented thread pays only a
+// format and a couple of memcpys.
+//
+// Enabled by setting LEGATE_ASYNC_LOGGING to a positive value. The backend registers as an
+// additional output stream on the loggers it is attached to; the streams Realm configured
+// from the command line keep writing synchronously, so quiet those via the usual -level
+// flags when async-only output is wanted. If a ring fills faster than the drainer empties
+// it, the overflowing record falls back to a synchronous write rather than being dropped.
+class AsyncLoggingBackend : public Realm::LoggerOutputStream {
+ public:
+  // True when LEGATE_ASYNC_LOGGING is set to a positive value; latched on first use
+  static bool enabled();
+  // Routes a copy of `logger`'s records through the async backend; no-op when not enabled
+  static void attach(Logger& logger);
+
+ public:
+  virtual void log_msg(Realm::Logger::LoggingLevel level,
+                       const std::string& name,
+                       const char* msgdata,
+                       size_t msglen) override;
+  virtual void flush() override;
+
+ private:
+  // SPSC ring of length-prefixed records over a circular byte buffer. The owning thread is
+  // the only writer and the drainer the only reader, so the monotonically increasing head
+  // and tail offsets are the only shared state.
+  class Ring {
+   public:
+    static constexpr size_t CAPACITY = 1 << 20;
+
+   public:
+    bool try_enqueue(const char* data, size_t len);
+    // Writes out all records enqueued so far and returns how many were drained
+    size_t drain(std::FILE* out);
+    bool empty() const { return head_.load() == tail_.load(); }
+
+   private:
+    void write_bytes(size_t offset, const void* data, size_t len);
+    void read_bytes(size_t offset, void* data, size_t len) const;
+
+   private:
+    std::unique_ptr<char[]> buffer_{new char[CAPACITY]};
+    std::atomic<size_t> head_{0};
+    std::atomic<size_t> tail_{0};
+  };
+
+ private:
+  AsyncLoggingBackend();
+  ~AsyncLoggingBackend();
+  static AsyncLoggingBackend* get_backend();
+  Ring* local_ring();
+  void drain_loop();
+
+ private:
+  // Ring registration happens once per producer thread; the drainer takes the same lock only
+  // to snapshot the list
+  std::mutex rings_lock_{};
+  std::vector<std::unique_ptr<Ring>> rings_{};
+  std::atomic<bool> shutdown_{false};
+  std::thread drainer_{};
+};
+
+}  // namespace detail
+}  // namespace legate
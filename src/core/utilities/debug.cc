@@ -33,6 +33,16 @@ struct print_dense_array_fn {
   }
 };
 
+struct summarize_dense_array_fn {
+  template <Type::Code CODE, int DIM>
+  ArraySummary operator()(const Store& store)
+  {
+    using T        = legate_type_of<CODE>;
+    Rect<DIM> rect = store.shape<DIM>();
+    return summarize_dense_array(store.read_accessor<T>(rect), rect);
+  }
+};
+
 }  // namespace
 
 std::string print_dense_array(const Store& store)
@@ -41,4 +51,20 @@ std::string print_dense_array(const Store& store)
   return double_dispatch(store.dim(), store.code(), print_dense_array_fn{}, store);
 }
 
+ArraySummary summarize_dense_array(const Store& store)
+{
+  assert(store.is_readable());
+  return double_dispatch(store.dim(), store.code(), summarize_dense_array_fn{}, store);
+}
+
+std::string ArraySummary::to_string() const
+{
+  std::stringstream ss;
+  ss << "ArraySummary(checksum: " << std::hex << checksum << std::dec
+     << ", num_elements: " << num_elements;
+  if (min_value <= max_value) ss << ", min: " << min_value << ", max: " << max_value;
+  ss << ", nan_count: " << nan_count << ")";
+  return std::move(ss).str();
+}
+
 }  // namespace legate
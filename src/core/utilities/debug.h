@@ -23,6 +23,10 @@
 #include <cuda_runtime_api.h>
 #endif
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <sstream>
 
 /** @defgroup util Utilities
@@ -138,4 +142,178 @@ std::string print_dense_array(ACC accessor, const Rect<DIM>& rect)
  */
 std::string print_dense_array(const Store& store);
 
+/**
+ * @ingroup util
+ * @brief A compact numeric fingerprint of a dense array
+ *
+ * Unlike `print_dense_array`, which materializes a full textual dump, a summary is a few
+ * words of metadata that can be computed over multi-GB stores and compared across ranks or
+ * runs when chasing numeric divergence. The checksum mixes each element's bit pattern with
+ * its position, so it is sensitive to both value and layout changes while staying
+ * independent of the number of threads that computed it.
+ */
+struct ArraySummary {
+  /**
+   * @brief Position-sensitive hash over the elements' bit patterns
+   */
+  uint64_t checksum{0};
+  /**
+   * @brief Minimum element value. Tracked only for arithmetic element types.
+   */
+  double min_value{std::numeric_limits<double>::max()};
+  /**
+   * @brief Maximum element value. Tracked only for arithmetic element types.
+   */
+  double max_value{std::numeric_limits<double>::lowest()};
+  /**
+   * @brief Number of NaN elements. Tracked only for floating-point element types.
+   */
+  size_t nan_count{0};
+  /**
+   * @brief Number of elements summarized
+   */
+  size_t num_elements{0};
+
+  /**
+   * @brief Renders the summary in a single-line human-readable form
+   *
+   * @return A string expressing the summary
+   */
+  std::string to_string() const;
+};
+
+namespace detail {
+
+// SplitMix64 finalizer over the element's bit pattern, folded in 8-byte chunks so wider
+// types (e.g. complex128) hash all of their bytes
+template <typename T>
+inline uint64_t hash_element(const T& value)
+{
+  uint64_t result = 0;
+  const char* src = reinterpret_cast<const char*>(&value);
+  for (size_t offset = 0; offset < sizeof(T); offset += sizeof(uint64_t)) {
+    uint64_t bits = 0;
+    memcpy(&bits, src + offset, std::min(sizeof(uint64_t), sizeof(T) - offset));
+    bits += 0x9E3779B97F4A7C15ULL;
+    bits = (bits ^ (bits >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    bits = (bits ^ (bits >> 27)) * 0x94D049BB133111EBULL;
+    result += bits ^ (bits >> 31);
+  }
+  return result;
+}
+
+template <typename T>
+inline void update_summary(ArraySummary& summary, const T& value, size_t idx)
+{
+  summary.checksum += hash_element(value) * (idx + 1);
+  if constexpr (std::is_arithmetic<T>::value) {
+    if constexpr (std::is_floating_point<T>::value)
+      if (std::isnan(value)) {
+        ++summary.nan_count;
+        return;
+      }
+    auto as_double = static_cast<double>(value);
+    if (as_double < summary.min_value) summary.min_value = as_double;
+    if (as_double > summary.max_value) summary.max_value = as_double;
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @ingroup util
+ * @brief Summarizes a dense array behind an accessor into an `ArraySummary`
+ *
+ * The instance must cover `rect` with an affine layout. When the layout is contiguous in
+ * row-major order the elements are scanned with a flat, OpenMP-parallel loop; other affine
+ * layouts fall back to a sequential walk. The result is deterministic either way.
+ *
+ * @param accessor Accessor to an array
+ * @param rect Sub-rectangle within which the elements should be summarized
+ *
+ * @return A summary of the array's contents
+ */
+template <typename T, int DIM>
+ArraySummary summarize_dense_array(const AccessorRO<T, DIM>& accessor, const Rect<DIM>& rect)
+{
+  ArraySummary summary;
+  summary.num_elements = rect.volume();
+  if (0 == summary.num_elements) return summary;
+
+  size_t strides[DIM];
+  const T* base      = accessor.ptr(rect, strides);
+  Point<DIM> extents = rect.hi - rect.lo + Point<DIM>::ONES();
+
+#ifdef LEGATE_USE_CUDA
+  T* buf = nullptr;
+  if (is_device_only_ptr(base)) {
+    size_t num_elems = 1;
+    for (size_t dim = 0; dim < DIM; ++dim) num_elems = MAX(num_elems, strides[dim] * extents[dim]);
+    buf             = new T[num_elems];
+    cudaError_t res = cudaMemcpy(buf, base, num_elems * sizeof(T), cudaMemcpyDeviceToHost);
+    assert(res == cudaSuccess);
+    base = buf;
+  }
+#endif  // LEGATE_USE_CUDA
+
+  bool dense      = true;
+  size_t expected = 1;
+  for (int32_t dim = DIM - 1; dim >= 0; --dim) {
+    if (extents[dim] > 1 && strides[dim] != expected) dense = false;
+    expected *= extents[dim];
+  }
+
+  if (dense) {
+    const int64_t volume = static_cast<int64_t>(summary.num_elements);
+    uint64_t checksum    = 0;
+    double min_value     = summary.min_value;
+    double max_value     = summary.max_value;
+    size_t nan_count     = 0;
+#if defined(LEGATE_USE_OPENMP) && defined(_OPENMP)
+#pragma omp parallel for schedule(static) reduction(+ : checksum, nan_count) \
+  reduction(min : min_value) reduction(max : max_value)
+#endif
+    for (int64_t idx = 0; idx < volume; ++idx) {
+      const T& value = base[idx];
+      checksum += detail::hash_element(value) * (static_cast<uint64_t>(idx) + 1);
+      if constexpr (std::is_arithmetic<T>::value) {
+        if constexpr (std::is_floating_point<T>::value)
+          if (std::isnan(value)) {
+            ++nan_count;
+            continue;
+          }
+        auto as_double = static_cast<double>(value);
+        if (as_double < min_value) min_value = as_double;
+        if (as_double > max_value) max_value = as_double;
+      }
+    }
+    summary.checksum  = checksum;
+    summary.min_value = min_value;
+    summary.max_value = max_value;
+    summary.nan_count = nan_count;
+  } else {
+    size_t idx = 0;
+    for (PointInRectIterator<DIM> itr(rect); itr.valid(); ++itr) {
+      coord_t offset = 0;
+      for (int32_t dim = 0; dim < DIM; ++dim) offset += ((*itr)[dim] - rect.lo[dim]) * strides[dim];
+      detail::update_summary(summary, base[offset], idx++);
+    }
+  }
+
+#ifdef LEGATE_USE_CUDA
+  if (buf != nullptr) delete[] buf;
+#endif  // LEGATE_USE_CUDA
+  return summary;
+}
+
+/**
+ * @ingroup util
+ * @brief Summarizes the store's contents into an `ArraySummary`
+ *
+ * @param store Store to summarize
+ *
+ * @return A summary of the store's contents
+ */
+ArraySummary summarize_dense_array(const Store& store);
+
 }  // namespace legate
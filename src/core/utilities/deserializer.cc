@@ -37,13 +37,23 @@ TaskDeserializer::TaskDeserializer(const Legion::Task* task,
   runtime->get_output_regions(ctx, outputs_);
 }
 
-void TaskDeserializer::_unpack(Store& value)
+void TaskDeserializer::_unpack(Store& value) { unpack_store(value, nullptr); }
+
+void TaskDeserializer::unpack_store(Store& value, StoreArgRecord* record)
 {
   auto is_future        = unpack<bool>();
   auto is_output_region = unpack<bool>();
   auto dim              = unpack<int32_t>();
   auto type             = unpack_type();
 
+  if (record != nullptr) {
+    record->type        = type;
+    record->dim         = dim;
+    record->is_future   = is_future;
+    record->is_unbound  = is_output_region;
+    record->body_offset = current_offset();
+  }
+
   auto transform = unpack_transform();
 
   if (is_future) {
@@ -63,6 +73,47 @@ void TaskDeserializer::_unpack(Store& value)
   }
 }
 
+Store TaskDeserializer::replay_store(const StoreArgRecord& record)
+{
+  // Jump straight to the store's body; the header in front of it (flags, dim, and type)
+  // has already been resolved into the record
+  args_ = full_args_.subspan(record.body_offset);
+
+  Store value;
+  auto transform = unpack_transform();
+  auto redop_id  = unpack<int32_t>();
+  if (record.is_future) {
+    auto fut = unpack<FutureWrapper>();
+    if (redop_id != -1 && !fut.valid()) fut.initialize_with_identity(redop_id);
+    value = Store(record.dim, record.type, redop_id, fut, std::move(transform));
+  } else if (!record.is_unbound) {
+    auto rf = unpack<RegionField>();
+    value   = Store(record.dim, record.type, redop_id, std::move(rf), std::move(transform));
+  } else {
+    assert(redop_id == -1);
+    auto out = unpack<UnboundRegionField>();
+    value    = Store(record.dim, record.type, std::move(out), std::move(transform));
+  }
+  return value;
+}
+
+Scalar TaskDeserializer::unpack_scalar(ScalarArgRecord* record)
+{
+  auto type = unpack_type();
+  if (record != nullptr) {
+    record->type        = type;
+    record->data_offset = current_offset();
+  }
+  Scalar value(std::move(type), args_.ptr());
+  args_ = args_.subspan(value.size());
+  return value;
+}
+
+Scalar TaskDeserializer::replay_scalar(const ScalarArgRecord& record) const
+{
+  return Scalar(record.type, full_args_.ptr() + record.data_offset);
+}
+
 void TaskDeserializer::_unpack(FutureWrapper& value)
 {
   auto read_only    = unpack<bool>();
@@ -77,6 +128,19 @@ void TaskDeserializer::_unpack(FutureWrapper& value)
     domain.rect_data[idx + domain.dim] = point[idx] - 1;
   }
 
+  auto has_inline_data = unpack<bool>();
+  if (has_inline_data) {
+    // The payload follows in the argument blob, which outlives the task, so the wrapper can
+    // alias it instead of going through a future
+#ifdef DEBUG_LEGATE
+    assert(read_only);
+#endif
+    auto* inline_data = args_.ptr();
+    args_             = args_.subspan(field_size);
+    value             = FutureWrapper(field_size, domain, inline_data);
+    return;
+  }
+
   auto has_storage      = future_index >= 0;
   Legion::Future future = has_storage ? futures_[future_index] : Legion::Future();
   value                 = FutureWrapper(read_only, field_size, domain, future, has_storage);
@@ -163,7 +227,7 @@ void TaskDeserializer::_unpack(FutureWrapper& value)
   // We still need to deserialize these fields to get to the domain
   unpack<bool>();
   auto future_index = unpack<int32_t>();
-  unpack<uint32_t>();
+  auto field_size   = unpack<uint32_t>();
 
   auto point = unpack<std::vector<int64_t>>();
   Domain domain;
@@ -173,6 +237,10 @@ void TaskDeserializer::_unpack(FutureWrapper& value)
     domain.rect_data[idx + domain.dim] = point[idx] - 1;
   }
 
+  // Skip over any payload the launcher inlined into the blob
+  auto has_inline_data = unpack<bool>();
+  if (has_inline_data) args_ = args_.subspan(field_size);
+
   value = FutureWrapper(future_index, domain);
 }
 
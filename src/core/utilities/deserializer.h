@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstring>
 #include <memory>
 
 #include "legion.h"
@@ -45,6 +46,19 @@ class BaseDeserializer {
     static_cast<Deserializer*>(this)->_unpack(value);
     return std::move(value);
   }
+  // Zero-copy alternative to unpack<std::vector<T>>: the returned span aliases the task's
+  // argument buffer, which outlives the deserializer, so callers that don't need ownership
+  // can skip the allocation and copy altogether
+  template <typename T>
+  Span<const T> unpack_span()
+  {
+    static_assert(legate_type_code_of<T> != Type::Code::INVALID,
+                  "Spans can be unpacked only for types packed as raw bytes");
+    auto size  = unpack<uint32_t>();
+    auto* data = reinterpret_cast<const T*>(args_.ptr());
+    args_      = args_.subspan(size * sizeof(T));
+    return Span<const T>(data, size);
+  }
 
  public:
   template <typename T, std::enable_if_t<legate_type_code_of<T> != Type::Code::INVALID>* = nullptr>
@@ -59,8 +73,16 @@ class BaseDeserializer {
   void _unpack(std::vector<T>& values)
   {
     auto size = unpack<uint32_t>();
-    values.reserve(size);
-    for (uint32_t idx = 0; idx < size; ++idx) values.emplace_back(unpack<T>());
+    // Elements with a valid type code are unpacked by raw copies, so the whole payload
+    // can be copied in bulk instead of element by element
+    if constexpr (legate_type_code_of<T> != Type::Code::INVALID) {
+      values.resize(size);
+      if (size > 0) memcpy(values.data(), args_.ptr(), size * sizeof(T));
+      args_ = args_.subspan(size * sizeof(T));
+    } else {
+      values.reserve(size);
+      for (uint32_t idx = 0; idx < size; ++idx) values.emplace_back(unpack<T>());
+    }
   }
   template <typename T1, typename T2>
   void _unpack(std::pair<T1, T2>& values)
@@ -80,10 +102,36 @@ class BaseDeserializer {
 
  protected:
   std::shared_ptr<TransformStack> unpack_transform();
-  std::unique_ptr<Type> unpack_type();
+  std::shared_ptr<const Type> unpack_type();
+
+ protected:
+  size_t current_offset() const { return args_.ptr() - full_args_.ptr(); }
 
  protected:
   Span<const int8_t> args_;
+  Span<const int8_t> full_args_;
+};
+
+// Recorded layout of a store argument. Task launches with identical argument blobs repeat
+// millions of times, so the structural parts resolved on the first deserialization (the
+// type and the offset of the store's body) are recorded and later invocations rebuild the
+// store directly against their own regions and futures. The body (transform, reduction op,
+// and field or future descriptor) is replayed from the recorded offset: transform stacks
+// cannot be shared across invocations, as stores may mutate them (see
+// `Store::remove_transform`).
+struct StoreArgRecord {
+  std::shared_ptr<const Type> type{nullptr};
+  int32_t dim{-1};
+  bool is_future{false};
+  bool is_unbound{false};
+  size_t body_offset{0};
+};
+
+// Recorded layout of a scalar argument; scalars are shared and point straight into the
+// argument blob, so replaying one is a single offset read
+struct ScalarArgRecord {
+  std::shared_ptr<const Type> type{nullptr};
+  size_t data_offset{0};
 };
 
 class TaskDeserializer : public BaseDeserializer<TaskDeserializer> {
@@ -101,6 +149,14 @@ class TaskDeserializer : public BaseDeserializer<TaskDeserializer> {
   void _unpack(comm::Communicator& value);
   void _unpack(Legion::PhaseBarrier& barrier);
 
+ public:
+  // Unpacks a store or scalar while recording its layout for later replay
+  void unpack_store(Store& value, StoreArgRecord* record);
+  Scalar unpack_scalar(ScalarArgRecord* record);
+  // Rebuilds a store or scalar from a recorded layout against this invocation's resources
+  Store replay_store(const StoreArgRecord& record);
+  Scalar replay_scalar(const ScalarArgRecord& record) const;
+
  private:
   Span<const Legion::Future> futures_;
   Span<const Legion::PhysicalRegion> regions_;
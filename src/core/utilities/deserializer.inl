@@ -18,7 +18,7 @@ namespace legate {
 
 template <typename Deserializer>
 BaseDeserializer<Deserializer>::BaseDeserializer(const void* args, size_t arglen)
-  : args_(Span<const int8_t>(static_cast<const int8_t*>(args), arglen))
+  : args_(Span<const int8_t>(static_cast<const int8_t*>(args), arglen)), full_args_(args_)
 {
 }
 
@@ -104,7 +104,7 @@ std::shared_ptr<TransformStack> BaseDeserializer<Deserializer>::unpack_transform
 }
 
 template <typename Deserializer>
-std::unique_ptr<Type> BaseDeserializer<Deserializer>::unpack_type()
+std::shared_ptr<const Type> BaseDeserializer<Deserializer>::unpack_type()
 {
   auto code = static_cast<Type::Code>(unpack<int32_t>());
   switch (code) {
@@ -112,19 +112,19 @@ std::unique_ptr<Type> BaseDeserializer<Deserializer>::unpack_type()
       auto uid  = unpack<uint32_t>();
       auto N    = unpack<uint32_t>();
       auto type = unpack_type();
-      return std::make_unique<FixedArrayType>(uid, std::move(type), N);
+      return intern_type(std::make_unique<FixedArrayType>(uid, std::move(type), N));
     }
     case Type::Code::STRUCT: {
       auto uid        = unpack<uint32_t>();
       auto num_fields = unpack<uint32_t>();
 
-      std::vector<std::unique_ptr<Type>> field_types;
+      std::vector<std::shared_ptr<const Type>> field_types;
       field_types.reserve(num_fields);
       for (uint32_t idx = 0; idx < num_fields; ++idx) field_types.emplace_back(unpack_type());
 
       auto align = unpack<bool>();
 
-      return std::make_unique<StructType>(uid, std::move(field_types), align);
+      return intern_type(std::make_unique<StructType>(uid, std::move(field_types), align));
     }
     case Type::Code::BOOL:
     case Type::Code::INT8:
@@ -140,10 +140,10 @@ std::unique_ptr<Type> BaseDeserializer<Deserializer>::unpack_type()
     case Type::Code::FLOAT64:
     case Type::Code::COMPLEX64:
     case Type::Code::COMPLEX128: {
-      return std::make_unique<PrimitiveType>(code);
+      return intern_primitive_type(code);
     }
     case Type::Code::STRING: {
-      return std::make_unique<StringType>();
+      return intern_string_type();
     }
     default: {
       LEGATE_ABORT;
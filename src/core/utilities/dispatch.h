@@ -16,7 +16,15 @@
 
 #pragma once
 
+#include <array>
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+#include "legate_defines.h"
+
 #include "core/type/type_info.h"
+#include "core/utilities/typedefs.h"
 
 /**
  * @file
@@ -24,122 +32,231 @@
  */
 namespace legate {
 
+/**
+ * @ingroup util
+ * @brief Compile-time allowlist for type codes in dispatch routines
+ *
+ * Dispatch routines instantiate the dispatched functor for every enabled combination of
+ * type code and dimension, whether or not a deployment ever dispatches to it. Specialize
+ * this trait to `std::false_type` for a type code (before any dispatch call is instantiated)
+ * to prune all instantiations for that code from the binary. Pruned combinations abort
+ * when reached at runtime.
+ */
+template <Type::Code CODE>
+struct type_dispatch_enabled : std::true_type {};
+
+/**
+ * @ingroup util
+ * @brief Compile-time allowlist for dimensions in dispatch routines
+ *
+ * Specialize this trait to `std::false_type` for a dimension (before any dispatch call is
+ * instantiated) to prune all instantiations for that dimension from the binary. Dimensions
+ * greater than `LEGATE_MAX_DIM` are always disabled. Pruned combinations abort when reached
+ * at runtime.
+ */
 template <int DIM>
-struct inner_type_dispatch_fn {
-  template <typename Functor, typename... Fnargs>
-  constexpr decltype(auto) operator()(Type::Code code, Functor f, Fnargs&&... args)
-  {
-    switch (code) {
-      case Type::Code::BOOL: {
-        return f.template operator()<Type::Code::BOOL, DIM>(std::forward<Fnargs>(args)...);
-      }
-      case Type::Code::INT8: {
-        return f.template operator()<Type::Code::INT8, DIM>(std::forward<Fnargs>(args)...);
-      }
-      case Type::Code::INT16: {
-        return f.template operator()<Type::Code::INT16, DIM>(std::forward<Fnargs>(args)...);
-      }
-      case Type::Code::INT32: {
-        return f.template operator()<Type::Code::INT32, DIM>(std::forward<Fnargs>(args)...);
-      }
-      case Type::Code::INT64: {
-        return f.template operator()<Type::Code::INT64, DIM>(std::forward<Fnargs>(args)...);
-      }
-      case Type::Code::UINT8: {
-        return f.template operator()<Type::Code::UINT8, DIM>(std::forward<Fnargs>(args)...);
-      }
-      case Type::Code::UINT16: {
-        return f.template operator()<Type::Code::UINT16, DIM>(std::forward<Fnargs>(args)...);
-      }
-      case Type::Code::UINT32: {
-        return f.template operator()<Type::Code::UINT32, DIM>(std::forward<Fnargs>(args)...);
-      }
-      case Type::Code::UINT64: {
-        return f.template operator()<Type::Code::UINT64, DIM>(std::forward<Fnargs>(args)...);
-      }
-      case Type::Code::FLOAT16: {
-        return f.template operator()<Type::Code::FLOAT16, DIM>(std::forward<Fnargs>(args)...);
-      }
-      case Type::Code::FLOAT32: {
-        return f.template operator()<Type::Code::FLOAT32, DIM>(std::forward<Fnargs>(args)...);
-      }
-      case Type::Code::FLOAT64: {
-        return f.template operator()<Type::Code::FLOAT64, DIM>(std::forward<Fnargs>(args)...);
-      }
-      case Type::Code::COMPLEX64: {
-        return f.template operator()<Type::Code::COMPLEX64, DIM>(std::forward<Fnargs>(args)...);
-      }
-      case Type::Code::COMPLEX128: {
-        return f.template operator()<Type::Code::COMPLEX128, DIM>(std::forward<Fnargs>(args)...);
-      }
-      default: break;
-    }
-    assert(false);
-    return f.template operator()<Type::Code::BOOL, DIM>(std::forward<Fnargs>(args)...);
-  }
+struct dim_dispatch_enabled : std::bool_constant<(DIM >= 1 && DIM <= LEGATE_MAX_DIM)> {};
+
+/**
+ * @ingroup util
+ * @brief Compile-time allowlist for type code pairs in `type_type_dispatch`
+ *
+ * Mixed-type kernels instantiate quadratically many combinations, so they get their own
+ * pairwise mask: by default a pair is enabled when both codes pass `type_dispatch_enabled`,
+ * and deployments can specialize the trait further to keep only the conversions they
+ * actually perform. Pruned combinations abort when reached at runtime.
+ */
+template <Type::Code CODE1, Type::Code CODE2>
+struct type_type_dispatch_enabled
+  : std::bool_constant<type_dispatch_enabled<CODE1>::value && type_dispatch_enabled<CODE2>::value> {
 };
 
-template <int DIM>
-struct inner_dim_dispatch_fn {
-  template <typename Functor, typename... Fnargs>
-  constexpr decltype(auto) operator()(int dim, Functor f, Fnargs&&... args)
-  {
-    switch (dim) {
-      case 1: {
-        return f.template operator()<DIM, 1>(std::forward<Fnargs>(args)...);
-      }
-#if LEGATE_MAX_DIM >= 2
-      case 2: {
-        return f.template operator()<DIM, 2>(std::forward<Fnargs>(args)...);
-      }
-#endif
-#if LEGATE_MAX_DIM >= 3
-      case 3: {
-        return f.template operator()<DIM, 3>(std::forward<Fnargs>(args)...);
-      }
-#endif
-#if LEGATE_MAX_DIM >= 4
-      case 4: {
-        return f.template operator()<DIM, 4>(std::forward<Fnargs>(args)...);
-      }
-#endif
-#if LEGATE_MAX_DIM >= 5
-      case 5: {
-        return f.template operator()<DIM, 5>(std::forward<Fnargs>(args)...);
-      }
-#endif
-#if LEGATE_MAX_DIM >= 6
-      case 6: {
-        return f.template operator()<DIM, 6>(std::forward<Fnargs>(args)...);
-      }
-#endif
-#if LEGATE_MAX_DIM >= 7
-      case 7: {
-        return f.template operator()<DIM, 7>(std::forward<Fnargs>(args)...);
-      }
-#endif
-#if LEGATE_MAX_DIM >= 8
-      case 8: {
-        return f.template operator()<DIM, 8>(std::forward<Fnargs>(args)...);
-      }
-#endif
-#if LEGATE_MAX_DIM >= 9
-      case 9: {
-        return f.template operator()<DIM, 9>(std::forward<Fnargs>(args)...);
-      }
-#endif
-    }
-    assert(false);
-    return f.template operator()<DIM, 1>(std::forward<Fnargs>(args)...);
-  }
+namespace detail {
+
+// Dispatchable type codes, in flat table order
+inline constexpr std::array<Type::Code, 14> DISPATCH_TYPE_CODES = {
+  Type::Code::BOOL,
+  Type::Code::INT8,
+  Type::Code::INT16,
+  Type::Code::INT32,
+  Type::Code::INT64,
+  Type::Code::UINT8,
+  Type::Code::UINT16,
+  Type::Code::UINT32,
+  Type::Code::UINT64,
+  Type::Code::FLOAT16,
+  Type::Code::FLOAT32,
+  Type::Code::FLOAT64,
+  Type::Code::COMPLEX64,
+  Type::Code::COMPLEX128,
 };
 
+inline constexpr int32_t NUM_DISPATCH_TYPE_CODES =
+  static_cast<int32_t>(DISPATCH_TYPE_CODES.size());
+
+constexpr int32_t dispatch_type_index(Type::Code code)
+{
+  for (int32_t idx = 0; idx < NUM_DISPATCH_TYPE_CODES; ++idx)
+    if (DISPATCH_TYPE_CODES[idx] == code) return idx;
+  return -1;
+}
+
+// A single dispatch deduces one return type shared by all of its branches, so the result
+// type can be probed from any one combination's signature; we use the first one.
+template <typename Functor, typename... Fnargs>
+using type_dim_dispatch_result_t = decltype(
+  std::declval<Functor>().template operator()<Type::Code::BOOL, 1>(std::declval<Fnargs>()...));
+
+template <typename Functor, typename... Fnargs>
+using dim_dim_dispatch_result_t =
+  decltype(std::declval<Functor>().template operator()<1, 1>(std::declval<Fnargs>()...));
+
+template <typename Functor, typename... Fnargs>
+using dim_dispatch_result_t =
+  decltype(std::declval<Functor>().template operator()<1>(std::declval<Fnargs>()...));
+
+template <typename Functor, typename... Fnargs>
+using type_dispatch_result_t =
+  decltype(std::declval<Functor>().template operator()<Type::Code::BOOL>(std::declval<Fnargs>()...));
+
+template <typename Functor, typename... Fnargs>
+using type_type_dispatch_result_t =
+  decltype(std::declval<Functor>().template operator()<Type::Code::BOOL, Type::Code::BOOL>(
+    std::declval<Fnargs>()...));
+
+template <Type::Code CODE, int DIM, typename Functor, typename... Fnargs>
+type_dim_dispatch_result_t<Functor, Fnargs...> type_dim_dispatch_entry(Functor f,
+                                                                       Fnargs&&... args)
+{
+  if constexpr (type_dispatch_enabled<CODE>::value && dim_dispatch_enabled<DIM>::value)
+    return f.template operator()<CODE, DIM>(std::forward<Fnargs>(args)...);
+  else
+    // This combination was pruned at configuration time
+    LEGATE_ABORT;
+}
+
+template <int DIM1, int DIM2, typename Functor, typename... Fnargs>
+dim_dim_dispatch_result_t<Functor, Fnargs...> dim_dim_dispatch_entry(Functor f, Fnargs&&... args)
+{
+  if constexpr (dim_dispatch_enabled<DIM1>::value && dim_dispatch_enabled<DIM2>::value)
+    return f.template operator()<DIM1, DIM2>(std::forward<Fnargs>(args)...);
+  else
+    LEGATE_ABORT;
+}
+
+template <int DIM, typename Functor, typename... Fnargs>
+dim_dispatch_result_t<Functor, Fnargs...> dim_dispatch_entry(Functor f, Fnargs&&... args)
+{
+  if constexpr (dim_dispatch_enabled<DIM>::value)
+    return f.template operator()<DIM>(std::forward<Fnargs>(args)...);
+  else
+    LEGATE_ABORT;
+}
+
+template <Type::Code CODE, typename Functor, typename... Fnargs>
+type_dispatch_result_t<Functor, Fnargs...> type_dispatch_entry(Functor f, Fnargs&&... args)
+{
+  if constexpr (type_dispatch_enabled<CODE>::value)
+    return f.template operator()<CODE>(std::forward<Fnargs>(args)...);
+  else
+    LEGATE_ABORT;
+}
+
+template <Type::Code CODE1, Type::Code CODE2, typename Functor, typename... Fnargs>
+type_type_dispatch_result_t<Functor, Fnargs...> type_type_dispatch_entry(Functor f,
+                                                                         Fnargs&&... args)
+{
+  if constexpr (type_type_dispatch_enabled<CODE1, CODE2>::value)
+    return f.template operator()<CODE1, CODE2>(std::forward<Fnargs>(args)...);
+  else
+    LEGATE_ABORT;
+}
+
+// Builders for the flat dispatch tables. Entry IDX of a two-level table covers the
+// combination (IDX / inner table size, IDX % inner table size).
+
+template <typename Functor, typename... Fnargs, size_t... IDX>
+constexpr auto make_type_dim_dispatch_table(std::index_sequence<IDX...>)
+{
+  using Entry = type_dim_dispatch_result_t<Functor, Fnargs...> (*)(Functor, Fnargs&&...);
+  constexpr auto NUM_CODES = static_cast<size_t>(NUM_DISPATCH_TYPE_CODES);
+  return std::array<Entry, sizeof...(IDX)>{
+    &type_dim_dispatch_entry<DISPATCH_TYPE_CODES[IDX % NUM_CODES],
+                             static_cast<int>(IDX / NUM_CODES) + 1,
+                             Functor,
+                             Fnargs...>...};
+}
+
+template <typename Functor, typename... Fnargs, size_t... IDX>
+constexpr auto make_dim_dim_dispatch_table(std::index_sequence<IDX...>)
+{
+  using Entry = dim_dim_dispatch_result_t<Functor, Fnargs...> (*)(Functor, Fnargs&&...);
+  return std::array<Entry, sizeof...(IDX)>{
+    &dim_dim_dispatch_entry<static_cast<int>(IDX / LEGATE_MAX_DIM) + 1,
+                            static_cast<int>(IDX % LEGATE_MAX_DIM) + 1,
+                            Functor,
+                            Fnargs...>...};
+}
+
+template <typename Functor, typename... Fnargs, size_t... IDX>
+constexpr auto make_dim_dispatch_table(std::index_sequence<IDX...>)
+{
+  using Entry = dim_dispatch_result_t<Functor, Fnargs...> (*)(Functor, Fnargs&&...);
+  return std::array<Entry, sizeof...(IDX)>{
+    &dim_dispatch_entry<static_cast<int>(IDX) + 1, Functor, Fnargs...>...};
+}
+
+template <typename Functor, typename... Fnargs, size_t... IDX>
+constexpr auto make_type_dispatch_table(std::index_sequence<IDX...>)
+{
+  using Entry = type_dispatch_result_t<Functor, Fnargs...> (*)(Functor, Fnargs&&...);
+  return std::array<Entry, sizeof...(IDX)>{
+    &type_dispatch_entry<DISPATCH_TYPE_CODES[IDX], Functor, Fnargs...>...};
+}
+
+template <typename Functor, typename... Fnargs>
+inline constexpr auto TYPE_DIM_DISPATCH_TABLE = make_type_dim_dispatch_table<Functor, Fnargs...>(
+  std::make_index_sequence<LEGATE_MAX_DIM * NUM_DISPATCH_TYPE_CODES>{});
+
+template <typename Functor, typename... Fnargs>
+inline constexpr auto DIM_DIM_DISPATCH_TABLE = make_dim_dim_dispatch_table<Functor, Fnargs...>(
+  std::make_index_sequence<LEGATE_MAX_DIM * LEGATE_MAX_DIM>{});
+
+template <typename Functor, typename... Fnargs>
+inline constexpr auto DIM_DISPATCH_TABLE =
+  make_dim_dispatch_table<Functor, Fnargs...>(std::make_index_sequence<LEGATE_MAX_DIM>{});
+
+template <typename Functor, typename... Fnargs, size_t... IDX>
+constexpr auto make_type_type_dispatch_table(std::index_sequence<IDX...>)
+{
+  using Entry = type_type_dispatch_result_t<Functor, Fnargs...> (*)(Functor, Fnargs&&...);
+  constexpr auto NUM_CODES = static_cast<size_t>(NUM_DISPATCH_TYPE_CODES);
+  return std::array<Entry, sizeof...(IDX)>{
+    &type_type_dispatch_entry<DISPATCH_TYPE_CODES[IDX / NUM_CODES],
+                              DISPATCH_TYPE_CODES[IDX % NUM_CODES],
+                              Functor,
+                              Fnargs...>...};
+}
+
+template <typename Functor, typename... Fnargs>
+inline constexpr auto TYPE_DISPATCH_TABLE = make_type_dispatch_table<Functor, Fnargs...>(
+  std::make_index_sequence<NUM_DISPATCH_TYPE_CODES>{});
+
+template <typename Functor, typename... Fnargs>
+inline constexpr auto TYPE_TYPE_DISPATCH_TABLE = make_type_type_dispatch_table<Functor, Fnargs...>(
+  std::make_index_sequence<NUM_DISPATCH_TYPE_CODES * NUM_DISPATCH_TYPE_CODES>{});
+
+}  // namespace detail
+
 /**
  * @ingroup util
  * @brief Converts the runtime dimension and type code into compile time constants and
  * invokes the functor with them
  *
  * The functor's `operator()` should take a dimension and a type code as template parameters.
+ * The call is routed through a flat table of the enabled combinations indexed by
+ * `(dim, code)`; combinations pruned via `type_dispatch_enabled` or `dim_dispatch_enabled`
+ * abort when reached.
  *
  * @param dim Dimension
  * @param code Type code
@@ -151,55 +268,15 @@ struct inner_dim_dispatch_fn {
 template <typename Functor, typename... Fnargs>
 constexpr decltype(auto) double_dispatch(int dim, Type::Code code, Functor f, Fnargs&&... args)
 {
-  switch (dim) {
-#if LEGATE_MAX_DIM >= 1
-    case 1: {
-      return inner_type_dispatch_fn<1>{}(code, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 2
-    case 2: {
-      return inner_type_dispatch_fn<2>{}(code, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 3
-    case 3: {
-      return inner_type_dispatch_fn<3>{}(code, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 4
-    case 4: {
-      return inner_type_dispatch_fn<4>{}(code, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 5
-    case 5: {
-      return inner_type_dispatch_fn<5>{}(code, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 6
-    case 6: {
-      return inner_type_dispatch_fn<6>{}(code, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 7
-    case 7: {
-      return inner_type_dispatch_fn<7>{}(code, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 8
-    case 8: {
-      return inner_type_dispatch_fn<8>{}(code, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 9
-    case 9: {
-      return inner_type_dispatch_fn<9>{}(code, f, std::forward<Fnargs>(args)...);
-    }
-#endif
+  auto type_idx = detail::dispatch_type_index(code);
+  assert(dim >= 1 && dim <= LEGATE_MAX_DIM && type_idx >= 0);
+  if (dim < 1 || dim > LEGATE_MAX_DIM || type_idx < 0) {
+    dim      = 1;
+    type_idx = 0;
   }
-  assert(false);
-  return inner_type_dispatch_fn<1>{}(code, f, std::forward<Fnargs>(args)...);
+  auto idx = (dim - 1) * detail::NUM_DISPATCH_TYPE_CODES + type_idx;
+  return detail::TYPE_DIM_DISPATCH_TABLE<Functor, Fnargs...>[idx](f,
+                                                                  std::forward<Fnargs>(args)...);
 }
 
 /**
@@ -208,6 +285,8 @@ constexpr decltype(auto) double_dispatch(int dim, Type::Code code, Functor f, Fn
  * the functor with them
  *
  * The functor's `operator()` should take exactly two integers as template parameters.
+ * The call is routed through a flat table of the enabled combinations indexed by
+ * `(dim1, dim2)`; dimensions pruned via `dim_dispatch_enabled` abort when reached.
  *
  * @param dim1 First dimension
  * @param dim2 Second dimension
@@ -219,55 +298,12 @@ constexpr decltype(auto) double_dispatch(int dim, Type::Code code, Functor f, Fn
 template <typename Functor, typename... Fnargs>
 constexpr decltype(auto) double_dispatch(int dim1, int dim2, Functor f, Fnargs&&... args)
 {
-  switch (dim1) {
-#if LEGATE_MAX_DIM >= 1
-    case 1: {
-      return inner_dim_dispatch_fn<1>{}(dim2, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 2
-    case 2: {
-      return inner_dim_dispatch_fn<2>{}(dim2, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 3
-    case 3: {
-      return inner_dim_dispatch_fn<3>{}(dim2, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 4
-    case 4: {
-      return inner_dim_dispatch_fn<4>{}(dim2, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 5
-    case 5: {
-      return inner_dim_dispatch_fn<5>{}(dim2, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 6
-    case 6: {
-      return inner_dim_dispatch_fn<6>{}(dim2, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 7
-    case 7: {
-      return inner_dim_dispatch_fn<7>{}(dim2, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 8
-    case 8: {
-      return inner_dim_dispatch_fn<8>{}(dim2, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 9
-    case 9: {
-      return inner_dim_dispatch_fn<9>{}(dim2, f, std::forward<Fnargs>(args)...);
-    }
-#endif
-  }
-  assert(false);
-  return inner_dim_dispatch_fn<1>{}(dim2, f, std::forward<Fnargs>(args)...);
+  assert(dim1 >= 1 && dim1 <= LEGATE_MAX_DIM && dim2 >= 1 && dim2 <= LEGATE_MAX_DIM);
+  if (dim1 < 1 || dim1 > LEGATE_MAX_DIM) dim1 = 1;
+  if (dim2 < 1 || dim2 > LEGATE_MAX_DIM) dim2 = 1;
+  auto idx = (dim1 - 1) * LEGATE_MAX_DIM + (dim2 - 1);
+  return detail::DIM_DIM_DISPATCH_TABLE<Functor, Fnargs...>[idx](f,
+                                                                 std::forward<Fnargs>(args)...);
 }
 
 /**
@@ -276,6 +312,7 @@ constexpr decltype(auto) double_dispatch(int dim1, int dim2, Functor f, Fnargs&&
  * the functor with it
  *
  * The functor's `operator()` should take an integer as its sole template parameter.
+ * Dimensions pruned via `dim_dispatch_enabled` abort when reached.
  *
  * @param dim Dimension
  * @param f Functor to dispatch
@@ -286,55 +323,10 @@ constexpr decltype(auto) double_dispatch(int dim1, int dim2, Functor f, Fnargs&&
 template <typename Functor, typename... Fnargs>
 constexpr decltype(auto) dim_dispatch(int dim, Functor f, Fnargs&&... args)
 {
-  switch (dim) {
-#if LEGATE_MAX_DIM >= 1
-    case 1: {
-      return f.template operator()<1>(std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 2
-    case 2: {
-      return f.template operator()<2>(std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 3
-    case 3: {
-      return f.template operator()<3>(std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 4
-    case 4: {
-      return f.template operator()<4>(std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 5
-    case 5: {
-      return f.template operator()<5>(std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 6
-    case 6: {
-      return f.template operator()<6>(std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 7
-    case 7: {
-      return f.template operator()<7>(std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 8
-    case 8: {
-      return f.template operator()<8>(std::forward<Fnargs>(args)...);
-    }
-#endif
-#if LEGATE_MAX_DIM >= 9
-    case 9: {
-      return f.template operator()<9>(std::forward<Fnargs>(args)...);
-    }
-#endif
-  }
-  assert(false);
-  return f.template operator()<1>(std::forward<Fnargs>(args)...);
+  assert(dim >= 1 && dim <= LEGATE_MAX_DIM);
+  if (dim < 1 || dim > LEGATE_MAX_DIM) dim = 1;
+  return detail::DIM_DISPATCH_TABLE<Functor, Fnargs...>[dim - 1](f,
+                                                                 std::forward<Fnargs>(args)...);
 }
 
 /**
@@ -343,6 +335,7 @@ constexpr decltype(auto) dim_dispatch(int dim, Functor f, Fnargs&&... args)
  * the functor with it
  *
  * The functor's `operator()` should take a type code as its sole template parameter.
+ * Type codes pruned via `type_dispatch_enabled` abort when reached.
  *
  * @param code Type code
  * @param f Functor to dispatch
@@ -353,53 +346,44 @@ constexpr decltype(auto) dim_dispatch(int dim, Functor f, Fnargs&&... args)
 template <typename Functor, typename... Fnargs>
 constexpr decltype(auto) type_dispatch(Type::Code code, Functor f, Fnargs&&... args)
 {
-  switch (code) {
-    case Type::Code::BOOL: {
-      return f.template operator()<Type::Code::BOOL>(std::forward<Fnargs>(args)...);
-    }
-    case Type::Code::INT8: {
-      return f.template operator()<Type::Code::INT8>(std::forward<Fnargs>(args)...);
-    }
-    case Type::Code::INT16: {
-      return f.template operator()<Type::Code::INT16>(std::forward<Fnargs>(args)...);
-    }
-    case Type::Code::INT32: {
-      return f.template operator()<Type::Code::INT32>(std::forward<Fnargs>(args)...);
-    }
-    case Type::Code::INT64: {
-      return f.template operator()<Type::Code::INT64>(std::forward<Fnargs>(args)...);
-    }
-    case Type::Code::UINT8: {
-      return f.template operator()<Type::Code::UINT8>(std::forward<Fnargs>(args)...);
-    }
-    case Type::Code::UINT16: {
-      return f.template operator()<Type::Code::UINT16>(std::forward<Fnargs>(args)...);
-    }
-    case Type::Code::UINT32: {
-      return f.template operator()<Type::Code::UINT32>(std::forward<Fnargs>(args)...);
-    }
-    case Type::Code::UINT64: {
-      return f.template operator()<Type::Code::UINT64>(std::forward<Fnargs>(args)...);
-    }
-    case Type::Code::FLOAT16: {
-      return f.template operator()<Type::Code::FLOAT16>(std::forward<Fnargs>(args)...);
-    }
-    case Type::Code::FLOAT32: {
-      return f.template operator()<Type::Code::FLOAT32>(std::forward<Fnargs>(args)...);
-    }
-    case Type::Code::FLOAT64: {
-      return f.template operator()<Type::Code::FLOAT64>(std::forward<Fnargs>(args)...);
-    }
-    case Type::Code::COMPLEX64: {
-      return f.template operator()<Type::Code::COMPLEX64>(std::forward<Fnargs>(args)...);
-    }
-    case Type::Code::COMPLEX128: {
-      return f.template operator()<Type::Code::COMPLEX128>(std::forward<Fnargs>(args)...);
-    }
-    default: break;
-  }
-  assert(false);
-  return f.template operator()<Type::Code::BOOL>(std::forward<Fnargs>(args)...);
+  auto type_idx = detail::dispatch_type_index(code);
+  assert(type_idx >= 0);
+  if (type_idx < 0) type_idx = 0;
+  return detail::TYPE_DISPATCH_TABLE<Functor, Fnargs...>[type_idx](f,
+                                                                   std::forward<Fnargs>(args)...);
+}
+
+/**
+ * @ingroup util
+ * @brief Converts two runtime type codes into compile time constants and invokes
+ * the functor with them
+ *
+ * The functor's `operator()` should take two type codes as template parameters. This is
+ * meant for mixed-type kernels, such as casts, that would otherwise nest two `type_dispatch`
+ * calls. The call is routed through a flat table of the enabled combinations indexed by
+ * `(code1, code2)`; pairs pruned via `type_type_dispatch_enabled` abort when reached.
+ *
+ * @param code1 First type code
+ * @param code2 Second type code
+ * @param f Functor to dispatch
+ * @param args Extra arguments to the functor
+ *
+ * @return The functor's return value
+ */
+template <typename Functor, typename... Fnargs>
+constexpr decltype(auto) type_type_dispatch(Type::Code code1,
+                                            Type::Code code2,
+                                            Functor f,
+                                            Fnargs&&... args)
+{
+  auto idx1 = detail::dispatch_type_index(code1);
+  auto idx2 = detail::dispatch_type_index(code2);
+  assert(idx1 >= 0 && idx2 >= 0);
+  if (idx1 < 0) idx1 = 0;
+  if (idx2 < 0) idx2 = 0;
+  auto idx = idx1 * detail::NUM_DISPATCH_TYPE_CODES + idx2;
+  return detail::TYPE_TYPE_DISPATCH_TABLE<Functor, Fnargs...>[idx](f,
+                                                                   std::forward<Fnargs>(args)...);
 }
 
 }  // namespace legate
@@ -59,4 +59,99 @@ DomainPoint delinearize(const DomainPoint& lo, const DomainPoint& hi, size_t idx
   return dim_dispatch(lo.dim, delinearize_fn{}, lo, hi, idx);
 }
 
+struct linearize_batch_fn {
+  template <int32_t DIM>
+  void operator()(const DomainPoint& lo_dp,
+                  const DomainPoint& hi_dp,
+                  const DomainPoint* points,
+                  size_t num_points,
+                  size_t* results)
+  {
+    Point<DIM> lo = lo_dp;
+    Point<DIM> hi = hi_dp;
+    size_t strides[DIM];
+    size_t stride = 1;
+    for (int32_t dim = DIM - 1; dim >= 0; --dim) {
+      strides[dim] = stride;
+      stride *= hi[dim] - lo[dim] + 1;
+    }
+    for (size_t idx = 0; idx < num_points; ++idx) {
+      const Point<DIM> point = points[idx];
+      size_t result          = 0;
+      for (int32_t dim = 0; dim < DIM; ++dim) result += (point[dim] - lo[dim]) * strides[dim];
+      results[idx] = result;
+    }
+  }
+};
+
+void linearize_batch(const DomainPoint& lo,
+                     const DomainPoint& hi,
+                     const DomainPoint* points,
+                     size_t num_points,
+                     size_t* results)
+{
+  dim_dispatch(lo.dim, linearize_batch_fn{}, lo, hi, points, num_points, results);
+}
+
+struct delinearize_batch_fn {
+  template <int32_t DIM>
+  void operator()(const DomainPoint& lo_dp,
+                  const DomainPoint& hi_dp,
+                  const size_t* indices,
+                  size_t num_points,
+                  DomainPoint* results)
+  {
+    Point<DIM> lo      = lo_dp;
+    Point<DIM> hi      = hi_dp;
+    Point<DIM> extents = hi - lo + Point<DIM>::ONES();
+    for (size_t idx = 0; idx < num_points; ++idx) {
+      size_t index = indices[idx];
+      Point<DIM> point;
+      for (int32_t dim = DIM - 1; dim >= 0; --dim) {
+        point[dim] = index % extents[dim] + lo[dim];
+        index /= extents[dim];
+      }
+      results[idx] = point;
+    }
+  }
+};
+
+void delinearize_batch(const DomainPoint& lo,
+                       const DomainPoint& hi,
+                       const size_t* indices,
+                       size_t num_points,
+                       DomainPoint* results)
+{
+  dim_dispatch(lo.dim, delinearize_batch_fn{}, lo, hi, indices, num_points, results);
+}
+
+RectLinearizer::RectLinearizer(const DomainPoint& lo, const DomainPoint& hi) : dim_(lo.dim)
+{
+  size_t stride = 1;
+  for (int32_t dim = dim_ - 1; dim >= 0; --dim) {
+    lo_[dim]      = lo[dim];
+    extents_[dim] = hi[dim] - lo[dim] + 1;
+    strides_[dim] = stride;
+    stride *= extents_[dim];
+  }
+}
+
+size_t RectLinearizer::linearize(const DomainPoint& point) const
+{
+  size_t result = 0;
+  for (int32_t dim = 0; dim < dim_; ++dim) result += (point[dim] - lo_[dim]) * strides_[dim];
+  return result;
+}
+
+DomainPoint RectLinearizer::delinearize(size_t idx) const
+{
+  DomainPoint point;
+  point.dim = dim_;
+  for (int32_t dim = dim_ - 1; dim >= 0; --dim) {
+    point[dim] = idx % extents_[dim] + lo_[dim];
+    idx /= extents_[dim];
+  }
+  return point;
+}
+
 }  // namespace legate
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "core/utilities/typedefs.h"
+#include "legate_defines.h"
 
 namespace legate {
 
@@ -24,4 +25,36 @@ size_t linearize(const DomainPoint& lo, const DomainPoint& hi, const DomainPoint
 
 DomainPoint delinearize(const DomainPoint& lo, const DomainPoint& hi, size_t idx);
 
+// Batch variants that dispatch on the dimension once and precompute the rectangle's strides
+// before the loop, so the per-point work is a handful of integer multiply-adds that the
+// compiler can vectorize
+void linearize_batch(const DomainPoint& lo,
+                     const DomainPoint& hi,
+                     const DomainPoint* points,
+                     size_t num_points,
+                     size_t* results);
+
+void delinearize_batch(const DomainPoint& lo,
+                       const DomainPoint& hi,
+                       const size_t* indices,
+                       size_t num_points,
+                       DomainPoint* results);
+
+// A functor that caches the strides of a rectangle for repeated point-at-a-time conversions
+// against it, avoiding the dimension dispatch and stride computation per call
+class RectLinearizer {
+ public:
+  RectLinearizer(const DomainPoint& lo, const DomainPoint& hi);
+
+ public:
+  size_t linearize(const DomainPoint& point) const;
+  DomainPoint delinearize(size_t idx) const;
+
+ private:
+  int32_t dim_;
+  coord_t lo_[LEGATE_MAX_DIM];
+  coord_t extents_[LEGATE_MAX_DIM];
+  size_t strides_[LEGATE_MAX_DIM];
+};
+
 }  // namespace legate
@@ -23,8 +23,17 @@ namespace legate {
 
 Memory::Kind find_memory_kind_for_executing_processor(bool host_accessible)
 {
-  auto proc = Processor::get_executing_processor();
-  switch (proc.kind()) {
+  // Task threads stay bound to one processor, so the processor kind is resolved once per
+  // thread and repeat calls are a thread-local load
+  static thread_local Processor::Kind cached_kind = Processor::Kind::NO_KIND;
+  if (Processor::Kind::NO_KIND == cached_kind)
+    cached_kind = Processor::get_executing_processor().kind();
+  return find_memory_kind_for_processor(cached_kind, host_accessible);
+}
+
+Memory::Kind find_memory_kind_for_processor(Processor::Kind proc_kind, bool host_accessible)
+{
+  switch (proc_kind) {
     case Processor::Kind::LOC_PROC: {
       return Memory::Kind::SYSTEM_MEM;
     }
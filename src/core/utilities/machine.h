@@ -24,4 +24,9 @@ namespace legate {
 
 Memory::Kind find_memory_kind_for_executing_processor(bool host_accessible = true);
 
+// Overload for callers that already know the processor kind (or resolve it once and make
+// many queries); this is a pure mapping with no processor lookup
+Memory::Kind find_memory_kind_for_processor(Processor::Kind proc_kind,
+                                            bool host_accessible = true);
+
 }  // namespace legate
@@ -20,6 +20,8 @@
 
 #ifdef LEGATE_USE_CUDA
 
+#include <cstdlib>
+
 #include <nvtx3/nvToolsExt.h>
 
 namespace legate {
@@ -34,6 +36,17 @@ class Range {
   nvtxRangeId_t range_;
 };
 
+// NVTX calls are no-ops when no tool is injected, but composing range messages is not free.
+// Profilers attach by pointing the injection environment variables at their NVTX backend, so
+// checking them once tells us whether building annotations is worth the cost.
+inline bool annotations_enabled()
+{
+  static const bool enabled = nullptr != std::getenv("NVTX_INJECTION64_PATH") ||
+                              nullptr != std::getenv("NVTX_INJECTION32_PATH") ||
+                              nullptr != std::getenv("CUDA_INJECTION64_PATH");
+  return enabled;
+}
+
 }  // namespace nvtx
 }  // namespace legate
 
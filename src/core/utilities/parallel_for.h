@@ -0,0 +1,147 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "legate_defines.h"
+
+#include "core/utilities/typedefs.h"
+
+/**
+ * @file
+ * @brief Parallel iteration helpers for OpenMP task variants
+ */
+namespace legate {
+
+/**
+ * @ingroup util
+ * @brief Scheduling policies for `parallel_for`
+ *
+ * `STATIC` divides the domain evenly up front and has the lowest overhead; prefer it when
+ * every point costs roughly the same. `DYNAMIC` hands out one chunk at a time and `GUIDED`
+ * hands out geometrically shrinking ones; both trade scheduling overhead for load balance
+ * on ragged domains where per-point cost varies.
+ */
+enum class ParallelSchedule : int32_t {
+  STATIC  = 1,
+  DYNAMIC = 2,
+  GUIDED  = 3,
+};
+
+namespace detail {
+
+// Points per scheduling unit. Chunk boundaries fall on multiples of this in the collapsed
+// iteration space, so along the contiguous dimension every chunk but the last covers whole
+// cache lines for any element size up to 64 / (lines per chunk) bytes, and no two threads
+// share a line except at chunk seams
+inline constexpr int64_t PARALLEL_FOR_CHUNK = 64;
+
+// CPU variants must not spawn threads of their own, so the OpenMP loops are conditional on
+// actually running on an OpenMP processor
+#if defined(LEGATE_USE_OPENMP) && defined(_OPENMP)
+inline bool on_omp_processor()
+{
+  return Processor::get_executing_processor().kind() == Processor::Kind::OMP_PROC;
+}
+#endif
+
+// Walks one chunk of the collapsed iteration space in row-major order: the starting point is
+// delinearized once and then advanced like an odometer, so the per-point cost is a compare
+// and an increment on the innermost (contiguous) dimension
+template <int DIM, typename FN>
+void run_chunk(const Rect<DIM>& rect, int64_t lo, int64_t hi, FN&& fn)
+{
+  Point<DIM> point;
+  int64_t rem = lo;
+  for (int32_t dim = DIM - 1; dim >= 0; --dim) {
+    int64_t extent = rect.hi[dim] - rect.lo[dim] + 1;
+    point[dim]     = rect.lo[dim] + static_cast<coord_t>(rem % extent);
+    rem /= extent;
+  }
+  for (int64_t idx = lo; idx < hi; ++idx) {
+    fn(point);
+    for (int32_t dim = DIM - 1; dim >= 0; --dim) {
+      if (point[dim] < rect.hi[dim]) {
+        ++point[dim];
+        break;
+      }
+      point[dim] = rect.lo[dim];
+    }
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @ingroup util
+ * @brief Applies a functor to every point of a rectangle, in parallel on OpenMP processors
+ *
+ * All dimensions are collapsed into a single iteration space so that high-dimensional
+ * rectangles with small extents still expose enough chunks to balance, and the space is
+ * carved into fixed-size chunks of consecutive points along the contiguous (last) dimension,
+ * with boundaries aligned to chunk-size multiples so threads don't share cache lines except
+ * at chunk seams. Chunks are distributed to threads according to `SCHEDULE`.
+ *
+ * The functor is invoked as `fn(const Point<DIM>&)` with points in row-major order within
+ * each chunk. Invocations may run concurrently; the functor must not carry loop-order
+ * dependences. On processors other than OpenMP ones, and in builds without OpenMP, the loop
+ * runs serially on the calling thread.
+ *
+ * @param rect Rectangle to iterate over
+ * @param fn Functor to apply to each point
+ *
+ * @tparam SCHEDULE Chunk scheduling policy (static by default)
+ */
+template <ParallelSchedule SCHEDULE = ParallelSchedule::STATIC, int DIM, typename FN>
+void parallel_for(const Rect<DIM>& rect, FN&& fn)
+{
+  if (rect.empty()) return;
+
+  const int64_t volume     = static_cast<int64_t>(rect.volume());
+  const int64_t num_chunks = (volume + detail::PARALLEL_FOR_CHUNK - 1) / detail::PARALLEL_FOR_CHUNK;
+
+#if defined(LEGATE_USE_OPENMP) && defined(_OPENMP)
+  if (SCHEDULE == ParallelSchedule::DYNAMIC) {
+#pragma omp parallel for schedule(dynamic) if (detail::on_omp_processor())
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+      auto lo = chunk * detail::PARALLEL_FOR_CHUNK;
+      detail::run_chunk(rect, lo, std::min(volume, lo + detail::PARALLEL_FOR_CHUNK), fn);
+    }
+  } else if (SCHEDULE == ParallelSchedule::GUIDED) {
+#pragma omp parallel for schedule(guided) if (detail::on_omp_processor())
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+      auto lo = chunk * detail::PARALLEL_FOR_CHUNK;
+      detail::run_chunk(rect, lo, std::min(volume, lo + detail::PARALLEL_FOR_CHUNK), fn);
+    }
+  } else {
+#pragma omp parallel for schedule(static) if (detail::on_omp_processor())
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+      auto lo = chunk * detail::PARALLEL_FOR_CHUNK;
+      detail::run_chunk(rect, lo, std::min(volume, lo + detail::PARALLEL_FOR_CHUNK), fn);
+    }
+  }
+#else
+  for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+    auto lo = chunk * detail::PARALLEL_FOR_CHUNK;
+    detail::run_chunk(rect, lo, std::min(volume, lo + detail::PARALLEL_FOR_CHUNK), fn);
+  }
+#endif
+}
+
+}  // namespace legate
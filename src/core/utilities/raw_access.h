@@ -0,0 +1,137 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+
+#include "core/utilities/typedefs.h"
+#include "legate_defines.h"
+
+/**
+ * @file
+ * @brief Raw pointer extraction from accessors for vectorizable kernels
+ */
+
+namespace legate {
+
+/**
+ * @ingroup accessor
+ * @brief A raw view of an affine instance: a restrict-qualified base pointer plus element
+ * strides
+ *
+ * Accessors hide base pointers behind generic accessor objects, which keeps compilers from
+ * proving no-aliasing in inner loops and often blocks auto-vectorization. A `RawAccess`
+ * extracts the base pointer (restrict-qualified, so distinct views are asserted not to
+ * alias) and per-dimension element strides once, and kernels index the raw pointer
+ * directly:
+ *
+ * @code{.cpp}
+ * auto in  = raw_access(input.read_accessor<float, 1>(rect), rect);
+ * auto out = raw_access(output.write_accessor<float, 1>(rect), rect);
+ * for (coord_t idx = 0; idx < volume; ++idx) out.data[idx] = in.data[idx] + 1.f;
+ * @endcode
+ *
+ * The restrict qualification is a promise from the caller that the views passed to a
+ * kernel do not overlap; passing overlapping views (e.g. the same store as both input and
+ * output) is undefined. The `operator[]` shim bounds-checks accesses in debug builds.
+ */
+template <typename FT, int DIM>
+struct RawAccess {
+  FT* __restrict__ data{nullptr};
+  size_t strides[DIM] = {};
+  Rect<DIM> bounds{};
+
+  /**
+   * @brief Accesses the element at the given point, bounds-checked in debug builds
+   *
+   * @param p Point to access; must lie within the bounds the view was extracted for
+   *
+   * @return Reference to the element
+   */
+  inline FT& operator[](const Point<DIM>& p) const
+  {
+#ifdef DEBUG_LEGATE
+    assert(bounds.contains(p));
+#endif
+    size_t offset = 0;
+    for (int32_t dim = 0; dim < DIM; ++dim) offset += (p[dim] - bounds.lo[dim]) * strides[dim];
+    return data[offset];
+  }
+};
+
+/**
+ * @ingroup accessor
+ * @brief Extracts a raw view from a read-only accessor
+ *
+ * The underlying instance must cover `bounds` with an affine layout, which the accessor's
+ * `ptr` method validates on extraction.
+ *
+ * @param accessor Accessor to extract the view from
+ * @param bounds Rectangle the view should cover
+ *
+ * @return A `RawAccess` over const elements
+ */
+template <typename FT, int DIM, typename T>
+RawAccess<const FT, DIM> raw_access(const AccessorRO<FT, DIM, T>& accessor,
+                                    const Rect<DIM, T>& bounds)
+{
+  RawAccess<const FT, DIM> result;
+  result.data   = accessor.ptr(bounds, result.strides);
+  result.bounds = bounds;
+  return result;
+}
+
+/**
+ * @ingroup accessor
+ * @brief Extracts a raw view from a write-only accessor
+ *
+ * @param accessor Accessor to extract the view from
+ * @param bounds Rectangle the view should cover
+ *
+ * @return A `RawAccess` over mutable elements
+ */
+template <typename FT, int DIM, typename T>
+RawAccess<FT, DIM> raw_access(const AccessorWO<FT, DIM, T>& accessor, const Rect<DIM, T>& bounds)
+{
+  RawAccess<FT, DIM> result;
+  result.data   = accessor.ptr(bounds, result.strides);
+  result.bounds = bounds;
+  return result;
+}
+
+/**
+ * @ingroup accessor
+ * @brief Extracts a raw view from a read-write accessor
+ *
+ * Note that a read-write view aliases itself by definition, so the no-aliasing promise
+ * only extends to other views used in the same kernel.
+ *
+ * @param accessor Accessor to extract the view from
+ * @param bounds Rectangle the view should cover
+ *
+ * @return A `RawAccess` over mutable elements
+ */
+template <typename FT, int DIM, typename T>
+RawAccess<FT, DIM> raw_access(const AccessorRW<FT, DIM, T>& accessor, const Rect<DIM, T>& bounds)
+{
+  RawAccess<FT, DIM> result;
+  result.data   = accessor.ptr(bounds, result.strides);
+  result.bounds = bounds;
+  return result;
+}
+
+}  // namespace legate
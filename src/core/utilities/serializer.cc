@@ -0,0 +1,165 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "core/utilities/serializer.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace legate {
+
+Serializer::Serializer(size_t initial_capacity)
+{
+  Block block;
+  block.data     = std::make_unique<int8_t[]>(initial_capacity);
+  block.capacity = initial_capacity;
+  blocks_.push_back(std::move(block));
+}
+
+int8_t* Serializer::reserve(size_t size)
+{
+  auto* block = &blocks_.back();
+  if (block->capacity - block->size < size) {
+    // The full block is retired as is; nothing packed so far moves
+    Block fresh;
+    fresh.capacity = std::max(block->capacity * 2, size);
+    fresh.data     = std::make_unique<int8_t[]>(fresh.capacity);
+    blocks_.push_back(std::move(fresh));
+    block = &blocks_.back();
+  }
+  auto* ptr = block->data.get() + block->size;
+  block->size += size;
+  size_ += size;
+  return ptr;
+}
+
+void Serializer::pack_buffer(const void* buffer, size_t size)
+{
+  if (0 == size) return;
+  memcpy(reserve(size), buffer, size);
+}
+
+const void* Serializer::buffer()
+{
+  if (blocks_.size() > 1) {
+    Block merged;
+    merged.capacity = std::max(size_, blocks_.back().capacity);
+    merged.data     = std::make_unique<int8_t[]>(merged.capacity);
+    for (auto& block : blocks_) {
+      memcpy(merged.data.get() + merged.size, block.data.get(), block.size);
+      merged.size += block.size;
+    }
+    blocks_.clear();
+    blocks_.push_back(std::move(merged));
+  }
+  return blocks_.front().data.get();
+}
+
+void Serializer::_pack(const Scalar& value)
+{
+  pack_type(value.type());
+  pack_buffer(value.ptr(), value.size());
+}
+
+void Serializer::pack_type(const Type& type)
+{
+  _pack(static_cast<int32_t>(type.code));
+  switch (type.code) {
+    case Type::Code::FIXED_ARRAY: {
+      auto& array_type = static_cast<const FixedArrayType&>(type);
+      _pack(static_cast<uint32_t>(array_type.uid()));
+      _pack(array_type.num_elements());
+      pack_type(array_type.element_type());
+      break;
+    }
+    case Type::Code::STRUCT: {
+      auto& struct_type = static_cast<const StructType&>(type);
+      _pack(static_cast<uint32_t>(struct_type.uid()));
+      _pack(struct_type.num_fields());
+      for (uint32_t idx = 0; idx < struct_type.num_fields(); ++idx)
+        pack_type(struct_type.field_type(idx));
+      _pack(struct_type.aligned());
+      break;
+    }
+    default: {
+      // Primitive and string types are fully described by their codes
+      break;
+    }
+  }
+}
+
+void Serializer::pack_transform(const TransformStack& transform) { transform.pack(*this); }
+
+void Serializer::pack_future_store(const Type& type,
+                                   int32_t dim,
+                                   int32_t redop_id,
+                                   const TransformStack& transform,
+                                   bool read_only,
+                                   int32_t future_index,
+                                   uint32_t field_size,
+                                   const std::vector<int64_t>& extents)
+{
+  _pack(true /*is_future*/);
+  _pack(false /*is_output_region*/);
+  _pack(dim);
+  pack_type(type);
+  pack_transform(transform);
+  _pack(redop_id);
+  _pack(read_only);
+  _pack(future_index);
+  _pack(field_size);
+  _pack(extents);
+  // Inlining future payloads into the blob is a launcher-side optimization; futures packed
+  // from C++ always travel as real futures
+  _pack(false /*has_inline_data*/);
+}
+
+void Serializer::pack_region_field_store(const Type& type,
+                                         int32_t dim,
+                                         int32_t redop_id,
+                                         const TransformStack& transform,
+                                         uint32_t requirement_index,
+                                         Legion::FieldID field_id)
+{
+  _pack(false /*is_future*/);
+  _pack(false /*is_output_region*/);
+  _pack(dim);
+  pack_type(type);
+  pack_transform(transform);
+  _pack(redop_id);
+  _pack(dim);
+  _pack(requirement_index);
+  _pack(static_cast<int32_t>(field_id));
+}
+
+void Serializer::pack_unbound_store(const Type& type,
+                                    int32_t dim,
+                                    const TransformStack& transform,
+                                    uint32_t output_index,
+                                    Legion::FieldID field_id)
+{
+  _pack(false /*is_future*/);
+  _pack(true /*is_output_region*/);
+  _pack(dim);
+  pack_type(type);
+  pack_transform(transform);
+  _pack(int32_t{-1} /*redop_id*/);
+  _pack(dim);
+  _pack(output_index);
+  _pack(static_cast<int32_t>(field_id));
+}
+
+}  // namespace legate
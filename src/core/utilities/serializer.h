@@ -0,0 +1,151 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "legion.h"
+
+#include "core/data/scalar.h"
+#include "core/data/transform.h"
+#include "core/type/type_info.h"
+#include "core/type/type_traits.h"
+#include "core/utilities/span.h"
+
+namespace legate {
+
+// The packing counterpart of BaseDeserializer: builds argument blobs in the wire format that
+// the deserializers expect, so C++ launchers don't have to hand-roll byte packing. The blob
+// grows through a chain of geometrically sized arena blocks; a full block is retired and a
+// larger one is started, so no field ever pays a realloc-copy of what has been packed so far.
+// The only copy happens once in buffer(), and only if more than one block was ever needed.
+class Serializer {
+ public:
+  Serializer(size_t initial_capacity = 4096);
+
+ public:
+  Serializer(const Serializer&) = delete;
+  Serializer& operator=(const Serializer&) = delete;
+  Serializer(Serializer&&)                 = default;
+  Serializer& operator=(Serializer&&) = default;
+
+ public:
+  template <typename T>
+  void pack(const T& value)
+  {
+    _pack(value);
+  }
+
+ public:
+  template <typename T, std::enable_if_t<legate_type_code_of<T> != Type::Code::INVALID>* = nullptr>
+  void _pack(const T& value)
+  {
+    // Fields pack without padding, so values can land on unaligned offsets
+    memcpy(reserve(sizeof(T)), &value, sizeof(T));
+  }
+
+ public:
+  template <typename T>
+  void _pack(const std::vector<T>& values)
+  {
+    _pack(static_cast<uint32_t>(values.size()));
+    // Elements with a valid type code are laid out as raw bytes, so the whole payload can be
+    // copied in bulk instead of element by element
+    if constexpr (legate_type_code_of<T> != Type::Code::INVALID) {
+      if (!values.empty()) pack_buffer(values.data(), values.size() * sizeof(T));
+    } else {
+      for (auto& value : values) _pack(value);
+    }
+  }
+  template <typename T>
+  void _pack(const Span<const T>& values)
+  {
+    static_assert(legate_type_code_of<T> != Type::Code::INVALID,
+                  "Spans can be packed only for types packed as raw bytes");
+    _pack(static_cast<uint32_t>(values.size()));
+    if (values.size() > 0) pack_buffer(values.ptr(), values.size() * sizeof(T));
+  }
+  template <typename T1, typename T2>
+  void _pack(const std::pair<T1, T2>& values)
+  {
+    _pack(values.first);
+    _pack(values.second);
+  }
+
+ public:
+  void _pack(const Scalar& value);
+
+ public:
+  // Packs the structural description of a type, symmetric to unpack_type
+  void pack_type(const Type& type);
+  // Packs a transform stack, symmetric to unpack_transform
+  void pack_transform(const TransformStack& transform);
+
+ public:
+  // Store arguments reference launch-local resources by index, so the store packers take the
+  // indices the launcher assigned instead of task-side Store objects. The layouts are
+  // symmetric to TaskDeserializer::unpack_store.
+  void pack_future_store(const Type& type,
+                         int32_t dim,
+                         int32_t redop_id,
+                         const TransformStack& transform,
+                         bool read_only,
+                         int32_t future_index,
+                         uint32_t field_size,
+                         const std::vector<int64_t>& extents);
+  void pack_region_field_store(const Type& type,
+                               int32_t dim,
+                               int32_t redop_id,
+                               const TransformStack& transform,
+                               uint32_t requirement_index,
+                               Legion::FieldID field_id);
+  void pack_unbound_store(const Type& type,
+                          int32_t dim,
+                          const TransformStack& transform,
+                          uint32_t output_index,
+                          Legion::FieldID field_id);
+
+ public:
+  // Appends raw bytes to the blob
+  void pack_buffer(const void* buffer, size_t size);
+
+ public:
+  size_t size() const { return size_; }
+  // Returns the packed blob as one contiguous buffer owned by the serializer. If the blob
+  // spans multiple arena blocks they are coalesced here, once; packing more fields afterwards
+  // is allowed and simply grows the blob further.
+  const void* buffer();
+
+ private:
+  // Returns a pointer to `size` writable bytes within a single block
+  int8_t* reserve(size_t size);
+
+ private:
+  struct Block {
+    std::unique_ptr<int8_t[]> data{nullptr};
+    size_t capacity{0};
+    size_t size{0};
+  };
+
+ private:
+  std::vector<Block> blocks_{};
+  size_t size_{0};
+};
+
+}  // namespace legate
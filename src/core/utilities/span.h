@@ -104,4 +104,85 @@ struct Span {
   size_t size_{0};
 };
 
+/**
+ * @ingroup data
+ * @brief A non-owning multi-dimensional view on affine data. Unlike `Span`, the underlying
+ * data need not be contiguous; each dimension carries its own stride (in elements).
+ */
+template <typename T, int DIM>
+struct StridedSpan {
+ public:
+  StridedSpan()                   = default;
+  StridedSpan(const StridedSpan&) = default;
+
+ public:
+  /**
+   * @brief Creates a strided span with an existing pointer, per-dimension strides, and extents.
+   *
+   * The caller must guarantee that the allocation covers every address reachable through the
+   * strides and that the allocation is alive while the span is alive.
+   *
+   * @param data Pointer to the first element
+   * @param strides Stride of each dimension, in elements
+   * @param extents Extent of each dimension
+   */
+  StridedSpan(T* data, const size_t* strides, const size_t* extents) : data_(data)
+  {
+    for (int dim = 0; dim < DIM; ++dim) {
+      strides_[dim] = strides[dim];
+      extents_[dim] = extents[dim];
+    }
+  }
+
+ public:
+  /**
+   * @brief Returns the total number of elements in the view
+   *
+   * @return The number of elements
+   */
+  size_t size() const
+  {
+    size_t result = 1;
+    for (int dim = 0; dim < DIM; ++dim) result *= extents_[dim];
+    return result;
+  }
+  /**
+   * @brief Returns the stride of a dimension, in elements
+   *
+   * @param dim Dimension to query
+   *
+   * @return Stride of the dimension
+   */
+  size_t stride(int dim) const
+  {
+    assert(dim < DIM);
+    return strides_[dim];
+  }
+  /**
+   * @brief Returns the extent of a dimension
+   *
+   * @param dim Dimension to query
+   *
+   * @return Extent of the dimension
+   */
+  size_t extent(int dim) const
+  {
+    assert(dim < DIM);
+    return extents_[dim];
+  }
+
+ public:
+  /**
+   * @brief Returns a pointer to the first element
+   *
+   * @return Pointer to the data
+   */
+  T* ptr() const { return data_; }
+
+ private:
+  T* data_{nullptr};
+  size_t strides_[DIM] = {};
+  size_t extents_[DIM] = {};
+};
+
 }  // namespace legate
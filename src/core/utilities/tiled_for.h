@@ -0,0 +1,216 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdlib>
+#include <unistd.h>
+
+#include "core/utilities/parallel_for.h"
+#include "core/utilities/typedefs.h"
+
+/**
+ * @file
+ * @brief Cache-blocked iteration helpers for CPU and OpenMP task variants
+ */
+namespace legate {
+
+namespace detail {
+
+// Bytes of cache a tile's working set should fit in. Half the L2 is targeted, since kernels
+// typically stream at least one operand that isn't part of the blocked working set; falls
+// back to half of a common per-core L2 when the size can't be queried. LEGATE_TILE_BYTES
+// overrides the detected value
+inline int64_t tile_budget_bytes()
+{
+  static const int64_t budget = [] {
+    if (const char* env = std::getenv("LEGATE_TILE_BYTES")) {
+      const int64_t bytes = std::atoll(env);
+      if (bytes > 0) return bytes;
+    }
+    long size = 0;
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+    size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+    if (size <= 0) size = 512 << 10;
+    return static_cast<int64_t>(size) / 2;
+  }();
+  return budget;
+}
+
+// Keep contiguous runs at least this long so the blocked loop still streams whole cache
+// lines along the last dimension
+inline constexpr int64_t TILE_MIN_EDGE = 64;
+
+// Picks per-dimension tile edges so a tile of `bytes_per_point`-byte elements fits in the
+// cache budget: the contiguous (last) dimension gets a long edge first, and the remainder of
+// the budget is split evenly (geometrically) across the outer dimensions
+template <int DIM>
+Point<DIM> choose_tile_shape(const Rect<DIM>& rect, size_t bytes_per_point)
+{
+  int64_t budget = tile_budget_bytes() / static_cast<int64_t>(std::max<size_t>(1, bytes_per_point));
+  if (budget < 1) budget = 1;
+
+  Point<DIM> tile;
+  const int64_t last_extent = rect.hi[DIM - 1] - rect.lo[DIM - 1] + 1;
+  tile[DIM - 1]             = std::min(last_extent, std::max(TILE_MIN_EDGE, budget));
+  budget                    = std::max<int64_t>(1, budget / tile[DIM - 1]);
+
+  for (int32_t dim = 0; dim < DIM - 1; ++dim) {
+    const int32_t dims_left = DIM - 1 - dim;
+    const int64_t extent    = rect.hi[dim] - rect.lo[dim] + 1;
+    int64_t edge = static_cast<int64_t>(std::pow(static_cast<double>(budget), 1.0 / dims_left));
+    if (edge < 1) edge = 1;
+    tile[dim] = std::min(extent, edge);
+    budget    = std::max<int64_t>(1, budget / tile[dim]);
+  }
+  return tile;
+}
+
+// Clips the tile at grid coordinates `index` against the iterated rectangle
+template <int DIM>
+Rect<DIM> tile_rect(const Rect<DIM>& rect, const Point<DIM>& tile, const Point<DIM>& index)
+{
+  Rect<DIM> result;
+  for (int32_t dim = 0; dim < DIM; ++dim) {
+    result.lo[dim] = rect.lo[dim] + index[dim] * tile[dim];
+    result.hi[dim] = std::min(rect.hi[dim], result.lo[dim] + tile[dim] - 1);
+  }
+  return result;
+}
+
+}  // namespace detail
+
+/**
+ * @ingroup util
+ * @brief Applies a functor to each tile of a cache-blocked decomposition of a rectangle
+ *
+ * The rectangle is carved into tiles whose working set fits in the per-core cache (derived
+ * from the L2 size at startup, overridable with `LEGATE_TILE_BYTES`), keeping the contiguous
+ * (last) dimension's edge long so tiles still stream whole cache lines. Tiles are visited in
+ * a serpentine order: consecutive tiles are always face-adjacent, so the boundary data of
+ * one tile is still resident when its neighbor starts. This is what makes transposed or
+ * strided accesses cache-friendly where plain row-major loops thrash.
+ *
+ * The functor is invoked as `fn(const Rect<DIM>&)` once per tile, serially and in order. To
+ * parallelize within shared-cache-sized tiles, compose with `parallel_for`:
+ * `tiled_for(rect, bytes, [&](const Rect<DIM>& tile) { parallel_for(tile, kernel); });`.
+ * To instead distribute whole tiles across OpenMP threads, use `tiled_parallel_for`.
+ *
+ * @param rect Rectangle to decompose
+ * @param bytes_per_point Bytes of cache each point's working set occupies (all operands the
+ * kernel touches per point)
+ * @param fn Functor to apply to each tile
+ */
+template <int DIM, typename FN>
+void tiled_for(const Rect<DIM>& rect, size_t bytes_per_point, FN&& fn)
+{
+  if (rect.empty()) return;
+
+  const auto tile = detail::choose_tile_shape(rect, bytes_per_point);
+  Point<DIM> counts;
+  int64_t total = 1;
+  for (int32_t dim = 0; dim < DIM; ++dim) {
+    const int64_t extent = rect.hi[dim] - rect.lo[dim] + 1;
+    counts[dim]          = (extent + tile[dim] - 1) / tile[dim];
+    total *= counts[dim];
+  }
+
+  // Serpentine walk over the tile grid: the innermost coordinate advances in its current
+  // direction, and a coordinate that hits either end of its range flips direction and
+  // carries, so successive tiles always differ by one step in exactly one dimension
+  Point<DIM> index = Point<DIM>::ZEROES();
+  coord_t direction[DIM];
+  for (int32_t dim = 0; dim < DIM; ++dim) direction[dim] = 1;
+
+  for (int64_t visited = 0; visited < total; ++visited) {
+    fn(detail::tile_rect(rect, tile, index));
+    for (int32_t dim = DIM - 1; dim >= 0; --dim) {
+      const coord_t next = index[dim] + direction[dim];
+      if (next >= 0 && next < counts[dim]) {
+        index[dim] = next;
+        break;
+      }
+      direction[dim] = -direction[dim];
+    }
+  }
+}
+
+/**
+ * @ingroup util
+ * @brief Applies a functor to every point of a rectangle, distributing cache-sized tiles
+ * across OpenMP threads
+ *
+ * The rectangle is decomposed exactly as in `tiled_for`, then whole tiles are handed to
+ * OpenMP threads so each tile's working set stays in the executing core's private cache;
+ * points within a tile are visited serially in row-major order. The functor is invoked as
+ * `fn(const Point<DIM>&)` and invocations from different tiles may run concurrently. On
+ * processors other than OpenMP ones, and in builds without OpenMP, tiles run serially on
+ * the calling thread in the serpentine order.
+ *
+ * @param rect Rectangle to iterate over
+ * @param bytes_per_point Bytes of cache each point's working set occupies
+ * @param fn Functor to apply to each point
+ *
+ * @tparam SCHEDULE Tile scheduling policy (dynamic by default, since edge tiles are smaller
+ * than interior ones)
+ */
+template <ParallelSchedule SCHEDULE = ParallelSchedule::DYNAMIC, int DIM, typename FN>
+void tiled_parallel_for(const Rect<DIM>& rect, size_t bytes_per_point, FN&& fn)
+{
+  if (rect.empty()) return;
+
+#if defined(LEGATE_USE_OPENMP) && defined(_OPENMP)
+  if (detail::on_omp_processor()) {
+    const auto tile = detail::choose_tile_shape(rect, bytes_per_point);
+    Point<DIM> counts;
+    int64_t total = 1;
+    for (int32_t dim = 0; dim < DIM; ++dim) {
+      const int64_t extent = rect.hi[dim] - rect.lo[dim] + 1;
+      counts[dim]          = (extent + tile[dim] - 1) / tile[dim];
+      total *= counts[dim];
+    }
+
+    auto run_tile = [&](int64_t linear) {
+      Point<DIM> index;
+      for (int32_t dim = DIM - 1; dim >= 0; --dim) {
+        index[dim] = static_cast<coord_t>(linear % counts[dim]);
+        linear /= counts[dim];
+      }
+      const auto bounds = detail::tile_rect(rect, tile, index);
+      detail::run_chunk(bounds, 0, static_cast<int64_t>(bounds.volume()), fn);
+    };
+
+    if (SCHEDULE == ParallelSchedule::STATIC) {
+#pragma omp parallel for schedule(static)
+      for (int64_t linear = 0; linear < total; ++linear) run_tile(linear);
+    } else if (SCHEDULE == ParallelSchedule::GUIDED) {
+#pragma omp parallel for schedule(guided)
+      for (int64_t linear = 0; linear < total; ++linear) run_tile(linear);
+    } else {
+#pragma omp parallel for schedule(dynamic)
+      for (int64_t linear = 0; linear < total; ++linear) run_tile(linear);
+    }
+    return;
+  }
+#endif
+  tiled_for(rect, bytes_per_point, [&](const Rect<DIM>& bounds) {
+    detail::run_chunk(bounds, 0, static_cast<int64_t>(bounds.volume()), fn);
+  });
+}
+
+}  // namespace legate
@@ -55,4 +55,78 @@
 #define MAX_LRU_LENGTH_TEST 1
 
 #define DISABLE_MPI_DEFAULT 0
-#define DISABLE_MPI_TEST 0
\ No newline at end of file
+#define DISABLE_MPI_TEST 0
+
+// Number of concurrent nonblocking send/recv pairs in the windowed MPI collectives
+#define COLL_WINDOW_SIZE_DEFAULT 16
+#define COLL_WINDOW_SIZE_TEST 2
+
+// Intra-process collective copies at least this large (in bytes) use non-temporal stores;
+// 0 disables the streaming path (1 << 20)
+#define COLL_STREAMING_THRESHOLD_DEFAULT 1048576
+#define COLL_STREAMING_THRESHOLD_TEST 64
+
+// Use a sense-reversing spin barrier instead of a pthread barrier in LocalNetwork
+#define COLL_SPIN_BARRIER_DEFAULT 1
+#define COLL_SPIN_BARRIER_TEST 1
+
+// MPI alltoall payloads up to this many bytes per rank use the log(P) Bruck algorithm
+#define ALLTOALL_BRUCK_THRESHOLD_DEFAULT 1024
+#define ALLTOALL_BRUCK_THRESHOLD_TEST 1024
+
+// Per-peer alltoallv payloads are split into pipelined segments of at most this many bytes
+// (1 << 24)
+#define COLL_MAX_SEGMENT_DEFAULT 16777216
+#define COLL_MAX_SEGMENT_TEST 16
+
+// Per-peer alltoallv payloads up to this many bytes are packed into fixed slots and exchanged
+// with the log(P) Bruck schedule instead of one message per peer; 0 disables aggregation
+#define ALLTOALLV_AGG_THRESHOLD_DEFAULT 256
+#define ALLTOALLV_AGG_THRESHOLD_TEST 16
+
+// Cache pairwise alltoallv schedules as persistent MPI requests and re-arm them with
+// MPI_Startall when the same shape (buffers, counts, displacements) repeats
+#define COLL_PERSISTENT_DEFAULT 1
+#define COLL_PERSISTENT_TEST 1
+
+// Pin the worker threads that drive nonblocking collectives to the highest core of the
+// process's startup affinity mask, keeping MPI progress off saturated compute cores (opt-in)
+#define COLL_PROGRESS_CORE_DEFAULT 0
+#define COLL_PROGRESS_CORE_TEST 0
+
+// Pass device pointers straight to MPI; disable to stage them through pinned host buffers
+#define CUDA_AWARE_MPI_DEFAULT 1
+#define CUDA_AWARE_MPI_TEST 1
+
+// Compress large alltoallv segments before they hit the wire (opt-in)
+#define COLL_COMPRESSION_DEFAULT 0
+#define COLL_COMPRESSION_TEST 0
+
+// Minimum per-peer segment size (in bytes) worth compressing (1 << 16)
+#define COLL_COMPRESSION_THRESHOLD_DEFAULT 65536
+#define COLL_COMPRESSION_THRESHOLD_TEST 16
+
+// Discover which node each MPI rank lives on and bias alltoall(v) schedules toward node-local
+// exchanges
+#define COLL_TOPOLOGY_AWARE_DEFAULT 1
+#define COLL_TOPOLOGY_AWARE_TEST 1
+
+// Capacity (in events) of the per-node ring buffer used by the mapping tracer
+// (LEGATE_MAPPING_TRACE)
+#define MAPPING_TRACE_EVENTS_DEFAULT 1048576
+#define MAPPING_TRACE_EVENTS_TEST 1024
+
+// Scale the chunk and LRU defaults above by the sizes of the memories discovered at startup
+// (see CoreMapper); explicit LEGATE_* settings always win over calibration
+#define AUTO_CALIBRATE_DEFAULT 1
+#define AUTO_CALIBRATE_TEST 0
+
+// Ready queues deeper than this are never deferred for batching in
+// BaseMapper::select_tasks_to_map
+#define MAX_MAPPING_WINDOW_DEFAULT 64
+#define MAX_MAPPING_WINDOW_TEST 1
+
+// Regions with fewer elements than this bypass region group consolidation and are mapped to
+// exact standalone instances (see InstanceManager::find_region_group)
+#define SMALL_REGION_VOLUME_DEFAULT 4096
+#define SMALL_REGION_VOLUME_TEST 0
\ No newline at end of file
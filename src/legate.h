@@ -27,6 +27,7 @@
 #include "core/data/allocator.h"
 #include "core/data/scalar.h"
 #include "core/data/store.h"
+#include "core/data/string_array.h"
 #include "core/legate_c.h"
 #include "core/mapping/mapping.h"
 #include "core/runtime/runtime.h"
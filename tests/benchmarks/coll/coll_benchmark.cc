@@ -0,0 +1,242 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Microbenchmark for the CPU collectives in src/core/comm: exercises collAlltoall,
+// collAlltoallv, and collAllgather across message sizes and thread counts and reports
+// latency/bandwidth tables, so the crossover thresholds (Bruck, segment pipelining,
+// compression, ...) can be validated per deployment.
+//
+// Run single-process (LocalNetwork):
+//   ./coll_benchmark --threads 8 --max-size 4194304 --iters 100
+// or multi-process (MPINetwork):
+//   LEGATE_NEED_NETWORK=1 mpirun -n 4 ./coll_benchmark --threads 4
+//
+// Per-peer payload sizes sweep from 8 bytes to --max-size in 4x steps.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/comm/coll.h"
+
+#include "../json_output.h"
+
+using namespace legate::comm::coll;
+
+namespace {
+
+struct Config {
+  int threads     = 4;
+  int iters       = 100;
+  size_t max_size = 4 << 20;
+  std::string json_path{};
+};
+
+enum BenchOp : int {
+  OP_ALLTOALL  = 0,
+  OP_ALLTOALLV = 1,
+  OP_ALLGATHER = 2,
+  NUM_OPS      = 3,
+};
+
+const char* const op_names[NUM_OPS] = {"alltoall", "alltoallv", "allgather"};
+
+std::vector<size_t> message_sizes(size_t max_size)
+{
+  std::vector<size_t> sizes;
+  for (size_t size = 8; size <= max_size; size *= 4) sizes.push_back(size);
+  return sizes;
+}
+
+int iterations(const Config& config, size_t size)
+{
+  // keep the large-payload sweeps from dominating the run
+  return size >= (1 << 20) ? std::max(1, config.iters / 10) : config.iters;
+}
+
+void worker(int global_rank,
+            int global_size,
+            int unique_id,
+            const int* mapping_table,
+            const Config& config,
+            std::vector<double>* my_seconds)
+{
+  Coll_Comm comm;
+  memset(&comm, 0, sizeof(Coll_Comm));
+  collCommCreate(&comm, global_size, global_rank, unique_id, mapping_table);
+
+  auto sizes = message_sizes(config.max_size);
+
+  std::vector<char> sendbuf(global_size * config.max_size);
+  std::vector<char> recvbuf(global_size * config.max_size);
+  std::vector<int> counts(global_size);
+  std::vector<int> displs(global_size);
+
+  for (size_t size_idx = 0; size_idx < sizes.size(); ++size_idx) {
+    size_t size = sizes[size_idx];
+    int iters   = iterations(config, size);
+    for (int i = 0; i < global_size; i++) {
+      counts[i] = static_cast<int>(size);
+      displs[i] = static_cast<int>(i * size);
+    }
+    for (int op = 0; op < NUM_OPS; ++op) {
+      auto run = [&]() {
+        switch (op) {
+          case OP_ALLTOALL:
+            collAlltoall(sendbuf.data(), recvbuf.data(), size, CollDataType::CollUint8, &comm);
+            break;
+          case OP_ALLTOALLV:
+            collAlltoallv(sendbuf.data(),
+                          counts.data(),
+                          displs.data(),
+                          recvbuf.data(),
+                          counts.data(),
+                          displs.data(),
+                          CollDataType::CollUint8,
+                          &comm);
+            break;
+          case OP_ALLGATHER:
+            collAllgather(sendbuf.data(), recvbuf.data(), size, CollDataType::CollUint8, &comm);
+            break;
+        }
+      };
+      // warm-up also acts as a barrier before the timed loop
+      run();
+      run();
+      auto start = std::chrono::high_resolution_clock::now();
+      for (int iter = 0; iter < iters; ++iter) run();
+      auto stop = std::chrono::high_resolution_clock::now();
+      // each (op, size) case runs once per worker; my_seconds is private to this worker, and
+      // the main thread takes the cross-worker max after the join
+      my_seconds[op][size_idx] = std::chrono::duration<double>(stop - start).count() / iters;
+    }
+  }
+
+  collCommDestroy(&comm);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  Config config;
+  for (int i = 1; i < argc; i++) {
+    std::string flag(argv[i]);
+    if (flag == "--threads" && i + 1 < argc)
+      config.threads = atoi(argv[++i]);
+    else if (flag == "--iters" && i + 1 < argc)
+      config.iters = atoi(argv[++i]);
+    else if (flag == "--max-size" && i + 1 < argc)
+      config.max_size = static_cast<size_t>(atoll(argv[++i]));
+    else if (flag == "--json" && i + 1 < argc)
+      config.json_path = argv[++i];
+    else {
+      fprintf(stderr,
+              "usage: %s [--threads N] [--iters N] [--max-size BYTES] [--json FILE]\n",
+              argv[0]);
+      return 1;
+    }
+  }
+
+  collInit(argc, argv);
+
+  int nprocs = 1, proc_id = 0;
+#ifdef LEGATE_USE_NETWORK
+  if (backend_network->comm_type == CollCommType::CollMPI) {
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    MPI_Comm_rank(MPI_COMM_WORLD, &proc_id);
+  }
+#endif
+  int global_size = nprocs * config.threads;
+
+  // global rank r lives in process r / threads, matching comm_cpu's mapping
+  std::vector<int> mapping(global_size);
+  for (int i = 0; i < global_size; i++) mapping[i] = i / config.threads;
+  const int* mapping_table =
+    backend_network->comm_type == CollCommType::CollMPI ? mapping.data() : nullptr;
+
+  int unique_id = collInitComm();
+
+  auto sizes = message_sizes(config.max_size);
+  // one private NUM_OPS-sized block of timing tables per worker, so workers never share a slot
+  std::vector<std::vector<double>> worker_seconds(config.threads * NUM_OPS);
+  for (auto& table : worker_seconds) table.assign(sizes.size(), 0.0);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < config.threads; t++)
+    threads.emplace_back(worker,
+                         proc_id * config.threads + t,
+                         global_size,
+                         unique_id,
+                         mapping_table,
+                         std::cref(config),
+                         &worker_seconds[t * NUM_OPS]);
+  for (auto& thread : threads) thread.join();
+
+  // the slowest rank defines the collective's latency
+  std::vector<double> max_seconds[NUM_OPS];
+  for (int op = 0; op < NUM_OPS; ++op) {
+    max_seconds[op].assign(sizes.size(), 0.0);
+    for (int t = 0; t < config.threads; t++)
+      for (size_t size_idx = 0; size_idx < sizes.size(); ++size_idx)
+        max_seconds[op][size_idx] =
+          std::max(max_seconds[op][size_idx], worker_seconds[t * NUM_OPS + op][size_idx]);
+  }
+
+  if (0 == proc_id) {
+    const char* backend =
+      backend_network->comm_type == CollCommType::CollMPI ? "MPINetwork" : "LocalNetwork";
+    printf("backend: %s, processes: %d, threads/process: %d, ranks: %d\n",
+           backend,
+           nprocs,
+           config.threads,
+           global_size);
+    printf("%-10s %14s %14s %14s\n", "op", "bytes/peer", "latency(us)", "MB/s/rank");
+    benchmark::JsonRecords json_records;
+    for (int op = 0; op < NUM_OPS; ++op) {
+      for (size_t size_idx = 0; size_idx < sizes.size(); ++size_idx) {
+        double seconds = max_seconds[op][size_idx];
+        // every rank moves one per-peer payload to each of the other ranks (or gathers one
+        // payload from each of them)
+        double bytes = static_cast<double>(sizes[size_idx]) * (global_size - 1);
+        double mbs   = seconds > 0.0 ? bytes / seconds / 1e6 : 0.0;
+        printf("%-10s %14zu %14.2f %14.2f\n", op_names[op], sizes[size_idx], seconds * 1e6, mbs);
+        json_records.add()
+          .set("benchmark", "coll")
+          .set("op", op_names[op])
+          .set("backend", backend)
+          .set("processes", static_cast<int64_t>(nprocs))
+          .set("threads_per_process", static_cast<int64_t>(config.threads))
+          .set("ranks", static_cast<int64_t>(global_size))
+          .set("bytes_per_peer", sizes[size_idx])
+          .set("latency_us", seconds * 1e6)
+          .set("mb_per_s_per_rank", mbs);
+      }
+    }
+    if (!config.json_path.empty() && !json_records.write(config.json_path.c_str())) {
+      fprintf(stderr, "failed to write %s\n", config.json_path.c_str());
+      return 1;
+    }
+  }
+
+  collFinalize();
+  return 0;
+}
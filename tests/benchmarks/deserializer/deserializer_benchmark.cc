@@ -0,0 +1,296 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Microbenchmark for task argument deserialization (src/core/utilities/deserializer.cc):
+// packs representative serialized blobs (primitive and tuple scalars, extension types, deep
+// transform stacks, future-backed stores) with the same wire format the Python launcher
+// emits, unpacks each in a timed loop, and reports ns/unpack per component. Deserialization
+// sits on every task's critical path, so regressions here should show up in this table
+// rather than in end-to-end A/B runs.
+//
+//   ./deserializer_benchmark --iters 1000000
+//
+// Region-backed and unbound stores are excluded: resolving them needs live Legion regions,
+// and their blob-parsing cost is the same header + type + transform measured here.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "core/data/scalar.h"
+#include "core/data/store.h"
+#include "core/utilities/deserializer.h"
+#include "legate_c.h"
+
+#include "../json_output.h"
+
+namespace {
+
+// Unpacks raw blobs without a Legion task: the structural components (scalars, types,
+// transforms, and future-backed stores with inline payloads) resolve against the blob
+// alone, which is exactly the code the benchmark wants to isolate
+class BlobDeserializer : public legate::BaseDeserializer<BlobDeserializer> {
+ public:
+  BlobDeserializer(const void* args, size_t arglen) : BaseDeserializer(args, arglen) {}
+
+ public:
+  using BaseDeserializer::_unpack;
+  using BaseDeserializer::unpack_transform;
+  using BaseDeserializer::unpack_type;
+
+ public:
+  // Mirrors TaskDeserializer::_unpack(FutureWrapper&) for the inline-data case
+  void _unpack(legate::FutureWrapper& value)
+  {
+    unpack<bool>();  // read_only
+    unpack<int32_t>();  // future_index
+    auto field_size = unpack<uint32_t>();
+
+    auto point = unpack<std::vector<int64_t>>();
+    legate::Domain domain;
+    domain.dim = static_cast<int32_t>(point.size());
+    for (int32_t idx = 0; idx < domain.dim; ++idx) {
+      domain.rect_data[idx]              = 0;
+      domain.rect_data[idx + domain.dim] = point[idx] - 1;
+    }
+
+    auto has_inline_data = unpack<bool>();
+    if (!has_inline_data) abort();  // the packer below always inlines the payload
+    auto* inline_data = current_args().ptr();
+    value             = legate::FutureWrapper(field_size, domain, inline_data);
+    args_             = args_.subspan(field_size);
+  }
+
+  // Mirrors TaskDeserializer::unpack_store for future-backed stores
+  void _unpack(legate::Store& value)
+  {
+    auto is_future = unpack<bool>();
+    unpack<bool>();  // is_output_region
+    auto dim  = unpack<int32_t>();
+    auto type = unpack_type();
+
+    auto transform = unpack_transform();
+
+    if (!is_future) abort();
+    auto redop_id = unpack<int32_t>();
+    auto fut      = unpack<legate::FutureWrapper>();
+    value         = legate::Store(dim, std::move(type), redop_id, fut, std::move(transform));
+  }
+};
+
+// Appends values in the launcher's wire format: fixed-width little-endian fields packed
+// back to back, vectors as a uint32 size followed by the raw payload
+struct Packer {
+  template <typename T>
+  void pack(const T& value)
+  {
+    const auto* bytes = reinterpret_cast<const int8_t*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+  }
+  template <typename T>
+  void pack_vector(const std::vector<T>& values)
+  {
+    pack<uint32_t>(static_cast<uint32_t>(values.size()));
+    const auto* bytes = reinterpret_cast<const int8_t*>(values.data());
+    buffer.insert(buffer.end(), bytes, bytes + values.size() * sizeof(T));
+  }
+  void pack_primitive_type(legate::Type::Code code) { pack<int32_t>(static_cast<int32_t>(code)); }
+  void pack_bytes(size_t size) { buffer.resize(buffer.size() + size, 0x5A); }
+
+  std::vector<int8_t> buffer{};
+};
+
+// Interleaves the four transform kinds to the requested depth, terminated like the launcher
+// terminates every transform stack
+void pack_transforms(Packer& packer, int32_t depth)
+{
+  for (int32_t level = 0; level < depth; ++level) {
+    switch (level % 4) {
+      case 0:
+        packer.pack<int32_t>(LEGATE_CORE_TRANSFORM_SHIFT);
+        packer.pack<int32_t>(0);
+        packer.pack<int64_t>(42);
+        break;
+      case 1:
+        packer.pack<int32_t>(LEGATE_CORE_TRANSFORM_PROMOTE);
+        packer.pack<int32_t>(1);
+        packer.pack<int64_t>(100);
+        break;
+      case 2:
+        packer.pack<int32_t>(LEGATE_CORE_TRANSFORM_TRANSPOSE);
+        packer.pack_vector<int32_t>({1, 0});
+        break;
+      default:
+        packer.pack<int32_t>(LEGATE_CORE_TRANSFORM_DELINEARIZE);
+        packer.pack<int32_t>(0);
+        packer.pack_vector<int64_t>({10, 10});
+        break;
+    }
+  }
+  packer.pack<int32_t>(-1);
+}
+
+void pack_future_store(Packer& packer, int32_t transform_depth)
+{
+  packer.pack<bool>(true);   // is_future
+  packer.pack<bool>(false);  // is_output_region
+  packer.pack<int32_t>(1);   // dim
+  packer.pack_primitive_type(legate::Type::Code::INT64);
+  pack_transforms(packer, transform_depth);
+  packer.pack<int32_t>(-1);  // redop_id
+  packer.pack<bool>(true);   // read_only
+  packer.pack<int32_t>(-1);  // future_index
+  packer.pack<uint32_t>(sizeof(int64_t));
+  packer.pack_vector<int64_t>({1});  // extents
+  packer.pack<bool>(true);           // has_inline_data
+  packer.pack<int64_t>(1234);
+}
+
+void pack_tuple_scalar(Packer& packer, uint32_t size)
+{
+  // Fixed-array uids for small primitive arrays are derived from the element code and
+  // length, matching fixed_array_type in src/core/type/type_info.cc
+  packer.pack<int32_t>(static_cast<int32_t>(legate::Type::Code::FIXED_ARRAY));
+  packer.pack<uint32_t>(static_cast<int32_t>(legate::Type::Code::INT64) | (size << 8));
+  packer.pack<uint32_t>(size);
+  packer.pack_primitive_type(legate::Type::Code::INT64);
+  packer.pack_bytes(size * sizeof(int64_t));
+}
+
+// Defeats dead-code elimination of the unpacked values
+volatile int64_t sink = 0;
+
+// Records mirror the printed table rows, for the consolidated regression driver
+benchmark::JsonRecords json_records;
+
+template <typename FN>
+double time_ns_per_op(int64_t iters, FN&& fn)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int64_t idx = 0; idx < iters; ++idx) fn();
+  const auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count() / iters;
+}
+
+template <typename FN>
+void report(const char* component, const Packer& packer, int64_t iters, FN&& unpack_one)
+{
+  const double ns = time_ns_per_op(iters, [&] {
+    BlobDeserializer dez(packer.buffer.data(), packer.buffer.size());
+    unpack_one(dez);
+  });
+  printf("  %-36s %8zu B %12.1f ns\n", component, packer.buffer.size(), ns);
+  json_records.add()
+    .set("benchmark", "deserializer")
+    .set("component", component)
+    .set("blob_bytes", packer.buffer.size())
+    .set("iters", iters)
+    .set("ns_per_unpack", ns);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  int64_t iters = 1000000;
+  std::string json_path;
+  for (int idx = 1; idx < argc; ++idx) {
+    if (std::string(argv[idx]) == "--iters" && idx + 1 < argc)
+      iters = atoll(argv[++idx]);
+    else if (std::string(argv[idx]) == "--json" && idx + 1 < argc)
+      json_path = argv[++idx];
+  }
+
+  printf("Deserialization cost per component (%lld iterations each):\n", (long long)iters);
+  printf("  %-36s %10s %15s\n", "component", "blob", "ns/unpack");
+
+  {
+    Packer packer;
+    packer.pack_primitive_type(legate::Type::Code::INT64);
+    packer.pack<int64_t>(42);
+    report("scalar<int64>", packer, iters, [](BlobDeserializer& dez) {
+      sink += dez.unpack<legate::Scalar>().value<int64_t>();
+    });
+  }
+  {
+    Packer packer;
+    pack_tuple_scalar(packer, 4);
+    report("scalar<int64[4]>", packer, iters, [](BlobDeserializer& dez) {
+      sink += static_cast<int64_t>(dez.unpack<legate::Scalar>().size());
+    });
+  }
+  {
+    Packer packer;
+    pack_tuple_scalar(packer, 128);
+    report("scalar<int64[128]>", packer, iters, [](BlobDeserializer& dez) {
+      sink += static_cast<int64_t>(dez.unpack<legate::Scalar>().size());
+    });
+  }
+  {
+    Packer packer;
+    constexpr uint32_t NUM_FIELDS = 8;
+    packer.pack<int32_t>(static_cast<int32_t>(legate::Type::Code::STRUCT));
+    packer.pack<uint32_t>(0x10000);  // uid; extension types intern by uid
+    packer.pack<uint32_t>(NUM_FIELDS);
+    for (uint32_t idx = 0; idx < NUM_FIELDS; ++idx)
+      packer.pack_primitive_type(legate::Type::Code::INT64);
+    packer.pack<bool>(true);  // align
+    report("type<struct of 8 fields>", packer, iters, [](BlobDeserializer& dez) {
+      sink += static_cast<int64_t>(dez.unpack_type()->size());
+    });
+  }
+  for (int32_t depth : {1, 4, 16}) {
+    Packer packer;
+    pack_transforms(packer, depth);
+    char name[64];
+    snprintf(name, sizeof(name), "transform stack, depth %d", depth);
+    report(name, packer, iters, [](BlobDeserializer& dez) {
+      sink += dez.unpack_transform() != nullptr;
+    });
+  }
+  for (int32_t depth : {0, 4}) {
+    Packer packer;
+    pack_future_store(packer, depth);
+    char name[64];
+    snprintf(name, sizeof(name), "future store, transform depth %d", depth);
+    report(name, packer, iters, [](BlobDeserializer& dez) {
+      sink += dez.unpack<legate::Store>().dim();
+    });
+  }
+  {
+    // A fat task signature: the shape of blob a heavily fused or multi-operand task carries
+    constexpr int32_t NUM_STORES  = 32;
+    constexpr int32_t NUM_SCALARS = 16;
+    Packer packer;
+    for (int32_t idx = 0; idx < NUM_STORES; ++idx) pack_future_store(packer, 3);
+    for (int32_t idx = 0; idx < NUM_SCALARS; ++idx) pack_tuple_scalar(packer, 4);
+    report("task blob: 32 stores + 16 scalars", packer, iters / 10, [](BlobDeserializer& dez) {
+      for (int32_t idx = 0; idx < NUM_STORES; ++idx) sink += dez.unpack<legate::Store>().dim();
+      for (int32_t idx = 0; idx < NUM_SCALARS; ++idx)
+        sink += static_cast<int64_t>(dez.unpack<legate::Scalar>().size());
+    });
+  }
+
+  if (!json_path.empty() && !json_records.write(json_path.c_str())) {
+    fprintf(stderr, "failed to write %s\n", json_path.c_str());
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,106 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+// Shared JSON emission for the benchmark executables: each benchmark appends one flat record
+// per measurement and writes them out as a JSON array, so the consolidated regression driver
+// (run_benchmarks.py) can consume results without scraping the human-readable tables. Record
+// values are strings, integers, or doubles; nothing here warrants a real JSON library.
+
+#include <stdio.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+class JsonRecords {
+ public:
+  class Record {
+   public:
+    Record& set(const char* key, const std::string& value)
+    {
+      append_key(key);
+      body_ += '"';
+      for (auto ch : value) {
+        if ('"' == ch || '\\' == ch) body_ += '\\';
+        body_ += ch;
+      }
+      body_ += '"';
+      return *this;
+    }
+    Record& set(const char* key, const char* value) { return set(key, std::string(value)); }
+    Record& set(const char* key, double value)
+    {
+      char buf[32];
+      snprintf(buf, sizeof(buf), "%.9g", value);
+      append_key(key);
+      body_ += buf;
+      return *this;
+    }
+    Record& set(const char* key, int64_t value)
+    {
+      char buf[32];
+      snprintf(buf, sizeof(buf), "%lld", static_cast<long long>(value));
+      append_key(key);
+      body_ += buf;
+      return *this;
+    }
+    Record& set(const char* key, size_t value) { return set(key, static_cast<int64_t>(value)); }
+    Record& set(const char* key, int32_t value) { return set(key, static_cast<int64_t>(value)); }
+
+   private:
+    void append_key(const char* key)
+    {
+      if (!body_.empty()) body_ += ", ";
+      body_ += '"';
+      body_ += key;
+      body_ += "\": ";
+    }
+
+   private:
+    friend class JsonRecords;
+    std::string body_{};
+  };
+
+ public:
+  Record& add()
+  {
+    records_.emplace_back();
+    return records_.back();
+  }
+
+ public:
+  // Writes the records as a JSON array; returns false when the file can't be opened
+  bool write(const char* path) const
+  {
+    FILE* file = fopen(path, "w");
+    if (nullptr == file) return false;
+    fprintf(file, "[\n");
+    for (size_t idx = 0; idx < records_.size(); ++idx)
+      fprintf(
+        file, "  {%s}%s\n", records_[idx].body_.c_str(), idx + 1 < records_.size() ? "," : "");
+    fprintf(file, "]\n");
+    fclose(file);
+    return true;
+  }
+
+ private:
+  std::vector<Record> records_{};
+};
+
+}  // namespace benchmark
@@ -0,0 +1,203 @@
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""Measures the round-trip launch latency of a task that does no work.
+
+The task body is empty, so every microsecond reported here is runtime
+overhead: argument packing, partitioning analysis, mapping, and the task
+wrapper's deserialization on the other side. Latencies are measured per
+launch by blocking on an execution fence after each one; throughput is
+measured by issuing a batch of launches and blocking once at the end.
+"""
+
+import argparse
+import json
+import time
+
+from launch_latency import user_context, user_lib
+
+import legate.core.types as ty
+from legate.core import Rect
+
+# Small enough that data movement is noise compared to the launch path
+STORE_SHAPE = (10,)
+
+
+def percentile_values(samples: list[float]) -> dict[str, float]:
+    samples = sorted(samples)
+
+    def pct(p: float) -> float:
+        return samples[min(int(len(samples) * p), len(samples) - 1)]
+
+    return {
+        "p50_us": pct(0.50),
+        "p90_us": pct(0.90),
+        "p99_us": pct(0.99),
+        "max_us": samples[-1],
+    }
+
+
+def percentiles(samples: list[float]) -> str:
+    vals = percentile_values(samples)
+    return (
+        f"p50 {vals['p50_us']:8.1f}us  p90 {vals['p90_us']:8.1f}us  "
+        f"p99 {vals['p99_us']:8.1f}us  max {vals['max_us']:8.1f}us"
+    )
+
+
+def make_stores(num_stores: int) -> list:
+    stores = []
+    for _ in range(num_stores):
+        store = user_context.create_store(ty.float64, STORE_SHAPE)
+        # Bind the storage up front so instance creation is not on the
+        # timed path
+        task = user_context.create_auto_task(
+            user_lib.shared_object.NULL_TASK
+        )
+        task.add_output(store)
+        task.execute()
+        stores.append(store)
+    return stores
+
+
+def launch_single(stores: list) -> None:
+    task = user_context.create_auto_task(user_lib.shared_object.NULL_TASK)
+    for store in stores:
+        task.add_input(store)
+    task.execute()
+
+
+def launch_index(stores: list, launch_domain: Rect) -> None:
+    task = user_context.create_manual_task(
+        user_lib.shared_object.NULL_TASK, launch_domain
+    )
+    for store in stores:
+        task.add_input(store)
+    task.execute()
+
+
+def bench_latency(launch, iters: int, warmup: int) -> list[float]:
+    for _ in range(warmup):
+        launch()
+    user_context.issue_execution_fence(block=True)
+    samples = []
+    for _ in range(iters):
+        start = time.perf_counter()
+        launch()
+        user_context.issue_execution_fence(block=True)
+        samples.append((time.perf_counter() - start) * 1e6)
+    return samples
+
+
+def bench_throughput(launch, iters: int, warmup: int) -> float:
+    for _ in range(warmup):
+        launch()
+    user_context.issue_execution_fence(block=True)
+    start = time.perf_counter()
+    for _ in range(iters):
+        launch()
+    user_context.issue_execution_fence(block=True)
+    return (time.perf_counter() - start) * 1e6 / iters
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--iters", type=int, default=1000, help="timed launches per case"
+    )
+    parser.add_argument(
+        "--warmup", type=int, default=100, help="untimed launches per case"
+    )
+    parser.add_argument(
+        "--store-counts",
+        type=int,
+        nargs="+",
+        default=[0, 1, 4, 16],
+        help="numbers of input stores to attach to each task",
+    )
+    parser.add_argument(
+        "--index-points",
+        type=int,
+        default=4,
+        help="number of point tasks in each index launch",
+    )
+    parser.add_argument(
+        "--json",
+        type=str,
+        default=None,
+        help="also write the results as a JSON array to this file",
+    )
+    args = parser.parse_args()
+
+    # Records mirror the printed lines, for the consolidated regression driver
+    records: list[dict] = []
+
+    launch_domain = Rect([args.index_points])
+    for num_stores in args.store_counts:
+        stores = make_stores(num_stores)
+
+        samples = bench_latency(
+            lambda: launch_single(stores), args.iters, args.warmup
+        )
+        amortized = bench_throughput(
+            lambda: launch_single(stores), args.iters, args.warmup
+        )
+        print(
+            f"single task, {num_stores:3d} stores: {percentiles(samples)}  "
+            f"amortized {amortized:8.1f}us"
+        )
+        records.append(
+            {
+                "benchmark": "launch_latency",
+                "case": "single",
+                "stores": num_stores,
+                "amortized_us": amortized,
+                **percentile_values(samples),
+            }
+        )
+
+        samples = bench_latency(
+            lambda: launch_index(stores, launch_domain),
+            args.iters,
+            args.warmup,
+        )
+        amortized = bench_throughput(
+            lambda: launch_index(stores, launch_domain),
+            args.iters,
+            args.warmup,
+        )
+        print(
+            f"index launch ({args.index_points} points), "
+            f"{num_stores:3d} stores: {percentiles(samples)}  "
+            f"amortized {amortized:8.1f}us"
+        )
+        records.append(
+            {
+                "benchmark": "launch_latency",
+                "case": "index",
+                "index_points": args.index_points,
+                "stores": num_stores,
+                "amortized_us": amortized,
+                **percentile_values(samples),
+            }
+        )
+
+    if args.json is not None:
+        with open(args.json, "w") as f:
+            json.dump(records, f, indent=2)
+
+
+if __name__ == "__main__":
+    main()
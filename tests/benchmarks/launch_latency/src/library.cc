@@ -0,0 +1,43 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "library.h"
+
+namespace launch_latency {
+
+static const char* const library_name = "launch_latency";
+
+/*static*/ legate::TaskRegistrar& Library::get_registrar()
+{
+  static legate::TaskRegistrar registrar;
+  return registrar;
+}
+
+void registration_callback()
+{
+  auto context = legate::Runtime::get_runtime()->create_library(library_name);
+  Library::get_registrar().register_all_tasks(context);
+}
+
+}  // namespace launch_latency
+
+extern "C" {
+
+void perform_registration(void)
+{
+  legate::Core::perform_registration<launch_latency::registration_callback>();
+}
+}
@@ -0,0 +1,42 @@
+/* Copyright 2023 NVIDIA Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "launch_latency_cffi.h"
+#include "library.h"
+
+namespace launch_latency {
+
+// Does nothing on purpose: every microsecond a launch of this task takes is runtime
+// overhead (mapping, sharding, argument deserialization, wrapper dispatch), which is
+// exactly what the benchmark driver measures
+class NullTask : public Task<NullTask, NULL_TASK> {
+ public:
+  static void cpu_variant(legate::TaskContext& context) {}
+  static void omp_variant(legate::TaskContext& context) {}
+  static void gpu_variant(legate::TaskContext& context) {}
+};
+
+}  // namespace launch_latency
+
+namespace  // unnamed
+{
+
+static void __attribute__((constructor)) register_tasks()
+{
+  launch_latency::NullTask::register_variants();
+}
+
+}  // namespace
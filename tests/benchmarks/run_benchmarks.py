@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+
+# Copyright 2023 NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""Runs the core performance surface under pinned configurations and writes
+one machine-readable JSON document.
+
+The surface covers CPU collective latencies (coll_benchmark), task argument
+deserialization (deserializer_benchmark), the mapper's instance cache
+(instance_manager_benchmark), and, when a built Python environment with the
+`legate` driver is available, task launch round trips
+(bench_launch_latency.py). Each benchmark emits its own records through its
+--json flag; this driver merges them and stamps environment metadata, so
+acceptance gates can diff documents across Legate upgrades instead of
+scraping tables.
+
+    ./run_benchmarks.py --bin-dir <build>/tests/benchmarks --output results.json
+
+Benchmarks whose executables are missing are reported in the document's
+"skipped" list rather than failing the run, so partial builds still produce a
+usable (if smaller) result set.
+"""
+
+import argparse
+import json
+import os
+import platform
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+from datetime import datetime, timezone
+
+SCHEMA_VERSION = 1
+
+# Pinned configurations: fixed sizes and iteration counts, so documents from
+# different builds are directly comparable. Bump SCHEMA_VERSION when changing
+# them, as that invalidates comparisons against older documents.
+EXECUTABLES = {
+    "coll": {
+        "path": os.path.join("coll", "coll_benchmark"),
+        "args": ["--threads", "4", "--iters", "50", "--max-size", "1048576"],
+    },
+    "deserializer": {
+        "path": os.path.join("deserializer", "deserializer_benchmark"),
+        "args": ["--iters", "200000"],
+    },
+    "instance_manager": {
+        "path": os.path.join(
+            "instance_manager", "instance_manager_benchmark"
+        ),
+        "args": ["--regions", "1024", "--iters", "100"],
+    },
+}
+
+LAUNCH_LATENCY_SCRIPT = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)),
+    "launch_latency",
+    "examples",
+    "bench_launch_latency.py",
+)
+LAUNCH_LATENCY_ARGS = [
+    "--iters",
+    "500",
+    "--warmup",
+    "50",
+    "--store-counts",
+    "0",
+    "4",
+    "16",
+]
+
+
+def environment_metadata() -> dict:
+    meta = {
+        "timestamp": datetime.now(timezone.utc).isoformat(),
+        "hostname": socket.gethostname(),
+        "platform": platform.platform(),
+        "machine": platform.machine(),
+        "processor_count": os.cpu_count(),
+        "python": platform.python_version(),
+    }
+    try:
+        repo_dir = os.path.dirname(os.path.abspath(__file__))
+        meta["git_commit"] = subprocess.check_output(
+            ["git", "rev-parse", "HEAD"],
+            cwd=repo_dir,
+            stderr=subprocess.DEVNULL,
+            text=True,
+        ).strip()
+    except (OSError, subprocess.CalledProcessError):
+        pass
+    # Tuning knobs change what the numbers mean, so record every one that is set
+    meta["env"] = {
+        key: value
+        for key, value in sorted(os.environ.items())
+        if key.startswith(("LEGATE_", "LEGION_", "REALM_", "GASNET_"))
+    }
+    return meta
+
+
+def run_command(
+    name: str, command: list[str], results: list, skipped: list
+) -> None:
+    fd, json_path = tempfile.mkstemp(suffix=".json", prefix=f"{name}-")
+    os.close(fd)
+    try:
+        proc = subprocess.run(command + ["--json", json_path])
+        if proc.returncode != 0:
+            skipped.append(
+                {"benchmark": name, "reason": f"exited with {proc.returncode}"}
+            )
+            return
+        with open(json_path) as f:
+            results.extend(json.load(f))
+        print(f"[{name}] done")
+    finally:
+        os.unlink(json_path)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+    )
+    parser.add_argument(
+        "--bin-dir",
+        required=True,
+        help="build directory containing the benchmark executables "
+        "(e.g. <build>/tests/benchmarks)",
+    )
+    parser.add_argument(
+        "--output",
+        default="benchmark_results.json",
+        help="path of the consolidated JSON document",
+    )
+    parser.add_argument(
+        "--skip",
+        nargs="+",
+        default=[],
+        choices=sorted(EXECUTABLES) + ["launch_latency"],
+        help="benchmarks to leave out of this run",
+    )
+    args = parser.parse_args()
+
+    results: list = []
+    skipped: list = []
+
+    for name, spec in EXECUTABLES.items():
+        if name in args.skip:
+            skipped.append({"benchmark": name, "reason": "skipped by request"})
+            continue
+        executable = os.path.join(args.bin_dir, spec["path"])
+        if not os.path.exists(executable):
+            skipped.append(
+                {"benchmark": name, "reason": f"{executable} not found"}
+            )
+            continue
+        run_command(name, [executable] + spec["args"], results, skipped)
+
+    if "launch_latency" in args.skip:
+        skipped.append(
+            {"benchmark": "launch_latency", "reason": "skipped by request"}
+        )
+    else:
+        legate = shutil.which("legate")
+        if legate is None:
+            skipped.append(
+                {
+                    "benchmark": "launch_latency",
+                    "reason": "legate driver not on PATH",
+                }
+            )
+        else:
+            run_command(
+                "launch_latency",
+                [legate, LAUNCH_LATENCY_SCRIPT] + LAUNCH_LATENCY_ARGS,
+                results,
+                skipped,
+            )
+
+    document = {
+        "schema_version": SCHEMA_VERSION,
+        "metadata": environment_metadata(),
+        "results": results,
+        "skipped": skipped,
+    }
+    with open(args.output, "w") as f:
+        json.dump(document, f, indent=2)
+        f.write("\n")
+
+    print(
+        f"wrote {len(results)} records to {args.output}"
+        + (f" ({len(skipped)} benchmarks skipped)" if skipped else "")
+    )
+    # Producing no records at all means the build directory was wrong or
+    # nothing ran; don't let a gate mistake that for a clean pass
+    return 0 if results else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())